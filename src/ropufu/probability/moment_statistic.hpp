@@ -57,6 +57,22 @@ namespace ropufu::aftermath::probability
         /** Indicates if all bins have the same counts. */
         bool is_balanced() const noexcept { return this->m_bin_index == 0; }
 
+        /** @brief Records an observation that has already been converted to \c statistic_type.
+         *  @param x Value to be recorded; it is overwritten in the process.
+         */
+        void observe_statistic(statistic_type& x) noexcept
+        {
+            x -= this->m_shift; // x now holds the offset value.
+
+            this->m_local_shifted_sums[this->m_bin_index] += x;
+
+            x *= x; // x now holds the offset value squared.
+            this->m_local_shifted_squares[this->m_bin_index] += x;
+
+            ++this->m_count;
+            this->m_bin_index = (this->m_bin_index + 1) % (type::breadth);
+        } // observe_statistic(...)
+
     public:
         moment_statistic() noexcept { }
 
@@ -92,15 +108,17 @@ namespace ropufu::aftermath::probability
         void observe(const observation_type& value) noexcept
         {
             statistic_type x = static_cast<statistic_type>(value);
-            x -= this->m_shift; // x now holds the offset value.
-
-            this->m_local_shifted_sums[this->m_bin_index] += x;
-
-            x *= x; // x now holds the offset value squared.
-            this->m_local_shifted_squares[this->m_bin_index] += x;
+            this->observe_statistic(x);
+        } // observe(...)
 
-            ++this->m_count;
-            this->m_bin_index = (this->m_bin_index + 1) % (type::breadth);
+        /** @brief Records the weighted observation (weight * value), e.g., with \p weight being the likelihood ratio
+         *    of an importance-sampled path. The mean of the statistic is then an unbiased estimate of the nominal mean.
+         */
+        void observe(const observation_type& value, const scalar_type& weight) noexcept
+        {
+            statistic_type x = static_cast<statistic_type>(value);
+            x *= weight;
+            this->observe_statistic(x);
         } // observe(...)
             
         type& operator <<(const observation_type& value) noexcept
@@ -4,9 +4,17 @@
 
 #include "random/alias_multisampler.hpp"
 #include "random/alias_sampler.hpp"
+#include "random/antithetic_engine.hpp"
 #include "random/bernoulli_sampler.hpp"
 #include "random/binomial_sampler.hpp"
+#include "random/btpe_binomial_sampler.hpp"
+#include "random/buffered_engine.hpp"
+#include "random/exponential_sampler_512.hpp"
+#include "random/inversion_sampler.hpp"
 #include "random/normal_sampler_512.hpp"
+#include "random/packed_alias_sampler.hpp"
+#include "random/philox_engine.hpp"
+#include "random/standard_exponential_sampler_512.hpp"
 #include "random/standard_normal_sampler_512.hpp"
 #include "random/uniform_int_sampler.hpp"
 #include "random/ziggurat_sampler.hpp"
@@ -4,11 +4,11 @@
 
 #include "../probability/concepts.hpp"
 #include "alias_sampler.hpp"
+#include "packed_alias_sampler.hpp"
 #include "uniform_int_sampler.hpp"
 
-#include <algorithm> // std::copy
+#include <algorithm> // std::copy, std::sort
 #include <cstddef>   // std::size_t
-#include <iterator>  // std::back_inserter
 #include <vector>    // std::vector
 
 namespace ropufu::aftermath::random
@@ -23,6 +23,11 @@ namespace ropufu::aftermath::random
         requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
     struct alias_multisampler;
     
+    /** @brief Collection of alias samplers sharing one packed table.
+     *  @remark Where the engine diameter allows, a single engine output is used per draw.
+     *  @remark Distributions can be replaced or erased one at a time; only the slice of the table that belongs
+     *    to that distribution is rebuilt, and the slots left unused are reclaimed lazily.
+     */
     template <typename t_engine_type, ropufu::distribution t_distribution_type, typename t_index_sampler_type>
         requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
     struct alias_multisampler
@@ -38,60 +43,131 @@ namespace ropufu::aftermath::random
         using probability_type = typename distribution_type::probability_type;
         using expectation_type = typename distribution_type::expectation_type;
         using uniform_type = typename engine_type::result_type;
+        using packing_type = alias_table_packing<engine_type, value_type, probability_type, index_sampler_type>;
+        using slot_type = typename packing_type::slot_type;
 
         using result_type = value_type;
         static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
 
     private:
-        using rationalize_t = rationalize<probability_type, uniform_type, type::engine_diameter>;
-
         // ~~ Condensed alias fields. ~~
-        std::vector<value_type> m_support = {};
-        std::vector<value_type> m_alias = {};
-        std::vector<uniform_type> m_cutoff = {};
-        // ~~ Samplers for each distribution in the collection. ~~
-        std::vector<index_sampler_type> m_index_samplers = {};
+        std::vector<slot_type> m_slots = {};
+        // ~~ Layout of each distribution in the collection. ~~
+        std::vector<packing_type> m_packings = {};
         // ~~ Offset indices for each of the distributions. ~~
         std::vector<std::size_t> m_offset_indices = {};
+        // ~~ Number of slots reserved for each of the distributions. ~~
+        std::vector<std::size_t> m_capacities = {};
+        // ~~ Number of slots in use by the distributions. ~~
+        std::size_t m_count_live_slots = 0;
+
+        /** Removes unused slots once they outnumber the ones in use. */
+        void reclaim()
+        {
+            if (this->m_slots.size() - this->m_count_live_slots > this->m_count_live_slots) this->compact();
+        } // reclaim(...)
 
     public:
         alias_multisampler() noexcept { }
 
         void reserve(std::size_t count_distributions, std::size_t count_total_support_size)
         {
-            this->m_support.reserve(count_total_support_size);
-            this->m_alias.reserve(count_total_support_size);
-            this->m_cutoff.reserve(count_total_support_size);
+            this->m_slots.reserve(count_total_support_size);
 
-            this->m_index_samplers.reserve(count_distributions);
+            this->m_packings.reserve(count_distributions);
             this->m_offset_indices.reserve(count_distributions);
+            this->m_capacities.reserve(count_distributions);
         } // reserve(...)
 
+        /** Number of distributions, including erased ones. */
+        std::size_t size() const noexcept { return this->m_packings.size(); }
+
+        /** Indicates if the distribution with index \p distribution_index has not been erased. */
+        bool contains(std::size_t distribution_index) const noexcept
+        {
+            return distribution_index < this->m_packings.size() && this->m_packings[distribution_index].count_slots() != 0;
+        } // contains(...)
+
         std::size_t push_back(const distribution_type& dist)
         {
             alias_type a { dist };
-            std::size_t offset_index = this->m_support.size();
-
-            std::copy(a.support().begin(), a.support().end(), std::back_inserter(this->m_support));
-            std::copy(a.alias().begin(), a.alias().end(), std::back_inserter(this->m_alias));
-            std::copy(a.cutoff().begin(), a.cutoff().end(), std::back_inserter(this->m_cutoff));
+            std::size_t offset_index = this->m_slots.size();
 
-            this->m_index_samplers.push_back(a.index_sampler());
+            this->m_packings.push_back(packing_type(a, this->m_slots));
             this->m_offset_indices.push_back(offset_index);
+            this->m_capacities.push_back(this->m_slots.size() - offset_index);
+            this->m_count_live_slots += this->m_slots.size() - offset_index;
 
             return this->m_offset_indices.size() - 1;
         } // push_back(...)
 
+        /** @brief Replaces (or restores, if erased) the distribution with index \p distribution_index.
+         *  @remark The new table overwrites the old slice if it fits, and is appended otherwise.
+         *  @remark Indices of other distributions are not affected.
+         */
+        void replace(std::size_t distribution_index, const distribution_type& dist)
+        {
+            alias_type a { dist };
+            std::vector<slot_type> slots {};
+            slots.reserve(a.support().size());
+            packing_type packing { a, slots };
+
+            std::size_t& offset_index = this->m_offset_indices[distribution_index];
+            std::size_t& capacity = this->m_capacities[distribution_index];
+            this->m_count_live_slots -= this->m_packings[distribution_index].count_slots();
+            if (slots.size() <= capacity)
+            {
+                std::copy(slots.begin(), slots.end(), this->m_slots.begin() + offset_index);
+            } // if (...)
+            else
+            {
+                offset_index = this->m_slots.size();
+                capacity = slots.size();
+                this->m_slots.insert(this->m_slots.end(), slots.begin(), slots.end());
+            } // else (...)
+            this->m_count_live_slots += slots.size();
+            this->m_packings[distribution_index] = packing;
+            this->reclaim();
+        } // replace(...)
+
+        /** @brief Erases the distribution with index \p distribution_index, which must not be sampled from afterwards.
+         *  @remark Indices of other distributions are not affected; the index may be reused by \c replace.
+         */
+        void erase(std::size_t distribution_index)
+        {
+            this->m_count_live_slots -= this->m_packings[distribution_index].count_slots();
+            this->m_packings[distribution_index] = packing_type{};
+            this->reclaim();
+        } // erase(...)
+
+        /** Removes unused slots, shifting the slices of the distributions toward the front of the table. */
+        void compact()
+        {
+            // Visit the slices in the order they are stored, so that each one only moves toward the front.
+            std::vector<std::size_t> order(this->m_packings.size());
+            for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+            std::sort(order.begin(), order.end(), [this] (std::size_t i, std::size_t j) {
+                return this->m_offset_indices[i] < this->m_offset_indices[j];
+            });
+
+            std::size_t position = 0;
+            for (std::size_t i : order)
+            {
+                std::size_t count = this->m_packings[i].count_slots();
+                std::size_t offset_index = this->m_offset_indices[i];
+                if (offset_index != position)
+                    std::copy(this->m_slots.begin() + offset_index, this->m_slots.begin() + (offset_index + count), this->m_slots.begin() + position);
+                this->m_offset_indices[i] = position;
+                this->m_capacities[i] = count;
+                position += count;
+            } // for (...)
+            this->m_slots.resize(position);
+        } // compact(...)
+
         value_type sample(std::size_t distribution_index, engine_type& uniform_generator)
         {
-            index_sampler_type& index_sampler = this->m_index_samplers[distribution_index];
-            std::size_t index_offset = this->m_offset_indices[distribution_index];
-            
-            // ~~ Stage 1 (index): generate a discrete uniform over {0, 1, ..., n - 1}. ~~
-            std::size_t index = index_sampler.sample(uniform_generator) + index_offset;
-            // ~~ Stage 2 (cutoff): generate a discrete uniform over {0, 1, ..., engine_diameter}. ~~
-            uniform_type u = uniform_generator();
-            return (u < this->m_cutoff[index]) ? this->m_support[index] : this->m_alias[index];
+            const slot_type* slots = this->m_slots.data() + this->m_offset_indices[distribution_index];
+            return this->m_packings[distribution_index].sample(slots, uniform_generator);
         } // sample(...)
 
         value_type operator ()(std::size_t distribution_index, engine_type& uniform_generator)
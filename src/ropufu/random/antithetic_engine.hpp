@@ -0,0 +1,75 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ANTITHETIC_ENGINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ANTITHETIC_ENGINE_HPP_INCLUDED
+
+#include <random> // std::seed_seq
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Engine adaptor that optionally reflects the outputs of \c t_engine_type, u -> (min + max - u).
+     *  @remark Two copies seeded alike, one of them reflected, produce antithetic streams: samplers that are
+     *    monotone in the engine output (e.g., inversion) yield negatively correlated values, and samplers
+     *    symmetric under the reflection (e.g., uniform on an interval) yield mirrored values.
+     *  @remark Reflection is not affected by re-seeding.
+     */
+    template <typename t_engine_type>
+    struct antithetic_engine
+    {
+        using type = antithetic_engine<t_engine_type>;
+        using engine_type = t_engine_type;
+        using result_type = typename engine_type::result_type;
+
+    private:
+        engine_type m_engine = {};
+        bool m_is_antithetic = false;
+
+    public:
+        antithetic_engine() noexcept { }
+
+        explicit antithetic_engine(const engine_type& engine, bool is_antithetic = false) noexcept
+            : m_engine(engine), m_is_antithetic(is_antithetic)
+        {
+        } // antithetic_engine(...)
+
+        explicit antithetic_engine(result_type value) noexcept
+            : m_engine(value)
+        {
+        } // antithetic_engine(...)
+
+        explicit antithetic_engine(std::seed_seq& sequence) noexcept
+            : m_engine(sequence)
+        {
+        } // antithetic_engine(...)
+
+        static constexpr result_type min() noexcept { return engine_type::min(); }
+        static constexpr result_type max() noexcept { return engine_type::max(); }
+
+        const engine_type& engine() const noexcept { return this->m_engine; }
+
+        /** Indicates if the outputs of the underlying engine are reflected. */
+        bool is_antithetic() const noexcept { return this->m_is_antithetic; }
+
+        void set_antithetic(bool value) noexcept { this->m_is_antithetic = value; }
+
+        void seed() noexcept { this->m_engine.seed(); }
+
+        void seed(result_type value) noexcept { this->m_engine.seed(value); }
+
+        void seed(std::seed_seq& sequence) noexcept { this->m_engine.seed(sequence); }
+
+        void discard(unsigned long long count) noexcept { this->m_engine.discard(count); }
+
+        result_type operator ()() noexcept
+        {
+            result_type u = this->m_engine();
+            return this->m_is_antithetic ? static_cast<result_type>(type::min() + (type::max() - u)) : u;
+        } // operator ()(...)
+
+        friend bool operator ==(const type& left, const type& right) noexcept
+        {
+            return left.m_engine == right.m_engine && left.m_is_antithetic == right.m_is_antithetic;
+        } // operator ==(...)
+    }; // struct antithetic_engine
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ANTITHETIC_ENGINE_HPP_INCLUDED
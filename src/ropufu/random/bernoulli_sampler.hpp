@@ -5,6 +5,10 @@
 #include "../probability/bernoulli_distribution.hpp"
 #include "../rationalize.hpp"
 
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <span>    // std::span
+
 namespace ropufu::aftermath::random
 {
     /** @brief Sampler for Bernoulli distributions. */
@@ -28,6 +32,10 @@ namespace ropufu::aftermath::random
 
         using result_type = value_type;
         static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+        /** Indicates if the engine can fill a buffer with uniforms in a single call. */
+        static constexpr bool has_bulk_engine = requires(engine_type& e, std::span<uniform_type> values) { e.generate(values); };
+        /** Number of engine outputs drawn at a time by the block-fill functions. */
+        static constexpr std::size_t batch_size = 256;
 
     private:
         using rationalize_t = rationalize<probability_type, uniform_type, type::engine_diameter>;
@@ -35,6 +43,12 @@ namespace ropufu::aftermath::random
         uniform_type m_factor = 1;
         uniform_type m_threshold = engine_type::min();
 
+        static void generate(engine_type& uniform_generator, uniform_type* uniforms, std::size_t count) noexcept
+        {
+            if constexpr (type::has_bulk_engine) uniform_generator.generate(std::span<uniform_type>(uniforms, count));
+            else for (std::size_t i = 0; i < count; ++i) uniforms[i] = uniform_generator();
+        } // generate(...)
+
     public:
         bernoulli_sampler() noexcept
             : bernoulli_sampler(distribution_type{})
@@ -65,10 +79,56 @@ namespace ropufu::aftermath::random
             return (this->m_factor * uniform_generator()) < this->m_threshold;
         } // sample(...)
 
+        /** Fills \p values with independent draws.
+         *  @remark Engine outputs are drawn a batch at a time and compared against the threshold in a
+         *    branch-free loop the compiler can vectorize.
+         */
+        void sample(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            uniform_type uniforms[type::batch_size];
+            for (std::size_t offset = 0; offset < values.size(); offset += type::batch_size)
+            {
+                std::size_t count = values.size() - offset;
+                if (count > type::batch_size) count = type::batch_size;
+                type::generate(uniform_generator, uniforms, count);
+
+                value_type* batch = values.data() + offset;
+                for (std::size_t i = 0; i < count; ++i) batch[i] = (this->m_factor * uniforms[i]) < this->m_threshold;
+            } // for (...)
+        } // sample(...)
+
+        /** Fills \p words with independent draws packed 64 to a word: the i-th draw is bit (i % 64) of word (i / 64). */
+        void sample_bits(engine_type& uniform_generator, std::span<std::uint64_t> words) noexcept
+        {
+            constexpr std::size_t word_size = 64;
+            constexpr std::size_t words_per_batch = type::batch_size / word_size;
+            uniform_type uniforms[type::batch_size];
+            for (std::size_t offset = 0; offset < words.size(); offset += words_per_batch)
+            {
+                std::size_t count_words = words.size() - offset;
+                if (count_words > words_per_batch) count_words = words_per_batch;
+                type::generate(uniform_generator, uniforms, count_words * word_size);
+
+                for (std::size_t j = 0; j < count_words; ++j)
+                {
+                    const uniform_type* word_uniforms = uniforms + j * word_size;
+                    std::uint64_t word = 0;
+                    for (std::size_t i = 0; i < word_size; ++i)
+                        word |= static_cast<std::uint64_t>((this->m_factor * word_uniforms[i]) < this->m_threshold) << i;
+                    words[offset + j] = word;
+                } // for (...)
+            } // for (...)
+        } // sample_bits(...)
+
         value_type operator ()(engine_type& uniform_generator) noexcept
         {
             return this->sample(uniform_generator);
         } // operator ()(...)
+
+        void operator ()(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            this->sample(uniform_generator, values);
+        } // operator ()(...)
     }; // struct bernoulli_sampler
 } // namespace ropufu::aftermath::random
 
@@ -0,0 +1,258 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_BTPE_BINOMIAL_SAMPLER_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_BTPE_BINOMIAL_SAMPLER_HPP_INCLUDED
+
+#include "../probability/binomial_distribution.hpp"
+
+#include <cmath> // std::exp, std::floor, std::lgamma, std::log, std::sqrt
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Sampler for binomial distributions in O(1) expected time per draw. */
+    template <typename t_engine_type,
+        typename t_value_type = typename probability::binomial_distribution<>::value_type,
+        typename t_probability_type = typename probability::binomial_distribution<t_value_type>::probability_type,
+        typename t_expectation_type = typename probability::binomial_distribution<t_value_type, t_probability_type>::expectation_type>
+    struct btpe_binomial_sampler;
+
+    /** @brief Sampler for binomial distributions in O(1) expected time per draw.
+     *  @remark Uses inversion by sequential search when the mean is small, and otherwise the BTPE
+     *    (triangle, parallelogram, exponential) rejection algorithm of Kachitvichyanukul and Schmeiser (1988).
+     *  @remark Uniforms are taken with the resolution of the engine; a draw consumes one (inversion) or
+     *    on average about two and a half (BTPE) of them, rather than one per trial.
+     */
+    template <typename t_engine_type, typename t_value_type, typename t_probability_type, typename t_expectation_type>
+    struct btpe_binomial_sampler
+    {
+        using type = btpe_binomial_sampler<t_engine_type, t_value_type, t_probability_type, t_expectation_type>;
+
+        using engine_type = t_engine_type;
+        using value_type = t_value_type;
+        using probability_type = t_probability_type;
+        using expectation_type = t_expectation_type;
+        using distribution_type = probability::binomial_distribution<value_type, probability_type, expectation_type>;
+        using uniform_type = typename engine_type::result_type;
+
+        using result_type = value_type;
+        static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+        /** Smallest mean (of the less likely outcome) for which BTPE is used instead of inversion. */
+        static constexpr double inversion_threshold = 30;
+
+    private:
+        static constexpr double scale = static_cast<double>(type::engine_diameter) + 1;
+
+        value_type m_count = 0;
+        /** Indicates that the sampler counts failures rather than successes. */
+        bool m_is_flipped = false;
+        /** Indicates that the result is always \c m_count (after the flip, if any), or always zero. */
+        bool m_is_degenerate = false;
+        bool m_is_inversion = true;
+        double m_r = 0; // Probability of the less likely outcome.
+        double m_q = 1; // Probability of the more likely outcome.
+        // ~~ Inversion ~~
+        double m_q_to_n = 1; // Probability of zero.
+        double m_search_bound = 0;
+        // ~~ BTPE ~~
+        double m_nrq = 0;
+        double m_mode = 0;
+        double m_xm = 0;
+        double m_xl = 0;
+        double m_xr = 0;
+        double m_c = 0;
+        double m_lambda_left = 0;
+        double m_lambda_right = 0;
+        double m_p1 = 0;
+        double m_p2 = 0;
+        double m_p3 = 0;
+        double m_p4 = 0;
+        double m_rejection_probability = 0;
+
+        /** Uniform on (0, 1] with the resolution of the engine. */
+        static double uniform(engine_type& uniform_generator) noexcept
+        {
+            return (static_cast<double>(uniform_generator() - engine_type::min()) + 1) / type::scale;
+        } // uniform(...)
+
+        /** Correction term of the Stirling approximation to log(x!). */
+        static double stirling(double x) noexcept
+        {
+            double x_squared = x * x;
+            return (13860 - (462 - (132 - (99 - 140 / x_squared) / x_squared) / x_squared) / x_squared) / x / 166320;
+        } // stirling(...)
+
+        double sample_inversion(engine_type& uniform_generator) const noexcept
+        {
+            double n = static_cast<double>(this->m_count);
+            double ratio = this->m_r / this->m_q;
+            while (true)
+            {
+                double u = type::uniform(uniform_generator);
+                double mass = this->m_q_to_n;
+                double x = 0;
+                while (u > mass)
+                {
+                    u -= mass;
+                    ++x;
+                    if (x > this->m_search_bound) break;
+                    mass *= ratio * (n - x + 1) / x;
+                } // while (...)
+                if (x <= this->m_search_bound) return x;
+            } // while (...)
+        } // sample_inversion(...)
+
+        double sample_btpe(engine_type& uniform_generator) const noexcept
+        {
+            double n = static_cast<double>(this->m_count);
+            double r = this->m_r;
+            double q = this->m_q;
+            double m = this->m_mode;
+            while (true)
+            {
+                double u = this->m_p4 * type::uniform(uniform_generator);
+                double v = type::uniform(uniform_generator);
+                double y = 0;
+
+                // Triangular region: immediate acceptance.
+                if (u <= this->m_p1) return std::floor(this->m_xm - this->m_p1 * v + u);
+
+                if (u <= this->m_p2) // Parallelograms.
+                {
+                    double x = this->m_xl + (u - this->m_p1) / this->m_c;
+                    v = v * this->m_c + 1 - std::abs(m - x + 0.5) / this->m_p1;
+                    if (v > 1) continue;
+                    y = std::floor(x);
+                } // if (...)
+                else if (u <= this->m_p3) // Left exponential tail.
+                {
+                    y = std::floor(this->m_xl + std::log(v) / this->m_lambda_left);
+                    if (y < 0) continue;
+                    v = v * (u - this->m_p2) * this->m_lambda_left;
+                } // else if (...)
+                else // Right exponential tail.
+                {
+                    y = std::floor(this->m_xr - std::log(v) / this->m_lambda_right);
+                    if (y > n) continue;
+                    v = v * (u - this->m_p3) * this->m_lambda_right;
+                } // else (...)
+
+                double k = std::abs(y - m);
+                if (k <= 20 || k >= this->m_nrq / 2 - 1)
+                {
+                    // Explicit evaluation of f(y) / f(m) by recursion.
+                    double s = r / q;
+                    double a = s * (n + 1);
+                    double f = 1;
+                    if (m < y) for (double i = m + 1; i <= y; ++i) f *= (a / i - s);
+                    else if (m > y) for (double i = y + 1; i <= m; ++i) f /= (a / i - s);
+                    if (v <= f) return y;
+                    continue;
+                } // if (...)
+
+                // Squeeze using the upper and lower bounds on log(f(y) / f(m)).
+                double rho = (k / this->m_nrq) * ((k * (k / 3 + 0.625) + 0.1666666666666666667) / this->m_nrq + 0.5);
+                double t = -k * k / (2 * this->m_nrq);
+                double log_v = std::log(v);
+                if (log_v < t - rho) return y;
+                if (log_v > t + rho) continue;
+
+                // Final acceptance / rejection test with Stirling's formula.
+                double x1 = y + 1;
+                double f1 = m + 1;
+                double z = n + 1 - m;
+                double w = n - y + 1;
+                double bound = this->m_xm * std::log(f1 / x1) + (n - m + 0.5) * std::log(z / w) + (y - m) * std::log(w * r / (x1 * q)) +
+                    type::stirling(f1) + type::stirling(z) + type::stirling(x1) + type::stirling(w);
+                if (log_v <= bound) return y;
+            } // while (...)
+        } // sample_btpe(...)
+
+    public:
+        btpe_binomial_sampler() noexcept
+            : btpe_binomial_sampler(distribution_type{})
+        {
+        } // btpe_binomial_sampler(...)
+
+        explicit btpe_binomial_sampler(const distribution_type& dist) noexcept
+            : m_count(dist.number_of_trials())
+        {
+            double p = static_cast<double>(dist.probability_of_success());
+            double n = static_cast<double>(this->m_count);
+
+            this->m_is_flipped = (p > 0.5);
+            this->m_r = this->m_is_flipped ? (1 - p) : p;
+            this->m_q = 1 - this->m_r;
+            double r = this->m_r;
+            double q = this->m_q;
+
+            // ~~ Special cases p = 0 and p = 1. ~~
+            if (r == 0)
+            {
+                this->m_is_degenerate = true;
+                return;
+            } // if (...)
+
+            double nr = n * r;
+            this->m_is_inversion = (nr < type::inversion_threshold);
+            if (this->m_is_inversion)
+            {
+                this->m_q_to_n = std::exp(n * std::log(q));
+                this->m_search_bound = nr + 10 * std::sqrt(nr * q + 1);
+                if (this->m_search_bound > n) this->m_search_bound = n;
+                return;
+            } // if (...)
+
+            this->m_nrq = nr * q;
+            double fm = nr + r;
+            this->m_mode = std::floor(fm);
+            this->m_p1 = std::floor(2.195 * std::sqrt(this->m_nrq) - 4.6 * q) + 0.5;
+            this->m_xm = this->m_mode + 0.5;
+            this->m_xl = this->m_xm - this->m_p1;
+            this->m_xr = this->m_xm + this->m_p1;
+            this->m_c = 0.134 + 20.5 / (15.3 + this->m_mode);
+            double a = (fm - this->m_xl) / (fm - this->m_xl * r);
+            this->m_lambda_left = a * (1 + a / 2);
+            a = (this->m_xr - fm) / (this->m_xr * q);
+            this->m_lambda_right = a * (1 + a / 2);
+            this->m_p2 = this->m_p1 * (1 + 2 * this->m_c);
+            this->m_p3 = this->m_p2 + this->m_c / this->m_lambda_left;
+            this->m_p4 = this->m_p3 + this->m_c / this->m_lambda_right;
+
+            // The hat has area p4 when scaled so that its height at the mode is one.
+            double m = this->m_mode;
+            double log_mode_mass = std::lgamma(n + 1) - std::lgamma(m + 1) - std::lgamma(n - m + 1) + m * std::log(r) + (n - m) * std::log(q);
+            this->m_rejection_probability = 1 - 1 / (std::exp(log_mode_mass) * this->m_p4);
+        } // btpe_binomial_sampler(...)
+
+        /** Upper bound on the probability of error due to the finite resolution of the engine. */
+        constexpr probability_type error_probability() const noexcept
+        {
+            if (this->m_is_degenerate) return 0;
+            double uniforms_per_draw = this->m_is_inversion ? 1 : (2 / (1 - this->m_rejection_probability));
+            return static_cast<probability_type>(uniforms_per_draw / static_cast<double>(type::engine_diameter));
+        } // error_probability(...)
+
+        /** Upper bound on the rejection probability. */
+        constexpr probability_type rejection_probability() const noexcept
+        {
+            return static_cast<probability_type>(this->m_rejection_probability);
+        } // rejection_probability(...)
+
+        value_type sample(engine_type& uniform_generator) noexcept
+        {
+            value_type result = 0;
+            if (!this->m_is_degenerate)
+            {
+                double x = this->m_is_inversion ? this->sample_inversion(uniform_generator) : this->sample_btpe(uniform_generator);
+                result = static_cast<value_type>(x);
+            } // if (...)
+            return this->m_is_flipped ? (this->m_count - result) : result;
+        } // sample(...)
+
+        value_type operator ()(engine_type& uniform_generator) noexcept
+        {
+            return this->sample(uniform_generator);
+        } // operator ()(...)
+    }; // struct btpe_binomial_sampler
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_BTPE_BINOMIAL_SAMPLER_HPP_INCLUDED
@@ -0,0 +1,137 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
+
+#include <algorithm> // std::copy, std::equal, std::min
+#include <array>     // std::array
+#include <cstddef>   // std::size_t
+#include <random>    // std::seed_seq
+#include <span>      // std::span
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Engine adaptor that draws raw outputs of \c t_engine_type in blocks of \c t_buffer_size.
+     *  @remark The sequence of outputs is the same as that of the underlying engine; only the calls to
+     *    the latter are grouped, so that samplers drawing one number at a time mostly read from a
+     *    cache-line-aligned array rather than step through the engine state.
+     *  @remark If the underlying engine has a bulk \c generate member, it is used to refill the buffer.
+     */
+    template <typename t_engine_type, std::size_t t_buffer_size = 256>
+    struct buffered_engine
+    {
+        using type = buffered_engine<t_engine_type, t_buffer_size>;
+        using engine_type = t_engine_type;
+        using result_type = typename engine_type::result_type;
+
+        static constexpr std::size_t buffer_size = t_buffer_size;
+        static constexpr std::size_t cache_line_size = 64;
+
+        static_assert(t_buffer_size != 0, "Buffer cannot be empty.");
+
+    private:
+        static constexpr bool has_bulk_engine = requires(engine_type& e, std::span<result_type> values) { e.generate(values); };
+
+        alignas(type::cache_line_size) std::array<result_type, t_buffer_size> m_buffer = {};
+        /** Position of the next output in \c m_buffer; \c buffer_size if the buffer is exhausted. */
+        std::size_t m_buffer_index = t_buffer_size;
+        engine_type m_engine = {};
+
+        /** Writes the next \p values.size() outputs of the underlying engine into \p values. */
+        void generate_raw(std::span<result_type> values) noexcept
+        {
+            if constexpr (type::has_bulk_engine) this->m_engine.generate(values);
+            else for (result_type& x : values) x = this->m_engine();
+        } // generate_raw(...)
+
+        void fill_buffer() noexcept
+        {
+            this->generate_raw(this->m_buffer);
+            this->m_buffer_index = 0;
+        } // fill_buffer(...)
+
+    public:
+        buffered_engine() noexcept { }
+
+        explicit buffered_engine(const engine_type& engine) noexcept
+            : m_engine(engine)
+        {
+        } // buffered_engine(...)
+
+        explicit buffered_engine(result_type value) noexcept
+            : m_engine(value)
+        {
+        } // buffered_engine(...)
+
+        explicit buffered_engine(std::seed_seq& sequence) noexcept
+            : m_engine(sequence)
+        {
+        } // buffered_engine(...)
+
+        static constexpr result_type min() noexcept { return engine_type::min(); }
+        static constexpr result_type max() noexcept { return engine_type::max(); }
+
+        /** The underlying engine; it is ahead of this adaptor by the number of buffered outputs. */
+        const engine_type& engine() const noexcept { return this->m_engine; }
+
+        /** Number of outputs that have been generated but not yet consumed. */
+        std::size_t count_buffered() const noexcept { return t_buffer_size - this->m_buffer_index; }
+
+        void seed() noexcept
+        {
+            this->m_engine.seed();
+            this->m_buffer_index = t_buffer_size;
+        } // seed(...)
+
+        void seed(result_type value) noexcept
+        {
+            this->m_engine.seed(value);
+            this->m_buffer_index = t_buffer_size;
+        } // seed(...)
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->m_engine.seed(sequence);
+            this->m_buffer_index = t_buffer_size;
+        } // seed(...)
+
+        void discard(unsigned long long count) noexcept
+        {
+            std::size_t buffered = this->count_buffered();
+            if (count <= buffered)
+            {
+                this->m_buffer_index += static_cast<std::size_t>(count);
+                return;
+            } // if (...)
+            this->m_engine.discard(count - buffered);
+            this->m_buffer_index = t_buffer_size;
+        } // discard(...)
+
+        result_type operator ()() noexcept
+        {
+            if (this->m_buffer_index == t_buffer_size) [[unlikely]] this->fill_buffer();
+            return this->m_buffer[this->m_buffer_index++];
+        } // operator ()(...)
+
+        /** Fills \p values with the next outputs; same as calling the engine for every element. */
+        void generate(std::span<result_type> values) noexcept
+        {
+            std::size_t i = std::min(values.size(), this->count_buffered());
+            std::copy(this->m_buffer.data() + this->m_buffer_index, this->m_buffer.data() + this->m_buffer_index + i, values.data());
+            this->m_buffer_index += i;
+            // Large requests go directly to the underlying engine.
+            std::size_t count_direct = ((values.size() - i) / t_buffer_size) * t_buffer_size;
+            this->generate_raw(values.subspan(i, count_direct));
+            i += count_direct;
+            while (i < values.size()) values[i++] = this->operator ()();
+        } // generate(...)
+
+        friend bool operator ==(const type& left, const type& right) noexcept
+        {
+            return left.m_engine == right.m_engine &&
+                left.m_buffer_index == right.m_buffer_index &&
+                std::equal(left.m_buffer.begin() + left.m_buffer_index, left.m_buffer.end(), right.m_buffer.begin() + right.m_buffer_index);
+        } // operator ==(...)
+    }; // struct buffered_engine
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
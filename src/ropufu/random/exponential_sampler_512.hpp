@@ -0,0 +1,77 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
+
+#include "../probability/exponential_distribution.hpp"
+#include "standard_exponential_sampler_512.hpp"
+
+#include <span> // std::span
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Sampler for exponential distributions. */
+    template <typename t_engine_type,
+        typename t_value_type = typename probability::exponential_distribution<>::value_type,
+        typename t_probability_type = typename probability::exponential_distribution<t_value_type>::probability_type,
+        typename t_expectation_type = typename probability::exponential_distribution<t_value_type, t_probability_type>::expectation_type>
+    struct exponential_sampler_512;
+
+    /** @brief Sampler for exponential distributions. */
+    template <typename t_engine_type, typename t_value_type, typename t_probability_type, typename t_expectation_type>
+    struct exponential_sampler_512
+    {
+        using type = exponential_sampler_512<t_engine_type, t_value_type, t_probability_type, t_expectation_type>;
+
+        using engine_type = t_engine_type;
+        using value_type = t_value_type;
+        using probability_type = t_probability_type;
+        using expectation_type = t_expectation_type;
+        using distribution_type = probability::exponential_distribution<value_type, probability_type, expectation_type>;
+        using uniform_type = typename engine_type::result_type;
+
+        using result_type = value_type;
+        using standard_sampler_type = random::standard_exponential_sampler_512<engine_type, value_type, probability_type, expectation_type>;
+
+    private:
+        standard_sampler_type m_standard_sampler = {};
+        value_type m_scale = 1;
+
+    public:
+        exponential_sampler_512() noexcept
+            : exponential_sampler_512(distribution_type{})
+        {
+        } // exponential_sampler_512(...)
+
+        explicit exponential_sampler_512(const distribution_type& dist) noexcept
+            : m_scale(static_cast<value_type>(dist.mu()))
+        {
+        } // exponential_sampler_512(...)
+
+        /** Mean of the sampled distribution. */
+        value_type scale() const noexcept { return this->m_scale; }
+
+        value_type sample(engine_type& uniform_generator) noexcept
+        {
+            return this->m_scale * this->m_standard_sampler(uniform_generator);
+        } // sample(...)
+
+        /** Fills \p values with independent draws. */
+        void sample(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            this->m_standard_sampler.sample(uniform_generator, values);
+            for (value_type& x : values) x = this->m_scale * x;
+        } // sample(...)
+
+        value_type operator ()(engine_type& uniform_generator) noexcept
+        {
+            return this->sample(uniform_generator);
+        } // operator ()(...)
+
+        void operator ()(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            this->sample(uniform_generator, values);
+        } // operator ()(...)
+    }; // struct exponential_sampler_512
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
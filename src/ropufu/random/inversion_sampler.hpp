@@ -0,0 +1,126 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_INVERSION_SAMPLER_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_INVERSION_SAMPLER_HPP_INCLUDED
+
+#include "../probability/concepts.hpp"
+#include "../rationalize.hpp"
+
+#include <cstddef>   // std::size_t
+#include <stdexcept> // std::logic_error
+#include <vector>    // std::vector
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_engine_type, ropufu::distribution t_distribution_type>
+        requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
+    struct inversion_sampler;
+
+    /** @brief Sampler for discrete distributions with bounded support by inversion of the c.d.f.
+     *  @remark Uses a guide table (Chen and Asau, 1974) to start the sequential search close to the
+     *    answer, which takes O(1) expected time with a table no longer than twice the support.
+     *  @remark Every draw uses exactly one engine output, and the result is a non-decreasing function
+     *    of that output, so samplers for different distributions driven by the same engine sequence
+     *    produce positively correlated (common random numbers) results.
+     */
+    template <typename t_engine_type, ropufu::distribution t_distribution_type>
+        requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
+    struct inversion_sampler
+    {
+        using type = inversion_sampler<t_engine_type, t_distribution_type>;
+
+        using engine_type = t_engine_type;
+        using distribution_type = t_distribution_type;
+
+        using value_type = typename distribution_type::value_type;
+        using probability_type = typename distribution_type::probability_type;
+        using expectation_type = typename distribution_type::expectation_type;
+        using uniform_type = typename engine_type::result_type;
+
+        using result_type = value_type;
+        static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+
+    private:
+        using rationalize_t = rationalize<probability_type, uniform_type, type::engine_diameter>;
+
+        std::vector<value_type> m_support = {};
+        /** An engine output u is mapped to the first support element with (u - min) < cutoff. */
+        std::vector<uniform_type> m_cutoff = {};
+        /** For each block of engine outputs, index of the support element of its smallest output. */
+        std::vector<std::size_t> m_guide = {};
+        /** Number of engine outputs per guide table entry. */
+        uniform_type m_block_size = 1;
+        /** Index of the first support element whose c.d.f. is indistinguishable from one. */
+        std::size_t m_last_index = 0;
+
+    public:
+        inversion_sampler()
+            : inversion_sampler(distribution_type{})
+        {
+        } // inversion_sampler(...)
+
+        /** @brief Constructs an inversion sampler for \p distribution.
+         *  @exception std::logic_error Trivial distributions not supported.
+         *  @exception std::logic_error \c t_engine_type cannot accomodate such a wide distribution.
+         */
+        explicit inversion_sampler(const distribution_type& dist)
+            : m_support(dist.support())
+        {
+            std::size_t n = this->m_support.size();
+            if (n == 0) throw std::logic_error("Trivial distributions not supported.");
+            if (n - 1 > type::engine_diameter) throw std::logic_error("Engine cannot accomodate such a wide distribution.");
+
+            // Cache the c.d.f.
+            this->m_cutoff.reserve(n);
+            this->m_last_index = n - 1;
+            uniform_type previous = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                probability_type p = dist.cdf(this->m_support[i]);
+                if (p > 1) p = 1; // Take care of rounding errors.
+                uniform_type cutoff = rationalize_t::probability(p);
+                if (cutoff < previous) cutoff = previous;
+                this->m_cutoff.push_back(cutoff);
+                previous = cutoff;
+                if (cutoff == type::engine_diameter && i < this->m_last_index) this->m_last_index = i; // Treat almost sure events as certain.
+            } // for (...)
+
+            // Build the guide table: only blocks containing some output in {0, 1, ..., engine_diameter} are stored.
+            this->m_block_size = type::engine_diameter / static_cast<uniform_type>(n); // Leaves at most 2n + 1 blocks.
+            if (this->m_block_size == 0) this->m_block_size = 1;
+            std::size_t count_blocks = 1 + static_cast<std::size_t>(type::engine_diameter / this->m_block_size);
+            this->m_guide.reserve(count_blocks);
+            std::size_t index = 0;
+            for (std::size_t k = 0; k < count_blocks; ++k)
+            {
+                uniform_type block_start = static_cast<uniform_type>(k) * this->m_block_size;
+                while (index < this->m_last_index && block_start >= this->m_cutoff[index]) ++index;
+                this->m_guide.push_back(index);
+            } // for (...)
+        } // inversion_sampler(...)
+
+        const std::vector<value_type>& support() const noexcept { return this->m_support; }
+        const std::vector<uniform_type>& cutoff() const noexcept { return this->m_cutoff; }
+        const std::vector<std::size_t>& guide() const noexcept { return this->m_guide; }
+
+        /** Maps an engine output \p u to the distribution; the result is non-decreasing in \p u. */
+        value_type quantile(uniform_type u) const noexcept
+        {
+            u -= engine_type::min(); // Uniform over {0, ..., engine_diameter}.
+            std::size_t index = this->m_guide[static_cast<std::size_t>(u / this->m_block_size)];
+            while (index < this->m_last_index && u >= this->m_cutoff[index]) ++index;
+            return this->m_support[index];
+        } // quantile(...)
+
+        value_type sample(engine_type& uniform_generator) noexcept
+        {
+            return this->quantile(uniform_generator());
+        } // sample(...)
+
+        value_type operator ()(engine_type& uniform_generator) noexcept
+        {
+            return this->sample(uniform_generator);
+        } // operator ()(...)
+    }; // struct inversion_sampler
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_INVERSION_SAMPLER_HPP_INCLUDED
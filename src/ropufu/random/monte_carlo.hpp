@@ -3,13 +3,21 @@
 #define ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_HPP_INCLUDED
 
 #include <array>       // std::array
+#include <atomic>      // std::atomic, std::memory_order_relaxed
 #include <concepts>    // std::default_initializable
 #include <cstddef>     // std::size_t, std::nullptr_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <functional>  // std::function
 #include <future>      // std::promise, std::future
+#include <memory>      // std::unique_ptr, std::make_unique
+#include <mutex>       // std::mutex, std::lock_guard
+#include <optional>    // std::optional, std::nullopt
+#include <random>      // std::seed_seq
 #include <stdexcept>   // std::logic_error
 #include <stop_token>  // std::stop_source, std::stop_token
 #include <thread>      // std::jthread
 #include <utility>     // std::move
+#include <vector>      // std::vector
 
 namespace ropufu::aftermath::random
 {
@@ -30,46 +38,385 @@ namespace ropufu::aftermath::random
             {g(h)};
         }; // concept monte_carlo_aggregator
 
+    /** Simulator whose random state is reset from a seed sequence. */
+    template <typename t_simulator_type>
+    concept seedable_monte_carlo_simulator = monte_carlo_simulator<t_simulator_type> &&
+        requires(t_simulator_type& f, std::seed_seq& sequence)
+        {
+            {f.seed(sequence)};
+        }; // concept seedable_monte_carlo_simulator
+
+    /** Derives independent, reproducible random streams from a single master seed.
+     *  @remark Simulations are grouped in blocks of \c block_size consecutive simulations. Each block
+     *    is run on a simulator re-seeded from (\c master_seed, block index), and blocks are aggregated
+     *    in order. Results do not depend on the number of threads or the schedule.
+     *  @remark Unless the block size is set explicitly, it is chosen for every run so that the run
+     *    is split into at most \c max_count_blocks blocks.
+     */
+    struct monte_carlo_seed
+    {
+        using type = monte_carlo_seed;
+
+        /** Largest number of blocks in a run when the block size is chosen automatically. */
+        static constexpr std::size_t max_count_blocks = 4096;
+
+        std::uint64_t master_seed = 0;
+        /** Number of consecutive simulations sharing one random stream; zero if chosen automatically for every run. */
+        std::size_t block_size = 0;
+        /** Index of the stream used by the first block of the next run; advanced after every run. */
+        std::size_t first_block = 0;
+
+        monte_carlo_seed() noexcept = default;
+
+        /** Seed with the block size chosen automatically for every run. */
+        explicit monte_carlo_seed(std::uint64_t master_seed) noexcept
+            : master_seed(master_seed)
+        {
+        } // monte_carlo_seed(...)
+
+        /** @exception std::logic_error \p block_size is zero. */
+        explicit monte_carlo_seed(std::uint64_t master_seed, std::size_t block_size)
+            : master_seed(master_seed), block_size(block_size)
+        {
+            if (block_size == 0) throw std::logic_error("Block size must be positive.");
+        } // monte_carlo_seed(...)
+
+        /** Number of consecutive simulations sharing one random stream in a run of \p count_simulations simulations. */
+        std::size_t block_size_for(std::size_t count_simulations) const noexcept
+        {
+            if (this->block_size != 0) return this->block_size;
+            std::size_t result = (count_simulations + type::max_count_blocks - 1) / type::max_count_blocks;
+            return (result == 0) ? 1 : result;
+        } // block_size_for(...)
+
+        std::size_t count_blocks(std::size_t count_simulations) const noexcept
+        {
+            std::size_t size = this->block_size_for(count_simulations);
+            return (count_simulations + size - 1) / size;
+        } // count_blocks(...)
+
+        /** Re-seeds \p simulator with the stream of the \p block_index-th block of the current run. */
+        template <seedable_monte_carlo_simulator t_simulator_type>
+        void seed_block(t_simulator_type& simulator, std::size_t block_index) const
+        {
+            std::uint64_t stream = static_cast<std::uint64_t>(this->first_block + block_index);
+            std::seed_seq sequence{
+                static_cast<std::uint32_t>(this->master_seed), static_cast<std::uint32_t>(this->master_seed >> 32),
+                static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+            simulator.seed(sequence);
+        } // seed_block(...)
+    }; // struct monte_carlo_seed
+
+    /** Determines how simulations are distributed among threads. */
+    enum struct monte_carlo_schedule : char
+    {
+        /** Each thread runs an equal share of simulations, fixed in advance. */
+        static_split = 0,
+        /** Threads claim simulations in chunks from a shared counter, with chunk size
+         *  proportional to the number of simulations still unclaimed. */
+        guided = 1
+    }; // enum struct monte_carlo_schedule
+
+    /** Condition on the partial aggregate, checked between chunks, to end simulations early. */
+    template <typename t_aggregator_type>
+    using monte_carlo_stop_condition = std::function<bool (const t_aggregator_type&)>;
+
+    namespace detail
+    {
+        /** Claims the next chunk of at most \p max_chunk_size simulations from the shared counter \p next_index.
+         *  @param first_index Set to the index of the first simulation claimed.
+         *  @return Number of simulations claimed; zero if none are left.
+         */
+        inline std::size_t claim_monte_carlo_chunk(std::atomic<std::size_t>& next_index,
+            std::size_t count_simulations, std::size_t count_threads, std::size_t max_chunk_size, std::size_t& first_index) noexcept
+        {
+            std::size_t from = next_index.load(std::memory_order_relaxed);
+            while (from < count_simulations)
+            {
+                std::size_t chunk_size = (count_simulations - from) / (2 * count_threads);
+                if (chunk_size > max_chunk_size) chunk_size = max_chunk_size;
+                if (chunk_size == 0) chunk_size = 1;
+                if (next_index.compare_exchange_weak(from, from + chunk_size, std::memory_order_relaxed))
+                {
+                    first_index = from;
+                    return chunk_size;
+                } // if (...)
+            } // while (...)
+            return 0;
+        } // claim_monte_carlo_chunk(...)
+
+        /** Range of simulations, [first_index, first_index + count), assigned to the \p k-th of \p count_threads threads
+         *  when \p count_simulations simulations are split evenly among them.
+         *  @return Number of simulations assigned.
+         */
+        inline std::size_t static_monte_carlo_share(std::size_t count_simulations, std::size_t count_threads, std::size_t k,
+            std::size_t& first_index) noexcept
+        {
+            // count_simulations = n * count_threads + r.
+            std::size_t n = count_simulations / count_threads;
+            std::size_t r = count_simulations % count_threads;
+            first_index = k * n + ((k < r) ? k : r);
+            return (k < r) ? (n + 1) : n;
+        } // static_monte_carlo_share(...)
+
+        /** Partial results of running simulations, shared between the workers and the task. */
+        template <typename t_aggregator_type>
+        struct monte_carlo_progress
+        {
+            using aggregator_type = t_aggregator_type;
+            using stop_condition_type = monte_carlo_stop_condition<aggregator_type>;
+
+            std::size_t count_simulations = 0;
+            std::atomic<std::size_t> count_completed = 0;
+            stop_condition_type stop_condition = nullptr;
+            std::stop_source cancellation_source;
+
+            /** Guards \c aggregate. */
+            mutable std::mutex mutex = {};
+            aggregator_type aggregate = {};
+
+            monte_carlo_progress(std::size_t count_simulations, stop_condition_type&& stop_condition, const std::stop_source& cancellation_source) noexcept
+                : count_simulations(count_simulations), stop_condition(std::move(stop_condition)), cancellation_source(cancellation_source)
+            {
+            } // monte_carlo_progress(...)
+
+            /** Adds the results of \p count simulations, aggregated in \p chunk, and checks the stop condition. */
+            void report(const aggregator_type& chunk, std::size_t count)
+            {
+                std::lock_guard lock(this->mutex);
+                this->aggregate(chunk);
+                this->count_completed.fetch_add(count, std::memory_order_relaxed);
+                if (this->stop_condition && this->stop_condition(this->aggregate)) this->cancellation_source.request_stop();
+            } // report(...)
+
+            aggregator_type snapshot() const
+            {
+                std::lock_guard lock(this->mutex);
+                return this->aggregate;
+            } // snapshot(...)
+        }; // struct monte_carlo_progress
+
+        /** State of a single run of simulations, shared among the threads executing it. */
+        template <typename t_simulator_type, typename t_aggregator_type, monte_carlo_schedule t_schedule>
+        struct monte_carlo_run
+        {
+            using type = monte_carlo_run<t_simulator_type, t_aggregator_type, t_schedule>;
+            using simulator_type = t_simulator_type;
+            using aggregator_type = t_aggregator_type;
+            using progress_type = monte_carlo_progress<aggregator_type>;
+
+            static constexpr monte_carlo_schedule schedule = t_schedule;
+
+            /** Largest number of chunks of consecutive blocks in a seeded run; each chunk keeps a single aggregator. */
+            static constexpr std::size_t max_count_chunks = 4096;
+
+        private:
+            std::size_t m_count_simulations;
+            std::size_t m_count_threads;
+            std::size_t m_report_interval;
+            std::optional<monte_carlo_seed> m_seed;
+            progress_type* m_progress;
+            /** Number of simulations in each block, if seeded. */
+            std::size_t m_block_size = 0;
+            /** Number of blocks in the run, if seeded. */
+            std::size_t m_count_blocks = 0;
+            /** Number of consecutive blocks in each chunk, if seeded. */
+            std::size_t m_chunk_size = 0;
+            /** Index of the next unclaimed simulation, or chunk if seeded. */
+            std::atomic<std::size_t> m_next_index = 0;
+            /** Aggregators for individual chunks, if seeded. */
+            std::vector<aggregator_type> m_chunk_aggregators = {};
+
+            /** Runs \p count simulations into a single aggregator.
+             *  @return False if the run has been interrupted.
+             */
+            bool run_simulations(simulator_type& simulator, std::size_t count, const std::stop_token& token)
+            {
+                aggregator_type aggregator {};
+                std::size_t i = 0;
+                bool is_stopped = false;
+                while (i < count)
+                {
+                    aggregator(simulator());
+                    ++i;
+                    if (token.stop_requested())
+                    {
+                        is_stopped = true;
+                        break;
+                    } // if (...)
+                } // while (...)
+                this->m_progress->report(aggregator, i);
+                return !is_stopped;
+            } // run_simulations(...)
+
+            /** Runs the blocks of the \p chunk_index-th chunk, in order, into the aggregator of that chunk.
+             *  @return False if the run has been interrupted.
+             */
+            bool run_chunk(simulator_type& simulator, std::size_t chunk_index, const std::stop_token& token)
+            {
+                if constexpr (seedable_monte_carlo_simulator<simulator_type>)
+                {
+                    const monte_carlo_seed& seed = *(this->m_seed);
+                    aggregator_type& aggregator = this->m_chunk_aggregators[chunk_index];
+                    std::size_t first = chunk_index * this->m_chunk_size;
+                    std::size_t to = (this->m_count_blocks - first < this->m_chunk_size) ? this->m_count_blocks : (first + this->m_chunk_size);
+                    std::size_t count = 0;
+                    bool is_stopped = false;
+                    for (std::size_t b = first; b < to && !is_stopped; ++b)
+                    {
+                        seed.seed_block(simulator, b);
+                        std::size_t from = b * this->m_block_size;
+                        std::size_t size = (this->m_count_simulations - from < this->m_block_size) ? (this->m_count_simulations - from) : this->m_block_size;
+                        for (std::size_t i = 0; i < size; ++i)
+                        {
+                            aggregator(simulator());
+                            ++count;
+                            if (token.stop_requested())
+                            {
+                                is_stopped = true;
+                                break;
+                            } // if (...)
+                        } // for (...)
+                    } // for (...)
+                    this->m_progress->report(aggregator, count);
+                    return !is_stopped;
+                } // if constexpr (...)
+                else return true;
+            } // run_chunk(...)
+
+        public:
+            /** @param report_interval Largest number of simulations run between progress reports if not seeded;
+             *    seeded runs report once per chunk.
+             */
+            monte_carlo_run(std::size_t count_simulations, std::size_t count_threads, std::size_t report_interval,
+                const std::optional<monte_carlo_seed>& seed, progress_type* progress)
+                : m_count_simulations(count_simulations), m_count_threads(count_threads), m_report_interval(report_interval),
+                m_seed(seed), m_progress(progress)
+            {
+                if (!seed.has_value()) return;
+
+                // Chunk boundaries depend on the number of simulations alone, so the order of aggregation is fixed.
+                this->m_block_size = seed->block_size_for(count_simulations);
+                this->m_count_blocks = seed->count_blocks(count_simulations);
+                this->m_chunk_size = (this->m_count_blocks + type::max_count_chunks - 1) / type::max_count_chunks;
+                if (this->m_chunk_size == 0) this->m_chunk_size = 1;
+                this->m_chunk_aggregators.resize((this->m_count_blocks + this->m_chunk_size - 1) / this->m_chunk_size);
+            } // monte_carlo_run(...)
+
+            /** Runs the share of the \p k-th thread. */
+            void work(simulator_type& simulator, std::size_t k, const std::stop_token& token)
+            {
+                std::size_t first = 0;
+                if (this->m_seed.has_value())
+                {
+                    std::size_t count_chunks = this->m_chunk_aggregators.size();
+                    if constexpr (type::schedule == monte_carlo_schedule::static_split)
+                    {
+                        std::size_t m = detail::static_monte_carlo_share(count_chunks, this->m_count_threads, k, first);
+                        for (std::size_t to = first + m; first < to; ++first)
+                            if (!this->run_chunk(simulator, first, token)) return;
+                    } // if constexpr (...)
+                    else
+                    {
+                        while (detail::claim_monte_carlo_chunk(this->m_next_index, count_chunks, this->m_count_threads, 1, first) != 0)
+                            if (!this->run_chunk(simulator, first, token)) return;
+                    } // else (...)
+                    return;
+                } // if (...)
+
+                if constexpr (type::schedule == monte_carlo_schedule::static_split)
+                {
+                    std::size_t m = detail::static_monte_carlo_share(this->m_count_simulations, this->m_count_threads, k, first);
+                    for (std::size_t to = first + m; first < to; first += this->m_report_interval)
+                    {
+                        std::size_t chunk_size = (to - first < this->m_report_interval) ? (to - first) : this->m_report_interval;
+                        if (!this->run_simulations(simulator, chunk_size, token)) return;
+                    } // for (...)
+                } // if constexpr (...)
+                else
+                {
+                    while (std::size_t m = detail::claim_monte_carlo_chunk(
+                        this->m_next_index, this->m_count_simulations, this->m_count_threads, this->m_report_interval, first))
+                    {
+                        if (!this->run_simulations(simulator, m, token)) return;
+                    } // while (...)
+                } // else (...)
+            } // work(...)
+
+            /** Joint result of the run; to be called after all threads have finished. */
+            aggregator_type result() const
+            {
+                if (!this->m_seed.has_value()) return this->m_progress->snapshot();
+
+                aggregator_type joint_aggregator {};
+                for (const aggregator_type& x : this->m_chunk_aggregators) joint_aggregator(x);
+                return joint_aggregator;
+            } // result(...)
+        }; // struct monte_carlo_run
+    } // namespace detail
+
     template <monte_carlo_simulator t_simulator_type,
         monte_carlo_aggregator<t_simulator_type> t_aggregator_type,
-        std::size_t t_count_threads = 1>
+        std::size_t t_count_threads = 1,
+        monte_carlo_schedule t_schedule = monte_carlo_schedule::guided>
         requires (t_count_threads > 0)
     struct monte_carlo;
 
+    template <monte_carlo_simulator t_simulator_type,
+        monte_carlo_aggregator<t_simulator_type> t_aggregator_type,
+        monte_carlo_schedule t_schedule = monte_carlo_schedule::guided>
+    struct monte_carlo_pool;
+
     template <typename t_aggregator_type>
     struct monte_carlo_task
     {
         using type = monte_carlo_task<t_aggregator_type>;
         using aggregator_type = t_aggregator_type;
+        using progress_type = detail::monte_carlo_progress<aggregator_type>;
+        using stop_condition_type = monte_carlo_stop_condition<aggregator_type>;
 
-        template <monte_carlo_simulator t_simulator_type, monte_carlo_aggregator<t_simulator_type>, std::size_t t_count_threads>
+        template <monte_carlo_simulator t_simulator_type, monte_carlo_aggregator<t_simulator_type>, std::size_t t_count_threads, monte_carlo_schedule>
             requires (t_count_threads > 0)
         friend struct monte_carlo;
 
+        template <monte_carlo_simulator t_simulator_type, monte_carlo_aggregator<t_simulator_type>, monte_carlo_schedule>
+        friend struct monte_carlo_pool;
+
     private:
         std::promise<aggregator_type> m_promise = {};
         std::future<aggregator_type> m_future = {};
         std::stop_source m_cancellation_source = {};
+        std::unique_ptr<progress_type> m_progress = nullptr;
 
         std::stop_token get_token() const noexcept
         {
             return this->m_cancellation_source.get_token();
         } // get_token(...)
 
-        void set_value(const aggregator_type& result)
+        progress_type* progress() noexcept
         {
-            this->m_promise.set_value(result);
-        } // set_value(...)
+            return this->m_progress.get();
+        } // progress(...)
+
+        /** Sets the result through a promise released from the task, so that the task
+         *  may be safely reassigned as soon as the result becomes ready.
+         */
+        void release_value(const aggregator_type& result)
+        {
+            std::promise<aggregator_type> promise = std::move(this->m_promise);
+            promise.set_value(result);
+        } // release_value(...)
 
         /** Invalid task. */
         monte_carlo_task(std::nullptr_t) noexcept
         {
         } // monte_carlo_task(...)
 
-        /** Default task. */
-        monte_carlo_task() noexcept
+        /** Task to run \p count_simulations simulations, or fewer if \p stop_condition is met. */
+        monte_carlo_task(std::size_t count_simulations, stop_condition_type&& stop_condition)
             : m_promise(), m_future(this->m_promise.get_future())
         {
+            this->m_progress = std::make_unique<progress_type>(count_simulations, std::move(stop_condition), this->m_cancellation_source);
         } // monte_carlo_task(...)
 
         monte_carlo_task(const type&) = delete;
@@ -79,6 +426,7 @@ namespace ropufu::aftermath::random
             this->m_promise = std::move(other.m_promise);
             this->m_future = std::move(other.m_future);
             this->m_cancellation_source = std::move(other.m_cancellation_source);
+            this->m_progress = std::move(other.m_progress);
         } // monte_carlo_task(...)
 
         void operator =(type&& other) noexcept
@@ -86,6 +434,7 @@ namespace ropufu::aftermath::random
             this->m_promise = std::move(other.m_promise);
             this->m_future = std::move(other.m_future);
             this->m_cancellation_source = std::move(other.m_cancellation_source);
+            this->m_progress = std::move(other.m_progress);
         } // operator =(...)
 
     public:
@@ -94,6 +443,24 @@ namespace ropufu::aftermath::random
             return this->m_future.valid();
         } // valid(...)
 
+        /** Number of simulations requested. */
+        std::size_t count_simulations() const noexcept
+        {
+            return (this->m_progress == nullptr) ? 0 : this->m_progress->count_simulations;
+        } // count_simulations(...)
+
+        /** Number of simulations completed so far. */
+        std::size_t count_completed() const noexcept
+        {
+            return (this->m_progress == nullptr) ? 0 : this->m_progress->count_completed.load(std::memory_order_relaxed);
+        } // count_completed(...)
+
+        /** Aggregate of the simulations completed so far. */
+        aggregator_type snapshot() const
+        {
+            return (this->m_progress == nullptr) ? aggregator_type{} : this->m_progress->snapshot();
+        } // snapshot(...)
+
         // Requests to terminate the simulation.
         void request_stop() noexcept
         {
@@ -109,58 +476,43 @@ namespace ropufu::aftermath::random
 
     template <monte_carlo_simulator t_simulator_type,
         monte_carlo_aggregator<t_simulator_type> t_aggregator_type,
-        std::size_t t_count_threads>
+        std::size_t t_count_threads,
+        monte_carlo_schedule t_schedule>
         requires (t_count_threads > 0)
     struct monte_carlo
     {
-        using type = monte_carlo<t_simulator_type, t_aggregator_type, t_count_threads>;
+        using type = monte_carlo<t_simulator_type, t_aggregator_type, t_count_threads, t_schedule>;
         using simulator_type = t_simulator_type;
         using aggregator_type = t_aggregator_type;
 
         using task_type = monte_carlo_task<aggregator_type>;
+        using stop_condition_type = monte_carlo_stop_condition<aggregator_type>;
+        using run_type = detail::monte_carlo_run<simulator_type, aggregator_type, t_schedule>;
 
         static constexpr std::size_t count_threads = t_count_threads;
+        static constexpr monte_carlo_schedule schedule = t_schedule;
+        static constexpr std::size_t default_report_interval = 1024;
 
     private:
         task_type m_execution_task = task_type(nullptr);
         std::array<simulator_type, count_threads> m_simulators = {};
         std::array<std::jthread, count_threads> m_simulator_threads = {};
+        std::optional<monte_carlo_seed> m_seed = std::nullopt;
+        std::size_t m_report_interval = type::default_report_interval;
 
-        static std::array<std::size_t, t_count_threads> simulations_per_thread(std::size_t count_simulations) noexcept
+        aggregator_type execute(run_type& run, std::stop_token token) noexcept
         {
-            std::array<std::size_t, count_threads> result {};
-            std::size_t n = count_simulations / count_threads;
-            std::size_t k = count_simulations % count_threads;
-            // count_simulations = n * count_threads + k.
-            result.fill(n);
-            for (std::size_t i = 0; i < k; ++i) result[i] = n + 1;
-            return result;
-        } // simulations_per_thread(...)
-
-        aggregator_type execute(std::size_t count_simulations, std::stop_token token) noexcept
-        {
-            std::array<std::size_t, count_threads> simulation_counts = type::simulations_per_thread(count_simulations);
-            std::array<aggregator_type, count_threads> aggregators{};
-
             for (std::size_t k = 0; k < count_threads; ++k)
             {
-                std::size_t m = simulation_counts[k];
                 simulator_type& simulator = this->m_simulators[k];
-                aggregator_type& aggregator = aggregators[k];
                 this->m_simulator_threads[k] = std::jthread(
-                    [m, &simulator, &aggregator](std::stop_token token) {
-                        for (std::size_t i = 0; i < m; ++i)
-                        {
-                            aggregator(simulator());
-                            if (token.stop_requested()) break;
-                        } // for (...)
+                    [k, &run, &simulator](std::stop_token token) {
+                        run.work(simulator, k, token);
                     }, token);
             } // for (...)
 
             for (std::jthread& x : this->m_simulator_threads) x.join();
-            aggregator_type joint_aggregator{};
-            for (const aggregator_type& x : aggregators) joint_aggregator(x);
-            return joint_aggregator;
+            return run.result();
         } // execute(...)
 
     public:
@@ -175,21 +527,48 @@ namespace ropufu::aftermath::random
 
         monte_carlo(type&&) = delete;
 
-        aggregator_type execute_sync(std::size_t count_simulations)
+        /** Largest number of simulations a thread runs between progress reports.
+         *  @remark Seeded runs report progress once per chunk of consecutive blocks instead; see \c monte_carlo_run.
+         */
+        std::size_t report_interval() const noexcept { return this->m_report_interval; }
+
+        /** @exception std::logic_error \p value is zero. */
+        void set_report_interval(std::size_t value)
+        {
+            if (value == 0) throw std::logic_error("Report interval must be positive.");
+            this->m_report_interval = value;
+        } // set_report_interval(...)
+
+        /** Makes subsequent runs reproducible: simulators are re-seeded from \p value for every block of simulations.
+         *  @remark Each run continues with the streams following those of the previous run.
+         */
+        void seed(const monte_carlo_seed& value)
+            requires seedable_monte_carlo_simulator<simulator_type>
+        {
+            if (this->m_execution_task.valid()) throw std::logic_error("Monte carlo simulations still running.");
+            this->m_seed = value;
+        } // seed(...)
+
+        aggregator_type execute_sync(std::size_t count_simulations, stop_condition_type stop_condition = nullptr)
         {
-            this->begin_async(count_simulations);
+            this->begin_async(count_simulations, std::move(stop_condition));
             return this->m_execution_task.wait();
         } // execute_sync(...)
 
-        task_type& begin_async(std::size_t count_simulations)
+        /** Starts \p count_simulations simulations; they end early once \p stop_condition is met by the partial aggregate. */
+        task_type& begin_async(std::size_t count_simulations, stop_condition_type stop_condition = nullptr)
         {
             if (this->m_execution_task.valid()) throw std::logic_error("Monte carlo simulations still running.");
-            this->m_execution_task = task_type();
+            this->m_execution_task = task_type(count_simulations, std::move(stop_condition));
+
+            std::optional<monte_carlo_seed> seed = this->m_seed;
+            if (this->m_seed.has_value()) this->m_seed->first_block += this->m_seed->count_blocks(count_simulations);
 
             std::jthread t(
-                [this, count_simulations]() {
-                    aggregator_type result = this->execute(count_simulations, this->m_execution_task.get_token());
-                    this->m_execution_task.set_value(result);
+                [this, count_simulations, seed, report_interval = this->m_report_interval]() {
+                    run_type run(count_simulations, count_threads, report_interval, seed, this->m_execution_task.progress());
+                    aggregator_type result = this->execute(run, this->m_execution_task.get_token());
+                    this->m_execution_task.release_value(result);
                 });
             t.detach();
 
@@ -0,0 +1,126 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_PAIRING_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_PAIRING_HPP_INCLUDED
+
+#include "monte_carlo.hpp"
+
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <random>      // std::mt19937, std::seed_seq
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::declval, std::pair
+
+namespace ropufu::aftermath::random
+{
+    /** Seedable simulator whose random stream can be switched to its antithetic counterpart. */
+    template <typename t_simulator_type>
+    concept antithetic_monte_carlo_simulator = seedable_monte_carlo_simulator<t_simulator_type> &&
+        requires(t_simulator_type& f, bool value)
+        {
+            {f.set_antithetic(value)};
+        }; // concept antithetic_monte_carlo_simulator
+
+    /** Determines how the random streams of paired simulators are related. */
+    enum struct monte_carlo_pairing : char
+    {
+        /** Both simulators are fed identical engine streams. */
+        common_random_numbers = 0,
+        /** The second simulator is fed the antithetic stream of the first. */
+        antithetic = 1
+    }; // enum struct monte_carlo_pairing
+
+    template <seedable_monte_carlo_simulator t_first_simulator_type,
+        seedable_monte_carlo_simulator t_second_simulator_type = t_first_simulator_type,
+        monte_carlo_pairing t_pairing = monte_carlo_pairing::common_random_numbers>
+        requires (t_pairing == monte_carlo_pairing::common_random_numbers) ||
+            (std::is_same_v<t_first_simulator_type, t_second_simulator_type> && antithetic_monte_carlo_simulator<t_first_simulator_type>)
+    struct paired_simulator;
+
+    /** @brief Simulator running two simulators on related random streams, and reporting their outcomes as a pair.
+     *  @remark Before every simulation both simulators are re-seeded from one seed sequence, drawn from the
+     *    pair's own engine, so that they remain in step even if they consume different amounts of randomness.
+     *    Re-seeding costs about as much as initializing the simulators' engines, which is small compared to
+     *    simulations of any length.
+     *  @remark The pair is itself seedable, so it can be used with \c monte_carlo_seed.
+     *  @remark Since the simulators are re-seeded from the pair's engine, any seeds they were given beforehand are
+     *    discarded. For runs without \c monte_carlo_seed, give each pair its own seed on construction.
+     */
+    template <seedable_monte_carlo_simulator t_first_simulator_type,
+        seedable_monte_carlo_simulator t_second_simulator_type,
+        monte_carlo_pairing t_pairing>
+        requires (t_pairing == monte_carlo_pairing::common_random_numbers) ||
+            (std::is_same_v<t_first_simulator_type, t_second_simulator_type> && antithetic_monte_carlo_simulator<t_first_simulator_type>)
+    struct paired_simulator
+    {
+        using type = paired_simulator<t_first_simulator_type, t_second_simulator_type, t_pairing>;
+        using first_simulator_type = t_first_simulator_type;
+        using second_simulator_type = t_second_simulator_type;
+        using seed_engine_type = std::mt19937;
+
+        using first_result_type = decltype(std::declval<first_simulator_type&>()());
+        using second_result_type = decltype(std::declval<second_simulator_type&>()());
+        using result_type = std::pair<first_result_type, second_result_type>;
+
+        static constexpr monte_carlo_pairing pairing = t_pairing;
+
+    private:
+        first_simulator_type m_first = {};
+        second_simulator_type m_second = {};
+        /** Source of the seed sequences shared by the two simulators. */
+        seed_engine_type m_seed_engine = {};
+
+        void initialize_pairing() noexcept
+        {
+            if constexpr (type::pairing == monte_carlo_pairing::antithetic)
+            {
+                this->m_first.set_antithetic(false);
+                this->m_second.set_antithetic(true);
+            } // if constexpr (...)
+        } // initialize_pairing(...)
+
+    public:
+        paired_simulator() noexcept
+        {
+            this->initialize_pairing();
+        } // paired_simulator(...)
+
+        /** Pairs \p first and \p second, drawing their seeds from an engine seeded with \p seed. */
+        explicit paired_simulator(const first_simulator_type& first, const second_simulator_type& second, std::uint64_t seed) noexcept
+            : m_first(first), m_second(second)
+        {
+            std::seed_seq sequence{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+            this->m_seed_engine.seed(sequence);
+            this->initialize_pairing();
+        } // paired_simulator(...)
+
+        const first_simulator_type& first() const noexcept { return this->m_first; }
+        const second_simulator_type& second() const noexcept { return this->m_second; }
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->m_seed_engine.seed(sequence);
+        } // seed(...)
+
+        result_type operator ()()
+        {
+            std::uint32_t a = static_cast<std::uint32_t>(this->m_seed_engine());
+            std::uint32_t b = static_cast<std::uint32_t>(this->m_seed_engine());
+            std::seed_seq sequence{a, b};
+            this->m_first.seed(sequence);
+            this->m_second.seed(sequence);
+
+            first_result_type x = this->m_first();
+            second_result_type y = this->m_second();
+            return {x, y};
+        } // operator ()(...)
+    }; // struct paired_simulator
+
+    /** Simulator feeding identical engine streams to two simulators. */
+    template <seedable_monte_carlo_simulator t_first_simulator_type, seedable_monte_carlo_simulator t_second_simulator_type = t_first_simulator_type>
+    using common_random_numbers_simulator = paired_simulator<t_first_simulator_type, t_second_simulator_type, monte_carlo_pairing::common_random_numbers>;
+
+    /** Simulator feeding a stream and its antithetic counterpart to two copies of a simulator. */
+    template <antithetic_monte_carlo_simulator t_simulator_type>
+    using antithetic_simulator = paired_simulator<t_simulator_type, t_simulator_type, monte_carlo_pairing::antithetic>;
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_PAIRING_HPP_INCLUDED
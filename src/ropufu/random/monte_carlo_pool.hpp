@@ -0,0 +1,190 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_POOL_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_POOL_HPP_INCLUDED
+
+#include "monte_carlo.hpp"
+
+#include <atomic>             // std::atomic, std::memory_order_acq_rel
+#include <condition_variable> // std::condition_variable_any
+#include <cstddef>            // std::size_t
+#include <mutex>              // std::mutex, std::unique_lock, std::lock_guard
+#include <optional>           // std::optional, std::nullopt
+#include <stdexcept>          // std::logic_error
+#include <stop_token>         // std::stop_token
+#include <thread>             // std::jthread, std::thread
+#include <utility>            // std::move
+#include <vector>             // std::vector
+
+namespace ropufu::aftermath::random
+{
+    /** Monte carlo simulations run on a pool of persistent workers, the number of which is chosen at runtime.
+     *  @remark Workers are started once, on construction, and wait for new simulations between runs.
+     */
+    template <monte_carlo_simulator t_simulator_type,
+        monte_carlo_aggregator<t_simulator_type> t_aggregator_type,
+        monte_carlo_schedule t_schedule>
+    struct monte_carlo_pool
+    {
+        using type = monte_carlo_pool<t_simulator_type, t_aggregator_type, t_schedule>;
+        using simulator_type = t_simulator_type;
+        using aggregator_type = t_aggregator_type;
+
+        using task_type = monte_carlo_task<aggregator_type>;
+        using stop_condition_type = monte_carlo_stop_condition<aggregator_type>;
+        using run_type = detail::monte_carlo_run<simulator_type, aggregator_type, t_schedule>;
+
+        static constexpr monte_carlo_schedule schedule = t_schedule;
+        static constexpr std::size_t default_report_interval = 1024;
+
+    private:
+        task_type m_execution_task = task_type(nullptr);
+        std::vector<simulator_type> m_simulators = {};
+        std::optional<monte_carlo_seed> m_seed = std::nullopt;
+        std::size_t m_report_interval = type::default_report_interval;
+
+        /** State of the current simulations. */
+        std::optional<run_type> m_run = std::nullopt;
+
+        /** Guards \c m_generation and \c m_token. */
+        std::mutex m_mutex = {};
+        std::condition_variable_any m_posted = {};
+        /** Incremented every time new simulations are posted. */
+        std::size_t m_generation = 0;
+        std::stop_token m_token = {};
+
+        /** Number of workers still running the current simulations. */
+        std::atomic<std::size_t> m_count_busy_workers = 0;
+
+        /** Declared last so that the workers are joined before the rest of the pool is destroyed. */
+        std::vector<std::jthread> m_workers = {};
+
+        static std::size_t default_count_threads() noexcept
+        {
+            std::size_t count_threads = std::thread::hardware_concurrency();
+            return (count_threads == 0) ? 1 : count_threads;
+        } // default_count_threads(...)
+
+        void start_workers()
+        {
+            std::size_t count_threads = this->m_simulators.size();
+            this->m_workers.reserve(count_threads);
+            for (std::size_t k = 0; k < count_threads; ++k)
+            {
+                this->m_workers.emplace_back([this, k](std::stop_token worker_token) { this->work(k, worker_token); });
+            } // for (...)
+        } // start_workers(...)
+
+        /** Main loop of the \p k-th worker. */
+        void work(std::size_t k, std::stop_token worker_token) noexcept
+        {
+            std::size_t seen_generation = 0;
+            while (true)
+            {
+                std::stop_token token {};
+                {
+                    std::unique_lock lock(this->m_mutex);
+                    bool is_posted = this->m_posted.wait(lock, worker_token,
+                        [this, seen_generation]() { return this->m_generation != seen_generation; });
+                    if (!is_posted) return; // The pool is being destroyed.
+
+                    seen_generation = this->m_generation;
+                    token = this->m_token;
+                } // lock
+
+                this->m_run->work(this->m_simulators[k], k, token);
+                if (this->m_count_busy_workers.fetch_sub(1, std::memory_order_acq_rel) == 1) this->complete();
+            } // while (...)
+        } // work(...)
+
+        /** Called by the last worker to finish the current simulations. */
+        void complete() noexcept
+        {
+            aggregator_type result = this->m_run->result();
+            this->m_execution_task.release_value(result);
+        } // complete(...)
+
+    public:
+        /** Starts a pool with one worker per hardware thread. */
+        monte_carlo_pool()
+            : monte_carlo_pool(type::default_count_threads())
+        {
+        } // monte_carlo_pool(...)
+
+        /** Starts a pool with \p count_threads default-constructed simulators.
+         *  @exception std::logic_error \p count_threads is zero.
+         */
+        explicit monte_carlo_pool(std::size_t count_threads)
+        {
+            if (count_threads == 0) throw std::logic_error("Number of threads must be positive.");
+            this->m_simulators = std::vector<simulator_type>(count_threads);
+            this->start_workers();
+        } // monte_carlo_pool(...)
+
+        /** Starts a pool with one worker per simulator.
+         *  @exception std::logic_error \p simulators is empty.
+         */
+        explicit monte_carlo_pool(const std::vector<simulator_type>& simulators)
+            : m_simulators(simulators)
+        {
+            if (simulators.empty()) throw std::logic_error("Number of threads must be positive.");
+            this->start_workers();
+        } // monte_carlo_pool(...)
+
+        monte_carlo_pool(const type&) = delete;
+
+        monte_carlo_pool(type&&) = delete;
+
+        std::size_t count_threads() const noexcept { return this->m_simulators.size(); }
+
+        /** Largest number of simulations a worker runs between progress reports.
+         *  @remark Seeded runs report progress once per chunk of consecutive blocks instead; see \c monte_carlo_run.
+         */
+        std::size_t report_interval() const noexcept { return this->m_report_interval; }
+
+        /** @exception std::logic_error \p value is zero. */
+        void set_report_interval(std::size_t value)
+        {
+            if (value == 0) throw std::logic_error("Report interval must be positive.");
+            this->m_report_interval = value;
+        } // set_report_interval(...)
+
+        /** Makes subsequent runs reproducible: simulators are re-seeded from \p value for every block of simulations.
+         *  @remark Each run continues with the streams following those of the previous run.
+         */
+        void seed(const monte_carlo_seed& value)
+            requires seedable_monte_carlo_simulator<simulator_type>
+        {
+            if (this->m_execution_task.valid()) throw std::logic_error("Monte carlo simulations still running.");
+            this->m_seed = value;
+        } // seed(...)
+
+        aggregator_type execute_sync(std::size_t count_simulations, stop_condition_type stop_condition = nullptr)
+        {
+            this->begin_async(count_simulations, std::move(stop_condition));
+            return this->m_execution_task.wait();
+        } // execute_sync(...)
+
+        /** Starts \p count_simulations simulations; they end early once \p stop_condition is met by the partial aggregate. */
+        task_type& begin_async(std::size_t count_simulations, stop_condition_type stop_condition = nullptr)
+        {
+            if (this->m_execution_task.valid()) throw std::logic_error("Monte carlo simulations still running.");
+            this->m_execution_task = task_type(count_simulations, std::move(stop_condition));
+
+            // Workers are idle at this point.
+            this->m_run.reset();
+            this->m_run.emplace(count_simulations, this->m_simulators.size(), this->m_report_interval, this->m_seed, this->m_execution_task.progress());
+            if (this->m_seed.has_value()) this->m_seed->first_block += this->m_seed->count_blocks(count_simulations);
+            this->m_count_busy_workers.store(this->m_workers.size(), std::memory_order_relaxed);
+            {
+                std::lock_guard lock(this->m_mutex);
+                this->m_token = this->m_execution_task.get_token();
+                ++this->m_generation;
+            } // lock
+            this->m_posted.notify_all();
+
+            return this->m_execution_task;
+        } // begin_async(...)
+    }; // struct monte_carlo_pool
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_MONTE_CARLO_POOL_HPP_INCLUDED
@@ -5,6 +5,8 @@
 #include "../probability/normal_distribution.hpp"
 #include "standard_normal_sampler_512.hpp"
 
+#include <span> // std::span
+
 namespace ropufu::aftermath::random
 {
     /** @brief Sampler for Bernoulli distributions. */
@@ -58,10 +60,22 @@ namespace ropufu::aftermath::random
             return this->m_shift + this->m_scale * this->m_standard_sampler(uniform_generator);
         } // sample(...)
 
+        /** Fills \p values with independent draws. */
+        void sample(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            this->m_standard_sampler.sample(uniform_generator, values);
+            for (value_type& x : values) x = this->m_shift + this->m_scale * x;
+        } // sample(...)
+
         value_type operator ()(engine_type& uniform_generator) noexcept
         {
             return this->sample(uniform_generator);
         } // operator ()(...)
+
+        void operator ()(engine_type& uniform_generator, std::span<value_type> values) noexcept
+        {
+            this->sample(uniform_generator, values);
+        } // operator ()(...)
     }; // struct normal_sampler_512
 } // namespace ropufu::aftermath::random
 
@@ -0,0 +1,213 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_PACKED_ALIAS_SAMPLER_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_PACKED_ALIAS_SAMPLER_HPP_INCLUDED
+
+#include "../probability/concepts.hpp"
+#include "alias_sampler.hpp"
+#include "uniform_int_sampler.hpp"
+
+#include <cstddef>   // std::size_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+namespace ropufu::aftermath::random
+{
+    namespace detail
+    {
+        /** Smallest power of two that is not less than \p value. */
+        constexpr std::size_t alias_slot_alignment(std::size_t value) noexcept
+        {
+            std::size_t result = 1;
+            while (result < value) result *= 2;
+            return result;
+        } // alias_slot_alignment(...)
+    } // namespace detail
+
+    /** @brief One entry of an alias table: the {support, alias, cutoff} triple.
+     *  @remark Aligned to its size rounded up to a power of two, so a slot never straddles two cache lines.
+     */
+    template <typename t_value_type, typename t_uniform_type>
+    struct alignas(detail::alias_slot_alignment(2 * sizeof(t_value_type) + sizeof(t_uniform_type))) alias_slot
+    {
+        using value_type = t_value_type;
+        using uniform_type = t_uniform_type;
+
+        value_type support;
+        value_type alias;
+        /** The support element is chosen if the uniform is less than the cutoff. */
+        uniform_type cutoff;
+    }; // struct alias_slot
+
+    /** @brief Layout of a packed alias table, and the way uniforms are drawn from it.
+     *  @remark If every slot can be allotted a block of at least 2^d engine outputs, where d is the number
+     *    of binary digits in \c t_probability_type, a single engine output selects the slot (its block) and
+     *    makes the cutoff comparison (its position within the block). Otherwise the slot is chosen by
+     *    \c t_index_sampler_type and the cutoff is compared against a second engine output.
+     */
+    template <typename t_engine_type, typename t_value_type, typename t_probability_type, typename t_index_sampler_type>
+    struct alias_table_packing
+    {
+        using type = alias_table_packing<t_engine_type, t_value_type, t_probability_type, t_index_sampler_type>;
+
+        using engine_type = t_engine_type;
+        using value_type = t_value_type;
+        using probability_type = t_probability_type;
+        using index_sampler_type = t_index_sampler_type;
+        using uniform_type = typename engine_type::result_type;
+        using slot_type = alias_slot<value_type, uniform_type>;
+
+        static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+        static constexpr std::size_t rejection_loop_max = 100;
+
+    private:
+        static constexpr int probability_digits = std::numeric_limits<probability_type>::digits;
+
+        std::size_t m_count_slots = 0;
+        /** Number of engine outputs per slot; zero if two engine calls are made per draw. */
+        uniform_type m_block_size = 0;
+        index_sampler_type m_index_sampler = {};
+
+    public:
+        alias_table_packing() noexcept { }
+
+        /** @brief Packs the tables of \p source into \p slots.
+         *  @exception std::logic_error \c t_engine_type cannot accomodate such a wide distribution.
+         */
+        template <typename t_alias_sampler_type>
+        explicit alias_table_packing(const t_alias_sampler_type& source, std::vector<slot_type>& slots)
+            : m_count_slots(source.support().size()), m_index_sampler(source.index_sampler())
+        {
+            std::size_t n = this->m_count_slots;
+            uniform_type block_size = 1 + (type::engine_diameter - static_cast<uniform_type>(n - 1)) / static_cast<uniform_type>(n);
+            if constexpr (type::probability_digits < std::numeric_limits<uniform_type>::digits)
+            {
+                if ((block_size >> type::probability_digits) != 0) this->m_block_size = block_size;
+            } // if constexpr (...)
+
+            // Probability that the support element is chosen: (cutoff - min) / (diameter + 1).
+            constexpr long double full_scale = static_cast<long double>(type::engine_diameter) + 1;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                uniform_type cutoff = source.cutoff()[i];
+                if (this->m_block_size != 0)
+                {
+                    long double p = static_cast<long double>(cutoff - engine_type::min()) / full_scale;
+                    long double scaled = p * static_cast<long double>(this->m_block_size) + 0.5L;
+                    cutoff = (scaled >= static_cast<long double>(this->m_block_size)) ?
+                        this->m_block_size :
+                        static_cast<uniform_type>(scaled);
+                } // if (...)
+                slots.push_back(slot_type{source.support()[i], source.alias()[i], cutoff});
+            } // for (...)
+        } // alias_table_packing(...)
+
+        std::size_t count_slots() const noexcept { return this->m_count_slots; }
+
+        /** Indicates if a single engine output is used per draw. */
+        bool is_single_uniform() const noexcept { return this->m_block_size != 0; }
+
+        /** Draws from the table stored in \p slots.
+         *  @exception std::runtime_error Rejection sampling exceeded maximum allowed attempts.
+         */
+        value_type sample(const slot_type* slots, engine_type& uniform_generator)
+        {
+            if (this->m_block_size != 0)
+            {
+                std::size_t count_rejections = 0; // Prevent infinite loops for "bad" uniform generators.
+                uniform_type u = uniform_generator() - engine_type::min(); // Uniform over {0, ..., engine_diameter}.
+                uniform_type index = u / this->m_block_size;
+                while (index >= this->m_count_slots) // Reject if we are in the fractional block.
+                {
+                    ++count_rejections;
+                    if (count_rejections > type::rejection_loop_max)
+                        throw std::runtime_error("Sampler exceeded maximum allowed rejections.");
+
+                    u = uniform_generator() - engine_type::min();
+                    index = u / this->m_block_size;
+                } // while (...)
+                const slot_type& slot = slots[index];
+                return (u - index * this->m_block_size < slot.cutoff) ? slot.support : slot.alias;
+            } // if (...)
+
+            // ~~ Stage 1 (index): generate a discrete uniform over {0, 1, ..., n - 1}. ~~
+            const slot_type& slot = slots[this->m_index_sampler.sample(uniform_generator)];
+            // ~~ Stage 2 (cutoff): generate a discrete uniform over {0, 1, ..., engine_diameter}. ~~
+            uniform_type u = uniform_generator();
+            return (u < slot.cutoff) ? slot.support : slot.alias;
+        } // sample(...)
+    }; // struct alias_table_packing
+
+    template <typename t_engine_type,
+        ropufu::distribution t_distribution_type,
+        typename t_index_sampler_type = uniform_int_sampler<
+            t_engine_type,
+            std::size_t,
+            typename t_distribution_type::probability_type,
+            typename t_distribution_type::expectation_type>>
+        requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
+    struct packed_alias_sampler;
+
+    /** @brief Alias sampler with the {support, alias, cutoff} triples stored side by side.
+     *  @remark Where the engine diameter allows, a single engine output is used per draw.
+     */
+    template <typename t_engine_type, ropufu::distribution t_distribution_type, typename t_index_sampler_type>
+        requires probability::is_discrete_v<t_distribution_type> && probability::has_bounded_support_v<t_distribution_type>
+    struct packed_alias_sampler
+    {
+        using type = packed_alias_sampler<t_engine_type, t_distribution_type, t_index_sampler_type>;
+        using alias_type = alias_sampler<t_engine_type, t_distribution_type, t_index_sampler_type>;
+
+        using engine_type = t_engine_type;
+        using distribution_type = t_distribution_type;
+        using index_sampler_type = t_index_sampler_type;
+
+        using value_type = typename distribution_type::value_type;
+        using probability_type = typename distribution_type::probability_type;
+        using expectation_type = typename distribution_type::expectation_type;
+        using uniform_type = typename engine_type::result_type;
+        using packing_type = alias_table_packing<engine_type, value_type, probability_type, index_sampler_type>;
+        using slot_type = typename packing_type::slot_type;
+
+        using result_type = value_type;
+        static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+
+    private:
+        std::vector<slot_type> m_slots = {};
+        packing_type m_packing = {};
+
+    public:
+        packed_alias_sampler()
+            : packed_alias_sampler(distribution_type{})
+        {
+        } // packed_alias_sampler(...)
+
+        /** @brief Constructs a packed alias sampler for \p distribution.
+         *  @exception std::logic_error Trivial distributions not supported.
+         *  @exception std::logic_error \c t_engine_type cannot accomodate such a wide distribution.
+         */
+        explicit packed_alias_sampler(const distribution_type& dist)
+        {
+            alias_type a { dist };
+            this->m_slots.reserve(a.support().size());
+            this->m_packing = packing_type(a, this->m_slots);
+        } // packed_alias_sampler(...)
+
+        const std::vector<slot_type>& slots() const noexcept { return this->m_slots; }
+
+        /** Indicates if a single engine output is used per draw. */
+        bool is_single_uniform() const noexcept { return this->m_packing.is_single_uniform(); }
+
+        value_type sample(engine_type& uniform_generator)
+        {
+            return this->m_packing.sample(this->m_slots.data(), uniform_generator);
+        } // sample(...)
+
+        value_type operator ()(engine_type& uniform_generator)
+        {
+            return this->sample(uniform_generator);
+        } // operator ()(...)
+    }; // struct packed_alias_sampler
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_PACKED_ALIAS_SAMPLER_HPP_INCLUDED
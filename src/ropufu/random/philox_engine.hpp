@@ -0,0 +1,206 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
+
+#include <array>   // std::array
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <random>  // std::seed_seq
+#include <span>    // std::span
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Counter-based Philox-4x32-10 engine producing full 64-bit words.
+     *  @remark The n-th output of a stream is a bijective function of (key, stream, n), so skipping ahead
+     *    is O(1), and streams with different indices sharing one key are independent.
+     *  @remark Every application of the bijection yields 128 random bits, i.e., two outputs.
+     */
+    struct philox_engine
+    {
+        using type = philox_engine;
+        using result_type = std::uint64_t;
+        using key_type = std::array<std::uint32_t, 2>;
+        using counter_type = std::array<std::uint32_t, 4>;
+
+        static constexpr std::size_t word_size = 64;
+        static constexpr std::size_t count_rounds = 10;
+        static constexpr result_type default_seed = 20111115U;
+
+    private:
+        static constexpr std::uint32_t multiplier_0 = 0xD2511F53U;
+        static constexpr std::uint32_t multiplier_1 = 0xCD9E8D57U;
+        static constexpr std::uint32_t weyl_0 = 0x9E3779B9U; // Golden ratio.
+        static constexpr std::uint32_t weyl_1 = 0xBB67AE85U; // sqrt(3) - 1.
+        static constexpr std::size_t outputs_per_block = 2;
+
+        key_type m_key = {};
+        std::uint64_t m_stream = 0;
+        /** Index of the next block to be generated. */
+        std::uint64_t m_next_block = 0;
+        std::array<result_type, outputs_per_block> m_buffer = {};
+        /** Position of the next output in \c m_buffer; \c outputs_per_block if the buffer is exhausted. */
+        std::size_t m_buffer_index = outputs_per_block;
+
+        static constexpr void multiply(std::uint32_t a, std::uint32_t b, std::uint32_t& high, std::uint32_t& low) noexcept
+        {
+            std::uint64_t product = static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b);
+            high = static_cast<std::uint32_t>(product >> 32);
+            low = static_cast<std::uint32_t>(product);
+        } // multiply(...)
+
+        void fill_buffer() noexcept
+        {
+            counter_type block = type::bijection(
+                {static_cast<std::uint32_t>(this->m_next_block), static_cast<std::uint32_t>(this->m_next_block >> 32),
+                static_cast<std::uint32_t>(this->m_stream), static_cast<std::uint32_t>(this->m_stream >> 32)},
+                this->m_key);
+            this->m_buffer[0] = (static_cast<result_type>(block[1]) << 32) | block[0];
+            this->m_buffer[1] = (static_cast<result_type>(block[3]) << 32) | block[2];
+            ++this->m_next_block;
+            this->m_buffer_index = 0;
+        } // fill_buffer(...)
+
+        /** Writes the outputs of the \p count_blocks next blocks into \p values, bypassing the buffer. */
+        void generate_blocks(result_type* values, std::size_t count_blocks) noexcept
+        {
+            const counter_type stream = {0, 0, static_cast<std::uint32_t>(this->m_stream), static_cast<std::uint32_t>(this->m_stream >> 32)};
+            for (std::size_t k = 0; k < count_blocks; ++k)
+            {
+                counter_type counter = stream;
+                counter[0] = static_cast<std::uint32_t>(this->m_next_block);
+                counter[1] = static_cast<std::uint32_t>(this->m_next_block >> 32);
+                counter = type::bijection(counter, this->m_key);
+                values[type::outputs_per_block * k] = (static_cast<result_type>(counter[1]) << 32) | counter[0];
+                values[type::outputs_per_block * k + 1] = (static_cast<result_type>(counter[3]) << 32) | counter[2];
+                ++this->m_next_block;
+            } // for (...)
+        } // generate_blocks(...)
+
+    public:
+        /** The keyed bijection underlying the engine: Philox-4x32 with \c count_rounds rounds. */
+        static constexpr counter_type bijection(counter_type counter, key_type key) noexcept
+        {
+            for (std::size_t i = 0; i < type::count_rounds; ++i)
+            {
+                if (i != 0)
+                {
+                    key[0] += type::weyl_0;
+                    key[1] += type::weyl_1;
+                } // if (...)
+                std::uint32_t high_0 = 0, low_0 = 0, high_1 = 0, low_1 = 0;
+                type::multiply(type::multiplier_0, counter[0], high_0, low_0);
+                type::multiply(type::multiplier_1, counter[2], high_1, low_1);
+                counter = {high_1 ^ counter[1] ^ key[0], low_1, high_0 ^ counter[3] ^ key[1], low_0};
+            } // for (...)
+            return counter;
+        } // bijection(...)
+
+        philox_engine() noexcept
+            : philox_engine(type::default_seed)
+        {
+        } // philox_engine(...)
+
+        explicit philox_engine(result_type value, std::uint64_t stream = 0) noexcept
+        {
+            this->seed(value);
+            this->m_stream = stream;
+        } // philox_engine(...)
+
+        explicit philox_engine(std::seed_seq& sequence) noexcept
+        {
+            this->seed(sequence);
+        } // philox_engine(...)
+
+        static constexpr result_type min() noexcept { return std::numeric_limits<result_type>::min(); }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        const key_type& key() const noexcept { return this->m_key; }
+
+        std::uint64_t stream() const noexcept { return this->m_stream; }
+
+        /** Number of outputs generated since the beginning of the stream. */
+        std::uint64_t position() const noexcept
+        {
+            return type::outputs_per_block * this->m_next_block - (type::outputs_per_block - this->m_buffer_index);
+        } // position(...)
+
+        void seed() noexcept
+        {
+            this->seed(type::default_seed);
+        } // seed(...)
+
+        /** Sets the key to \p value and rewinds to the beginning of the current stream. */
+        void seed(result_type value) noexcept
+        {
+            this->m_key = {static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32)};
+            this->set_position(0);
+        } // seed(...)
+
+        /** Sets the key from \p sequence and rewinds to the beginning of stream zero. */
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            sequence.generate(this->m_key.begin(), this->m_key.end());
+            this->m_stream = 0;
+            this->set_position(0);
+        } // seed(...)
+
+        /** Switches to the beginning of stream \p value. */
+        void set_stream(std::uint64_t value) noexcept
+        {
+            this->m_stream = value;
+            this->set_position(0);
+        } // set_stream(...)
+
+        /** Engine with the same key positioned at the beginning of stream \p value. */
+        type split(std::uint64_t value) const noexcept
+        {
+            type result = *this;
+            result.set_stream(value);
+            return result;
+        } // split(...)
+
+        /** Moves to the \p value-th output of the current stream in O(1) time. */
+        void set_position(std::uint64_t value) noexcept
+        {
+            this->m_next_block = value / type::outputs_per_block;
+            this->m_buffer_index = type::outputs_per_block;
+            std::size_t offset = static_cast<std::size_t>(value % type::outputs_per_block);
+            if (offset != 0)
+            {
+                this->fill_buffer();
+                this->m_buffer_index = offset;
+            } // if (...)
+        } // set_position(...)
+
+        /** Skips \p count outputs in O(1) time. */
+        void discard(unsigned long long count) noexcept
+        {
+            this->set_position(this->position() + static_cast<std::uint64_t>(count));
+        } // discard(...)
+
+        result_type operator ()() noexcept
+        {
+            if (this->m_buffer_index == type::outputs_per_block) this->fill_buffer();
+            return this->m_buffer[this->m_buffer_index++];
+        } // operator ()(...)
+
+        /** Fills \p values with the next outputs; same as calling the engine for every element. */
+        void generate(std::span<result_type> values) noexcept
+        {
+            std::size_t i = 0;
+            while (i < values.size() && this->m_buffer_index != type::outputs_per_block) values[i++] = this->m_buffer[this->m_buffer_index++];
+            std::size_t count_blocks = (values.size() - i) / type::outputs_per_block;
+            this->generate_blocks(values.data() + i, count_blocks);
+            i += count_blocks * type::outputs_per_block;
+            while (i < values.size()) values[i++] = this->operator ()();
+        } // generate(...)
+
+        friend bool operator ==(const type& left, const type& right) noexcept
+        {
+            return left.m_key == right.m_key && left.m_stream == right.m_stream && left.position() == right.position();
+        } // operator ==(...)
+    }; // struct philox_engine
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
@@ -0,0 +1,67 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_STANDARD_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_STANDARD_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
+
+#include "../probability/standard_exponential_distribution.hpp"
+#include "ziggurat_layers_exponential_512_m24.hpp"
+#include "ziggurat_layers_exponential_512_2147483645.hpp"
+#include "ziggurat_layers_exponential_512_m32.hpp"
+#include "ziggurat_layers_exponential_512_m48.hpp"
+#include "ziggurat_layers_exponential_512_m64.hpp"
+#include "ziggurat_sampler.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    /** @brief Ziggurat for exponential distribution. */
+    template <typename t_engine_type,
+        typename t_value_type = typename probability::standard_exponential_distribution<>::value_type,
+        typename t_probability_type = typename probability::standard_exponential_distribution<t_value_type>::probability_type,
+        typename t_expectation_type = typename probability::standard_exponential_distribution<t_value_type, t_probability_type>::expectation_type>
+    struct standard_exponential_sampler_512;
+
+    /** @brief Ziggurat for exponential distribution. */
+    template <typename t_engine_type, typename t_value_type, typename t_probability_type, typename t_expectation_type>
+    struct standard_exponential_sampler_512 :
+        public ziggurat_sampler<
+            standard_exponential_sampler_512<t_engine_type, t_value_type, t_probability_type, t_expectation_type>,
+            t_engine_type,
+            probability::standard_exponential_distribution<t_value_type, t_probability_type, t_expectation_type>,
+            512>,
+        public ziggurat_layers_exponential_512<
+            typename t_engine_type::result_type,
+            t_value_type,
+            t_expectation_type,
+            t_engine_type::max() - t_engine_type::min()>
+    {
+        using type = standard_exponential_sampler_512<t_engine_type, t_value_type, t_probability_type, t_expectation_type>;
+
+        using engine_type = t_engine_type;
+        using value_type = t_value_type;
+        using probability_type = t_probability_type;
+        using expectation_type = t_expectation_type;
+        using distribution_type = probability::standard_exponential_distribution<value_type, probability_type, expectation_type>;
+        using ziggurat_type = ziggurat_sampler<type, engine_type, distribution_type, 512>;
+        using uniform_type = typename engine_type::result_type;
+
+        using result_type = value_type;
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
+        static constexpr long double scale = static_cast<long double>(engine_diameter) + 1;
+
+        friend ziggurat_type;
+
+        using ziggurat_type::ziggurat_sampler;
+
+    protected:
+        /** By memorylessness, the overshoot of the tail beyond the bottom layer is again standard exponential. */
+        value_type sample_right_tail(engine_type& uniform_generator) noexcept
+        {
+            const value_type r = static_cast<value_type>(type::downscaled_layer_widths[1] * type::scale);
+            return r + this->ziggurat_type::sample(uniform_generator);
+        } // sample_right_tail(...)
+    }; // struct standard_exponential_sampler_512
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_STANDARD_EXPONENTIAL_SAMPLER_512_HPP_INCLUDED
@@ -4,7 +4,12 @@
 
 #include "../probability/uniform_int_distribution.hpp"
 
-#include <cstddef> // std::size_t
+#include "../arithmetic.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <span>      // std::span
+#include <stdexcept> // std::overflow_error, std::runtime_error
 
 namespace ropufu::aftermath::random
 {
@@ -32,11 +37,39 @@ namespace ropufu::aftermath::random
         using result_type = value_type;
         static constexpr uniform_type engine_diameter = engine_type::max() - engine_type::min();
         static constexpr std::size_t rejection_loop_max = t_rejection_loop_max;
+        /** Indicates if the engine can fill a buffer with uniforms in a single call. */
+        static constexpr bool has_bulk_engine = requires(engine_type& e, std::span<uniform_type> values) { e.generate(values); };
+        /** Number of engine outputs drawn at a time by the block-fill function. */
+        static constexpr std::size_t batch_size = 256;
 
     private:
+        /** Number of bits in engine outputs; zero if the engine diameter is not a Mersenne number. */
+        static constexpr std::size_t engine_bits = static_cast<std::size_t>(aftermath::mersenne_power(static_cast<std::uint64_t>(type::engine_diameter)));
+        /** Indicates if the engine covers a whole number of bits, as required by multiply-shift range reduction. */
+        static constexpr bool is_full_width = (type::engine_bits != 0);
+        /** Multiply-shift uses the top (at most 32) bits of every engine output, so that products fit in 64 bits. */
+        static constexpr std::size_t reduction_bits = (type::engine_bits < 32) ? type::engine_bits : 32;
+        static constexpr std::uint64_t reduction_mask = (std::uint64_t(1) << type::reduction_bits) - 1;
+
         value_type m_min = 0;
         uniform_type m_diameter = type::engine_diameter;
         uniform_type m_engine_blocks = 1;
+        /** Number of values, b - a + 1; zero if multiply-shift range reduction does not apply. */
+        std::uint64_t m_reduction_range = 0;
+        /** Products whose lower bits fall below this threshold are rejected. */
+        std::uint64_t m_reduction_threshold = 0;
+
+        static void generate(engine_type& uniform_generator, uniform_type* uniforms, std::size_t count) noexcept
+        {
+            if constexpr (type::has_bulk_engine) uniform_generator.generate(std::span<uniform_type>(uniforms, count));
+            else for (std::size_t i = 0; i < count; ++i) uniforms[i] = uniform_generator();
+        } // generate(...)
+
+        /** Top \c reduction_bits bits of an engine output. */
+        static std::uint64_t top_bits(uniform_type u) noexcept
+        {
+            return static_cast<std::uint64_t>(u - engine_type::min()) >> (type::engine_bits - type::reduction_bits);
+        } // top_bits(...)
 
     public:
         uniform_int_sampler()
@@ -56,6 +89,16 @@ namespace ropufu::aftermath::random
                 this->m_engine_blocks = type::engine_diameter;
                 this->m_diameter = 0; // Resort to rejection when the maximum value is generated.
             } // if (...)
+
+            if constexpr (type::is_full_width)
+            {
+                std::uint64_t range = static_cast<std::uint64_t>(this->m_diameter) + 1;
+                if (this->m_diameter != 0 && range - 1 <= type::reduction_mask)
+                {
+                    this->m_reduction_range = range;
+                    this->m_reduction_threshold = (type::reduction_mask - range + 1) % range; // 2^bits mod range.
+                } // if (...)
+            } // if constexpr (...)
         } // uniform_int_sampler(...)
 
         /** Upper bound on the probability of error. */
@@ -91,10 +134,64 @@ namespace ropufu::aftermath::random
             return this->m_min + static_cast<value_type>(k);
         } // sample(...)
 
+        /** @brief Fills \p values with independent draws.
+         *  @remark For engines covering a whole number of bits, and at most 2^32 values, uses multiply-shift range
+         *    reduction with rejection (Lemire, 2019) in a loop the compiler can vectorize; the rare rejected
+         *    draws are redone one by one. Otherwise falls back to \c sample for every element.
+         *  @exception std::runtime_error Rejection sampling exceeded maximum allowed attempts.
+         */
+        void sample(engine_type& uniform_generator, std::span<value_type> values)
+        {
+            if (this->m_reduction_range == 0)
+            {
+                for (value_type& x : values) x = this->sample(uniform_generator);
+                return;
+            } // if (...)
+
+            const std::uint64_t range = this->m_reduction_range;
+            const std::uint64_t threshold = this->m_reduction_threshold;
+            uniform_type uniforms[type::batch_size];
+            for (std::size_t offset = 0; offset < values.size(); offset += type::batch_size)
+            {
+                std::size_t count = values.size() - offset;
+                if (count > type::batch_size) count = type::batch_size;
+                type::generate(uniform_generator, uniforms, count);
+
+                value_type* batch = values.data() + offset;
+                std::size_t count_rejections = 0;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    std::uint64_t product = type::top_bits(uniforms[i]) * range;
+                    batch[i] = this->m_min + static_cast<value_type>(product >> type::reduction_bits);
+                    count_rejections += ((product & type::reduction_mask) < threshold) ? 1 : 0;
+                } // for (...)
+                if (count_rejections == 0) continue;
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    std::uint64_t product = type::top_bits(uniforms[i]) * range;
+                    std::size_t count_attempts = 0; // Prevent infinite loops for "bad" uniform generators.
+                    while ((product & type::reduction_mask) < threshold)
+                    {
+                        ++count_attempts;
+                        if (count_attempts > type::rejection_loop_max)
+                            throw std::runtime_error("Sampler exceeded maximum allowed rejections.");
+                        product = type::top_bits(uniform_generator()) * range;
+                    } // while (...)
+                    batch[i] = this->m_min + static_cast<value_type>(product >> type::reduction_bits);
+                } // for (...)
+            } // for (...)
+        } // sample(...)
+
         value_type operator ()(engine_type& uniform_generator)
         {
             return this->sample(uniform_generator);
         } // operator ()(...)
+
+        void operator ()(engine_type& uniform_generator, std::span<value_type> values)
+        {
+            this->sample(uniform_generator, values);
+        } // operator ()(...)
     }; // struct uniform_int_sampler
 } // namespace ropufu::aftermath::random
 
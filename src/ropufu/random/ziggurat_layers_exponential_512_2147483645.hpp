@@ -0,0 +1,431 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_2147483645_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_2147483645_HPP_INCLUDED
+
+#include "../probability/standard_exponential_distribution.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type, std::size_t t_engine_diameter>
+    struct ziggurat_layers_exponential_512;
+
+    /** @brief Ziggurat with 512 layers for exponential distribution and 2147483645-diameter engines. */
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type>
+    struct ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, 2147483645>
+    {
+        using type = ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, 2147483645>;
+        using uniform_type = t_uniform_type;
+        using value_type = t_value_type;
+        using expectation_type = t_expectation_type;
+
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr std::size_t engine_diameter = 2147483645; // Not a Mersenne number.
+
+        static inline const uniform_type upscaled_low_probabilities[n_boxes] = {
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL)
+        }; // upscaled_low_probabilities[...]
+
+        static inline const uniform_type upscaled_high_probabilities[n_boxes] = {
+            uniform_type(1920997404ULL), uniform_type(1957484207ULL), uniform_type(2020591316ULL), uniform_type(2050324889ULL), uniform_type(2067855710ULL), uniform_type(2079503882ULL), uniform_type(2087846007ULL), uniform_type(2094136833ULL), 
+            uniform_type(2099063227ULL), uniform_type(2103033924ULL), uniform_type(2106307913ULL), uniform_type(2109057553ULL), uniform_type(2111402159ULL), uniform_type(2113427052ULL), uniform_type(2115194921ULL), uniform_type(2116752898ULL), 
+            uniform_type(2118137133ULL), uniform_type(2119375830ULL), uniform_type(2120491333ULL), uniform_type(2121501579ULL), uniform_type(2122421145ULL), uniform_type(2123261999ULL), uniform_type(2124034066ULL), uniform_type(2124745648ULL), 
+            uniform_type(2125403746ULL), uniform_type(2126014305ULL), uniform_type(2126582408ULL), uniform_type(2127112431ULL), uniform_type(2127608156ULL), uniform_type(2128072877ULL), uniform_type(2128509470ULL), uniform_type(2128920463ULL), 
+            uniform_type(2129308084ULL), uniform_type(2129674306ULL), uniform_type(2130020884ULL), uniform_type(2130349380ULL), uniform_type(2130661196ULL), uniform_type(2130957587ULL), uniform_type(2131239684ULL), uniform_type(2131508511ULL), 
+            uniform_type(2131764990ULL), uniform_type(2132009963ULL), uniform_type(2132244191ULL), uniform_type(2132468372ULL), uniform_type(2132683142ULL), uniform_type(2132889084ULL), uniform_type(2133086732ULL), uniform_type(2133276578ULL), 
+            uniform_type(2133459075ULL), uniform_type(2133634640ULL), uniform_type(2133803659ULL), uniform_type(2133966490ULL), uniform_type(2134123464ULL), uniform_type(2134274888ULL), uniform_type(2134421048ULL), uniform_type(2134562211ULL), 
+            uniform_type(2134698624ULL), uniform_type(2134830518ULL), uniform_type(2134958111ULL), uniform_type(2135081605ULL), uniform_type(2135201189ULL), uniform_type(2135317042ULL), uniform_type(2135429329ULL), uniform_type(2135538209ULL), 
+            uniform_type(2135643829ULL), uniform_type(2135746326ULL), uniform_type(2135845834ULL), uniform_type(2135942474ULL), uniform_type(2136036364ULL), uniform_type(2136127613ULL), uniform_type(2136216326ULL), uniform_type(2136302602ULL), 
+            uniform_type(2136386534ULL), uniform_type(2136468210ULL), uniform_type(2136547714ULL), uniform_type(2136625126ULL), uniform_type(2136700522ULL), uniform_type(2136773973ULL), uniform_type(2136845549ULL), uniform_type(2136915314ULL), 
+            uniform_type(2136983330ULL), uniform_type(2137049656ULL), uniform_type(2137114349ULL), uniform_type(2137177463ULL), uniform_type(2137239049ULL), uniform_type(2137299155ULL), uniform_type(2137357829ULL), uniform_type(2137415116ULL), 
+            uniform_type(2137471058ULL), uniform_type(2137525696ULL), uniform_type(2137579070ULL), uniform_type(2137631218ULL), uniform_type(2137682175ULL), uniform_type(2137731975ULL), uniform_type(2137780653ULL), uniform_type(2137828239ULL), 
+            uniform_type(2137874765ULL), uniform_type(2137920260ULL), uniform_type(2137964752ULL), uniform_type(2138008268ULL), uniform_type(2138050834ULL), uniform_type(2138092475ULL), uniform_type(2138133216ULL), uniform_type(2138173079ULL), 
+            uniform_type(2138212087ULL), uniform_type(2138250262ULL), uniform_type(2138287623ULL), uniform_type(2138324192ULL), uniform_type(2138359988ULL), uniform_type(2138395029ULL), uniform_type(2138429332ULL), uniform_type(2138462917ULL), 
+            uniform_type(2138495798ULL), uniform_type(2138527993ULL), uniform_type(2138559516ULL), uniform_type(2138590384ULL), uniform_type(2138620610ULL), uniform_type(2138650209ULL), uniform_type(2138679194ULL), uniform_type(2138707579ULL), 
+            uniform_type(2138735376ULL), uniform_type(2138762597ULL), uniform_type(2138789255ULL), uniform_type(2138815360ULL), uniform_type(2138840925ULL), uniform_type(2138865960ULL), uniform_type(2138890476ULL), uniform_type(2138914482ULL), 
+            uniform_type(2138937989ULL), uniform_type(2138961005ULL), uniform_type(2138983541ULL), uniform_type(2139005606ULL), uniform_type(2139027207ULL), uniform_type(2139048354ULL), uniform_type(2139069055ULL), uniform_type(2139089317ULL), 
+            uniform_type(2139109148ULL), uniform_type(2139128556ULL), uniform_type(2139147549ULL), uniform_type(2139166132ULL), uniform_type(2139184313ULL), uniform_type(2139202099ULL), uniform_type(2139219496ULL), uniform_type(2139236510ULL), 
+            uniform_type(2139253148ULL), uniform_type(2139269415ULL), uniform_type(2139285317ULL), uniform_type(2139300860ULL), uniform_type(2139316048ULL), uniform_type(2139330888ULL), uniform_type(2139345385ULL), uniform_type(2139359543ULL), 
+            uniform_type(2139373367ULL), uniform_type(2139386862ULL), uniform_type(2139400033ULL), uniform_type(2139412884ULL), uniform_type(2139425419ULL), uniform_type(2139437643ULL), uniform_type(2139449559ULL), uniform_type(2139461172ULL), 
+            uniform_type(2139472485ULL), uniform_type(2139483503ULL), uniform_type(2139494228ULL), uniform_type(2139504665ULL), uniform_type(2139514816ULL), uniform_type(2139524686ULL), uniform_type(2139534277ULL), uniform_type(2139543593ULL), 
+            uniform_type(2139552637ULL), uniform_type(2139561411ULL), uniform_type(2139569919ULL), uniform_type(2139578163ULL), uniform_type(2139586146ULL), uniform_type(2139593872ULL), uniform_type(2139601341ULL), uniform_type(2139608558ULL), 
+            uniform_type(2139615524ULL), uniform_type(2139622242ULL), uniform_type(2139628713ULL), uniform_type(2139634941ULL), uniform_type(2139640928ULL), uniform_type(2139646675ULL), uniform_type(2139652185ULL), uniform_type(2139657459ULL), 
+            uniform_type(2139662500ULL), uniform_type(2139667309ULL), uniform_type(2139671888ULL), uniform_type(2139676239ULL), uniform_type(2139680364ULL), uniform_type(2139684264ULL), uniform_type(2139687940ULL), uniform_type(2139691395ULL), 
+            uniform_type(2139694630ULL), uniform_type(2139697646ULL), uniform_type(2139700444ULL), uniform_type(2139703027ULL), uniform_type(2139705394ULL), uniform_type(2139707548ULL), uniform_type(2139709490ULL), uniform_type(2139711220ULL), 
+            uniform_type(2139712740ULL), uniform_type(2139714051ULL), uniform_type(2139715154ULL), uniform_type(2139716049ULL), uniform_type(2139716739ULL), uniform_type(2139717223ULL), uniform_type(2139717502ULL), uniform_type(2139717577ULL), 
+            uniform_type(2139717450ULL), uniform_type(2139717120ULL), uniform_type(2139716588ULL), uniform_type(2139715856ULL), uniform_type(2139714923ULL), uniform_type(2139713790ULL), uniform_type(2139712457ULL), uniform_type(2139710926ULL), 
+            uniform_type(2139709197ULL), uniform_type(2139707269ULL), uniform_type(2139705144ULL), uniform_type(2139702822ULL), uniform_type(2139700302ULL), uniform_type(2139697586ULL), uniform_type(2139694673ULL), uniform_type(2139691564ULL), 
+            uniform_type(2139688259ULL), uniform_type(2139684757ULL), uniform_type(2139681060ULL), uniform_type(2139677167ULL), uniform_type(2139673078ULL), uniform_type(2139668793ULL), uniform_type(2139664312ULL), uniform_type(2139659635ULL), 
+            uniform_type(2139654762ULL), uniform_type(2139649693ULL), uniform_type(2139644428ULL), uniform_type(2139638966ULL), uniform_type(2139633306ULL), uniform_type(2139627450ULL), uniform_type(2139621396ULL), uniform_type(2139615145ULL), 
+            uniform_type(2139608695ULL), uniform_type(2139602046ULL), uniform_type(2139595199ULL), uniform_type(2139588152ULL), uniform_type(2139580905ULL), uniform_type(2139573457ULL), uniform_type(2139565808ULL), uniform_type(2139557957ULL), 
+            uniform_type(2139549904ULL), uniform_type(2139541648ULL), uniform_type(2139533188ULL), uniform_type(2139524523ULL), uniform_type(2139515653ULL), uniform_type(2139506576ULL), uniform_type(2139497293ULL), uniform_type(2139487801ULL), 
+            uniform_type(2139478101ULL), uniform_type(2139468191ULL), uniform_type(2139458069ULL), uniform_type(2139447736ULL), uniform_type(2139437190ULL), uniform_type(2139426430ULL), uniform_type(2139415454ULL), uniform_type(2139404262ULL), 
+            uniform_type(2139392853ULL), uniform_type(2139381224ULL), uniform_type(2139369375ULL), uniform_type(2139357304ULL), uniform_type(2139345010ULL), uniform_type(2139332492ULL), uniform_type(2139319748ULL), uniform_type(2139306777ULL), 
+            uniform_type(2139293576ULL), uniform_type(2139280145ULL), uniform_type(2139266481ULL), uniform_type(2139252584ULL), uniform_type(2139238450ULL), uniform_type(2139224080ULL), uniform_type(2139209470ULL), uniform_type(2139194618ULL), 
+            uniform_type(2139179524ULL), uniform_type(2139164185ULL), uniform_type(2139148598ULL), uniform_type(2139132762ULL), uniform_type(2139116675ULL), uniform_type(2139100334ULL), uniform_type(2139083738ULL), uniform_type(2139066884ULL), 
+            uniform_type(2139049769ULL), uniform_type(2139032391ULL), uniform_type(2139014748ULL), uniform_type(2138996838ULL), uniform_type(2138978657ULL), uniform_type(2138960203ULL), uniform_type(2138941474ULL), uniform_type(2138922466ULL), 
+            uniform_type(2138903177ULL), uniform_type(2138883604ULL), uniform_type(2138863744ULL), uniform_type(2138843593ULL), uniform_type(2138823150ULL), uniform_type(2138802410ULL), uniform_type(2138781371ULL), uniform_type(2138760029ULL), 
+            uniform_type(2138738380ULL), uniform_type(2138716422ULL), uniform_type(2138694151ULL), uniform_type(2138671563ULL), uniform_type(2138648654ULL), uniform_type(2138625421ULL), uniform_type(2138601860ULL), uniform_type(2138577966ULL), 
+            uniform_type(2138553736ULL), uniform_type(2138529166ULL), uniform_type(2138504252ULL), uniform_type(2138478988ULL), uniform_type(2138453371ULL), uniform_type(2138427397ULL), uniform_type(2138401059ULL), uniform_type(2138374355ULL), 
+            uniform_type(2138347278ULL), uniform_type(2138319824ULL), uniform_type(2138291989ULL), uniform_type(2138263765ULL), uniform_type(2138235150ULL), uniform_type(2138206136ULL), uniform_type(2138176718ULL), uniform_type(2138146891ULL), 
+            uniform_type(2138116649ULL), uniform_type(2138085986ULL), uniform_type(2138054896ULL), uniform_type(2138023372ULL), uniform_type(2137991409ULL), uniform_type(2137958999ULL), uniform_type(2137926136ULL), uniform_type(2137892813ULL), 
+            uniform_type(2137859023ULL), uniform_type(2137824759ULL), uniform_type(2137790013ULL), uniform_type(2137754779ULL), uniform_type(2137719047ULL), uniform_type(2137682811ULL), uniform_type(2137646063ULL), uniform_type(2137608793ULL), 
+            uniform_type(2137570993ULL), uniform_type(2137532655ULL), uniform_type(2137493770ULL), uniform_type(2137454328ULL), uniform_type(2137414320ULL), uniform_type(2137373737ULL), uniform_type(2137332569ULL), uniform_type(2137290805ULL), 
+            uniform_type(2137248435ULL), uniform_type(2137205448ULL), uniform_type(2137161834ULL), uniform_type(2137117581ULL), uniform_type(2137072678ULL), uniform_type(2137027112ULL), uniform_type(2136980873ULL), uniform_type(2136933946ULL), 
+            uniform_type(2136886320ULL), uniform_type(2136837981ULL), uniform_type(2136788916ULL), uniform_type(2136739111ULL), uniform_type(2136688551ULL), uniform_type(2136637222ULL), uniform_type(2136585110ULL), uniform_type(2136532197ULL), 
+            uniform_type(2136478469ULL), uniform_type(2136423909ULL), uniform_type(2136368500ULL), uniform_type(2136312225ULL), uniform_type(2136255066ULL), uniform_type(2136197005ULL), uniform_type(2136138023ULL), uniform_type(2136078099ULL), 
+            uniform_type(2136017215ULL), uniform_type(2135955350ULL), uniform_type(2135892482ULL), uniform_type(2135828590ULL), uniform_type(2135763650ULL), uniform_type(2135697640ULL), uniform_type(2135630535ULL), uniform_type(2135562312ULL), 
+            uniform_type(2135492943ULL), uniform_type(2135422404ULL), uniform_type(2135350666ULL), uniform_type(2135277702ULL), uniform_type(2135203483ULL), uniform_type(2135127978ULL), uniform_type(2135051158ULL), uniform_type(2134972989ULL), 
+            uniform_type(2134893439ULL), uniform_type(2134812473ULL), uniform_type(2134730057ULL), uniform_type(2134646154ULL), uniform_type(2134560726ULL), uniform_type(2134473734ULL), uniform_type(2134385137ULL), uniform_type(2134294894ULL), 
+            uniform_type(2134202960ULL), uniform_type(2134109292ULL), uniform_type(2134013842ULL), uniform_type(2133916561ULL), uniform_type(2133817400ULL), uniform_type(2133716307ULL), uniform_type(2133613227ULL), uniform_type(2133508104ULL), 
+            uniform_type(2133400880ULL), uniform_type(2133291494ULL), uniform_type(2133179883ULL), uniform_type(2133065982ULL), uniform_type(2132949723ULL), uniform_type(2132831034ULL), uniform_type(2132709841ULL), uniform_type(2132586069ULL), 
+            uniform_type(2132459636ULL), uniform_type(2132330459ULL), uniform_type(2132198450ULL), uniform_type(2132063520ULL), uniform_type(2131925573ULL), uniform_type(2131784510ULL), uniform_type(2131640227ULL), uniform_type(2131492616ULL), 
+            uniform_type(2131341564ULL), uniform_type(2131186953ULL), uniform_type(2131028658ULL), uniform_type(2130866551ULL), uniform_type(2130700493ULL), uniform_type(2130530344ULL), uniform_type(2130355953ULL), uniform_type(2130177163ULL), 
+            uniform_type(2129993808ULL), uniform_type(2129805717ULL), uniform_type(2129612705ULL), uniform_type(2129414580ULL), uniform_type(2129211142ULL), uniform_type(2129002176ULL), uniform_type(2128787457ULL), uniform_type(2128566749ULL), 
+            uniform_type(2128339800ULL), uniform_type(2128106347ULL), uniform_type(2127866108ULL), uniform_type(2127618788ULL), uniform_type(2127364072ULL), uniform_type(2127101628ULL), uniform_type(2126831102ULL), uniform_type(2126552118ULL), 
+            uniform_type(2126264277ULL), uniform_type(2125967155ULL), uniform_type(2125660298ULL), uniform_type(2125343225ULL), uniform_type(2125015421ULL), uniform_type(2124676334ULL), uniform_type(2124325375ULL), uniform_type(2123961915ULL), 
+            uniform_type(2123585275ULL), uniform_type(2123194731ULL), uniform_type(2122789501ULL), uniform_type(2122368744ULL), uniform_type(2121931554ULL), uniform_type(2121476952ULL), uniform_type(2121003881ULL), uniform_type(2120511194ULL), 
+            uniform_type(2119997650ULL), uniform_type(2119461896ULL), uniform_type(2118902465ULL), uniform_type(2118317753ULL), uniform_type(2117706009ULL), uniform_type(2117065316ULL), uniform_type(2116393572ULL), uniform_type(2115688465ULL), 
+            uniform_type(2114947446ULL), uniform_type(2114167702ULL), uniform_type(2113346116ULL), uniform_type(2112479227ULL), uniform_type(2111563181ULL), uniform_type(2110593672ULL), uniform_type(2109565879ULL), uniform_type(2108474379ULL), 
+            uniform_type(2107313055ULL), uniform_type(2106074983ULL), uniform_type(2104752288ULL), uniform_type(2103335979ULL), uniform_type(2101815747ULL), uniform_type(2100179709ULL), uniform_type(2098414097ULL), uniform_type(2096502873ULL), 
+            uniform_type(2094427236ULL), uniform_type(2092165006ULL), uniform_type(2089689827ULL), uniform_type(2086970137ULL), uniform_type(2083967818ULL), uniform_type(2080636406ULL), uniform_type(2076918676ULL), uniform_type(2072743342ULL), 
+            uniform_type(2068020467ULL), uniform_type(2062634955ULL), uniform_type(2056437117ULL), uniform_type(2049228667ULL), uniform_type(2040741339ULL), uniform_type(2030603168ULL), uniform_type(2018283307ULL), uniform_type(2002997597ULL), 
+            uniform_type(1983538185ULL), uniform_type(1957945403ULL), uniform_type(1922822136ULL), uniform_type(1871741203ULL), uniform_type(1790975927ULL), uniform_type(1645420211ULL), uniform_type(1313749788ULL), uniform_type(0ULL)
+        }; // upscaled_high_probabilities[...]
+
+        static inline const value_type layer_left_endpoints[n_boxes] = {
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L)
+        }; // layer_left_endpoints[...]
+
+        static inline const value_type downscaled_layer_widths[n_boxes] = {
+            value_type(4.4152792433596072979169245e-9L), value_type(3.9496179554013467357043541e-9L), value_type(3.6001739945227929826460737e-9L), value_type(3.3874438707555915805732792e-9L), value_type(3.2341855060543754148598735e-9L), value_type(3.1142630506140230693601609e-9L), value_type(3.0156793602520618543856553e-9L), value_type(2.9319311118373647897786611e-9L), 
+            value_type(2.8590974124100643278309591e-9L), value_type(2.7946318726584812555468439e-9L), value_type(2.7367871445136896119950541e-9L), value_type(2.6843121404455313647741285e-9L), value_type(2.6362802840924026974584538e-9L), value_type(2.5919861584292933292915053e-9L), value_type(2.5508802727840737193399151e-9L), value_type(2.5125262347582227826000567e-9L), 
+            value_type(2.4765716853064285885102500e-9L), value_type(2.4427280093514695421270478e-9L), value_type(2.4107558230670343331409213e-9L), value_type(2.3804543702333023182489300e-9L), value_type(2.3516536285378390208407965e-9L), value_type(2.3242083350041596626260069e-9L), value_type(2.2979933965082869168914222e-9L), value_type(2.2729003170534799412581402e-9L), 
+            value_type(2.2488343829092687776030850e-9L), value_type(2.2257124205074404363972799e-9L), value_type(2.2034609926787564310258686e-9L), value_type(2.1820149342366428353165225e-9L), value_type(2.1613161530543650595230926e-9L), value_type(2.1413126408806179287069268e-9L), value_type(2.1219576513390840885931220e-9L), value_type(2.1032090123027622793056991e-9L), 
+            value_type(2.0850285471091006448098239e-9L), value_type(2.0673815845699099325513981e-9L), value_type(2.0502365419099621690176129e-9L), value_type(2.0335645679807052967293735e-9L), value_type(2.0173392365854653796202366e-9L), value_type(2.0015362816977250583834472e-9L), value_type(1.9861333678850684276078935e-9L), value_type(1.9711098904648334183279410e-9L), 
+            value_type(1.9564468008856449504964234e-9L), value_type(1.9421264536062404079130340e-9L), value_type(1.9281324713706741269919702e-9L), value_type(1.9144496262887203258732311e-9L), value_type(1.9010637345464468342837262e-9L), value_type(1.8879615629134011668842420e-9L), value_type(1.8751307454943851338209153e-9L), value_type(1.8625597094069762978949331e-9L), 
+            value_type(1.8502376082599313929712086e-9L), value_type(1.8381542624696422304291948e-9L), value_type(1.8263001055877071979010391e-9L), value_type(1.8146661359270831568203441e-9L), value_type(1.8032438728709433132783174e-9L), value_type(1.7920253173303231384073185e-9L), value_type(1.7810029158863585080771253e-9L), value_type(1.7701695282124252189882767e-9L), 
+            value_type(1.7595183974224312453159226e-9L), value_type(1.7490431230352544545127931e-9L), value_type(1.7387376362829843978279907e-9L), value_type(1.7285961775231505130352383e-9L), value_type(1.7186132755432772655501471e-9L), value_type(1.7087837285705478549905524e-9L), value_type(1.6991025868206252771994914e-9L), value_type(1.6895651364382291201263220e-9L), 
+            value_type(1.6801668846982830777367119e-9L), value_type(1.6709035463506568348952275e-9L), value_type(1.6617710310040021949723713e-9L), value_type(1.6527654314551612068238819e-9L), value_type(1.6438830128803030775089118e-9L), value_type(1.6351202028124972284593771e-9L), value_type(1.6264735818379978779282263e-9L), value_type(1.6179398749502262545511741e-9L), 
+            value_type(1.6095159435063977158289192e-9L), value_type(1.6011987777370455691887119e-9L), value_type(1.5929854897634215563425571e-9L), value_type(1.5848733070819742862851225e-9L), value_type(1.5768595664788817149259427e-9L), value_type(1.5689417083409945212649501e-9L), value_type(1.5611172713325796136300393e-9L), value_type(1.5533838874099768943719083e-9L), 
+            value_type(1.5457392771487326875845039e-9L), value_type(1.5381812453599804360793461e-9L), value_type(1.5307076769748302024862272e-9L), value_type(1.5233165331773267222050814e-9L), value_type(1.5160058477681619928140748e-9L), value_type(1.5087737237428009341795380e-9L), value_type(1.5016183300690136685196309e-9L), value_type(1.4945378986500197378391622e-9L), 
+            value_type(1.4875307214605507546069618e-9L), value_type(1.4805951478441397991883161e-9L), value_type(1.4737295819608583103634997e-9L), value_type(1.4669324803755531384419566e-9L), value_type(1.4602023497773957505704049e-9L), value_type(1.4535377448222493477971559e-9L), value_type(1.4469372660899941729725541e-9L), value_type(1.4403995581495321916043550e-9L), 
+            value_type(1.4339233077247246591882748e-9L), value_type(1.4275072419550043710839524e-9L), value_type(1.4211501267448526842617452e-9L), value_type(1.4148507651967433522002660e-9L), value_type(1.4086079961225341067429423e-9L), value_type(1.4024206926286357096020324e-9L), value_type(1.3962877607706095464081790e-9L), value_type(1.3902081382731411530890565e-9L), 
+            value_type(1.3841807933116105211960947e-9L), value_type(1.3782047233517325911835294e-9L), value_type(1.3722789540439747901308490e-9L), value_type(1.3664025381696744156836096e-9L), value_type(1.3605745546359785739600904e-9L), value_type(1.3547941075169145740880761e-9L), value_type(1.3490603251380703730250833e-9L), value_type(1.3433723592025239494192842e-9L), 
+            value_type(1.3377293839558083641927846e-9L), value_type(1.3321305953878366492451406e-9L), value_type(1.3265752104698383850089719e-9L), value_type(1.3210624664244786409114397e-9L), value_type(1.3155916200274405529113491e-9L), value_type(1.3101619469388558326164002e-9L), value_type(1.3047727410630635226338679e-9L), value_type(1.2994233139352668635268053e-9L), 
+            value_type(1.2941129941337417054435052e-9L), value_type(1.2888411267163279282610928e-9L), value_type(1.2836070726800082373736878e-9L), value_type(1.2784102084424468541265557e-9L), value_type(1.2732499253444243660097360e-9L), value_type(1.2681256291721646600151217e-9L), value_type(1.2630367396986057256714046e-9L), value_type(1.2579826902427184517442617e-9L), 
+            value_type(1.2529629272460266008583869e-9L), value_type(1.2479769098655271584930205e-9L), value_type(1.2430241095822534283863854e-9L), value_type(1.2381040098247637806403256e-9L), value_type(1.2332161056068770321999647e-9L), value_type(1.2283599031790112187513674e-9L), value_type(1.2235349196925161568104135e-9L), value_type(1.2187406828764218377855130e-9L), 
+            value_type(1.2139767307260544744713348e-9L), value_type(1.2092426112030000574726266e-9L), value_type(1.2045378819459216882586990e-9L), value_type(1.1998621099917618424990923e-9L), value_type(1.1952148715068841800608499e-9L), value_type(1.1905957515277316476227056e-9L), value_type(1.1860043437105985009206959e-9L), value_type(1.1814402500901335848922381e-9L), 
+            value_type(1.1769030808462108246642186e-9L), value_type(1.1723924540788204666076867e-9L), value_type(1.1679079955906512300518860e-9L), value_type(1.1634493386770492458808456e-9L), value_type(1.1590161239230545232888404e-9L), value_type(1.1546079990072297519001991e-9L), value_type(1.1502246185120095612814377e-9L), value_type(1.1458656437403109684212798e-9L), 
+            value_type(1.1415307425381576879041095e-9L), value_type(1.1372195891230822983903668e-9L), value_type(1.1329318639180809892334806e-9L), value_type(1.1286672533909057868327339e-9L), value_type(1.1244254498984888136730963e-9L), value_type(1.1202061515363022939214184e-9L), value_type(1.1160090619924667160175687e-9L), value_type(1.1118338904064278212342190e-9L), 
+            value_type(1.1076803512320309323479273e-9L), value_type(1.1035481641048285915003593e-9L), value_type(1.0994370537134645627352429e-9L), value_type(1.0953467496749839929438422e-9L), value_type(1.0912769864139259341653715e-9L), value_type(1.0872275030450605283340689e-9L), value_type(1.0831980432596389595230388e-9L), value_type(1.0791883552150298043756322e-9L), 
+            value_type(1.0751981914276206736613376e-9L), value_type(1.0712273086688690507839439e-9L), value_type(1.0672754678643910098172197e-9L), value_type(1.0633424339959810486859670e-9L), value_type(1.0594279760064606141623801e-9L), value_type(1.0555318667072570354454764e-9L), value_type(1.0516538826886185326361913e-9L), value_type(1.0477938042323747352186464e-9L), 
+            value_type(1.0439514152271557429573312e-9L), value_type(1.0401265030859861961455600e-9L), value_type(1.0363188586661741021268535e-9L), value_type(1.0325282761914172982315345e-9L), value_type(1.0287545531760534250671016e-9L), value_type(1.0249974903513821454080262e-9L), value_type(1.0212568915939910793021569e-9L), value_type(1.0175325638560195416419925e-9L), 
+            value_type(1.0138243170972966701976664e-9L), value_type(1.0101319642192929255155060e-9L), value_type(1.0064553210008262343941315e-9L), value_type(1.0027942060354662408211924e-9L), value_type(9.9914844067058222698566305e-10L), value_type(9.9551784894798227672193535e-10L), value_type(9.9190225754609317870708604e-10L), value_type(9.8830149572363241091506187e-10L), 
+            value_type(9.8471539526472531501623819e-10L), value_type(9.8114379042542226318660061e-10L), value_type(9.7758651788157224356115643e-10L), value_type(9.7404341667801084755979300e-10L), value_type(9.7051432817902213559437823e-10L), value_type(9.6699909602003529014139922e-10L), value_type(9.6349756606051833959570984e-10L), value_type(9.6000958633803255532989518e-10L), 
+            value_type(9.5653500702341239046092321e-10L), value_type(9.5307368037703704433757754e-10L), value_type(9.4962546070616090395771042e-10L), value_type(9.4619020432327123454167728e-10L), value_type(9.4276776950544256836044188e-10L), value_type(9.3935801645465827557741591e-10L), value_type(9.3596080725907079515167977e-10L), value_type(9.3257600585517295951729638e-10L), 
+            value_type(9.2920347799085376546508175e-10L), value_type(9.2584309118931282699560007e-10L), value_type(9.2249471471380859539572288e-10L), value_type(9.1915821953321624885444424e-10L), value_type(9.1583347828837193994730186e-10L), value_type(9.1252036525918084558867886e-10L), value_type(9.0921875633246719182215052e-10L), value_type(9.0592852897054512627747313e-10L), 
+            value_type(9.0264956218048998540018847e-10L), value_type(8.9938173648409015273516288e-10L), value_type(8.9612493388846032964797207e-10L), value_type(8.9287903785729764187991118e-10L), value_type(8.8964393328276258519068680e-10L), value_type(8.8641950645796737194199894e-10L), value_type(8.8320564505005477866914959e-10L), value_type(8.8000223807385111329185685e-10L), 
+            value_type(8.7680917586607742040826061e-10L), value_type(8.7362635006010352484143326e-10L), value_type(8.7045365356122997797610038e-10L), value_type(8.6729098052248341911366885e-10L), value_type(8.6413822632091129573489417e-10L), value_type(8.6099528753436230281177697e-10L), value_type(8.5786206191873930274644262e-10L), value_type(8.5473844838571187470169871e-10L), 
+            value_type(8.5162434698087601556776314e-10L), value_type(8.4851965886234887510075912e-10L), value_type(8.4542428627978675536689715e-10L), value_type(8.4233813255381494000622791e-10L), value_type(8.3926110205585824244537010e-10L), value_type(8.3619310018836147447404005e-10L), value_type(8.3313403336538933797120306e-10L), value_type(8.3008380899359553342106098e-10L), 
+            value_type(8.2704233545355115957768453e-10L), value_type(8.2400952208142274958441344e-10L), value_type(8.2098527915099055037915337e-10L), value_type(8.1796951785599790465349696e-10L), value_type(8.1496215029282283830207377e-10L), value_type(8.1196308944346319150497680e-10L), value_type(8.0897224915882685862379712e-10L), value_type(8.0598954414231892124154536e-10L), 
+            value_type(8.0301488993371767020744566e-10L), value_type(8.0004820289333171671673114e-10L), value_type(7.9708940018643058950968220e-10L), value_type(7.9413839976794140544927382e-10L), value_type(7.9119512036740438425892039e-10L), value_type(7.8825948147418015528726325e-10L), value_type(7.8533140332290197502281328e-10L), value_type(7.8241080687916613890572608e-10L), 
+            value_type(7.7949761382545402996669574e-10L), value_type(7.7659174654727940014534605e-10L), value_type(7.7369312811955462797612309e-10L), value_type(7.7080168229316983884450919e-10L), value_type(7.6791733348177891136903482e-10L), value_type(7.6504000674878652580667647e-10L), value_type(7.6216962779453053785562564e-10L), value_type(7.5930612294365408397838817e-10L), 
+            value_type(7.5644941913266194252170431e-10L), value_type(7.5359944389765578859375364e-10L), value_type(7.5075612536224308999352125e-10L), value_type(7.4791939222561449658635057e-10L), value_type(7.4508917375078467649238039e-10L), value_type(7.4226539975299164940419949e-10L), value_type(7.3944800058824976037491445e-10L), value_type(7.3663690714205152661114624e-10L), 
+            value_type(7.3383205081821367525559455e-10L), value_type(7.3103336352786277193432624e-10L), value_type(7.2824077767855591805381812e-10L), value_type(7.2545422616353206953646081e-10L), value_type(7.2267364235108960095075087e-10L), value_type(7.1989896007408580688949404e-10L), value_type(7.1713011361955409703752862e-10L), value_type(7.1436703771843470270713505e-10L), 
+            value_type(7.1160966753541477075774845e-10L), value_type(7.0885793865887377580616553e-10L), value_type(7.0611178709093023351953828e-10L), value_type(7.0337114923758574660759731e-10L), value_type(7.0063596189896246093044129e-10L), value_type(6.9790616225963005194776587e-10L), value_type(6.9518168787901840158472596e-10L), value_type(6.9246247668191216250513258e-10L), 
+            value_type(6.8974846694902344078706425e-10L), value_type(6.8703959730763885910819888e-10L), value_type(6.8433580672233729078351481e-10L), value_type(6.8163703448577458036802907e-10L), value_type(6.7894322020953158904977436e-10L), value_type(6.7625430381502192271736092e-10L), value_type(6.7357022552445571739255476e-10L), value_type(6.7089092585185587066785679e-10L), 
+            value_type(6.6821634559412311887477250e-10L), value_type(6.6554642582214636791910701e-10L), value_type(6.6288110787195469104004323e-10L), value_type(6.6022033333590740916077652e-10L), value_type(6.5756404405391866897680929e-10L), value_type(6.5491218210471293044619235e-10L), value_type(6.5226468979710776887230163e-10L), value_type(6.4962150966132038726804432e-10L), 
+            value_type(6.4698258444029422212008916e-10L), value_type(6.4434785708104200998758505e-10L), value_type(6.4171727072600166352188858e-10L), value_type(6.3909076870440128342718251e-10L), value_type(6.3646829452362960753658752e-10L), value_type(6.3384979186060816948927154e-10L), value_type(6.3123520455316140739054636e-10L), value_type(6.2862447659138092724279352e-10L), 
+            value_type(6.2601755210898008676823054e-10L), value_type(6.2341437537463502241690244e-10L), value_type(6.2081489078330819577043936e-10L), value_type(6.1821904284755048511306560e-10L), value_type(6.1562677618877779353822927e-10L), value_type(6.1303803552851808647704211e-10L), value_type(6.1045276567962470885099539e-10L), value_type(6.0787091153745176503585072e-10L), 
+            value_type(6.0529241807098727333770877e-10L), value_type(6.0271723031393973057897333e-10L), value_type(6.0014529335577364151519931e-10L), value_type(5.9757655233268948198815165e-10L), value_type(5.9501095241854347379040989e-10L), value_type(5.9244843881570245298671812e-10L), value_type(5.8988895674582901171024157e-10L), value_type(5.8733245144059198601966370e-10L), 
+            value_type(5.8477886813229724904522488e-10L), value_type(5.8222815204443364913516553e-10L), value_type(5.7968024838212880679191598e-10L), value_type(5.7713510232250935159888306e-10L), value_type(5.7459265900496004080792626e-10L), value_type(5.7205286352127605449286133e-10L), value_type(5.6951566090570260786710639e-10L), value_type(5.6698099612485585918773407e-10L), 
+            value_type(5.6444881406751892127884265e-10L), value_type(5.6191905953430660573964312e-10L), value_type(5.5939167722719234097135480e-10L), value_type(5.5686661173889050785409356e-10L), value_type(5.5434380754208722979909074e-10L), value_type(5.5182320897851243653653714e-10L), value_type(5.4930476024784579289240705e-10L), value_type(5.4678840539644884444803556e-10L), 
+            value_type(5.4427408830591548082347779e-10L), value_type(5.4176175268143255380763544e-10L), value_type(5.3925134203994221106906754e-10L), value_type(5.3674279969809721607988549e-10L), value_type(5.3423606876000022049178318e-10L), value_type(5.3173109210471763579831077e-10L), value_type(5.2922781237355841593823488e-10L), value_type(5.2672617195710771073275872e-10L), 
+            value_type(5.2422611298200498084729866e-10L), value_type(5.2172757729745577741730283e-10L), value_type(5.1923050646146598261277865e-10L), value_type(5.1673484172678688021426897e-10L), value_type(5.1424052402655897664750175e-10L), value_type(5.1174749395964202172113486e-10L), value_type(5.0925569177561818330643969e-10L), value_type(5.0676505735945481008724114e-10L), 
+            value_type(5.0427553021581266990881528e-10L), value_type(5.0178704945298497669395609e-10L), value_type(4.9929955376645191480751482e-10L), value_type(4.9681298142203473447150113e-10L), value_type(4.9432727023863282358798390e-10L), value_type(4.9184235757052645822811215e-10L), value_type(4.8935818028922719408081365e-10L), value_type(4.8687467476485708218007652e-10L), 
+            value_type(4.8439177684703707195924729e-10L), value_type(4.8190942184526410067627842e-10L), value_type(4.7942754450875545791359939e-10L), value_type(4.7694607900573805440286884e-10L), value_type(4.7446495890215921289207033e-10L), value_type(4.7198411713979453199095990e-10L), value_type(4.6950348601372724851299895e-10L), value_type(4.6702299714917233615465071e-10L), 
+            value_type(4.6454258147761732453999672e-10L), value_type(4.6206216921225049856075931e-10L), value_type(4.5958168982264573911535968e-10L), value_type(4.5710107200867178803440903e-10L), value_type(4.5462024367359215707005587e-10L), value_type(4.5213913189632024784872601e-10L), value_type(4.4965766290279250076676277e-10L), value_type(4.4717576203642053963950472e-10L), 
+            value_type(4.4469335372758131872162801e-10L), value_type(4.4221036146210220221870546e-10L), value_type(4.3972670774869570577668978e-10L), value_type(4.3724231408529629624240859e-10L), value_type(4.3475710092424917116407594e-10L), value_type(4.3227098763629831327613200e-10L), value_type(4.2978389247331832705706747e-10L), value_type(4.2729573252973160300585898e-10L), 
+            value_type(4.2480642370254920829761360e-10L), value_type(4.2231588064997055672004856e-10L), value_type(4.1982401674847335196344389e-10L), value_type(4.1733074404832151098218226e-10L), value_type(4.1483597322741474154621905e-10L), value_type(4.1233961354339915215670071e-10L), value_type(4.0984157278395369360617370e-10L), value_type(4.0734175721516234836924795e-10L), 
+            value_type(4.0484007152787677366321186e-10L), value_type(4.0233641878196854139923048e-10L), value_type(3.9983070034836417617535922e-10L), value_type(3.9732281584874984139995596e-10L), value_type(3.9481266309282573144140880e-10L), value_type(3.9230013801298295939264578e-10L), value_type(3.8978513459626794750244037e-10L), value_type(3.8726754481349098900424640e-10L), 
+            value_type(3.8474725854532671062314996e-10L), value_type(3.8222416350524457494508861e-10L), value_type(3.7969814515909726697046729e-10L), value_type(3.7716908664118375034842107e-10L), value_type(3.7463686866659189118916095e-10L), value_type(3.7210136943961275996682060e-10L), value_type(3.6956246455800495697372484e-10L), value_type(3.6702002691287247858062580e-10L), 
+            value_type(3.6447392658390365627006564e-10L), value_type(3.6192403072970145474807028e-10L), value_type(3.5937020347291679569886011e-10L), value_type(3.5681230577987645464220108e-10L), value_type(3.5425019533437532169801945e-10L), value_type(3.5168372640527927028984986e-10L), value_type(3.4911274970755937230463982e-10L), value_type(3.4653711225635054740631390e-10L), 
+            value_type(3.4395665721359773143411979e-10L), value_type(3.4137122372682006497509665e-10L), value_type(3.3878064675948818392995766e-10L), value_type(3.3618475691247115651254975e-10L), value_type(3.3358338023596764109980134e-10L), value_type(3.3097633803129008627921260e-10L), value_type(3.2836344664182086748120280e-10L), value_type(3.2574451723240471723031304e-10L), 
+            value_type(3.2311935555638217017192000e-10L), value_type(3.2048776170940346304193045e-10L), value_type(3.1784952986909079076807507e-10L), value_type(3.1520444801953833475861808e-10L), value_type(3.1255229765955327434617398e-10L), value_type(3.0989285349344619594320596e-10L), value_type(3.0722588310307494402480843e-10L), value_type(3.0455114659973090360708025e-10L), 
+            value_type(3.0186839625432970972947266e-10L), value_type(2.9917737610422802270815189e-10L), value_type(2.9647782153483267364083649e-10L), value_type(2.9376945883399633669062704e-10L), value_type(2.9105200471700283183241945e-10L), value_type(2.8832516581973281794744283e-10L), value_type(2.8558863815736427388500860e-10L), value_type(2.8284210654569866060689064e-10L), 
+            value_type(2.8008524398190942618331159e-10L), value_type(2.7731771098118043549115472e-10L), value_type(2.7453915486533322878898634e-10L), value_type(2.7174920899912825403229949e-10L), value_type(2.6894749196946003064701422e-10L), value_type(2.6613360670214222666903629e-10L), value_type(2.6330713951038730895634175e-10L), value_type(2.6046765906841678423610395e-10L), 
+            value_type(2.5761471530288043482362270e-10L), value_type(2.5474783819390271799200796e-10L), value_type(2.5186653647659561162509026e-10L), value_type(2.4897029623276077115481167e-10L), value_type(2.4605857936122761477094976e-10L), value_type(2.4313082191381145975739231e-10L), value_type(2.4018643228219570407545803e-10L), value_type(2.3722478921910686783396343e-10L), 
+            value_type(2.3424523967491633029409878e-10L), value_type(2.3124709642821411746748092e-10L), value_type(2.2822963548589343651486913e-10L), value_type(2.2519209322478163309751924e-10L), value_type(2.2213366324275899200203025e-10L), value_type(2.1905349288250571701823817e-10L), value_type(2.1595067938536808757727846e-10L), value_type(2.1282426562616340846739980e-10L), 
+            value_type(2.0967323537183541208839755e-10L), value_type(2.0649650799746114556769622e-10L), value_type(2.0329293258186537917254023e-10L), value_type(2.0006128129160356623004195e-10L), value_type(1.9680024194580567974054273e-10L), value_type(1.9350840963466721985249210e-10L), value_type(1.9018427724038427116500118e-10L), value_type(1.8682622467997116631542505e-10L), 
+            value_type(1.8343250665326994771566531e-10L), value_type(1.8000123863473645898398075e-10L), value_type(1.7653038079187805358033478e-10L), value_type(1.7301771944336467590205184e-10L), value_type(1.6946084558163157667236258e-10L), value_type(1.6585712987258364992254114e-10L), value_type(1.6220369340112544778699951e-10L), value_type(1.5849737324515961393054266e-10L), 
+            value_type(1.5473468171784536389859753e-10L), value_type(1.5091175779785612914703618e-10L), value_type(1.4702430884111939176433185e-10L), value_type(1.4306754009333728491782232e-10L), value_type(1.3903606873956743754000213e-10L), value_type(1.3492381814497405519398596e-10L), value_type(1.3072388642330164277386183e-10L), value_type(1.2642838130729278585244124e-10L), 
+            value_type(1.2202821015969947487230745e-10L), value_type(1.1751280932768984138188034e-10L), value_type(1.1286979004029315029474238e-10L), value_type(1.0808446721143390886464392e-10L), value_type(1.0313922028065705887189502e-10L), value_type(9.8012606973284278386834104e-11L), value_type(9.2678102886131758318873624e-11L), value_type(8.7102254951246981089735507e-11L), 
+            value_type(8.1241879438736981411046719e-11L), value_type(7.5039626255264066223492669e-11L), value_type(6.8416582179541855833724311e-11L), value_type(6.1259101541604210329425875e-11L), value_type(5.3393274824748612874153316e-11L), value_type(4.4529358872509546496937488e-11L), value_type(3.4118773030489338023394606e-11L), value_type(2.0872583100596627445784156e-11L)
+        }; // downscaled_layer_widths[...]
+
+        static inline const expectation_type layer_bottom_endpoints[n_boxes] = {
+            expectation_type(0.0000000000000000000000000L), expectation_type(0.00020721783744635918968952929L), expectation_type(0.00043886672775980303183094354L), expectation_type(0.00069300017184409350947051025L), expectation_type(0.00096309309483817841638174844L), expectation_type(0.0012459849125208814143141717L), expectation_type(0.0015397701842404248127078010L), expectation_type(0.0018431594067784276767553902L), 
+            expectation_type(0.0021552146978583792443992555L), expectation_type(0.0024752194002373523990148675L), expectation_type(0.0028026058533448324027609604L), expectation_type(0.0031369119459340503444296509L), expectation_type(0.0034777533118636174564826753L), expectation_type(0.0038248046561578975188500416L), expectation_type(0.0041777867172523927845054373L), expectation_type(0.0045364568697845658281215889L), 
+            expectation_type(0.0049006021685972633758703617L), expectation_type(0.0052700340820601560936192836L), expectation_type(0.0056445844261951472869044867L), expectation_type(0.0060241021723627292634277320L), expectation_type(0.0064084509034165849409015468L), expectation_type(0.0067975067598692365989525599L), expectation_type(0.0071911567622168692829048180L), expectation_type(0.0075892974261199805224021902L), 
+            expectation_type(0.0079918336084884426107355654L), expectation_type(0.0083986775377186407732592002L), expectation_type(0.0088097479923293856474262983L), expectation_type(0.0092249696003227712485253983L), expectation_type(0.0096442722376123975796616083L), expectation_type(0.010067590508397449719034718L), expectation_type(0.010494863293820558615207215L), expectation_type(0.010926033357913685982974413L), 
+            expectation_type(0.011361047001911455796817769L), expectation_type(0.011799853759641138239648867L), expectation_type(0.012242406127989293125973420L), expectation_type(0.012688659327475459816740283L), expectation_type(0.013138571088791836084708046L), expectation_type(0.013592101461838746163612364L), expectation_type(0.014049212644332388394157396L), expectation_type(0.014509868827509569093045615L), 
+            expectation_type(0.014974036056823716800398880L), expectation_type(0.015441682105832872858635777L), expectation_type(0.015912776361735672473558046L), expectation_type(0.016387289721225112386365767L), expectation_type(0.016865194495509726590466495L), expectation_type(0.017346464323503713523688989L), expectation_type(0.017831074092316438840416442L), expectation_type(0.018318999864281503417657497L), 
+            expectation_type(0.018810218809859403511079740L), expectation_type(0.019304709145828318342976050L), expectation_type(0.019802450078246870024404949L), expectation_type(0.020303421749732565003043793L), expectation_type(0.020807605190651494658795091L), expectation_type(0.021314982273859948354198356L), expectation_type(0.021825535672677877722626297L), expectation_type(0.022339248821808484778550035L), 
+            expectation_type(0.022856105880948292448309754L), expectation_type(0.023376091700858487252207259L), expectation_type(0.023899191791691601201911081L), expectation_type(0.024425392293388148345987146L), expectation_type(0.024954679947976012099385863L), expectation_type(0.025487042073621500705808740L), expectation_type(0.026022466540295313520693262L), expectation_type(0.026560941746929416387660229L), 
+            expectation_type(0.027102456599952204687659361L), expectation_type(0.027647000493099505356092916L), expectation_type(0.028194563288408079239539246L), expectation_type(0.028745135298306458197520256L), expectation_type(0.029298707268725296426865482L), expectation_type(0.029855270363156027546257022L), expectation_type(0.030414816147592580855817272L), expectation_type(0.030977336576296294289953749L), 
+            expectation_type(0.031542823978329031340065730L), expectation_type(0.032111271044803920310289630L), expectation_type(0.032682670816807135644104703L), expectation_type(0.033257016673947775859080035L), expectation_type(0.033834302323496198926601846L), expectation_type(0.034414521790074187400164158L), expectation_type(0.034997669405863062050113885L), expectation_type(0.035583739801298370661909311L), 
+            expectation_type(0.036172727896222071510612595L), expectation_type(0.036764628891465229763462176L), expectation_type(0.037359438260836168340074791L), expectation_type(0.037957151743490779230938194L), expectation_type(0.038557765336663321830115544L), expectation_type(0.039161275288737524809950295L), expectation_type(0.039767678092639179407851528L), expectation_type(0.040376970479532675440190285L), 
+            expectation_type(0.040989149412805096554162167L), expectation_type(0.041604212082322566860031506L), expectation_type(0.042222155898944534980996732L), expectation_type(0.042842978489282600779497540L), expectation_type(0.043466677690691340948799646L), expectation_type(0.044093251546479378069574486L), expectation_type(0.044722698301329668850268561L), expectation_type(0.045355016396918665836330456L), 
+            expectation_type(0.045990204467724637187825548L), expectation_type(0.046628261337016015095265350L), expectation_type(0.047269186013011188583601999L), expectation_type(0.047912977685201664079943980L), expectation_type(0.048559635720830990140424853L), expectation_type(0.049209159661522283835794440L), expectation_type(0.049861549220047607939970042L), expectation_type(0.050516804277232832495948089L), 
+            expectation_type(0.051174924878991973602865272L), expectation_type(0.051835911233485338257099112L), expectation_type(0.052499763708396118512492842L), expectation_type(0.053166482828320372680853321L), expectation_type(0.053836069272265607225006867L), expectation_type(0.054508523871253431736272548L), expectation_type(0.055183847606022002162327174L), expectation_type(0.055862041604824195388463864L), 
+            expectation_type(0.056543107141317672414440642L), expectation_type(0.057227045632543188668392889L), expectation_type(0.057913858636987699342258919L), expectation_type(0.058603547852728985835529633L), expectation_type(0.059296115115658697209416015L), expectation_type(0.059991562397780858678353181L), expectation_type(0.060689891805583048244588765L), expectation_type(0.061391105578477583211061243L), 
+            expectation_type(0.062095206087310191040577113L), expectation_type(0.062802195832933764377830835L), expectation_type(0.063512077444844918490391167L), expectation_type(0.064224853679881181356613433L), expectation_type(0.064940527420976752542348233L), expectation_type(0.065659101675974867245205261L), expectation_type(0.066380579576494896799241896L), expectation_type(0.067104964376852406853938459L), 
+            expectation_type(0.067832259453030479676157965L), expectation_type(0.068562468301700687858468936L), expectation_type(0.069295594539292183418362750L), expectation_type(0.070031641901107439089233302L), expectation_type(0.070770614240483247767638554L), expectation_type(0.071512515527995651809111797L), expectation_type(0.072257349850707536359194061L), expectation_type(0.073005121411457680356792496L), 
+            expectation_type(0.073755834528190115430578292L), expectation_type(0.074509493633322696791717874L), expectation_type(0.075266103273153841563040100L), expectation_type(0.076025668107306438921245714L), expectation_type(0.076788192908207983101327313L), expectation_type(0.077553682560606024848886782L), expectation_type(0.078322142061118079426533435L), expectation_type(0.079093576517815169897706547L), 
+            expectation_type(0.079867991149838223230945796L), expectation_type(0.080645391287046573889320823L), expectation_type(0.081425782369697865086979537L), expectation_type(0.082209169948158671895599345L), expectation_type(0.082995559682645202950774699L), expectation_type(0.083784957342993468720072076L), expectation_type(0.084577368808458334224147427L), expectation_type(0.085372800067540902819258425L), 
+            expectation_type(0.086171257217843705219084972L), expectation_type(0.086972746465953194417686113L), expectation_type(0.087777274127349072631915081L), expectation_type(0.088584846626340000865708966L), expectation_type(0.089395470496025265262369935L), expectation_type(0.090209152378281997103438937L), expectation_type(0.091025899023777565180560534L), expectation_type(0.091845717292006780353896920L), 
+            expectation_type(0.092668614151353572458891987L), expectation_type(0.093494596679176819372052069L), expectation_type(0.094323672061920027033391770L), expectation_type(0.095155847595244577583863698L), expectation_type(0.095991130684186280544220423L), expectation_type(0.096829528843334979169424088L), expectation_type(0.097671049697036980790413989L), expectation_type(0.098515700979620096131763505L), 
+            expectation_type(0.099363490535641088297102292L), expectation_type(0.10021442632015534737042901L), expectation_type(0.10106851639900862141563864L), expectation_type(0.10192576894915064909261990L), expectation_type(0.10278619225897055316893402L), expectation_type(0.10364979472865386791313183L), expectation_type(0.10451658487056108673000466L), expectation_type(0.10538657130962762945939228L), 
+            expectation_type(0.10625976278378514152763526L), expectation_type(0.10713616814440404963260639L), expectation_type(0.10801579635675731087698425L), expectation_type(0.10889865650050530425683438L), expectation_type(0.10978475777020182517977123L), expectation_type(0.11067410947582115524449970L), expectation_type(0.11156672104330619087630777L), expectation_type(0.11246260201513762559548690L), 
+            expectation_type(0.11336176205092419171156896L), expectation_type(0.11426421092801397809908396L), expectation_type(0.11516995854212685143321128L), expectation_type(0.11607901490800801885875173L), expectation_type(0.11699139016010278054543090L), expectation_type(0.11790709455325253095843644L), expectation_type(0.11882613846341207795673624L), expectation_type(0.11974853238838835903425005L), 
+            expectation_type(0.12067428694860064415119276L), expectation_type(0.12160341288786232467544408L), expectation_type(0.12253592107418439797695025L), expectation_type(0.12347182250060076720202293L), expectation_type(0.12441112828601548570885785L), expectation_type(0.12535384967607208558034817L), expectation_type(0.12629999804404513955484082L), expectation_type(0.12724958489175421563925044L), 
+            expectation_type(0.12820262185050039360113795L), expectation_type(0.12915912068202552248609016L), expectation_type(0.13011909327949440828300779L), expectation_type(0.13108255166850013087163429L), expectation_type(0.13204950800809269944267263L), expectation_type(0.13301997459183126568991347L), expectation_type(0.13399396384886012424465974L), expectation_type(0.13497148834500874006406689L), 
+            expectation_type(0.13595256078391605280548954L), expectation_type(0.13693719400817931862719016L), expectation_type(0.13792540100052776036048214L), expectation_type(0.13891719488502130760822317L), expectation_type(0.13991258892827471904824763L), expectation_type(0.14091159654070739006657376L), expectation_type(0.14191423127781915982283727L), expectation_type(0.14292050684149244296825123L), 
+            expectation_type(0.14393043708132102250340953L), expectation_type(0.14494403599596585168846691L), expectation_type(0.14596131773453822451077043L), expectation_type(0.14698229659801068598412885L), expectation_type(0.14800698704065606550895466L), expectation_type(0.14903540367151502867300512L), expectation_type(0.15006756125589255522803940L), expectation_type(0.15110347471688376354821771L), 
+            expectation_type(0.15214315913692951467148948L), expectation_type(0.15318662975940224205573449L), expectation_type(0.15423390199022246645741594L), expectation_type(0.15528499139950646887257885L), expectation_type(0.15633991372324560827900528L), expectation_type(0.15739868486501778499529132L), expectation_type(0.15846132089773156483886327L), expectation_type(0.15952783806540349393209862L), 
+            expectation_type(0.16059825278496914898564406L), expectation_type(0.16167258164812848319290917L), expectation_type(0.16275084142322604351206088L), expectation_type(0.16383304905716665110448249L), expectation_type(0.16491922167736715305477293L), expectation_type(0.16600937659374487023049486L), expectation_type(0.16710353130074338326396739L), expectation_type(0.16820170347939631616777347L), 
+            expectation_type(0.16930391099942979504507062L), expectation_type(0.17041017192140427774045253L), expectation_type(0.17152050449889646911266605L), expectation_type(0.17263492718072205591308284L), expectation_type(0.17375345861320001504010071L), expectation_type(0.17487611764245926922677625L), expectation_type(0.17600292331678848502468650L), expectation_type(0.17713389488902982928957591L), 
+            expectation_type(0.17826905181901752227265888L), expectation_type(0.17940841377606204789503266L), expectation_type(0.18055200064148090485168316L), expectation_type(0.18169983251117680587688478L), expectation_type(0.18285192969826425682596886L), expectation_type(0.18400831273574547221176333L), expectation_type(0.18516900237923660950056659L), expectation_type(0.18633401960974533084619178L), 
+            expectation_type(0.18750338563650072804612856L), expectation_type(0.18867712189983667436681864L), expectation_type(0.18985525007412969553194616L), expectation_type(0.19103779207079248162597695L), expectation_type(0.19222477004132419196340975L), expectation_type(0.19341620638041873614183667L), expectation_type(0.19461212372913224656454211L), expectation_type(0.19581254497811099071772305L), 
+            expectation_type(0.19701749327088100545139530L), expectation_type(0.19822699200720077047579679L), expectation_type(0.19944106484647827428203414L), expectation_type(0.20065973571125386276360845L), expectation_type(0.20188302879075029899246692L), expectation_type(0.20311096854449150192898849L), expectation_type(0.20434357970599147236098065L), expectation_type(0.20558088728651495611509148L), 
+            expectation_type(0.20682291657891143760944331L), expectation_type(0.20806969316152410116492666L), expectation_type(0.20932124290217544321242887L), expectation_type(0.21057759196223126567418114L), expectation_type(0.21183876680074482941124498L), expectation_type(0.21310479417868299676985153L), expectation_type(0.21437570116323624398294742L), expectation_type(0.21565151513221447754824825L), 
+            expectation_type(0.21693226377853064377108033L), expectation_type(0.21821797511477417749250641L), expectation_type(0.21950867747787639468647349L), expectation_type(0.22080439953386999417249204L), expectation_type(0.22210517028274489622399200L), expectation_type(0.22341101906340271043130413L), expectation_type(0.22472197555871219187959128L), expectation_type(0.22603806980066811360666031L), 
+            expectation_type(0.22735933217565605449747914L), expectation_type(0.22868579342982567533902803L), expectation_type(0.23001748467457513179218156L), expectation_type(0.23135443739214935163191406L), expectation_type(0.23269668344135498486260387L), expectation_type(0.23404425506339491933523672L), expectation_type(0.23539718488782534138602817L), expectation_type(0.23675550593863841089427310L), 
+            expectation_type(0.23811925164047371313890593L), expectation_type(0.23948845582496174604133116L), expectation_type(0.24086315273720280094501299L), expectation_type(0.24224337704238469813426553L), expectation_type(0.24362916383254294497582632L), expectation_type(0.24502054863346699502358466L), expectation_type(0.24641756741175640081234384L), expectation_type(0.24782025658203077154073385L), 
+            expectation_type(0.24922865301429756957366219L), expectation_type(0.25064279404148190685596300L), expectation_type(0.25206271746712263410419590L), expectation_type(0.25348846157323915222434191L), expectation_type(0.25492006512837351698982885L), expectation_type(0.25635756739581255481663801L), expectation_type(0.25780100814199485970979300L), expectation_type(0.25925042764510769935826348L), 
+            expectation_type(0.26070586670387902216409261L), expectation_type(0.26216736664656992695871813L), expectation_type(0.26363496934017313354943175L), expectation_type(0.26510871719982317532887381L), expectation_type(0.26658865319842422526096591L), expectation_type(0.26807482087650166393245648L), expectation_type(0.26956726435228370334990842L), expectation_type(0.27106602833201959310281729L), 
+            expectation_type(0.27257115812054115675650856L), expectation_type(0.27408269963207463625289676L), expectation_type(0.27560069940131006107091638L), expectation_type(0.27712520459473560733874141L), expectation_type(0.27865626302224467042463901L), expectation_type(0.28019392314902364321200323L), expectation_type(0.28173823410772867175926862L), expectation_type(0.28328924571095995085372526L), 
+            expectation_type(0.28484700846404242461207492L), expectation_type(0.28641157357812207230929281L), expectation_type(0.28798299298358728760904376L), expectation_type(0.28956131934382520093190172L), expectation_type(0.29114660606932315047236147L), expectation_type(0.29273890733212587803648223L), expectation_type(0.29433827808065941212928494L), expectation_type(0.29594477405493300332313403L), 
+            expectation_type(0.29755845180213089667401493L), expectation_type(0.29917936869260616365337864L), expectation_type(0.30080758293628927260591461L), expectation_type(0.30244315359952455305317493L), expectation_type(0.30408614062234820621536981L), expectation_type(0.30573660483622203294900436L), expectation_type(0.30739460798223759198393684L), expectation_type(0.30906021272980606703857916L), 
+            expectation_type(0.31073348269584971230987043L), expectation_type(0.31241448246451136325781794L), expectation_type(0.31410327760739914488860165L), expectation_type(0.31579993470438418431921867L), expectation_type(0.31750452136496983979708750L), expectation_type(0.31921710625025169615489831L), expectation_type(0.32093775909548834860323761L), expectation_type(0.32266655073330380460019709L), 
+            expectation_type(0.32440355311754317919403337L), expectation_type(0.32614883934780424473142152L), expectation_type(0.32790248369466832330063397L), expectation_type(0.32966456162565498200612170L), expectation_type(0.33143514983192600955656097L), expectation_type(0.33321432625576522024791874L), expectation_type(0.33500217011886175094935800L), expectation_type(0.33679876195142569103392020L), 
+            expectation_type(0.33860418362216611739875411L), expectation_type(0.34041851836916290004435471L), expectation_type(0.34224185083166500158769467L), expectation_type(0.34407426708284942024932733L), expectation_type(0.34591585466357642419434828L), expectation_type(0.34776670261717829978895728L), expectation_type(0.34962690152532049179642724L), expectation_type(0.35149654354497575450702967L), 
+            expectation_type(0.35337572244655376431578681L), expectation_type(0.35526453365323057170397710L), expectation_type(0.35716307428152429967820294L), expectation_type(0.35907144318316563259323492L), expectation_type(0.36098974098831389046495108L), expectation_type(0.36291807015017185634639378L), expectation_type(0.36485653499105502555174770L), expectation_type(0.36680524174997358344463652L), 
+            expectation_type(0.36876429863178820168931927L), expectation_type(0.37073381585800368042611623L), expectation_type(0.37271390571926756555174397L), expectation_type(0.37470468262964414663418178L), expectation_type(0.37670626318273770319550292L), expectation_type(0.37871876620974252719251213L), expectation_type(0.38074231283950112042969884L), expectation_type(0.38277702656065606121684556L), 
+            expectation_type(0.38482303328598536972646063L), expectation_type(0.38688046141901579221752382L), expectation_type(0.38894944192301328777941080L), expectation_type(0.39103010839245515602585798L), expectation_type(0.39312259712709371016124095L), expectation_type(0.39522704720872719851383330L), expectation_type(0.39734360058079983211427900L), expectation_type(0.39947240213095931113543499L), 
+            expectation_type(0.40161359977670718591535056L), expectation_type(0.40376734455428476791533011L), expectation_type(0.40593379071094515371047045L), expectation_type(0.40811309580077027490418117L), expectation_type(0.41030542078420077540667807L), expectation_type(0.41251093013145598455070025L), expectation_type(0.41472979193003134306873817L), expectation_type(0.41696217799647139566648225L), 
+            expectation_type(0.41920826399262793938461235L), expectation_type(0.42146822954662516605125994L), expectation_type(0.42374225837876671952552988L), expectation_type(0.42603053843263356893689054L), expectation_type(0.42833326201163654824049795L), expectation_type(0.43065062592130340688133137L), expectation_type(0.43298283161759733979580939L), expectation_type(0.43533008536158230852622130L), 
+            expectation_type(0.43769259838077012833032098L), expectation_type(0.44007058703750538743042911L), expectation_type(0.44246427300476690264154800L), expectation_type(0.44487388344978873035286402L), expectation_type(0.44729965122592988531109996L), expectation_type(0.44974181507325002755930982L), expectation_type(0.45220061982827863095631878L), expectation_type(0.45467631664349773234186001L), 
+            expectation_type(0.45716916321709348450499450L), expectation_type(0.45967942403356962506115284L), expectation_type(0.46220737061585687635016598L), expectation_type(0.46475328178959648310421813L), expectation_type(0.46731744396032387772119532L), expectation_type(0.46990015140433017183296364L), expectation_type(0.47250170657403517695442871L), expectation_type(0.47512242041876636510073921L), 
+            expectation_type(0.47776261272190404508635493L), expectation_type(0.48042261245542455373017341L), expectation_type(0.48310275815295100057055003L), expectation_type(0.48580339830250567914604676L), expectation_type(0.48852489176025035636137275L), expectation_type(0.49126760818660104139079809L), expectation_type(0.49403192850621337295710692L), expectation_type(0.49681824539345440459470336L), 
+            expectation_type(0.49962696378510738059604941L), expectation_type(0.50245850142219927763612023L), expectation_type(0.50531328942299778054289970L), expectation_type(0.50819177288939647207828179L), expectation_type(0.51109441154909604007722778L), expectation_type(0.51402168043619714854671228L), expectation_type(0.51697407061304943368494005L), expectation_type(0.51995208993645330108532474L), 
+            expectation_type(0.52295626387158956536998004L), expectation_type(0.52598713635735960266540401L), expectation_type(0.52904527072715911452495956L), expectation_type(0.53213125068948584785827523L), expectation_type(0.53524568137320025605134223L), expectation_type(0.53838919044272334374677622L), expectation_type(0.54156242928897378075356884L), expectation_type(0.54476607430242363526576371L), 
+            expectation_type(0.54800082823529660720651534L), expectation_type(0.55126742166065345839519588L), expectation_type(0.55456661453691682938459769L), expectation_type(0.55789919788729380254294226L), expectation_type(0.56126599560457330305143078L), expectation_type(0.56466786639292282940574891L), expectation_type(0.56810570585960379657641388L), expectation_type(0.57158044877098877888373312L), 
+            expectation_type(0.57509307148892264933083931L), expectation_type(0.57864459460535288910566046L), expectation_type(0.58223608579529725675673425L), expectation_type(0.58586866291066086580200546L), expectation_type(0.58954349734020830710430056L), expectation_type(0.59326181766419755895303927L), expectation_type(0.59702491363585972300130277L), expectation_type(0.60083414052614396452946629L), 
+            expectation_type(0.60469092387303831958656169L), expectation_type(0.60859676468244174638136309L), expectation_type(0.61255324513414244197781892L), expectation_type(0.61656203485412306714709585L), expectation_type(0.62062489782337269319628126L), expectation_type(0.62474370000389090955128904L), expectation_type(0.62892041777493104248579693L), expectation_type(0.63315714728712708681064736L), 
+            expectation_type(0.63745611485945216315842594L), expectation_type(0.64181968856454734937020250L), expectation_type(0.64625039117256444867978180L), expectation_type(0.65075091465319424303599275L), expectation_type(0.65532413647114914812073059L), expectation_type(0.65997313795348840448192621L), expectation_type(0.66470122505966689103991366L), expectation_type(0.66951195194943155768263933L), 
+            expectation_type(0.67440914782275190543588637L), expectation_type(0.67939694760384629445628723L), expectation_type(0.68447982716328846856933622L), expectation_type(0.68966264392506406806322705L), expectation_type(0.69495068389850889641505205L), expectation_type(0.70034971642068549186625387L), expectation_type(0.70586605820975206403776904L), expectation_type(0.71150664873729443325879048L), 
+            expectation_type(0.71727913945936837770152560L), expectation_type(0.72319200014692332390536441L), expectation_type(0.72925464648993591873678824L), expectation_type(0.73547759440747709659004092L), expectation_type(0.74187264821167249929128092L), expectation_type(0.74845313214526635827628608L), expectation_type(0.75523417813929314431455069L), expectation_type(0.76223308737894139898772102L), 
+            expectation_type(0.76946979014354445397615606L), expectation_type(0.77696743855888550001834253L), expectation_type(0.78475318227282791611785888L), expectation_type(0.79285920086473065534814573L), expectation_type(0.80132410465836278942261877L), expectation_type(0.81019487771676995816279493L), expectation_type(0.81952964234332621205215691L), expectation_type(0.82940171123596302000799357L), 
+            expectation_type(0.83990574028828638442358351L), expectation_type(0.85116747651166736686823054L), expectation_type(0.86336002946253700818118862L), expectation_type(0.87673287837407410881274868L), expectation_type(0.89166820379521830373051201L), expectation_type(0.90880378162845308259058488L), expectation_type(0.92935032978672016308870604L), expectation_type(0.95616620079454265269621639L)
+        }; // layer_bottom_endpoints[...]
+
+        static inline const expectation_type downscaled_layer_heights[n_boxes] = {
+            expectation_type(9.6493325073197095146924525e-14L), expectation_type(1.0786992061746008880147455e-13L), expectation_type(1.1834010688555929730471438e-13L), expectation_type(1.2577181838983686737751066e-13L), expectation_type(1.3173176817498090791393351e-13L), expectation_type(1.3680442801209012159607358e-13L), expectation_type(1.4127661611970174704058768e-13L), expectation_type(1.4531206875848014555839155e-13L), 
+            expectation_type(1.4901380186249248692909699e-13L), expectation_type(1.5245119741411581448672356e-13L), expectation_type(1.5567340564738873327656495e-13L), expectation_type(1.5871662944821501169245200e-13L), expectation_type(1.6160837597172017688049318e-13L), expectation_type(1.6437008119542408233586141e-13L), expectation_type(1.6701880518031747041135278e-13L), expectation_type(1.6956836884906639079375751e-13L), 
+            expectation_type(1.7203014063601528278410797e-13L), expectation_type(1.7441359565510972414656185e-13L), expectation_type(1.7672672248341242967801285e-13L), expectation_type(1.7897632512766153219006927e-13L), expectation_type(1.8116825120344590938712975e-13L), expectation_type(1.8330756709797092957709492e-13L), expectation_type(1.8539869434167971951999299e-13L), expectation_type(1.8744551713149931269133147e-13L), 
+            expectation_type(1.8945146808333348798269183e-13L), expectation_type(1.9141959733562714707757325e-13L), expectation_type(1.9335262876629991801362476e-13L), expectation_type(1.9525300612458277005234655e-13L), expectation_type(1.9712293119003108373992298e-13L), expectation_type(1.9896439556963838771051345e-13L), expectation_type(2.0077920737465144595650584e-13L), expectation_type(2.0256901374341773571148956e-13L), 
+            expectation_type(2.0433531996919233479475384e-13L), expectation_type(2.0607950583398034974303734e-13L), expectation_type(2.0780283962822296174780098e-13L), expectation_type(2.0950649024215328446320396e-13L), expectation_type(2.1119153764121452897226482e-13L), expectation_type(2.1285898198011292912316102e-13L), expectation_type(2.1450975156422236635390939e-13L), expectation_type(2.1614470983044329883744729e-13L), 
+            expectation_type(2.1776466149019545070244137e-13L), expectation_type(2.1937035795343606210433733e-13L), expectation_type(2.2096250213325369134893769e-13L), expectation_type(2.2254175271477525227007138e-13L), expectation_type(2.2410872795913047953503492e-13L), expectation_type(2.2566400910248856248097411e-13L), expectation_type(2.2720814340128051463742595e-13L), expectation_type(2.2874164686730365921936646e-13L), 
+            expectation_type(2.3026500673019785996847961e-13L), expectation_type(2.3177868365956830438580529e-13L), expectation_type(2.3328311377463132141285501e-13L), expectation_type(2.3477871046553635371285788e-13L), expectation_type(2.3626586604735408609049749e-13L), expectation_type(2.3774495326502445536805973e-13L), expectation_type(2.3921632666525246385461436e-13L), expectation_type(2.4068032384936168850762960e-13L), 
+            expectation_type(2.4213726661941344093333247e-13L), expectation_type(2.4358746202843093117192153e-13L), expectation_type(2.4503120334429701515890457e-13L), expectation_type(2.4646877093579157544583632e-13L), expectation_type(2.4790043308827556003243846e-13L), expectation_type(2.4932644675569243503343287e-13L), expectation_type(2.5074705825482683336895318e-13L), expectation_type(2.5216250390711976761021210e-13L), 
+            expectation_type(2.5357301063277744703548383e-13L), expectation_type(2.5497879650141590877928684e-13L), expectation_type(2.5638007124304732853088146e-13L), expectation_type(2.5777703672282832652037545e-13L), expectation_type(2.5916988738264924918277549e-13L), expectation_type(2.6055881065234064195178070e-13L), expectation_type(2.6194398733300408168485837e-13L), expectation_type(2.6332559195473502668374504e-13L), 
+            expectation_type(2.6470379311079175656487919e-13L), expectation_type(2.6607875377007368725039730e-13L), expectation_type(2.6745063156960164647742035e-13L), expectation_type(2.6881957908853972553621514e-13L), expectation_type(2.7018574410516103071989246e-13L), expectation_type(2.7154926983803625193603164e-13L), expectation_type(2.7291029517261288003682342e-13L), expectation_type(2.7426895487425276698825994e-13L), 
+            expectation_type(2.7562537978870533044249607e-13L), expectation_type(2.7697969703091199868607868e-13L), expectation_type(2.7833203016296354185430979e-13L), expectation_type(2.7968249936196491926128246e-13L), expectation_type(2.8103122157850146506459234e-13L), expectation_type(2.8237831068634499328223443e-13L), expectation_type(2.8372387762398815956465947e-13L), expectation_type(2.8506803052854966631044212e-13L), 
+            expectation_type(2.8641087486255119110317566e-13L), expectation_type(2.8775251353402885681358740e-13L), expectation_type(2.8909304701040728927218839e-13L), expectation_type(2.9043257342653250767928695e-13L), expectation_type(2.9177118868723078017892896e-13L), expectation_type(2.9310898656473389844795522e-13L), expectation_type(2.9444605879128685334499763e-13L), expectation_type(2.9578249514723142466358192e-13L), 
+            expectation_type(2.9711838354483854867253336e-13L), expectation_type(2.9845381010814333272216793e-13L), expectation_type(2.9978885924901909850958655e-13L), expectation_type(3.0112361373971072104759752e-13L), expectation_type(3.0245815478203266845815120e-13L), expectation_type(3.0379256207342342957662074e-13L), expectation_type(3.0512691387003534361168381e-13L), expectation_type(3.0646128704702712970704995e-13L), 
+            expectation_type(3.0779575715621557352248912e-13L), expectation_type(3.0913039848123278973504339e-13L), expectation_type(3.1046528409032617725034149e-13L), expectation_type(3.1180048588692955757227480e-13L), expectation_type(3.1313607465812598133462400e-13L), expectation_type(3.1447212012111525350155891e-13L), expectation_type(3.1580869096779231868687367e-13L), expectation_type(3.1714585490753622292512437e-13L), 
+            expectation_type(3.1848367870830338917540237e-13L), expectation_type(3.1982222823611337625159410e-13L), expectation_type(3.2116156849301010312034968e-13L), expectation_type(3.2250176365357668364751734e-13L), expectation_type(3.2384287710007750440267741e-13L), expectation_type(3.2518497145629696576133168e-13L), expectation_type(3.2652810862014037199919048e-13L), expectation_type(3.2787234979505877890672839e-13L), 
+            expectation_type(3.2921775552035616888422057e-13L), expectation_type(3.3056438570043410624453565e-13L), expectation_type(3.3191229963302601367297731e-13L), expectation_type(3.3326155603647038985239904e-13L), expectation_type(3.3461221307606964469199851e-13L), expectation_type(3.3596432838957874998700401e-13L), expectation_type(3.3731795911186557823426994e-13L), expectation_type(3.3867316189878262016729144e-13L), 
+            expectation_type(3.4002999295028772259216506e-13L), expectation_type(3.4138850803284956328215182e-13L), expectation_type(3.4274876250117177067979579e-13L), expectation_type(3.4411081131926789524175960e-13L), expectation_type(3.4547470908091783929429799e-13L), expectation_type(3.4684051002953484662383253e-13L), expectation_type(3.4820826807747073556801652e-13L), expectation_type(3.4957803682478572440340781e-13L), 
+            expectation_type(3.5094986957750794006143980e-13L), expectation_type(3.5232381936540651573727159e-13L), expectation_type(3.5369993895930106522679206e-13L), expectation_type(3.5507828088792926759709916e-13L), expectation_type(3.5645889745439330112312417e-13L), expectation_type(3.5784184075220492663945411e-13L), expectation_type(3.5922716268094813414661080e-13L), expectation_type(3.6061491496157742949388017e-13L), 
+            expectation_type(3.6200514915136904727161583e-13L), expectation_type(3.6339791665854162892063123e-13L), expectation_type(3.6479326875656219892645913e-13L), expectation_type(3.6619125659815260440568084e-13L), expectation_type(3.6759193122901095216367825e-13L), expectation_type(3.6899534360126198030968074e-13L), expectation_type(3.7040154458664973679508424e-13L), expectation_type(3.7181058498948540296172858e-13L), 
+            expectation_type(3.7322251555936259463393549e-13L), expectation_type(3.7463738700365199485790154e-13L), expectation_type(3.7605524999978671958355510e-13L), expectation_type(3.7747615520734938899195619e-13L), expectation_type(3.7890015327997147147958921e-13L), expectation_type(3.8032729487705508328637212e-13L), expectation_type(3.8175763067532706324121326e-13L), expectation_type(3.8319121138023479801405752e-13L), 
+            expectation_type(3.8462808773719294759056574e-13L), expectation_type(3.8606831054268991247181327e-13L), expectation_type(3.8751193065526259245244577e-13L), expectation_type(3.8895899900634771090735138e-13L), expectation_type(3.9040956661101771753128529e-13L), expectation_type(3.9186368457860903568832609e-13L), expectation_type(3.9332140412325018724392431e-13L), expectation_type(3.9478277657429710731919795e-13L), 
+            expectation_type(3.9624785338668275321217640e-13L), expectation_type(3.9771668615118791519812797e-13L), expectation_type(3.9918932660463995150997233e-13L), expectation_type(4.0066582664004599500180096e-13L), expectation_type(4.0214623831666701433612810e-13L), expectation_type(4.0363061387003895755994371e-13L), expectation_type(4.0511900572194706022434838e-13L), expectation_type(4.0661146649035926336145902e-13L), 
+            expectation_type(4.0810804899932455828837134e-13L), expectation_type(4.0960880628884195501189212e-13L), expectation_type(4.1111379162470565863151463e-13L), expectation_type(4.1262305850833193327386071e-13L), expectation_type(4.1413666068657303545074123e-13L), expectation_type(4.1565465216152350804425943e-13L), expectation_type(4.1717708720032404213217026e-13L), expectation_type(4.1870402034496803633727511e-13L), 
+            expectation_type(4.2023550642211591209347741e-13L), expectation_type(4.2177160055292217796020165e-13L), expectation_type(4.2331235816288017669184606e-13L), expectation_type(4.2485783499168939499847694e-13L), expectation_type(4.2640808710315016764914000e-13L), expectation_type(4.2796317089509056461279745e-13L), expectation_type(4.2952314310933021215806243e-13L), expectation_type(4.3108806084168576610635985e-13L), 
+            expectation_type(4.3265798155202272762888482e-13L), expectation_type(4.3423296307435826898051982e-13L), expectation_type(4.3581306362701971826783176e-13L), expectation_type(4.3739834182286333865649382e-13L), expectation_type(4.3898885667955802824767241e-13L), expectation_type(4.4058466762993856211307767e-13L), expectation_type(4.4218583453243299760246367e-13L), expectation_type(4.4379241768156886796104434e-13L), 
+            expectation_type(4.4540447781856279746065992e-13L), expectation_type(4.4702207614199818360787929e-13L), expectation_type(4.4864527431859560850182901e-13L), expectation_type(4.5027413449408066203845102e-13L), expectation_type(4.5190871930415388436675987e-13L), expectation_type(4.5354909188556756377358536e-13L), expectation_type(4.5519531588731415898962657e-13L), expectation_type(4.5684745548193115176094881e-13L), 
+            expectation_type(4.5850557537692717641191258e-13L), expectation_type(4.6016974082633431803946763e-13L), expectation_type(4.6184001764239151993216988e-13L), expectation_type(4.6351647220736409381337184e-13L), expectation_type(4.6519917148550438358571477e-13L), expectation_type(4.6688818303515869442792044e-13L), expectation_type(4.6858357502102566439520229e-13L), expectation_type(4.7028541622657132513728726e-13L), 
+            expectation_type(4.7199377606660617201458538e-13L), expectation_type(4.7370872460002964181062285e-13L), expectation_type(4.7543033254274747846027102e-13L), expectation_type(4.7715867128076755379704362e-13L), expectation_type(4.7889381288347980133299683e-13L), expectation_type(4.8063583011712601659151943e-13L), expectation_type(4.8238479645846537759234143e-13L), expectation_type(4.8414078610864164382112150e-13L), 
+            expectation_type(4.8590387400725810149068884e-13L), expectation_type(4.8767413584666643721119344e-13L), expectation_type(4.8945164808647584143203642e-13L), expectation_type(4.9123648796828876730580267e-13L), expectation_type(4.9302873353066990006624539e-13L), expectation_type(4.9482846362435502672801478e-13L), expectation_type(4.9663575792770663603137412e-13L), expectation_type(4.9845069696242322420362110e-13L), 
+            expectation_type(5.0027336210950943343045214e-13L), expectation_type(5.0210383562551430707250037e-13L), expectation_type(5.0394220065904510877968281e-13L), expectation_type(5.0578854126756432191148869e-13L), expectation_type(5.0764294243447762123558732e-13L), expectation_type(5.0950549008652079092901899e-13L), expectation_type(5.1137627111145375163315070e-13L), expectation_type(5.1325537337607005491171028e-13L), 
+            expectation_type(5.1514288574453040613583258e-13L), expectation_type(5.1703889809702898678584478e-13L), expectation_type(5.1894350134880156464092123e-13L), expectation_type(5.2085678746948460555929630e-13L), expectation_type(5.2277884950283483377846561e-13L), expectation_type(5.2470978158681892914264442e-13L), expectation_type(5.2664967897408329966089956e-13L), expectation_type(5.2859863805281412659278509e-13L), 
+            expectation_type(5.3055675636799814714015487e-13L), expectation_type(5.3252413264309491709795692e-13L), expectation_type(5.3450086680213158280030597e-13L), expectation_type(5.3648705999223148872180477e-13L), expectation_type(5.3848281460658825450308614e-13L), expectation_type(5.4048823430789727332394276e-13L), expectation_type(5.4250342405225691282281651e-13L), expectation_type(5.4452849011355204054966406e-13L), 
+            expectation_type(5.4656354010833284864903958e-13L), expectation_type(5.4860868302120231752802047e-13L), expectation_type(5.5066402923072603611414175e-13L), expectation_type(5.5272969053587848741581338e-13L), expectation_type(5.5480578018304031294586044e-13L), expectation_type(5.5689241289356148866290348e-13L), expectation_type(5.5898970489190577895224939e-13L), expectation_type(5.6109777393439228435765469e-13L), 
+            expectation_type(5.6321673933855036386155415e-13L), expectation_type(5.6534672201310469409295543e-13L), expectation_type(5.6748784448860772654420581e-13L), expectation_type(5.6964023094873732035266158e-13L), expectation_type(5.7180400726227786313202502e-13L), expectation_type(5.7397930101580374643186640e-13L), expectation_type(5.7616624154708463640515101e-13L), expectation_type(5.7836495997923257494788981e-13L), 
+            expectation_type(5.8057558925561156275225007e-13L), expectation_type(5.8279826417553091423064672e-13L), expectation_type(5.8503312143074433600739463e-13L), expectation_type(5.8728029964277736656003368e-13L), expectation_type(5.8953993940110652558965113e-13L), expectation_type(5.9181218330221425881727350e-13L), expectation_type(5.9409717598954452819631593e-13L), expectation_type(5.9639506419438469010183099e-13L), 
+            expectation_type(5.9870599677770012605897064e-13L), expectation_type(6.0103012477294894321166516e-13L), expectation_type(6.0336760142990494626958942e-13L), expectation_type(6.0571858225951800042694215e-13L), expectation_type(6.0808322507984185710160779e-13L), expectation_type(6.1046169006306050274350547e-13L), expectation_type(6.1285413978364511691963165e-13L), expectation_type(6.1526073926767479098488661e-13L), 
+            expectation_type(6.1768165604335526455144993e-13L), expectation_type(6.2011706019277108541310077e-13L), expectation_type(6.2256712440490779138506630e-13L), expectation_type(6.2503202402998195159237691e-13L), expectation_type(6.2751193713511819207956785e-13L), expectation_type(6.3000704456141366831758004e-13L), expectation_type(6.3251752998243183744709123e-13L), expectation_type(6.3504357996416882822538395e-13L), 
+            expectation_type(6.3758538402653720905298699e-13L), expectation_type(6.4014313470641351668213708e-13L), expectation_type(6.4271702762229753291207973e-13L), expectation_type(6.4530726154063298654868009e-13L), expectation_type(6.4791403844384111607906372e-13L), expectation_type(6.5053756360012035796397643e-13L), expectation_type(6.5317804563506732941381836e-13L), expectation_type(6.5583569660517625638464034e-13L), 
+            expectation_type(6.5851073207327606087580587e-13L), expectation_type(6.6120337118596647018137863e-13L), expectation_type(6.6391383675311674848448662e-13L), expectation_type(6.6664235532949298223267250e-13L), expectation_type(6.6938915729858227945161402e-13L), expectation_type(6.7215447695868477413013973e-13L), expectation_type(6.7493855261134696486616217e-13L), expectation_type(6.7774162665221266717918729e-13L), 
+            expectation_type(6.8056394566437072661641804e-13L), expectation_type(6.8340576051428163063547510e-13L), expectation_type(6.8626732645036827716658444e-13L), expectation_type(6.8914890320435941298733372e-13L), expectation_type(6.9205075509547765216650351e-13L), expectation_type(6.9497315113756753078878107e-13L), expectation_type(6.9791636514926275627532137e-13L), expectation_type(7.0088067586729567558185997e-13L), 
+            expectation_type(7.0386636706305602452594823e-13L), expectation_type(7.0687372766251023905684709e-13L), expectation_type(7.0990305186959701750139990e-13L), expectation_type(7.1295463929321943026839687e-13L), expectation_type(7.1602879507795869028107124e-13L), expectation_type(7.1912583003863973421105644e-13L), expectation_type(7.2224606079888403269149693e-13L), expectation_type(7.2538980993379055901944121e-13L), 
+            expectation_type(7.2855740611689161302920793e-13L), expectation_type(7.3174918427153623316695736e-13L), expectation_type(7.3496548572686024943299027e-13L), expectation_type(7.3820665837850864771533636e-13L), expectation_type(7.4147305685428284792397365e-13L), expectation_type(7.4476504268489276098897064e-13L), expectation_type(7.4808298448000110093927645e-13L), expectation_type(7.5142725810975540671971128e-13L), 
+            expectation_type(7.5479824689201159404578632e-13L), expectation_type(7.5819634178546163155341447e-13L), expectation_type(7.6162194158888714016740010e-13L), expectation_type(7.6507545314677037374824004e-13L), expectation_type(7.6855729156150417789773527e-13L), expectation_type(7.7206788041245316908221518e-13L), expectation_type(7.7560765198212955640103085e-13L), expectation_type(7.7917704748975877359534851e-13L), 
+            expectation_type(7.8277651733252243136292339e-13L), expectation_type(7.8640652133477907385120549e-13L), expectation_type(7.9006752900557686464570047e-13L), expectation_type(7.9376001980478667527585660e-13L), expectation_type(7.9748448341819914433425442e-13L), expectation_type(8.0124142004194516151451600e-13L), expectation_type(8.0503134067661595483744825e-13L), expectation_type(8.0885476743147657072669969e-13L), 
+            expectation_type(8.1271223383918508836333864e-13L), expectation_type(8.1660428518144945835545666e-13L), expectation_type(8.2053147882607446143681105e-13L), expectation_type(8.2449438457587300993822728e-13L), expectation_type(8.2849358502993893178533041e-13L), expectation_type(8.3252967595780255706639445e-13L), expectation_type(8.3660326668701594910735624e-13L), expectation_type(8.4071498050474156921177223e-13L), 
+            expectation_type(8.4486545507394662630857593e-13L), expectation_type(8.4905534286483543549406621e-13L), expectation_type(8.5328531160218389539011451e-13L), expectation_type(8.5755604472927380316367762e-13L), expectation_type(8.6186824188916027558803685e-13L), expectation_type(8.6622261942404316074312094e-13L), expectation_type(8.7061991089355314303333672e-13L), expectation_type(8.7506086761280540916861729e-13L), 
+            expectation_type(8.7954625921111841025932044e-13L), expectation_type(8.8407687421234259235806190e-13L), expectation_type(8.8865352063779415420506275e-13L), expectation_type(8.9327702663284211960373733e-13L), expectation_type(8.9794824111825349032760638e-13L), expectation_type(9.0266803446746119705787753e-13L), expectation_type(9.0743729921098323097534992e-13L), expectation_type(9.1225695076928897620673422e-13L), 
+            expectation_type(9.1712792821548065237859365e-13L), expectation_type(9.2205119506923421790610782e-13L), expectation_type(9.2702774012352540288511057e-13L), expectation_type(9.3205857830575308587327838e-13L), expectation_type(9.3714475157496437976793265e-13L), expectation_type(9.4228732985698395723368084e-13L), expectation_type(9.4748741201935476772710327e-13L), expectation_type(9.5274612688810885431216811e-13L), 
+            expectation_type(9.5806463430850598681192035e-13L), expectation_type(9.6344412625200484909256973e-13L), expectation_type(9.6888582797186716010923166e-13L), expectation_type(9.7439099920994002977981714e-13L), expectation_type(9.7996093545731676694206070e-13L), expectation_type(9.8559696927174204413822147e-13L), expectation_type(9.9130047165480462653581644e-13L), expectation_type(9.9707285349215070735291301e-13L), 
+            expectation_type(1.0029155670601542578823959e-12L), expectation_type(1.0088301076026987833662118e-12L), expectation_type(1.0148180149819586606028482e-12L), expectation_type(1.0208808754073191102216258e-12L), expectation_type(1.0270203232468432345253928e-12L), expectation_type(1.0332380429259839685707696e-12L), expectation_type(1.0395357709185499281155531e-12L), expectation_type(1.0459152978352688307109793e-12L), 
+            expectation_type(1.0523784706156524263762613e-12L), expectation_type(1.0589271948292549041834252e-12L), expectation_type(1.0655634370928349544476551e-12L), expectation_type(1.0722892276103827107877259e-12L), expectation_type(1.0791066628434595788660453e-12L), expectation_type(1.0860179083198246729734807e-12L), expectation_type(1.0930252015888897400249629e-12L), expectation_type(1.1001308553331589187025824e-12L), 
+            expectation_type(1.1073372606454747179730579e-12L), expectation_type(1.1146468904826118995280571e-12L), expectation_type(1.1220623033065416949035803e-12L), expectation_type(1.1295861469255357044807383e-12L), expectation_type(1.1372211625481982416726910e-12L), expectation_type(1.1449701890645148065884164e-12L), expectation_type(1.1528361675690905601943370e-12L), expectation_type(1.1608221461429347291417866e-12L), 
+            expectation_type(1.1689312849114343574702005e-12L), expectation_type(1.1771668613975643521201977e-12L), expectation_type(1.1855322761909121566567986e-12L), expectation_type(1.1940310589547677868239058e-12L), expectation_type(1.2026668747953580395106182e-12L), expectation_type(1.2114435310193038147515566e-12L), expectation_type(1.2203649843075699635004675e-12L), expectation_type(1.2294353483365783610499693e-12L), 
+            expectation_type(1.2386589018797899361037883e-12L), expectation_type(1.2480400974259558751501573e-12L), expectation_type(1.2575835703534210503832377e-12L), expectation_type(1.2672941487033663603645247e-12L), expectation_type(1.2771768635987376888382954e-12L), expectation_type(1.2872369603598688018454421e-12L), expectation_type(1.2974799103725102584408434e-12L), expectation_type(1.3079114237691789272490857e-12L), 
+            expectation_type(1.3185374629905025609966022e-12L), expectation_type(1.3293642572996186458870434e-12L), expectation_type(1.3403983183297731403128276e-12L), expectation_type(1.3516464567531400216768543e-12L), expectation_type(1.3631158001676461985276266e-12L), expectation_type(1.3748138123083517770994570e-12L), expectation_type(1.3867483137008325855653670e-12L), expectation_type(1.3989275038861887512327485e-12L), 
+            expectation_type(1.4113599853609303252337337e-12L), expectation_type(1.4240547893902641850180637e-12L), expectation_type(1.4370214038704510521735185e-12L), expectation_type(1.4502698034351773575751705e-12L), expectation_type(1.4638104820225942607511636e-12L), expectation_type(1.4776544881441632617381924e-12L), expectation_type(1.4918134631241182338293752e-12L), expectation_type(1.5062996826096768437794710e-12L), 
+            expectation_type(1.5211261016876574110908027e-12L), expectation_type(1.5363064039835195063391522e-12L), expectation_type(1.5518550551647964510316801e-12L), expectation_type(1.5677873613233038189161726e-12L), expectation_type(1.5841195327704236622105352e-12L), expectation_type(1.6008687538483987712348648e-12L), expectation_type(1.6180532594393669095064216e-12L), expectation_type(1.6356924189445319138186931e-12L), 
+            expectation_type(1.6538068286104408375231863e-12L), expectation_type(1.6724184132002400656577746e-12L), expectation_type(1.6915505381479210498346819e-12L), expectation_type(1.7112281334964212508799351e-12L), expectation_type(1.7314778311102117142031636e-12L), expectation_type(1.7523281168747453013843537e-12L), expectation_type(1.7738094998549996073024893e-12L), expectation_type(1.7959547006907962072490665e-12L), 
+            expectation_type(1.8187988618667346334092353e-12L), expectation_type(1.8423797829206264322706072e-12L), expectation_type(1.8667381841600126222506930e-12L), expectation_type(1.8919180030587036434381864e-12L), expectation_type(1.9179667282254046479631167e-12L), expectation_type(1.9449357767007035504141854e-12L), expectation_type(1.9728809213799830009184671e-12L), expectation_type(2.0018627766196917172696665e-12L), 
+            expectation_type(2.0319473516154234607810324e-12L), expectation_type(2.0632066830092665546606753e-12L), expectation_type(2.0957195604764637712577080e-12L), expectation_type(2.1295723618676989201181277e-12L), expectation_type(2.1648600179859606619707779e-12L), expectation_type(2.2016871314419191108612369e-12L), expectation_type(2.2401692795032516500146264e-12L), expectation_type(2.2804345377542317688976122e-12L), 
+            expectation_type(2.3226252701423432821537755e-12L), expectation_type(2.3669002421865588238503167e-12L), expectation_type(2.4134371285400869695055741e-12L), expectation_type(2.4624355048090847517607051e-12L), expectation_type(2.5141204380052894191898808e-12L), expectation_type(2.5687468223147153102137695e-12L), expectation_type(2.6266046499005440486236827e-12L), expectation_type(2.6880254643680624830719552e-12L), 
+            expectation_type(2.7533903232846023392363555e-12L), expectation_type(2.8231397045226832595616004e-12L), expectation_type(2.8977859421794003247240941e-12L), expectation_type(2.9779289910240050751306201e-12L), expectation_type(3.0642766239059571440904540e-12L), expectation_type(3.1576706112827164456773363e-12L), expectation_type(3.2591210908375764012723509e-12L), expectation_type(3.3698523299361634898202175e-12L), 
+            expectation_type(3.4913646177459228296877044e-12L), expectation_type(3.6255194455473564733557490e-12L), expectation_type(3.7746590577190352619830334e-12L), expectation_type(3.9417780029855054260369185e-12L), expectation_type(4.1307756075633203437859721e-12L), expectation_type(4.3468385187893963631848669e-12L), expectation_type(4.5970403153579351035461147e-12L), expectation_type(4.8913196972558849991101732e-12L), 
+            expectation_type(5.2441545944257854614054734e-12L), expectation_type(5.6775999106012475885273042e-12L), expectation_type(6.2272180478175891446940742e-12L), expectation_type(6.9548028716857561528778616e-12L), expectation_type(7.9793752437331269454547449e-12L), expectation_type(9.5677320784750751841563660e-12L), expectation_type(1.2487113031225199206353141e-11L), expectation_type(2.0411703394117046839620338e-11L)
+        }; // downscaled_layer_heights[...]
+
+    }; // struct ziggurat_layers_exponential_512<...>
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_2147483645_HPP_INCLUDED
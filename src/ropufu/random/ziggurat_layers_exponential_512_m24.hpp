@@ -0,0 +1,431 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M24_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M24_HPP_INCLUDED
+
+#include "../arithmetic.hpp"
+#include "../probability/standard_exponential_distribution.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type, std::size_t t_engine_diameter>
+    struct ziggurat_layers_exponential_512;
+
+    /** @brief Ziggurat with 512 layers for exponential distribution and full 24-bit engines. */
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type>
+    struct ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(24ULL)>
+    {
+        using type = ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(24ULL)>;
+        using uniform_type = t_uniform_type;
+        using value_type = t_value_type;
+        using expectation_type = t_expectation_type;
+
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr std::size_t engine_diameter = aftermath::mersenne_number(24ULL); // 16777215.
+
+        static inline const uniform_type upscaled_low_probabilities[n_boxes] = {
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL)
+        }; // upscaled_low_probabilities[...]
+
+        static inline const uniform_type upscaled_high_probabilities[n_boxes] = {
+            uniform_type(15007791ULL), uniform_type(15292844ULL), uniform_type(15785869ULL), uniform_type(16018162ULL), uniform_type(16155122ULL), uniform_type(16246123ULL), uniform_type(16311296ULL), uniform_type(16360443ULL), 
+            uniform_type(16398931ULL), uniform_type(16429952ULL), uniform_type(16455530ULL), uniform_type(16477011ULL), uniform_type(16495328ULL), uniform_type(16511148ULL), uniform_type(16524959ULL), uniform_type(16537131ULL), 
+            uniform_type(16547945ULL), uniform_type(16557623ULL), uniform_type(16566338ULL), uniform_type(16574230ULL), uniform_type(16581414ULL), uniform_type(16587983ULL), uniform_type(16594015ULL), uniform_type(16599574ULL), 
+            uniform_type(16604716ULL), uniform_type(16609486ULL), uniform_type(16613924ULL), uniform_type(16618065ULL), uniform_type(16621938ULL), uniform_type(16625568ULL), uniform_type(16628979ULL), uniform_type(16632190ULL), 
+            uniform_type(16635218ULL), uniform_type(16638080ULL), uniform_type(16640787ULL), uniform_type(16643354ULL), uniform_type(16645790ULL), uniform_type(16648105ULL), uniform_type(16650309ULL), uniform_type(16652409ULL), 
+            uniform_type(16654413ULL), uniform_type(16656327ULL), uniform_type(16658157ULL), uniform_type(16659908ULL), uniform_type(16661586ULL), uniform_type(16663195ULL), uniform_type(16664739ULL), uniform_type(16666222ULL), 
+            uniform_type(16667648ULL), uniform_type(16669020ULL), uniform_type(16670340ULL), uniform_type(16671612ULL), uniform_type(16672839ULL), uniform_type(16674022ULL), uniform_type(16675163ULL), uniform_type(16676266ULL), 
+            uniform_type(16677332ULL), uniform_type(16678362ULL), uniform_type(16679359ULL), uniform_type(16680324ULL), uniform_type(16681258ULL), uniform_type(16682163ULL), uniform_type(16683041ULL), uniform_type(16683891ULL), 
+            uniform_type(16684716ULL), uniform_type(16685517ULL), uniform_type(16686295ULL), uniform_type(16687050ULL), uniform_type(16687783ULL), uniform_type(16688496ULL), uniform_type(16689189ULL), uniform_type(16689863ULL), 
+            uniform_type(16690519ULL), uniform_type(16691157ULL), uniform_type(16691778ULL), uniform_type(16692383ULL), uniform_type(16692972ULL), uniform_type(16693546ULL), uniform_type(16694105ULL), uniform_type(16694650ULL), 
+            uniform_type(16695181ULL), uniform_type(16695699ULL), uniform_type(16696205ULL), uniform_type(16696698ULL), uniform_type(16697179ULL), uniform_type(16697649ULL), uniform_type(16698107ULL), uniform_type(16698555ULL), 
+            uniform_type(16698992ULL), uniform_type(16699419ULL), uniform_type(16699836ULL), uniform_type(16700243ULL), uniform_type(16700641ULL), uniform_type(16701030ULL), uniform_type(16701410ULL), uniform_type(16701782ULL), 
+            uniform_type(16702146ULL), uniform_type(16702501ULL), uniform_type(16702849ULL), uniform_type(16703189ULL), uniform_type(16703521ULL), uniform_type(16703846ULL), uniform_type(16704165ULL), uniform_type(16704476ULL), 
+            uniform_type(16704781ULL), uniform_type(16705079ULL), uniform_type(16705371ULL), uniform_type(16705657ULL), uniform_type(16705936ULL), uniform_type(16706210ULL), uniform_type(16706478ULL), uniform_type(16706741ULL), 
+            uniform_type(16706997ULL), uniform_type(16707249ULL), uniform_type(16707495ULL), uniform_type(16707736ULL), uniform_type(16707973ULL), uniform_type(16708204ULL), uniform_type(16708430ULL), uniform_type(16708652ULL), 
+            uniform_type(16708869ULL), uniform_type(16709082ULL), uniform_type(16709290ULL), uniform_type(16709494ULL), uniform_type(16709694ULL), uniform_type(16709889ULL), uniform_type(16710081ULL), uniform_type(16710268ULL), 
+            uniform_type(16710452ULL), uniform_type(16710632ULL), uniform_type(16710808ULL), uniform_type(16710980ULL), uniform_type(16711149ULL), uniform_type(16711314ULL), uniform_type(16711476ULL), uniform_type(16711634ULL), 
+            uniform_type(16711789ULL), uniform_type(16711941ULL), uniform_type(16712089ULL), uniform_type(16712234ULL), uniform_type(16712376ULL), uniform_type(16712515ULL), uniform_type(16712651ULL), uniform_type(16712784ULL), 
+            uniform_type(16712914ULL), uniform_type(16713041ULL), uniform_type(16713166ULL), uniform_type(16713287ULL), uniform_type(16713406ULL), uniform_type(16713522ULL), uniform_type(16713635ULL), uniform_type(16713745ULL), 
+            uniform_type(16713853ULL), uniform_type(16713959ULL), uniform_type(16714062ULL), uniform_type(16714162ULL), uniform_type(16714260ULL), uniform_type(16714356ULL), uniform_type(16714449ULL), uniform_type(16714539ULL), 
+            uniform_type(16714628ULL), uniform_type(16714714ULL), uniform_type(16714798ULL), uniform_type(16714879ULL), uniform_type(16714959ULL), uniform_type(16715036ULL), uniform_type(16715111ULL), uniform_type(16715183ULL), 
+            uniform_type(16715254ULL), uniform_type(16715323ULL), uniform_type(16715389ULL), uniform_type(16715453ULL), uniform_type(16715516ULL), uniform_type(16715576ULL), uniform_type(16715635ULL), uniform_type(16715691ULL), 
+            uniform_type(16715745ULL), uniform_type(16715798ULL), uniform_type(16715848ULL), uniform_type(16715897ULL), uniform_type(16715944ULL), uniform_type(16715989ULL), uniform_type(16716032ULL), uniform_type(16716073ULL), 
+            uniform_type(16716112ULL), uniform_type(16716150ULL), uniform_type(16716186ULL), uniform_type(16716220ULL), uniform_type(16716252ULL), uniform_type(16716282ULL), uniform_type(16716311ULL), uniform_type(16716338ULL), 
+            uniform_type(16716363ULL), uniform_type(16716387ULL), uniform_type(16716409ULL), uniform_type(16716429ULL), uniform_type(16716447ULL), uniform_type(16716464ULL), uniform_type(16716479ULL), uniform_type(16716493ULL), 
+            uniform_type(16716505ULL), uniform_type(16716515ULL), uniform_type(16716524ULL), uniform_type(16716531ULL), uniform_type(16716536ULL), uniform_type(16716540ULL), uniform_type(16716542ULL), uniform_type(16716543ULL), 
+            uniform_type(16716542ULL), uniform_type(16716539ULL), uniform_type(16716535ULL), uniform_type(16716529ULL), uniform_type(16716522ULL), uniform_type(16716513ULL), uniform_type(16716503ULL), uniform_type(16716491ULL), 
+            uniform_type(16716477ULL), uniform_type(16716462ULL), uniform_type(16716445ULL), uniform_type(16716427ULL), uniform_type(16716408ULL), uniform_type(16716386ULL), uniform_type(16716364ULL), uniform_type(16716339ULL), 
+            uniform_type(16716314ULL), uniform_type(16716286ULL), uniform_type(16716257ULL), uniform_type(16716227ULL), uniform_type(16716195ULL), uniform_type(16716161ULL), uniform_type(16716126ULL), uniform_type(16716090ULL), 
+            uniform_type(16716052ULL), uniform_type(16716012ULL), uniform_type(16715971ULL), uniform_type(16715928ULL), uniform_type(16715884ULL), uniform_type(16715838ULL), uniform_type(16715791ULL), uniform_type(16715742ULL), 
+            uniform_type(16715692ULL), uniform_type(16715640ULL), uniform_type(16715587ULL), uniform_type(16715531ULL), uniform_type(16715475ULL), uniform_type(16715417ULL), uniform_type(16715357ULL), uniform_type(16715296ULL), 
+            uniform_type(16715233ULL), uniform_type(16715168ULL), uniform_type(16715102ULL), uniform_type(16715034ULL), uniform_type(16714965ULL), uniform_type(16714894ULL), uniform_type(16714822ULL), uniform_type(16714747ULL), 
+            uniform_type(16714672ULL), uniform_type(16714594ULL), uniform_type(16714515ULL), uniform_type(16714434ULL), uniform_type(16714352ULL), uniform_type(16714268ULL), uniform_type(16714182ULL), uniform_type(16714095ULL), 
+            uniform_type(16714006ULL), uniform_type(16713915ULL), uniform_type(16713822ULL), uniform_type(16713728ULL), uniform_type(16713632ULL), uniform_type(16713534ULL), uniform_type(16713435ULL), uniform_type(16713333ULL), 
+            uniform_type(16713230ULL), uniform_type(16713125ULL), uniform_type(16713018ULL), uniform_type(16712910ULL), uniform_type(16712799ULL), uniform_type(16712687ULL), uniform_type(16712573ULL), uniform_type(16712457ULL), 
+            uniform_type(16712339ULL), uniform_type(16712219ULL), uniform_type(16712097ULL), uniform_type(16711974ULL), uniform_type(16711848ULL), uniform_type(16711720ULL), uniform_type(16711591ULL), uniform_type(16711459ULL), 
+            uniform_type(16711325ULL), uniform_type(16711190ULL), uniform_type(16711052ULL), uniform_type(16710912ULL), uniform_type(16710770ULL), uniform_type(16710626ULL), uniform_type(16710479ULL), uniform_type(16710331ULL), 
+            uniform_type(16710180ULL), uniform_type(16710027ULL), uniform_type(16709872ULL), uniform_type(16709715ULL), uniform_type(16709555ULL), uniform_type(16709393ULL), uniform_type(16709228ULL), uniform_type(16709062ULL), 
+            uniform_type(16708893ULL), uniform_type(16708721ULL), uniform_type(16708547ULL), uniform_type(16708371ULL), uniform_type(16708192ULL), uniform_type(16708010ULL), uniform_type(16707826ULL), uniform_type(16707639ULL), 
+            uniform_type(16707450ULL), uniform_type(16707258ULL), uniform_type(16707063ULL), uniform_type(16706866ULL), uniform_type(16706666ULL), uniform_type(16706463ULL), uniform_type(16706257ULL), uniform_type(16706049ULL), 
+            uniform_type(16705837ULL), uniform_type(16705623ULL), uniform_type(16705405ULL), uniform_type(16705185ULL), uniform_type(16704961ULL), uniform_type(16704734ULL), uniform_type(16704505ULL), uniform_type(16704272ULL), 
+            uniform_type(16704035ULL), uniform_type(16703796ULL), uniform_type(16703553ULL), uniform_type(16703307ULL), uniform_type(16703057ULL), uniform_type(16702804ULL), uniform_type(16702547ULL), uniform_type(16702287ULL), 
+            uniform_type(16702023ULL), uniform_type(16701755ULL), uniform_type(16701484ULL), uniform_type(16701208ULL), uniform_type(16700929ULL), uniform_type(16700646ULL), uniform_type(16700359ULL), uniform_type(16700068ULL), 
+            uniform_type(16699772ULL), uniform_type(16699473ULL), uniform_type(16699169ULL), uniform_type(16698861ULL), uniform_type(16698548ULL), uniform_type(16698231ULL), uniform_type(16697910ULL), uniform_type(16697583ULL), 
+            uniform_type(16697252ULL), uniform_type(16696917ULL), uniform_type(16696576ULL), uniform_type(16696230ULL), uniform_type(16695879ULL), uniform_type(16695523ULL), uniform_type(16695162ULL), uniform_type(16694795ULL), 
+            uniform_type(16694423ULL), uniform_type(16694046ULL), uniform_type(16693662ULL), uniform_type(16693273ULL), uniform_type(16692878ULL), uniform_type(16692477ULL), uniform_type(16692070ULL), uniform_type(16691657ULL), 
+            uniform_type(16691237ULL), uniform_type(16690811ULL), uniform_type(16690378ULL), uniform_type(16689938ULL), uniform_type(16689492ULL), uniform_type(16689038ULL), uniform_type(16688577ULL), uniform_type(16688109ULL), 
+            uniform_type(16687634ULL), uniform_type(16687150ULL), uniform_type(16686659ULL), uniform_type(16686160ULL), uniform_type(16685653ULL), uniform_type(16685137ULL), uniform_type(16684613ULL), uniform_type(16684080ULL), 
+            uniform_type(16683538ULL), uniform_type(16682987ULL), uniform_type(16682426ULL), uniform_type(16681856ULL), uniform_type(16681276ULL), uniform_type(16680686ULL), uniform_type(16680086ULL), uniform_type(16679476ULL), 
+            uniform_type(16678854ULL), uniform_type(16678221ULL), uniform_type(16677578ULL), uniform_type(16676922ULL), uniform_type(16676255ULL), uniform_type(16675575ULL), uniform_type(16674883ULL), uniform_type(16674178ULL), 
+            uniform_type(16673460ULL), uniform_type(16672728ULL), uniform_type(16671982ULL), uniform_type(16671222ULL), uniform_type(16670447ULL), uniform_type(16669658ULL), uniform_type(16668852ULL), uniform_type(16668031ULL), 
+            uniform_type(16667193ULL), uniform_type(16666339ULL), uniform_type(16665467ULL), uniform_type(16664577ULL), uniform_type(16663669ULL), uniform_type(16662741ULL), uniform_type(16661795ULL), uniform_type(16660828ULL), 
+            uniform_type(16659840ULL), uniform_type(16658831ULL), uniform_type(16657799ULL), uniform_type(16656745ULL), uniform_type(16655668ULL), uniform_type(16654566ULL), uniform_type(16653438ULL), uniform_type(16652285ULL), 
+            uniform_type(16651105ULL), uniform_type(16649897ULL), uniform_type(16648660ULL), uniform_type(16647394ULL), uniform_type(16646097ULL), uniform_type(16644767ULL), uniform_type(16643405ULL), uniform_type(16642008ULL), 
+            uniform_type(16640576ULL), uniform_type(16639106ULL), uniform_type(16637598ULL), uniform_type(16636050ULL), uniform_type(16634461ULL), uniform_type(16632829ULL), uniform_type(16631151ULL), uniform_type(16629427ULL), 
+            uniform_type(16627654ULL), uniform_type(16625830ULL), uniform_type(16623953ULL), uniform_type(16622021ULL), uniform_type(16620031ULL), uniform_type(16617981ULL), uniform_type(16615867ULL), uniform_type(16613687ULL), 
+            uniform_type(16611439ULL), uniform_type(16609117ULL), uniform_type(16606720ULL), uniform_type(16604243ULL), uniform_type(16601682ULL), uniform_type(16599033ULL), uniform_type(16596291ULL), uniform_type(16593451ULL), 
+            uniform_type(16590509ULL), uniform_type(16587458ULL), uniform_type(16584292ULL), uniform_type(16581005ULL), uniform_type(16577589ULL), uniform_type(16574038ULL), uniform_type(16570342ULL), uniform_type(16566493ULL), 
+            uniform_type(16562481ULL), uniform_type(16558295ULL), uniform_type(16553925ULL), uniform_type(16549356ULL), uniform_type(16544577ULL), uniform_type(16539572ULL), uniform_type(16534324ULL), uniform_type(16528815ULL), 
+            uniform_type(16523026ULL), uniform_type(16516934ULL), uniform_type(16510516ULL), uniform_type(16503743ULL), uniform_type(16496586ULL), uniform_type(16489012ULL), uniform_type(16480982ULL), uniform_type(16472455ULL), 
+            uniform_type(16463382ULL), uniform_type(16453710ULL), uniform_type(16443376ULL), uniform_type(16432311ULL), uniform_type(16420435ULL), uniform_type(16407653ULL), uniform_type(16393859ULL), uniform_type(16378928ULL), 
+            uniform_type(16362712ULL), uniform_type(16345038ULL), uniform_type(16325701ULL), uniform_type(16304453ULL), uniform_type(16280998ULL), uniform_type(16254971ULL), uniform_type(16225926ULL), uniform_type(16193306ULL), 
+            uniform_type(16156409ULL), uniform_type(16114335ULL), uniform_type(16065914ULL), uniform_type(16009598ULL), uniform_type(15943291ULL), uniform_type(15864086ULL), uniform_type(15767837ULL), uniform_type(15648418ULL), 
+            uniform_type(15496391ULL), uniform_type(15296448ULL), uniform_type(15022047ULL), uniform_type(14622977ULL), uniform_type(13991999ULL), uniform_type(12854845ULL), uniform_type(10263670ULL), uniform_type(0ULL)
+        }; // upscaled_high_probabilities[...]
+
+        static inline const value_type layer_left_endpoints[n_boxes] = {
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L)
+        }; // layer_left_endpoints[...]
+
+        static inline const value_type downscaled_layer_widths[n_boxes] = {
+            value_type(5.6515577604642555548696479e-7L), value_type(5.0555112771832103992821442e-7L), value_type(4.6082229812230560971849095e-7L), value_type(4.3359284069514080326089978e-7L), value_type(4.1397576887152126763003682e-7L), value_type(3.9862569368166419451045040e-7L), value_type(3.8600698058082738462978309e-7L), value_type(3.7528720415977304850349345e-7L), 
+            value_type(3.6596449009042520927429868e-7L), value_type(3.5771290052191684775011304e-7L), value_type(3.5030877488840668253734452e-7L), value_type(3.4359197397671315645576277e-7L), value_type(3.3744389600564744873007306e-7L), value_type(3.3177424759075247671089075e-7L), value_type(3.2651269392190163437476290e-7L), value_type(3.2160337676883284591036190e-7L), 
+            value_type(3.1700119417112090458316215e-7L), value_type(3.1266920339673109621790468e-7L), value_type(3.0857676331411202449712959e-7L), value_type(3.0469817712563089659279936e-7L), value_type(3.0101168197402933448122496e-7L), value_type(2.9749868419723499296266201e-7L), value_type(2.9414317187444675775996215e-7L), value_type(2.9093125751727344283228276e-7L), 
+            value_type(2.8785081776750922121530703e-7L), value_type(2.8489120640780313883888484e-7L), value_type(2.8204302347994551983548065e-7L), value_type(2.7929792783956938315141461e-7L), value_type(2.7664848369401988120109880e-7L), value_type(2.7408803398674245990123518e-7L), value_type(2.7161059518122021023950999e-7L), value_type(2.6921076924488276410190313e-7L), 
+            value_type(2.6688366956463904559773782e-7L), value_type(2.6462485822814250990269723e-7L), value_type(2.6243029263992866638080572e-7L), value_type(2.6029627985276789385432574e-7L), value_type(2.5821943731328903798682763e-7L), value_type(2.5619665896991708078993581e-7L), value_type(2.5422508588713637442172719e-7L), value_type(2.5230208066541265719660245e-7L), 
+            value_type(2.5042520509002799609279037e-7L), value_type(2.4859220053156930670146201e-7L), value_type(2.4680097070115352401098210e-7L), value_type(2.4504956642871829131305965e-7L), value_type(2.4333617218597461315756681e-7L), value_type(2.4165909411932597616516360e-7L), value_type(2.4001674939409487893023675e-7L), value_type(2.3840765668124502479297170e-7L), 
+            value_type(2.3683042764261646377111687e-7L), value_type(2.3528375929143150390860564e-7L), value_type(2.3376642712222346322326201e-7L), value_type(2.3227727891898375217976638e-7L), value_type(2.3081522916269535563484750e-7L), value_type(2.2937925396991121603286289e-7L), value_type(2.2796838650296044812576026e-7L), value_type(2.2658171279998195430903566e-7L), 
+            value_type(2.2521836797950561254969472e-7L), value_type(2.2387753277990010257838501e-7L), value_type(2.2255843039882767110785571e-7L), value_type(2.2126032360200917349014920e-7L), value_type(2.1998251207420697758652212e-7L), value_type(2.1872432998846177671812890e-7L), value_type(2.1748514377234155558353988e-7L), value_type(2.1626435005233530047949059e-7L), 
+            value_type(2.1506137375959977082131048e-7L), value_type(2.1387566638208635866828710e-7L), value_type(2.1270670434967201905961559e-7L), value_type(2.1155398754032342331505847e-7L), value_type(2.1041703789656240333056204e-7L), value_type(2.0929539814259522809502893e-7L), value_type(2.0818863059343696092561086e-7L), value_type(2.0709631604822111838575432e-7L), 
+            value_type(2.0601805276064788152312298e-7L), value_type(2.0495345548020308915707849e-7L), value_type(2.0390215455838544785210701e-7L), value_type(2.0286379511471972279712982e-7L), value_type(2.0183803625781684985815669e-7L), value_type(2.0082455035717464534197631e-7L), value_type(1.9982302236180093513321063e-7L), value_type(1.9883314916208958343155080e-7L), 
+            value_type(1.9785463899169353668440303e-7L), value_type(1.9688721086642152013909124e-7L), value_type(1.9593059405743986332005707e-7L), value_type(1.9498452759629110199498967e-7L), value_type(1.9404875980944916252660725e-7L), value_type(1.9312304788031942087177636e-7L), value_type(1.9220715743676281042040402e-7L), value_type(1.9130086216237825920075462e-7L), 
+            value_type(1.9040394342991868782815615e-7L), value_type(1.8951618995534403223958763e-7L), value_type(1.8863739747113154666420795e-7L), value_type(1.8776736841757012845293587e-7L), value_type(1.8690591165086259936720391e-7L), value_type(1.8605284216694868048757253e-7L), value_type(1.8520798084004261640587314e-7L), value_type(1.8437115417495375995785706e-7L), 
+            value_type(1.8354219407232656717667498e-7L), value_type(1.8272093760599895231755083e-7L), value_type(1.8190722681173533434401637e-7L), value_type(1.8110090848664343611931694e-7L), value_type(1.8030183399863239579305342e-7L), value_type(1.7950985910531439485238366e-7L), value_type(1.7872484378179314013633567e-7L), value_type(1.7794665205682046567533349e-7L), 
+            value_type(1.7717515185683732269500863e-7L), value_type(1.7641021485744775411056606e-7L), value_type(1.7565171634190433111802559e-7L), value_type(1.7489953506621117048660836e-7L), value_type(1.7415355313047623912250734e-7L), value_type(1.7341365585616835742501268e-7L), value_type(1.7267973166895628940383822e-7L), value_type(1.7195167198682769602098561e-7L), 
+            value_type(1.7122937111320465672390850e-7L), value_type(1.7051272613479004925343932e-7L), value_type(1.6980163682389542588564195e-7L), value_type(1.6909600554501623237284285e-7L), value_type(1.6839573716543437266476465e-7L), value_type(1.6770073896964130909430302e-7L), value_type(1.6701092057738717829224449e-7L), value_type(1.6632619386517286558789771e-7L), 
+            value_type(1.6564647289101267731827571e-7L), value_type(1.6497167382230523840800932e-7L), value_type(1.6430171486665957420378009e-7L), value_type(1.6363651620553205898705352e-7L), value_type(1.6297599993053807309171408e-7L), value_type(1.6232008998230984681482947e-7L), value_type(1.6166871209177911978732454e-7L), value_type(1.6102179372376994366827412e-7L), 
+            value_type(1.6037926402279323574135093e-7L), value_type(1.5974105376094058055327326e-7L), value_type(1.5910709528778030320914058e-7L), value_type(1.5847732248216402632459957e-7L), value_type(1.5785167070585679602815858e-7L), value_type(1.5723007675890844216635949e-7L), value_type(1.5661247883668814375023615e-7L), value_type(1.5599881648850822098692972e-7L), 
+            value_type(1.5538903057776698691089442e-7L), value_type(1.5478306324354408037070072e-7L), value_type(1.5418085786358508250543040e-7L), value_type(1.5358235901861540437443679e-7L), value_type(1.5298751245792643663384597e-7L), value_type(1.5239626506617978473892499e-7L), value_type(1.5180856483137808592717635e-7L), value_type(1.5122436081395342727748916e-7L), 
+            value_type(1.5064360311692676681966417e-7L), value_type(1.5006624285709401071222344e-7L), value_type(1.4949223213719652704191712e-7L), value_type(1.4892152401903588839915920e-7L), value_type(1.4835407249749453811053004e-7L), value_type(1.4778983247542587544852261e-7L), value_type(1.4722875973937895943608713e-7L), value_type(1.4667081093612464475771514e-7L), 
+            value_type(1.4611594354995149214008937e-7L), value_type(1.4556411588070124438307088e-7L), value_type(1.4501528702251503268953284e-7L), value_type(1.4446941684326278044116096e-7L), value_type(1.4392646596462950719642245e-7L), value_type(1.4338639574283340828452333e-7L), value_type(1.4284916824995169853009503e-7L), value_type(1.4231474625583126573590843e-7L), 
+            value_type(1.4178309321056218373259658e-7L), value_type(1.4125417322749308903625587e-7L), value_type(1.4072795106676833221491235e-7L), value_type(1.4020439211936767756053055e-7L), value_type(1.3968346239163014504263563e-7L), value_type(1.3916512849024436908226259e-7L), value_type(1.3864935760768859159166422e-7L), value_type(1.3813611750810411400725446e-7L), 
+            value_type(1.3762537651358670661081740e-7L), value_type(1.3711710349088111508407051e-7L), value_type(1.3661126783846441566538390e-7L), value_type(1.3610783947400455306694602e-7L), value_type(1.3560678882218095096536384e-7L), value_type(1.3510808680285461481123928e-7L), value_type(1.3461170481957565224503110e-7L), value_type(1.3411761474841661881267234e-7L), 
+            value_type(1.3362578892712055712874232e-7L), value_type(1.3313620014455303725429710e-7L), value_type(1.3264882163044792589473149e-7L), value_type(1.3216362704543701307531123e-7L), value_type(1.3168059047135400815795910e-7L), value_type(1.3119968640180378331020661e-7L), value_type(1.3072088973298809266480044e-7L), value_type(1.3024417575477933020924959e-7L), 
+            value_type(1.2976952014203420966843708e-7L), value_type(1.2929689894613955599953582e-7L), value_type(1.2882628858678269127792270e-7L), value_type(1.2835766584393917835070612e-7L), value_type(1.2789100785007095427217146e-7L), value_type(1.2742629208252814278235216e-7L), value_type(1.2696349635614808148548669e-7L), value_type(1.2650259881604533544047775e-7L), 
+            value_type(1.2604357793058669507512686e-7L), value_type(1.2558641248454537313923142e-7L), value_type(1.2513108157242882325424929e-7L), value_type(1.2467756459197480191242966e-7L), value_type(1.2422584123781048691823402e-7L), value_type(1.2377589149526964862174590e-7L), value_type(1.2332769563436304622098142e-7L), value_type(1.2288123420389739024316655e-7L), 
+            value_type(1.2243648802573837437293297e-7L), value_type(1.2199343818921343538090724e-7L), value_type(1.2155206604565004930720617e-7L), value_type(1.2111235320304551554457704e-7L), value_type(1.2067428152086431830556164e-7L), value_type(1.2023783310495928739462441e-7L), value_type(1.1980299030261290747513086e-7L), value_type(1.1936973569769524734645417e-7L), 
+            value_type(1.1893805210593509834158583e-7L), value_type(1.1850792257030102402346073e-7L), value_type(1.1807933035648913209211047e-7L), value_type(1.1765225894851448399887401e-7L), value_type(1.1722669204440315837364860e-7L), value_type(1.1680261355198208117372033e-7L), value_type(1.1638000758476382861739246e-7L), value_type(1.1595885845792369862431478e-7L), 
+            value_type(1.1553915068436643279192604e-7L), value_type(1.1512086897088005403187086e-7L), value_type(1.1470399821437436500338874e-7L), value_type(1.1428852349820172953819667e-7L), value_type(1.1387443008855783347325042e-7L), value_type(1.1346170343096019280846521e-7L), value_type(1.1305032914680224599530337e-7L), value_type(1.1264029302998093354345788e-7L), 
+            value_type(1.1223158104359573210634357e-7L), value_type(1.1182417931671717186695343e-7L), value_type(1.1141807414122292548479505e-7L), value_type(1.1101325196869961416899552e-7L), value_type(1.1060969940740853169530482e-7L), value_type(1.1020740321931354046501929e-7L), value_type(1.0980635031716944508767928e-7L), value_type(1.0940652776166919852932607e-7L), 
+            value_type(1.0900792275864834367352011e-7L), value_type(1.0861052265634513925958676e-7L), value_type(1.0821431494271486365514346e-7L), value_type(1.0781928724279683284860036e-7L), value_type(1.0742542731613271047011540e-7L), value_type(1.0703272305423472762202106e-7L), value_type(1.0664116247810246887522965e-7L), value_type(1.0625073373578691801748856e-7L), 
+            value_type(1.0586142510000049307133887e-7L), value_type(1.0547322496577183478088934e-7L), value_type(1.0508612184814414624172012e-7L), value_type(1.0470010437991591366014289e-7L), value_type(1.0431516130942286941761091e-7L), value_type(1.0393128149836008872249897e-7L), value_type(1.0354845391964314019229840e-7L), value_type(1.0316666765530723876044157e-7L), 
+            value_type(1.0278591189444337637790261e-7L), value_type(1.0240617593117043211337241e-7L), value_type(1.0202744916264228847873447e-7L), value_type(1.0164972108708900514898506e-7L), value_type(1.0127298130189112473657439e-7L), value_type(1.0089721950168620794708526e-7L), value_type(1.0052242547650671731271787e-7L), value_type(1.0014858910994838979758231e-7L), 
+            value_type(9.9775700377368258918588037e-8L), value_type(9.9403749344111506650987143e-8L), value_type(9.9032726163766344310589320e-8L), value_type(9.8662621076446139846563878e-8L), value_type(9.8293424407098026559885347e-8L), value_type(9.7925126563837245202270350e-8L), value_type(9.7557718036306487727433274e-8L), value_type(9.7191189394059526678357829e-8L), 
+            value_type(9.6825531284968429317934476e-8L), value_type(9.6460734433653670161863188e-8L), value_type(9.6096789639936469567526556e-8L), value_type(9.5733687777312699485230187e-8L), value_type(9.5371419791447710402710035e-8L), value_type(9.5009976698691445923360486e-8L), value_type(9.4649349584613223325820039e-8L), value_type(9.4289529602555569869297069e-8L), 
+            value_type(9.3930507972206515546634557e-8L), value_type(9.3572275978189753456299547e-8L), value_type(9.3214824968672088975347496e-8L), value_type(9.2858146353987608477482843e-8L), value_type(9.2502231605278007462580287e-8L), value_type(9.2147072253148526654859986e-8L), value_type(9.1792659886338952894198213e-8L), value_type(9.1438986150409149496147588e-8L), 
+            value_type(9.1086042746438588197963074e-8L), value_type(9.0733821429739361846595944e-8L), value_type(9.0382314008582163626039199e-8L), value_type(9.0031512342934724870899577e-8L), value_type(8.9681408343212209375457974e-8L), value_type(8.9331993969039067587101173e-8L), value_type(8.8983261228021859173721091e-8L), value_type(8.8635202174532557179862954e-8L), 
+            value_type(8.8287808908501851338964567e-8L), value_type(8.7941073574221972091393976e-8L), value_type(8.7594988359158560472116933e-8L), value_type(8.7249545492771112279188203e-8L), value_type(8.6904737245341527815865239e-8L), value_type(8.6560555926810301015513394e-8L), value_type(8.6216993885619883909650880e-8L), value_type(8.5874043507564764185024611e-8L), 
+            value_type(8.5531697214647794994578346e-8L), value_type(8.5189947463942317238137259e-8L), value_type(8.4848786746459615209647184e-8L), value_type(8.4508207586021246816416834e-8L), value_type(8.4168202538135789509037516e-8L), value_type(8.3828764188879542614982322e-8L), value_type(8.3489885153780725940253364e-8L), value_type(8.3151558076706713287228625e-8L), 
+            value_type(8.2813775628753837927861609e-8L), value_type(8.2476530507139305063818134e-8L), value_type(8.2139815434094743892597718e-8L), value_type(8.1803623155760929074157063e-8L), value_type(8.1467946441083198148357188e-8L), value_type(8.1132778080707087781350995e-8L), value_type(8.0798110885873707609777930e-8L), value_type(8.0463937687314365895581241e-8L), 
+            value_type(8.0130251334143956190908682e-8L), value_type(7.9797044692752608730621045e-8L), value_type(7.9464310645695104307328523e-8L), value_type(7.9132042090577541927675383e-8L), value_type(7.8800231938940744584994234e-8L), value_type(7.8468873115139879997731661e-8L), value_type(7.8137958555219765139529972e-8L), value_type(7.7807481205785314808856670e-8L), 
+            value_type(7.7477434022866585335878103e-8L), value_type(7.7147809970777854783052587e-8L), value_type(7.6818602020970170643696438e-8L), value_type(7.6489803150876785058370997e-8L), value_type(7.6161406342750885929899056e-8L), value_type(7.5833404582495020000361118e-8L), value_type(7.5505790858481590932360183e-8L), value_type(7.5178558160363801685517915e-8L), 
+            value_type(7.4851699477876395969361560e-8L), value_type(7.4525207799625538255630411e-8L), value_type(7.4199076111867155714998257e-8L), value_type(7.3873297397273048471880224e-8L), value_type(7.3547864633684056711054501e-8L), value_type(7.3222770792849554383939676e-8L), value_type(7.2898008839152519511042763e-8L), value_type(7.2573571728319410318582786e-8L), 
+            value_type(7.2249452406114054637456639e-8L), value_type(7.1925643807014737084870566e-8L), value_type(7.1602138852873644493752262e-8L), value_type(7.1278930451557804800284789e-8L), value_type(7.0956011495570628090353732e-8L), value_type(7.0633374860653130682971753e-8L), value_type(7.0311013404363893931054790e-8L), value_type(6.9988919964636778781895888e-8L), 
+            value_type(6.9667087358315384992129485e-8L), value_type(6.9345508379663210161667451e-8L), value_type(6.9024175798848428360485367e-8L), value_type(6.8703082360402170989141232e-8L), value_type(6.8382220781649153551557767e-8L), value_type(6.8061583751109451134764554e-8L), value_type(6.7741163926870182487347676e-8L), value_type(6.7420953934925817562807076e-8L), 
+            value_type(6.7100946367485776136153236e-8L), value_type(6.6781133781247935495516876e-8L), value_type(6.6461508695636613131845573e-8L), value_type(6.6142063591003535667911313e-8L), value_type(6.5822790906790247843783783e-8L), value_type(6.5503683039650355061961825e-8L), value_type(6.5184732341529929634637886e-8L), value_type(6.4865931117704344301419000e-8L), 
+            value_type(6.4547271624769726621072952e-8L), value_type(6.4228746068587154297121237e-8L), value_type(6.3910346602177634173971746e-8L), value_type(6.3592065323565826324539942e-8L), value_type(6.3273894273570389114961312e-8L), value_type(6.2955825433538731135331252e-8L), value_type(6.2637850723023861169913369e-8L), value_type(6.2319961997400927671495851e-8L), 
+            value_type(6.2002151045420934209949128e-8L), value_type(6.1684409586699006772455461e-8L), value_type(6.1366729269134472269321250e-8L), value_type(6.1049101666259884789238326e-8L), value_type(6.0731518274516006671655229e-8L), value_type(6.0413970510449614915885364e-8L), value_type(6.0096449707830859393082571e-8L), value_type(5.9778947114686747304517143e-8L), 
+            value_type(5.9461453890247167841521975e-8L), value_type(5.9143961101799701517941248e-8L), value_type(5.8826459721449279596117215e-8L), value_type(5.8508940622778569802961939e-8L), value_type(5.8191394577404764480172431e-8L), value_type(5.7873812251428235731465892e-8L), value_type(5.7556184201768298267934994e-8L), value_type(5.7238500872381083702981131e-8L), 
+            value_type(5.6920752590354279143602109e-8L), value_type(5.6602929561873217133067240e-8L), value_type(5.6285021868052522318941095e-8L), value_type(5.5967019460627221571616470e-8L), value_type(5.5648912157496907501016033e-8L), value_type(5.5330689638116209162341892e-8L), value_type(5.5012341438724466857807650e-8L), value_type(5.4693856947407128876557581e-8L), 
+            value_type(5.4375225398980985200870556e-8L), value_type(5.4056435869694924949572925e-8L), value_type(5.3737477271737448799447608e-8L), value_type(5.3418338347541682844019361e-8L), value_type(5.3099007663878124176295495e-8L), value_type(5.2779473605724798601161233e-8L), value_type(5.2459724369903924784691564e-8L), value_type(5.2139747958473554111498981e-8L), 
+            value_type(5.1819532171861988596862722e-8L), value_type(5.1499064601732067185128930e-8L), value_type(5.1178332623561650180943773e-8L), value_type(5.0857323388925818623815057e-8L), value_type(5.0536023817465436015786153e-8L), value_type(5.0214420588525789468598092e-8L), value_type(4.9892500132448031171991853e-8L), value_type(4.9570248621495073779616818e-8L), 
+            value_type(4.9247651960392449059326134e-8L), value_type(4.8924695776463411622224223e-8L), value_type(4.8601365409336251802416385e-8L), value_type(4.8277645900200366229615422e-8L), value_type(4.7953521980586113024023519e-8L), value_type(4.7628978060641841757529959e-8L), value_type(4.7303998216879726398571085e-8L), value_type(4.6978566179360131447472463e-8L), 
+            value_type(4.6652665318282195352188528e-8L), value_type(4.6326278629946107849496387e-8L), value_type(4.5999388722050174549775301e-8L), value_type(4.5671977798283186837905525e-8L), value_type(4.5344027642169830310818000e-8L), value_type(4.5015519600123850985100148e-8L), value_type(4.4686434563660433802075016e-8L), value_type(4.4356752950715708652589614e-8L), 
+            value_type(4.4026454686017458789428081e-8L), value_type(4.3695519180446935763287136e-8L), value_type(4.3363925309327151351421311e-8L), value_type(4.3031651389568084163249731e-8L), value_type(4.2698675155593866443927267e-8L), value_type(4.2364973733971160203600417e-8L), value_type(4.2030523616651541148849517e-8L), value_type(4.1695300632733728111188118e-8L), 
+            value_type(4.1359279918643862274746139e-8L), value_type(4.1022435886623684538161285e-8L), value_type(4.0684742191407302355877194e-8L), value_type(4.0346171694957191306463399e-8L), value_type(4.0006696429119042383649890e-8L), value_type(3.9666287556042932064439786e-8L), value_type(3.9324915326204932791441642e-8L), value_type(3.8982549033848554536451750e-8L), 
+            value_type(3.8639156969649152858900593e-8L), value_type(3.8294706370386473208839774e-8L), value_type(3.7949163365390618434306228e-8L), value_type(3.7602492919504691513641269e-8L), value_type(3.7254658772282910767895991e-8L), value_type(3.6905623373115814800722048e-8L), value_type(3.6555347811943920041279592e-8L), value_type(3.6203791745187465187261618e-8L), 
+            value_type(3.5850913316482215230596759e-8L), value_type(3.5496669071769175516391266e-8L), value_type(3.5141013868238875540391616e-8L), value_type(3.4783900776577920995336143e-8L), value_type(3.4425280975905968618490126e-8L), value_type(3.4065103640724209485044941e-8L), value_type(3.3703315819120757145885413e-8L), value_type(3.3339862301392750834421985e-8L), 
+            value_type(3.2974685478148009379042839e-8L), value_type(3.2607725186838961389532430e-8L), value_type(3.2238918545556279826160254e-8L), value_type(3.1868199772766747595029678e-8L), value_type(3.1495499991516521058052546e-8L), value_type(3.1120747016433759085913583e-8L), value_type(3.0743865121649528791954205e-8L), value_type(3.0364774787508196096945354e-8L), 
+            value_type(2.9983392423652431947137542e-8L), value_type(2.9599630065736639473209593e-8L), value_type(2.9213395042637755022423403e-8L), value_type(2.8824589610583989403087060e-8L), value_type(2.8433110550098010903540651e-8L), value_type(2.8038848721036532816421834e-8L), value_type(2.7641688570285152832405925e-8L), value_type(2.7241507585813354825648689e-8L), 
+            value_type(2.6838175689782365016581658e-8L), value_type(2.6431554562193994153951765e-8L), value_type(2.6021496885129237800478433e-8L), value_type(2.5607845495898045909448583e-8L), value_type(2.5190432435339278514993303e-8L), value_type(2.4769077874987492241760393e-8L), value_type(2.4343588903752557015099653e-8L), value_type(2.3913758151000236853014652e-8L), 
+            value_type(2.3479362218297309683961037e-8L), value_type(2.3040159886360082680785337e-8L), value_type(2.2595890056614299149066316e-8L), value_type(2.2146269377833218759512944e-8L), value_type(2.1690989497030605098609166e-8L), value_type(2.1229713859422694535598585e-8L), value_type(2.0762073963855820153457108e-8L), value_type(2.0287664956277954733867005e-8L), 
+            value_type(1.9806040412747492573189986e-8L), value_type(1.9316706122505866045482996e-8L), value_type(1.8819112627079810165528089e-8L), value_type(1.8312646197883474273276501e-8L), value_type(1.7796617834564129773130619e-8L), value_type(1.7270249727817520516868392e-8L), value_type(1.6732658436151520068050670e-8L), value_type(1.6182833749298377403198620e-8L), 
+            value_type(1.5619611809622601868270074e-8L), value_type(1.5041640469483008949949811e-8L), value_type(1.4447333966103041015060378e-8L), value_type(1.3834812608355622568182105e-8L), value_type(1.3201820964371222743536201e-8L), value_type(1.2545614422831258928931484e-8L), value_type(1.1862797859930581345287272e-8L), value_type(1.1149089282722022948733224e-8L), 
+            value_type(1.0398961173457540303136835e-8L), value_type(9.6050727197626171787836910e-9L), value_type(8.7573230287246476245235456e-9L), value_type(7.8411654537412394575370304e-9L), value_type(6.8343395753787435747637906e-9L), value_type(5.6997582674508189355945131e-9L), value_type(4.3672032021073187505862293e-9L), value_type(2.6716907923892402393352890e-9L)
+        }; // downscaled_layer_widths[...]
+
+        static inline const expectation_type layer_bottom_endpoints[n_boxes] = {
+            expectation_type(0.0000000000000000000000000L), expectation_type(0.00020721783744635918968952929L), expectation_type(0.00043886672775980303183094354L), expectation_type(0.00069300017184409350947051025L), expectation_type(0.00096309309483817841638174844L), expectation_type(0.0012459849125208814143141717L), expectation_type(0.0015397701842404248127078010L), expectation_type(0.0018431594067784276767553902L), 
+            expectation_type(0.0021552146978583792443992555L), expectation_type(0.0024752194002373523990148675L), expectation_type(0.0028026058533448324027609604L), expectation_type(0.0031369119459340503444296509L), expectation_type(0.0034777533118636174564826753L), expectation_type(0.0038248046561578975188500416L), expectation_type(0.0041777867172523927845054373L), expectation_type(0.0045364568697845658281215889L), 
+            expectation_type(0.0049006021685972633758703617L), expectation_type(0.0052700340820601560936192836L), expectation_type(0.0056445844261951472869044867L), expectation_type(0.0060241021723627292634277320L), expectation_type(0.0064084509034165849409015468L), expectation_type(0.0067975067598692365989525599L), expectation_type(0.0071911567622168692829048180L), expectation_type(0.0075892974261199805224021902L), 
+            expectation_type(0.0079918336084884426107355654L), expectation_type(0.0083986775377186407732592002L), expectation_type(0.0088097479923293856474262983L), expectation_type(0.0092249696003227712485253983L), expectation_type(0.0096442722376123975796616083L), expectation_type(0.010067590508397449719034718L), expectation_type(0.010494863293820558615207215L), expectation_type(0.010926033357913685982974413L), 
+            expectation_type(0.011361047001911455796817769L), expectation_type(0.011799853759641138239648867L), expectation_type(0.012242406127989293125973420L), expectation_type(0.012688659327475459816740283L), expectation_type(0.013138571088791836084708046L), expectation_type(0.013592101461838746163612364L), expectation_type(0.014049212644332388394157396L), expectation_type(0.014509868827509569093045615L), 
+            expectation_type(0.014974036056823716800398880L), expectation_type(0.015441682105832872858635777L), expectation_type(0.015912776361735672473558046L), expectation_type(0.016387289721225112386365767L), expectation_type(0.016865194495509726590466495L), expectation_type(0.017346464323503713523688989L), expectation_type(0.017831074092316438840416442L), expectation_type(0.018318999864281503417657497L), 
+            expectation_type(0.018810218809859403511079740L), expectation_type(0.019304709145828318342976050L), expectation_type(0.019802450078246870024404949L), expectation_type(0.020303421749732565003043793L), expectation_type(0.020807605190651494658795091L), expectation_type(0.021314982273859948354198356L), expectation_type(0.021825535672677877722626297L), expectation_type(0.022339248821808484778550035L), 
+            expectation_type(0.022856105880948292448309754L), expectation_type(0.023376091700858487252207259L), expectation_type(0.023899191791691601201911081L), expectation_type(0.024425392293388148345987146L), expectation_type(0.024954679947976012099385863L), expectation_type(0.025487042073621500705808740L), expectation_type(0.026022466540295313520693262L), expectation_type(0.026560941746929416387660229L), 
+            expectation_type(0.027102456599952204687659361L), expectation_type(0.027647000493099505356092916L), expectation_type(0.028194563288408079239539246L), expectation_type(0.028745135298306458197520256L), expectation_type(0.029298707268725296426865482L), expectation_type(0.029855270363156027546257022L), expectation_type(0.030414816147592580855817272L), expectation_type(0.030977336576296294289953749L), 
+            expectation_type(0.031542823978329031340065730L), expectation_type(0.032111271044803920310289630L), expectation_type(0.032682670816807135644104703L), expectation_type(0.033257016673947775859080035L), expectation_type(0.033834302323496198926601846L), expectation_type(0.034414521790074187400164158L), expectation_type(0.034997669405863062050113885L), expectation_type(0.035583739801298370661909311L), 
+            expectation_type(0.036172727896222071510612595L), expectation_type(0.036764628891465229763462176L), expectation_type(0.037359438260836168340074791L), expectation_type(0.037957151743490779230938194L), expectation_type(0.038557765336663321830115544L), expectation_type(0.039161275288737524809950295L), expectation_type(0.039767678092639179407851528L), expectation_type(0.040376970479532675440190285L), 
+            expectation_type(0.040989149412805096554162167L), expectation_type(0.041604212082322566860031506L), expectation_type(0.042222155898944534980996732L), expectation_type(0.042842978489282600779497540L), expectation_type(0.043466677690691340948799646L), expectation_type(0.044093251546479378069574486L), expectation_type(0.044722698301329668850268561L), expectation_type(0.045355016396918665836330456L), 
+            expectation_type(0.045990204467724637187825548L), expectation_type(0.046628261337016015095265350L), expectation_type(0.047269186013011188583601999L), expectation_type(0.047912977685201664079943980L), expectation_type(0.048559635720830990140424853L), expectation_type(0.049209159661522283835794440L), expectation_type(0.049861549220047607939970042L), expectation_type(0.050516804277232832495948089L), 
+            expectation_type(0.051174924878991973602865272L), expectation_type(0.051835911233485338257099112L), expectation_type(0.052499763708396118512492842L), expectation_type(0.053166482828320372680853321L), expectation_type(0.053836069272265607225006867L), expectation_type(0.054508523871253431736272548L), expectation_type(0.055183847606022002162327174L), expectation_type(0.055862041604824195388463864L), 
+            expectation_type(0.056543107141317672414440642L), expectation_type(0.057227045632543188668392889L), expectation_type(0.057913858636987699342258919L), expectation_type(0.058603547852728985835529633L), expectation_type(0.059296115115658697209416015L), expectation_type(0.059991562397780858678353181L), expectation_type(0.060689891805583048244588765L), expectation_type(0.061391105578477583211061243L), 
+            expectation_type(0.062095206087310191040577113L), expectation_type(0.062802195832933764377830835L), expectation_type(0.063512077444844918490391167L), expectation_type(0.064224853679881181356613433L), expectation_type(0.064940527420976752542348233L), expectation_type(0.065659101675974867245205261L), expectation_type(0.066380579576494896799241896L), expectation_type(0.067104964376852406853938459L), 
+            expectation_type(0.067832259453030479676157965L), expectation_type(0.068562468301700687858468936L), expectation_type(0.069295594539292183418362750L), expectation_type(0.070031641901107439089233302L), expectation_type(0.070770614240483247767638554L), expectation_type(0.071512515527995651809111797L), expectation_type(0.072257349850707536359194061L), expectation_type(0.073005121411457680356792496L), 
+            expectation_type(0.073755834528190115430578292L), expectation_type(0.074509493633322696791717874L), expectation_type(0.075266103273153841563040100L), expectation_type(0.076025668107306438921245714L), expectation_type(0.076788192908207983101327313L), expectation_type(0.077553682560606024848886782L), expectation_type(0.078322142061118079426533435L), expectation_type(0.079093576517815169897706547L), 
+            expectation_type(0.079867991149838223230945796L), expectation_type(0.080645391287046573889320823L), expectation_type(0.081425782369697865086979537L), expectation_type(0.082209169948158671895599345L), expectation_type(0.082995559682645202950774699L), expectation_type(0.083784957342993468720072076L), expectation_type(0.084577368808458334224147427L), expectation_type(0.085372800067540902819258425L), 
+            expectation_type(0.086171257217843705219084972L), expectation_type(0.086972746465953194417686113L), expectation_type(0.087777274127349072631915081L), expectation_type(0.088584846626340000865708966L), expectation_type(0.089395470496025265262369935L), expectation_type(0.090209152378281997103438937L), expectation_type(0.091025899023777565180560534L), expectation_type(0.091845717292006780353896920L), 
+            expectation_type(0.092668614151353572458891987L), expectation_type(0.093494596679176819372052069L), expectation_type(0.094323672061920027033391770L), expectation_type(0.095155847595244577583863698L), expectation_type(0.095991130684186280544220423L), expectation_type(0.096829528843334979169424088L), expectation_type(0.097671049697036980790413989L), expectation_type(0.098515700979620096131763505L), 
+            expectation_type(0.099363490535641088297102292L), expectation_type(0.10021442632015534737042901L), expectation_type(0.10106851639900862141563864L), expectation_type(0.10192576894915064909261990L), expectation_type(0.10278619225897055316893402L), expectation_type(0.10364979472865386791313183L), expectation_type(0.10451658487056108673000466L), expectation_type(0.10538657130962762945939228L), 
+            expectation_type(0.10625976278378514152763526L), expectation_type(0.10713616814440404963260639L), expectation_type(0.10801579635675731087698425L), expectation_type(0.10889865650050530425683438L), expectation_type(0.10978475777020182517977123L), expectation_type(0.11067410947582115524449970L), expectation_type(0.11156672104330619087630777L), expectation_type(0.11246260201513762559548690L), 
+            expectation_type(0.11336176205092419171156896L), expectation_type(0.11426421092801397809908396L), expectation_type(0.11516995854212685143321128L), expectation_type(0.11607901490800801885875173L), expectation_type(0.11699139016010278054543090L), expectation_type(0.11790709455325253095843644L), expectation_type(0.11882613846341207795673624L), expectation_type(0.11974853238838835903425005L), 
+            expectation_type(0.12067428694860064415119276L), expectation_type(0.12160341288786232467544408L), expectation_type(0.12253592107418439797695025L), expectation_type(0.12347182250060076720202293L), expectation_type(0.12441112828601548570885785L), expectation_type(0.12535384967607208558034817L), expectation_type(0.12629999804404513955484082L), expectation_type(0.12724958489175421563925044L), 
+            expectation_type(0.12820262185050039360113795L), expectation_type(0.12915912068202552248609016L), expectation_type(0.13011909327949440828300779L), expectation_type(0.13108255166850013087163429L), expectation_type(0.13204950800809269944267263L), expectation_type(0.13301997459183126568991347L), expectation_type(0.13399396384886012424465974L), expectation_type(0.13497148834500874006406689L), 
+            expectation_type(0.13595256078391605280548954L), expectation_type(0.13693719400817931862719016L), expectation_type(0.13792540100052776036048214L), expectation_type(0.13891719488502130760822317L), expectation_type(0.13991258892827471904824763L), expectation_type(0.14091159654070739006657376L), expectation_type(0.14191423127781915982283727L), expectation_type(0.14292050684149244296825123L), 
+            expectation_type(0.14393043708132102250340953L), expectation_type(0.14494403599596585168846691L), expectation_type(0.14596131773453822451077043L), expectation_type(0.14698229659801068598412885L), expectation_type(0.14800698704065606550895466L), expectation_type(0.14903540367151502867300512L), expectation_type(0.15006756125589255522803940L), expectation_type(0.15110347471688376354821771L), 
+            expectation_type(0.15214315913692951467148948L), expectation_type(0.15318662975940224205573449L), expectation_type(0.15423390199022246645741594L), expectation_type(0.15528499139950646887257885L), expectation_type(0.15633991372324560827900528L), expectation_type(0.15739868486501778499529132L), expectation_type(0.15846132089773156483886327L), expectation_type(0.15952783806540349393209862L), 
+            expectation_type(0.16059825278496914898564406L), expectation_type(0.16167258164812848319290917L), expectation_type(0.16275084142322604351206088L), expectation_type(0.16383304905716665110448249L), expectation_type(0.16491922167736715305477293L), expectation_type(0.16600937659374487023049486L), expectation_type(0.16710353130074338326396739L), expectation_type(0.16820170347939631616777347L), 
+            expectation_type(0.16930391099942979504507062L), expectation_type(0.17041017192140427774045253L), expectation_type(0.17152050449889646911266605L), expectation_type(0.17263492718072205591308284L), expectation_type(0.17375345861320001504010071L), expectation_type(0.17487611764245926922677625L), expectation_type(0.17600292331678848502468650L), expectation_type(0.17713389488902982928957591L), 
+            expectation_type(0.17826905181901752227265888L), expectation_type(0.17940841377606204789503266L), expectation_type(0.18055200064148090485168316L), expectation_type(0.18169983251117680587688478L), expectation_type(0.18285192969826425682596886L), expectation_type(0.18400831273574547221176333L), expectation_type(0.18516900237923660950056659L), expectation_type(0.18633401960974533084619178L), 
+            expectation_type(0.18750338563650072804612856L), expectation_type(0.18867712189983667436681864L), expectation_type(0.18985525007412969553194616L), expectation_type(0.19103779207079248162597695L), expectation_type(0.19222477004132419196340975L), expectation_type(0.19341620638041873614183667L), expectation_type(0.19461212372913224656454211L), expectation_type(0.19581254497811099071772305L), 
+            expectation_type(0.19701749327088100545139530L), expectation_type(0.19822699200720077047579679L), expectation_type(0.19944106484647827428203414L), expectation_type(0.20065973571125386276360845L), expectation_type(0.20188302879075029899246692L), expectation_type(0.20311096854449150192898849L), expectation_type(0.20434357970599147236098065L), expectation_type(0.20558088728651495611509148L), 
+            expectation_type(0.20682291657891143760944331L), expectation_type(0.20806969316152410116492666L), expectation_type(0.20932124290217544321242887L), expectation_type(0.21057759196223126567418114L), expectation_type(0.21183876680074482941124498L), expectation_type(0.21310479417868299676985153L), expectation_type(0.21437570116323624398294742L), expectation_type(0.21565151513221447754824825L), 
+            expectation_type(0.21693226377853064377108033L), expectation_type(0.21821797511477417749250641L), expectation_type(0.21950867747787639468647349L), expectation_type(0.22080439953386999417249204L), expectation_type(0.22210517028274489622399200L), expectation_type(0.22341101906340271043130413L), expectation_type(0.22472197555871219187959128L), expectation_type(0.22603806980066811360666031L), 
+            expectation_type(0.22735933217565605449747914L), expectation_type(0.22868579342982567533902803L), expectation_type(0.23001748467457513179218156L), expectation_type(0.23135443739214935163191406L), expectation_type(0.23269668344135498486260387L), expectation_type(0.23404425506339491933523672L), expectation_type(0.23539718488782534138602817L), expectation_type(0.23675550593863841089427310L), 
+            expectation_type(0.23811925164047371313890593L), expectation_type(0.23948845582496174604133116L), expectation_type(0.24086315273720280094501299L), expectation_type(0.24224337704238469813426553L), expectation_type(0.24362916383254294497582632L), expectation_type(0.24502054863346699502358466L), expectation_type(0.24641756741175640081234384L), expectation_type(0.24782025658203077154073385L), 
+            expectation_type(0.24922865301429756957366219L), expectation_type(0.25064279404148190685596300L), expectation_type(0.25206271746712263410419590L), expectation_type(0.25348846157323915222434191L), expectation_type(0.25492006512837351698982885L), expectation_type(0.25635756739581255481663801L), expectation_type(0.25780100814199485970979300L), expectation_type(0.25925042764510769935826348L), 
+            expectation_type(0.26070586670387902216409261L), expectation_type(0.26216736664656992695871813L), expectation_type(0.26363496934017313354943175L), expectation_type(0.26510871719982317532887381L), expectation_type(0.26658865319842422526096591L), expectation_type(0.26807482087650166393245648L), expectation_type(0.26956726435228370334990842L), expectation_type(0.27106602833201959310281729L), 
+            expectation_type(0.27257115812054115675650856L), expectation_type(0.27408269963207463625289676L), expectation_type(0.27560069940131006107091638L), expectation_type(0.27712520459473560733874141L), expectation_type(0.27865626302224467042463901L), expectation_type(0.28019392314902364321200323L), expectation_type(0.28173823410772867175926862L), expectation_type(0.28328924571095995085372526L), 
+            expectation_type(0.28484700846404242461207492L), expectation_type(0.28641157357812207230929281L), expectation_type(0.28798299298358728760904376L), expectation_type(0.28956131934382520093190172L), expectation_type(0.29114660606932315047236147L), expectation_type(0.29273890733212587803648223L), expectation_type(0.29433827808065941212928494L), expectation_type(0.29594477405493300332313403L), 
+            expectation_type(0.29755845180213089667401493L), expectation_type(0.29917936869260616365337864L), expectation_type(0.30080758293628927260591461L), expectation_type(0.30244315359952455305317493L), expectation_type(0.30408614062234820621536981L), expectation_type(0.30573660483622203294900436L), expectation_type(0.30739460798223759198393684L), expectation_type(0.30906021272980606703857916L), 
+            expectation_type(0.31073348269584971230987043L), expectation_type(0.31241448246451136325781794L), expectation_type(0.31410327760739914488860165L), expectation_type(0.31579993470438418431921867L), expectation_type(0.31750452136496983979708750L), expectation_type(0.31921710625025169615489831L), expectation_type(0.32093775909548834860323761L), expectation_type(0.32266655073330380460019709L), 
+            expectation_type(0.32440355311754317919403337L), expectation_type(0.32614883934780424473142152L), expectation_type(0.32790248369466832330063397L), expectation_type(0.32966456162565498200612170L), expectation_type(0.33143514983192600955656097L), expectation_type(0.33321432625576522024791874L), expectation_type(0.33500217011886175094935800L), expectation_type(0.33679876195142569103392020L), 
+            expectation_type(0.33860418362216611739875411L), expectation_type(0.34041851836916290004435471L), expectation_type(0.34224185083166500158769467L), expectation_type(0.34407426708284942024932733L), expectation_type(0.34591585466357642419434828L), expectation_type(0.34776670261717829978895728L), expectation_type(0.34962690152532049179642724L), expectation_type(0.35149654354497575450702967L), 
+            expectation_type(0.35337572244655376431578681L), expectation_type(0.35526453365323057170397710L), expectation_type(0.35716307428152429967820294L), expectation_type(0.35907144318316563259323492L), expectation_type(0.36098974098831389046495108L), expectation_type(0.36291807015017185634639378L), expectation_type(0.36485653499105502555174770L), expectation_type(0.36680524174997358344463652L), 
+            expectation_type(0.36876429863178820168931927L), expectation_type(0.37073381585800368042611623L), expectation_type(0.37271390571926756555174397L), expectation_type(0.37470468262964414663418178L), expectation_type(0.37670626318273770319550292L), expectation_type(0.37871876620974252719251213L), expectation_type(0.38074231283950112042969884L), expectation_type(0.38277702656065606121684556L), 
+            expectation_type(0.38482303328598536972646063L), expectation_type(0.38688046141901579221752382L), expectation_type(0.38894944192301328777941080L), expectation_type(0.39103010839245515602585798L), expectation_type(0.39312259712709371016124095L), expectation_type(0.39522704720872719851383330L), expectation_type(0.39734360058079983211427900L), expectation_type(0.39947240213095931113543499L), 
+            expectation_type(0.40161359977670718591535056L), expectation_type(0.40376734455428476791533011L), expectation_type(0.40593379071094515371047045L), expectation_type(0.40811309580077027490418117L), expectation_type(0.41030542078420077540667807L), expectation_type(0.41251093013145598455070025L), expectation_type(0.41472979193003134306873817L), expectation_type(0.41696217799647139566648225L), 
+            expectation_type(0.41920826399262793938461235L), expectation_type(0.42146822954662516605125994L), expectation_type(0.42374225837876671952552988L), expectation_type(0.42603053843263356893689054L), expectation_type(0.42833326201163654824049795L), expectation_type(0.43065062592130340688133137L), expectation_type(0.43298283161759733979580939L), expectation_type(0.43533008536158230852622130L), 
+            expectation_type(0.43769259838077012833032098L), expectation_type(0.44007058703750538743042911L), expectation_type(0.44246427300476690264154800L), expectation_type(0.44487388344978873035286402L), expectation_type(0.44729965122592988531109996L), expectation_type(0.44974181507325002755930982L), expectation_type(0.45220061982827863095631878L), expectation_type(0.45467631664349773234186001L), 
+            expectation_type(0.45716916321709348450499450L), expectation_type(0.45967942403356962506115284L), expectation_type(0.46220737061585687635016598L), expectation_type(0.46475328178959648310421813L), expectation_type(0.46731744396032387772119532L), expectation_type(0.46990015140433017183296364L), expectation_type(0.47250170657403517695442871L), expectation_type(0.47512242041876636510073921L), 
+            expectation_type(0.47776261272190404508635493L), expectation_type(0.48042261245542455373017341L), expectation_type(0.48310275815295100057055003L), expectation_type(0.48580339830250567914604676L), expectation_type(0.48852489176025035636137275L), expectation_type(0.49126760818660104139079809L), expectation_type(0.49403192850621337295710692L), expectation_type(0.49681824539345440459470336L), 
+            expectation_type(0.49962696378510738059604941L), expectation_type(0.50245850142219927763612023L), expectation_type(0.50531328942299778054289970L), expectation_type(0.50819177288939647207828179L), expectation_type(0.51109441154909604007722778L), expectation_type(0.51402168043619714854671228L), expectation_type(0.51697407061304943368494005L), expectation_type(0.51995208993645330108532474L), 
+            expectation_type(0.52295626387158956536998004L), expectation_type(0.52598713635735960266540401L), expectation_type(0.52904527072715911452495956L), expectation_type(0.53213125068948584785827523L), expectation_type(0.53524568137320025605134223L), expectation_type(0.53838919044272334374677622L), expectation_type(0.54156242928897378075356884L), expectation_type(0.54476607430242363526576371L), 
+            expectation_type(0.54800082823529660720651534L), expectation_type(0.55126742166065345839519588L), expectation_type(0.55456661453691682938459769L), expectation_type(0.55789919788729380254294226L), expectation_type(0.56126599560457330305143078L), expectation_type(0.56466786639292282940574891L), expectation_type(0.56810570585960379657641388L), expectation_type(0.57158044877098877888373312L), 
+            expectation_type(0.57509307148892264933083931L), expectation_type(0.57864459460535288910566046L), expectation_type(0.58223608579529725675673425L), expectation_type(0.58586866291066086580200546L), expectation_type(0.58954349734020830710430056L), expectation_type(0.59326181766419755895303927L), expectation_type(0.59702491363585972300130277L), expectation_type(0.60083414052614396452946629L), 
+            expectation_type(0.60469092387303831958656169L), expectation_type(0.60859676468244174638136309L), expectation_type(0.61255324513414244197781892L), expectation_type(0.61656203485412306714709585L), expectation_type(0.62062489782337269319628126L), expectation_type(0.62474370000389090955128904L), expectation_type(0.62892041777493104248579693L), expectation_type(0.63315714728712708681064736L), 
+            expectation_type(0.63745611485945216315842594L), expectation_type(0.64181968856454734937020250L), expectation_type(0.64625039117256444867978180L), expectation_type(0.65075091465319424303599275L), expectation_type(0.65532413647114914812073059L), expectation_type(0.65997313795348840448192621L), expectation_type(0.66470122505966689103991366L), expectation_type(0.66951195194943155768263933L), 
+            expectation_type(0.67440914782275190543588637L), expectation_type(0.67939694760384629445628723L), expectation_type(0.68447982716328846856933622L), expectation_type(0.68966264392506406806322705L), expectation_type(0.69495068389850889641505205L), expectation_type(0.70034971642068549186625387L), expectation_type(0.70586605820975206403776904L), expectation_type(0.71150664873729443325879048L), 
+            expectation_type(0.71727913945936837770152560L), expectation_type(0.72319200014692332390536441L), expectation_type(0.72925464648993591873678824L), expectation_type(0.73547759440747709659004092L), expectation_type(0.74187264821167249929128092L), expectation_type(0.74845313214526635827628608L), expectation_type(0.75523417813929314431455069L), expectation_type(0.76223308737894139898772102L), 
+            expectation_type(0.76946979014354445397615606L), expectation_type(0.77696743855888550001834253L), expectation_type(0.78475318227282791611785888L), expectation_type(0.79285920086473065534814573L), expectation_type(0.80132410465836278942261877L), expectation_type(0.81019487771676995816279493L), expectation_type(0.81952964234332621205215691L), expectation_type(0.82940171123596302000799357L), 
+            expectation_type(0.83990574028828638442358351L), expectation_type(0.85116747651166736686823054L), expectation_type(0.86336002946253700818118862L), expectation_type(0.87673287837407410881274868L), expectation_type(0.89166820379521830373051201L), expectation_type(0.90880378162845308259058488L), expectation_type(0.92935032978672016308870604L), expectation_type(0.95616620079454265269621639L)
+        }; // layer_bottom_endpoints[...]
+
+        static inline const expectation_type downscaled_layer_heights[n_boxes] = {
+            expectation_type(1.2351146328300566553479185e-11L), expectation_type(1.3807350642728476814621154e-11L), expectation_type(1.5147534563054146808011146e-11L), expectation_type(1.6098793690972244613378215e-11L), expectation_type(1.6861667307875770676624415e-11L), expectation_type(1.7510967804820013237812671e-11L), expectation_type(1.8083407915914701221125746e-11L), expectation_type(1.8599945883744803153793120e-11L), 
+            expectation_type(1.9073767748638445332888209e-11L), expectation_type(1.9513754404856825387651819e-11L), expectation_type(1.9926197082723082565770927e-11L), expectation_type(2.0315729751902631757000458e-11L), expectation_type(2.0685873328456484724512753e-11L), expectation_type(2.1039371617666893203394948e-11L), expectation_type(2.1378408307467779581781095e-11L), expectation_type(2.1704752476063372123965320e-11L), 
+            expectation_type(2.2019859283134460501872446e-11L), expectation_type(2.2324941543336673773639019e-11L), expectation_type(2.2621021794593558974075567e-11L), expectation_type(2.2908970949818290906674009e-11L), expectation_type(2.3189537503849814051438997e-11L), expectation_type(2.3463369954288163080240559e-11L), expectation_type(2.3731034257063001189254128e-11L), expectation_type(2.3993027589409928187328783e-11L), 
+            expectation_type(2.4249789326190202755560726e-11L), expectation_type(2.4501709885147497613107903e-11L), expectation_type(2.4749137922675819621975403e-11L), expectation_type(2.4992386238694940199324501e-11L), expectation_type(2.5231736661004352592078604e-11L), expectation_type(2.5467444115314067094717248e-11L), expectation_type(2.5699740039877140977641264e-11L), expectation_type(2.5928835268414323464493736e-11L), 
+            expectation_type(2.6154922478473479825531133e-11L), expectation_type(2.6378178282161543875103981e-11L), expectation_type(2.6598765020664436306434841e-11L), expectation_type(2.6816832311940704578665953e-11L), expectation_type(2.7032518391575126080479827e-11L), expectation_type(2.7245951279377550478135524e-11L), expectation_type(2.7457249798442751010118109e-11L), expectation_type(2.7666524468700419429164230e-11L), 
+            expectation_type(2.7873878293218275991390502e-11L), expectation_type(2.8079407452476445877475415e-11L), expectation_type(2.8283201919355501661492785e-11L), expectation_type(2.8485346005556595901091296e-11L), expectation_type(2.8685918848508941038336500e-11L), expectation_type(2.8884994846446523855565570e-11L), expectation_type(2.9082644048196591462948728e-11L), expectation_type(2.9278932503273045819716975e-11L), 
+            expectation_type(2.9473922577073419628723252e-11L), expectation_type(2.9667673235310609146327244e-11L), expectation_type(2.9860240301247553818607226e-11L), expectation_type(3.0051676688826462303266503e-11L), expectation_type(3.0242032614379305230532323e-11L), expectation_type(3.0431355789261171680039906e-11L), expectation_type(3.0619691595452943526308627e-11L), expectation_type(3.0807083245926553945915279e-11L), 
+            expectation_type(3.0993571931348248436793891e-11L), expectation_type(3.1179196954507285607523190e-11L), expectation_type(3.1363995853694856033976118e-11L), expectation_type(3.1548004516116873593067567e-11L), expectation_type(3.1731257282301538510585772e-11L), expectation_type(3.1913787042355528905394734e-11L), expectation_type(3.2095625324829112994437230e-11L), expectation_type(3.2276802378868501118876477e-11L), 
+            expectation_type(3.2457347250261778753717781e-11L), expectation_type(3.2637287851921423397526372e-11L), expectation_type(3.2816651029290556148980019e-11L), expectation_type(3.2995462621110728410241273e-11L), expectation_type(3.3173747515945353230052781e-11L), expectation_type(3.3351529704814136885070015e-11L), expectation_type(3.3528832330259428286308389e-11L), expectation_type(3.3705677732134746447010487e-11L), 
+            expectation_type(3.3882087490378407275814218e-11L), expectation_type(3.4058082465010750223745313e-11L), expectation_type(3.4233682833571615728553998e-11L), expectation_type(3.4408908126195144278821656e-11L), expectation_type(3.4583777258501394514066348e-11L), expectation_type(3.4758308562468481804025729e-11L), expectation_type(3.4932519815434719755062165e-11L), expectation_type(3.5106428267367429499072649e-11L), 
+            expectation_type(3.5280050666523511372392911e-11L), expectation_type(3.5453403283616415275873585e-11L), expectation_type(3.5626501934594680396204212e-11L), expectation_type(3.5799362002128636914848475e-11L), expectation_type(3.5971998455894078953792445e-11L), expectation_type(3.6144425871734647133104828e-11L), expectation_type(3.6316658449778227932273416e-11L), expectation_type(3.6488710031576820942682200e-11L), 
+            expectation_type(3.6660594116333986652095669e-11L), expectation_type(3.6832323876279115512629823e-11L), expectation_type(3.7003912171243308171279233e-11L), expectation_type(3.7175371562487586247306578e-11L), expectation_type(3.7346714325830426609830065e-11L), expectation_type(3.7517952464118197251097678e-11L), expectation_type(3.7689097719078940459539676e-11L), expectation_type(3.7860161582597072964439676e-11L), 
+            expectation_type(3.8031155307443929605706421e-11L), expectation_type(3.8202089917496645798283502e-11L), expectation_type(3.8372976217475635636902847e-11L), expectation_type(3.8543824802228859824522302e-11L), expectation_type(3.8714646065589175281450888e-11L), expectation_type(3.8885450208829302370840590e-11L), expectation_type(3.9056247248737323565207110e-11L), expectation_type(3.9227047025334127679545348e-11L), 
+            expectation_type(3.9397859209252826183239616e-11L), expectation_type(3.9568693308798883211172389e-11L), expectation_type(3.9739558676708510224162915e-11L), expectation_type(3.9910464516621772097070106e-11L), expectation_type(4.0081419889285826715916813e-11L), expectation_type(4.0252433718502768549763876e-11L), expectation_type(4.0423514796835662303707087e-11L), expectation_type(4.0594671791085530344385444e-11L), 
+            expectation_type(4.0765913247551292270632916e-11L), expectation_type(4.0937247597083942350743537e-11L), expectation_type(4.1108683159945586515444573e-11L), expectation_type(4.1280228150483341477496858e-11L), expectation_type(4.1451890681627520952504050e-11L), expectation_type(4.1623678769222994772111149e-11L), expectation_type(4.1795600336202103058968816e-11L), expectation_type(4.1967663216607036955529878e-11L), 
+            expectation_type(4.2139875159469157262020042e-11L), expectation_type(4.2312243832552310533085061e-11L), expectation_type(4.2484776825966816675012220e-11L), expectation_type(4.2657481655660441004946345e-11L), expectation_type(4.2830365766792325356564118e-11L), expectation_type(4.3003436536995535554419197e-11L), expectation_type(4.3176701279533584966072299e-11L), expectation_type(4.3350167246356014524431232e-11L), 
+            expectation_type(4.3523841631057847343016792e-11L), expectation_type(4.3697731571747489669400646e-11L), expectation_type(4.3871844153827418368933818e-11L), expectation_type(4.4046186412691777413906424e-11L), expectation_type(4.4220765336344801057460566e-11L), expectation_type(4.4395587867943788649204521e-11L), expectation_type(4.4570660908270174614704244e-11L), expectation_type(4.4745991318132066244951600e-11L), 
+            expectation_type(4.4921585920701460948052598e-11L), expectation_type(4.5097451503789202875580116e-11L), expectation_type(4.5273594822060595766676064e-11L), expectation_type(4.5450022599194453911546040e-11L), expectation_type(4.5626741529988245817882723e-11L), expectation_type(4.5803758282411864999444337e-11L), expectation_type(4.5981079499612448858354186e-11L), expectation_type(4.6158711801872559494483935e-11L), 
+            expectation_type(4.6336661788523939067063685e-11L), expectation_type(4.6514936039818956701616721e-11L), expectation_type(4.6693541118761773549412554e-11L), expectation_type(4.6872483572901167158873183e-11L), expectation_type(4.7051769936086875521198030e-11L), expectation_type(4.7231406730191244737303028e-11L), expectation_type(4.7411400466797891969018585e-11L), expectation_type(4.7591757648859026949737885e-11L), 
+            expectation_type(4.7772484772323010618934146e-11L), expectation_type(4.7953588327733668205895177e-11L), expectation_type(4.8135074801802816128534193e-11L), expectation_type(4.8316950678957407213352691e-11L), expectation_type(4.8499222442862646814086950e-11L), expectation_type(4.8681896577922383251427426e-11L), expectation_type(4.8864979570758029466534593e-11L), expectation_type(4.9048477911667228738206371e-11L), 
+            expectation_type(4.9232398096063435627431732e-11L), expectation_type(4.9416746625897543861701750e-11L), expectation_type(4.9601530011062655540381865e-11L), expectation_type(4.9786754770783050724254604e-11L), expectation_type(4.9972427434988383066180229e-11L), expectation_type(5.0158554545674095551013776e-11L), expectation_type(5.0345142658249020552547910e-11L), expectation_type(5.0532198342871100199811911e-11L), 
+            expectation_type(5.0719728185772136396101500e-11L), expectation_type(5.0907738790572454677944269e-11L), expectation_type(5.1096236779586342368578970e-11L), expectation_type(5.1285228795119099106384421e-11L), expectation_type(5.1474721500756516751905226e-11L), expectation_type(5.1664721582647585840249900e-11L), expectation_type(5.1855235750781207094718532e-11L), expectation_type(5.2046270740257669001856445e-11L), 
+            expectation_type(5.2237833312555636020109812e-11L), expectation_type(5.2429930256795376609160943e-11L), expectation_type(5.2622568390998945882861414e-11L), expectation_type(5.2815754563348024266056505e-11L), expectation_type(5.3009495653440101037536445e-11L), expectation_type(5.3203798573543680033192223e-11L), expectation_type(5.3398670269853174032706058e-11L), expectation_type(5.3594117723744144429338481e-11L), 
+            expectation_type(5.3790147953029533657105809e-11L), expectation_type(5.3986768013217529496243120e-11L), expectation_type(5.4183984998771692771443271e-11L), expectation_type(5.4381806044373973074742979e-11L), expectation_type(5.4580238326191230964467955e-11L), expectation_type(5.4779289063145879593233935e-11L), expectation_type(5.4978965518191253882948942e-11L), expectation_type(5.5179274999592311175764459e-11L), 
+            expectation_type(5.5380224862212263730977983e-11L), expectation_type(5.5581822508805740494246342e-11L), expectation_type(5.5784075391319073223575930e-11L), expectation_type(5.5986991012198300304008547e-11L), expectation_type(5.6190576925705480408418472e-11L), expectation_type(5.6394840739243907555136591e-11L), expectation_type(5.6599790114692819065000653e-11L), expectation_type(5.6805432769752188422661760e-11L), 
+            expectation_type(5.7011776479298196092272449e-11L), expectation_type(5.7218829076749972919678735e-11L), expectation_type(5.7426598455448212866468049e-11L), expectation_type(5.7635092570046254461085820e-11L), expectation_type(5.7844319437914233514968843e-11L), expectation_type(5.8054287140556913334320925e-11L), expectation_type(5.8265003825045802858648040e-11L), expectation_type(5.8476477705466177874137663e-11L), 
+            expectation_type(5.8688717064379625682844981e-11L), expectation_type(5.8901730254302739357633862e-11L), expectation_type(5.9115525699202593978859204e-11L), expectation_type(5.9330111896009644033557519e-11L), expectation_type(5.9545497416148688463855826e-11L), expectation_type(5.9761690907088557681564656e-11L), expectation_type(5.9978701093911185224362669e-11L), expectation_type(6.0196536780900735620202862e-11L), 
+            expectation_type(6.0415206853153469455888763e-11L), expectation_type(6.0634720278209036619219624e-11L), expectation_type(6.0855086107703899208445609e-11L), expectation_type(6.1076313479047596685493321e-11L), expectation_type(6.1298411617122577498736226e-11L), expectation_type(6.1521389836008333625949636e-11L), expectation_type(6.1745257540730587298207879e-11L), expectation_type(6.1970024229036292571310180e-11L), 
+            expectation_type(6.2195699493195228424086143e-11L), expectation_type(6.2422293021828974694635393e-11L), expectation_type(6.2649814601768077428995908e-11L), expectation_type(6.2878274119938226125517372e-11L), expectation_type(6.3107681565276281926770707e-11L), expectation_type(6.3338047030677013054428259e-11L), expectation_type(6.3569380714971411717340669e-11L), expectation_type(6.3801692924937485366042247e-11L), 
+            expectation_type(6.4034994077344434536072418e-11L), expectation_type(6.4269294701031149636677027e-11L), expectation_type(6.4504605439019979920482317e-11L), expectation_type(6.4740937050666749534439244e-11L), expectation_type(6.4978300413848018024560599e-11L), expectation_type(6.5216706527186605969616091e-11L), expectation_type(6.5456166512316430575997457e-11L), expectation_type(6.5696691616187721102528026e-11L), 
+            expectation_type(6.5938293213413709926344039e-11L), expectation_type(6.6180982808659921936598105e-11L), expectation_type(6.6424772039077212780356492e-11L), expectation_type(6.6669672676779735314702999e-11L), expectation_type(6.6915696631369043472086902e-11L), expectation_type(6.7162855952505573655117537e-11L), expectation_type(6.7411162832528775776516892e-11L), expectation_type(6.7660629609127199185500427e-11L), 
+            expectation_type(6.7911268768059873010734267e-11L), expectation_type(6.8163092945930355941107827e-11L), expectation_type(6.8416114933014867199449990e-11L), expectation_type(6.8670347676145948483349453e-11L), expectation_type(6.8925804281653145995594328e-11L), expectation_type(6.9182498018362242410511033e-11L), expectation_type(6.9440442320654610769736767e-11L), expectation_type(6.9699650791588305921857732e-11L), 
+            expectation_type(6.9960137206082554267205424e-11L), expectation_type(7.0221915514167349296502476e-11L), expectation_type(7.0484999844299908776921483e-11L), expectation_type(7.0749404506749799500858608e-11L), expectation_type(7.1015143997054587333292032e-11L), expectation_type(7.1282232999547923937640314e-11L), expectation_type(7.1550686390962037095008963e-11L), expectation_type(7.1820519244106649027997362e-11L), 
+            expectation_type(7.2091746831626406671279267e-11L), expectation_type(7.2364384629838969473619424e-11L), expectation_type(7.2638448322655964149849326e-11L), expectation_type(7.2913953805589081910106438e-11L), expectation_type(7.3190917189843662164523266e-11L), expectation_type(7.3469354806502177625557055e-11L), expectation_type(7.3749283210800109202321922e-11L), expectation_type(7.4030719186496775200879889e-11L), 
+            expectation_type(7.4313679750343758215135720e-11L), expectation_type(7.4598182156653654823056842e-11L), expectation_type(7.4884243901971957905544190e-11L), expectation_type(7.5171882729854969198632922e-11L), expectation_type(7.5461116635756730697350531e-11L), expectation_type(7.5751963872028057880637036e-11L), expectation_type(7.6044442953030855556230865e-11L), expectation_type(7.6338572660370998573486447e-11L), 
+            expectation_type(7.6634372048253164868309655e-11L), expectation_type(7.6931860448961117442143091e-11L), expectation_type(7.7231057478467045097684391e-11L), expectation_type(7.7531983042173689226725728e-11L), expectation_type(7.7834657340793105846955518e-11L), expectation_type(7.8139100876366038599800719e-11L), expectation_type(7.8445334458426009744109601e-11L), expectation_type(7.8753379210312372513485548e-11L), 
+            expectation_type(7.9063256575636709760761067e-11L), expectation_type(7.9374988324907110813894438e-11L), expectation_type(7.9688596562315011146516378e-11L), expectation_type(8.0004103732689438067629885e-11L), expectation_type(8.0321532628623670414478237e-11L), expectation_type(8.0640906397779491458591774e-11L), expectation_type(8.0962248550374392188746879e-11L), expectation_type(8.1285582966857267110949368e-11L), 
+            expectation_type(8.1610933905778337013934405e-11L), expectation_type(8.1938326011859233113590309e-11L), expectation_type(8.2267784324269384951706254e-11L), expectation_type(8.2599334285115070740930213e-11L), expectation_type(8.2933001748147713894012555e-11L), expectation_type(8.3268812987698243645276340e-11L), expectation_type(8.3606794707844581379567608e-11L), expectation_type(8.3946974051819567963356371e-11L), 
+            expectation_type(8.4289378611666911480887471e-11L), expectation_type(8.4634036438153009795302187e-11L), expectation_type(8.4980976050942788785028597e-11L), expectation_type(8.5330226449047995479997114e-11L), expectation_type(8.5681817121556696198335700e-11L), expectation_type(8.6035778058653053749087329e-11L), expectation_type(8.6392139762936795437769194e-11L), expectation_type(8.6750933261052135639266290e-11L), 
+            expectation_type(8.7112190115636283770907384e-11L), expectation_type(8.7475942437598051328162256e-11L), expectation_type(8.7842222898737470995160223e-11L), expectation_type(8.8211064744717757511726455e-11L), expectation_type(8.8582501808401374810453649e-11L), expectation_type(8.8956568523562427819631644e-11L), expectation_type(8.9333299938988071197089253e-11L), expectation_type(8.9712731732982122103774086e-11L), 
+            expectation_type(9.0094900228284580986069065e-11L), expectation_type(9.0479842407421304311807374e-11L), expectation_type(9.0867595928498637457112819e-11L), expectation_type(9.1258199141458405694723483e-11L), expectation_type(9.1651691104809277783244772e-11L), expectation_type(9.2048111602851161367687705e-11L), expectation_type(9.2447501163409963719046039e-11L), expectation_type(9.2849901076100756791258694e-11L), 
+            expectation_type(9.3255353411138123771906895e-11L), expectation_type(9.3663901038713236955653694e-11L), expectation_type(9.4075587648958025682925749e-11L), expectation_type(9.4490457772517640172087647e-11L), expectation_type(9.4908556801753304354790447e-11L), expectation_type(9.5329931012598580443935925e-11L), expectation_type(9.5754627587093042191394120e-11L), expectation_type(9.6182694636618375033097154e-11L), 
+            expectation_type(9.6614181225862992121380426e-11L), expectation_type(9.7049137397542378311058988e-11L), expectation_type(9.7487614197903552363149323e-11L), expectation_type(9.7929663703043273999581148e-11L), expectation_type(9.8375339046070920211403202e-11L), expectation_type(9.8824694445148317818689023e-11L), expectation_type(9.9277785232440250342045375e-11L), expectation_type(9.9734667884010860639937486e-11L), 
+            expectation_type(1.0019540005070275060238025e-10L), expectation_type(1.0066004059003723983889525e-10L), expectation_type(1.0112864959917599140364002e-10L), expectation_type(1.0160128844898604910700780e-10L), expectation_type(1.0207801981925226313251668e-10L), expectation_type(1.0255890773508311411275987e-10L), expectation_type(1.0304401760455808648571761e-10L), expectation_type(1.0353341625766699621100840e-10L), 
+            expectation_type(1.0402717198659405255211604e-10L), expectation_type(1.0452535458740193585243151e-10L), expectation_type(1.0502803540317381075987492e-10L), expectation_type(1.0553528736867397541482693e-10L), expectation_type(1.0604718505659078049353052e-10L), expectation_type(1.0656380472542854707645228e-10L), expectation_type(1.0708522436911847911361927e-10L), expectation_type(1.0761152376842201550340247e-10L), 
+            expectation_type(1.0814278454420370994831940e-10L), expectation_type(1.0867909021265457606283043e-10L), expectation_type(1.0922052624255090380809102e-10L), expectation_type(1.0976718011463785527102960e-10L), expectation_type(1.1031914138323169814590812e-10L), expectation_type(1.1087650174013935015257051e-10L), expectation_type(1.1143935508099900434025768e-10L), expectation_type(1.1200779757415100234199411e-10L), 
+            expectation_type(1.1258192773215384008551424e-10L), expectation_type(1.1316184648606624962640342e-10L), expectation_type(1.1374765726262272463170915e-10L), expectation_type(1.1433946606443667031245411e-10L), expectation_type(1.1493738155337258784862091e-10L), expectation_type(1.1554151513723637715520211e-10L), expectation_type(1.1615198105994099097429587e-10L), expectation_type(1.1676889649531333088851492e-10L), 
+            expectation_type(1.1739238164471747765031087e-10L), expectation_type(1.1802255983867913271825703e-10L), expectation_type(1.1865955764270655662681862e-10L), expectation_type(1.1930350496751436763021430e-10L), expectation_type(1.1995453518386835937962315e-10L), expectation_type(1.2061278524228206154517952e-10L), expectation_type(1.2127839579780915885900777e-10L), expectation_type(1.2195151134019016324312878e-10L), 
+            expectation_type(1.2263228032962696675599524e-10L), expectation_type(1.2332085533847516181243350e-10L), expectation_type(1.2401739319916137728742055e-10L), expectation_type(1.2472205515865142905917164e-10L), expectation_type(1.2543500703981491282029538e-10L), expectation_type(1.2615641941005307498566948e-10L), expectation_type(1.2688646775757949225518054e-10L), expectation_type(1.2762533267576738927858777e-10L), 
+            expectation_type(1.2837320005600345468419863e-10L), expectation_type(1.2913026128951591757871243e-10L), expectation_type(1.2989671347867457106025775e-10L), expectation_type(1.3067275965829254155096026e-10L), expectation_type(1.3145860902749408313728950e-10L), expectation_type(1.3225447719274972145483751e-10L), expectation_type(1.3306058642271989705943900e-10L), expectation_type(1.3387716591559109888799195e-10L), 
+            expectation_type(1.3470445207963459171546576e-10L), expectation_type(1.3554268882776750934347254e-10L), expectation_type(1.3639212788694961656989312e-10L), expectation_type(1.3725302912330677669728894e-10L), expectation_type(1.3812566088393446950721082e-10L), expectation_type(1.3901030035640199606895562e-10L), expectation_type(1.3990723394705073103085999e-10L), expectation_type(1.4081675767925843497265073e-10L), 
+            expectation_type(1.4173917761292676407306751e-10L), expectation_type(1.4267481028654131279350512e-10L), expectation_type(1.4362398318325346079882857e-10L), expectation_type(1.4458703522254170064792867e-10L), expectation_type(1.4556431727912780805454668e-10L), expectation_type(1.4655619273095107841253524e-10L), expectation_type(1.4756303803814288518930149e-10L), expectation_type(1.4858524335509511937079495e-10L), 
+            expectation_type(1.4962321317788086736435928e-10L), expectation_type(1.5067736702946533670893206e-10L), expectation_type(1.5174814018534105654914435e-10L), expectation_type(1.5283598444243544694260544e-10L), expectation_type(1.5394136893437284506208667e-10L), expectation_type(1.5506478099642909275854648e-10L), expectation_type(1.5620672708379717052624652e-10L), expectation_type(1.5736773374708972768219959e-10L), 
+            expectation_type(1.5854834866934164244890945e-10L), expectation_type(1.5974914176914624032514484e-10L), expectation_type(1.6097070637496620121377261e-10L), expectation_type(1.6221366047610865184275180e-10L), expectation_type(1.6347864805634815012058547e-10L), expectation_type(1.6476634051672649878474065e-10L), expectation_type(1.6607743819466053439718299e-10L), expectation_type(1.6741267198715495994693138e-10L), 
+            expectation_type(1.6877280508665455143006858e-10L), expectation_type(1.7015863483888731871049350e-10L), expectation_type(1.7157099473295725991364404e-10L), expectation_type(1.7301075653495338761206732e-10L), expectation_type(1.7447883257746345084595394e-10L), expectation_type(1.7597617821863075237622987e-10L), expectation_type(1.7750379448578726566862787e-10L), expectation_type(1.7906273092025489836395975e-10L), 
+            expectation_type(1.8065408864165103060454157e-10L), expectation_type(1.8227902365198943087726693e-10L), expectation_type(1.8393875040206216188537089e-10L), expectation_type(1.8563454564505540359749789e-10L), expectation_type(1.8736775260513069036988495e-10L), expectation_type(1.8913978549183741203725544e-10L), expectation_type(1.9095213439476423901075769e-10L), expectation_type(1.9280637059684649333942696e-10L), 
+            expectation_type(1.9470415234929344284379382e-10L), expectation_type(1.9664723115626586351797979e-10L), expectation_type(1.9863745862331579814317075e-10L), expectation_type(2.0067679393030967943657646e-10L), expectation_type(2.0276731199722518632074088e-10L), expectation_type(2.0491121241999742929115283e-10L), expectation_type(2.0711082926367590254516231e-10L), expectation_type(2.0936864181175901048572083e-10L), 
+            expectation_type(2.1168728638395822994586079e-10L), expectation_type(2.1406956935011965043505714e-10L), expectation_type(2.1651848148596826381918628e-10L), expectation_type(2.1903721383718580838924115e-10L), expectation_type(2.2162917528262300082216911e-10L), expectation_type(2.2429801201583004379829998e-10L), expectation_type(2.2704762919735137972324479e-10L), expectation_type(2.2988221506932795801301949e-10L), 
+            expectation_type(2.3280626787005035071681464e-10L), expectation_type(2.3582462594064006430482230e-10L), expectation_type(2.3894250148076573908583316e-10L), expectation_type(2.4216551848740247110056209e-10L), expectation_type(2.4549975550281833754933555e-10L), expectation_type(2.4895179390859167832729664e-10L), expectation_type(2.5252877263574701312765129e-10L), expectation_type(2.5623845032236139000296371e-10L), 
+            expectation_type(2.6008927614596261726255318e-10L), expectation_type(2.6409047079727471511685931e-10L), expectation_type(2.6825211935531578728715993e-10L), expectation_type(2.7258527818561692657201096e-10L), expectation_type(2.7710209843166797118565978e-10L), expectation_type(2.8181596922841404595383966e-10L), expectation_type(2.8674168446697897372869539e-10L), expectation_type(2.9189563782310399868196491e-10L), 
+            expectation_type(2.9729605188312774321607330e-10L), expectation_type(3.0296324863466159985724633e-10L), expectation_type(3.0891997043464004567449569e-10L), expectation_type(3.1519176296213813507337178e-10L), expectation_type(3.2180743479633511588197554e-10L), expectation_type(3.2879961239493993320793537e-10L), expectation_type(3.3620541475700044500958254e-10L), expectation_type(3.4406727946646356041423521e-10L), 
+            expectation_type(3.5243398189478684059534406e-10L), expectation_type(3.6136190321293461587181346e-10L), expectation_type(3.7091662218915224328070429e-10L), expectation_type(3.8117493303837393162333576e-10L), expectation_type(3.9222743069060383293682284e-10L), expectation_type(4.0418186177066849523384011e-10L), expectation_type(4.1716752390955558912312507e-10L), expectation_type(4.3134112333918680713306953e-10L), 
+            expectation_type(4.4689469708417315044162369e-10L), expectation_type(4.6406651604228807340886728e-10L), expectation_type(4.8315638751143972526351093e-10L), expectation_type(5.0454761375068115145887083e-10L), expectation_type(5.2873930854478343039510148e-10L), expectation_type(5.5639536279151539092525081e-10L), expectation_type(5.8842119461643711163245287e-10L), expectation_type(6.2608895769192708179456104e-10L), 
+            expectation_type(6.7125182715849933643021400e-10L), expectation_type(7.2673283085837794371461982e-10L), expectation_type(7.9708395651704413584495775e-10L), expectation_type(8.9021481939309920733347743e-10L), expectation_type(1.0213600906488221591052431e-9L), expectation_type(1.2246697773299728529509313e-9L), expectation_type(1.5983505610330731058468494e-9L), expectation_type(2.6126981865260323184618909e-9L)
+        }; // downscaled_layer_heights[...]
+    }; // struct ziggurat_layers_exponential_512<...>
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M24_HPP_INCLUDED
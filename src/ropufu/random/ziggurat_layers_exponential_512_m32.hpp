@@ -0,0 +1,431 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M32_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M32_HPP_INCLUDED
+
+#include "../arithmetic.hpp"
+#include "../probability/standard_exponential_distribution.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type, std::size_t t_engine_diameter>
+    struct ziggurat_layers_exponential_512;
+
+    /** @brief Ziggurat with 512 layers for exponential distribution and full 32-bit engines. */
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type>
+    struct ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(32ULL)>
+    {
+        using type = ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(32ULL)>;
+        using uniform_type = t_uniform_type;
+        using value_type = t_value_type;
+        using expectation_type = t_expectation_type;
+
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr std::size_t engine_diameter = aftermath::mersenne_number(32ULL); // 4294967295.
+
+        static inline const uniform_type upscaled_low_probabilities[n_boxes] = {
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL)
+        }; // upscaled_low_probabilities[...]
+
+        static inline const uniform_type upscaled_high_probabilities[n_boxes] = {
+            uniform_type(3841994812ULL), uniform_type(3914968419ULL), uniform_type(4041182637ULL), uniform_type(4100649783ULL), uniform_type(4135711426ULL), uniform_type(4159007770ULL), uniform_type(4175692019ULL), uniform_type(4188273671ULL), 
+            uniform_type(4198126459ULL), uniform_type(4206067852ULL), uniform_type(4212615832ULL), uniform_type(4218115110ULL), uniform_type(4222804323ULL), uniform_type(4226854109ULL), uniform_type(4230389847ULL), uniform_type(4233505802ULL), 
+            uniform_type(4236274271ULL), uniform_type(4238751665ULL), uniform_type(4240982670ULL), uniform_type(4243003164ULL), uniform_type(4244842295ULL), uniform_type(4246524003ULL), uniform_type(4248068137ULL), uniform_type(4249491301ULL), 
+            uniform_type(4250807497ULL), uniform_type(4252028614ULL), uniform_type(4253164822ULL), uniform_type(4254224866ULL), uniform_type(4255216317ULL), uniform_type(4256145758ULL), uniform_type(4257018945ULL), uniform_type(4257840931ULL), 
+            uniform_type(4258616173ULL), uniform_type(4259348618ULL), uniform_type(4260041772ULL), uniform_type(4260698765ULL), uniform_type(4261322396ULL), uniform_type(4261915178ULL), uniform_type(4262479374ULL), uniform_type(4263017027ULL), 
+            uniform_type(4263529986ULL), uniform_type(4264019930ULL), uniform_type(4264488387ULL), uniform_type(4264936749ULL), uniform_type(4265366289ULL), uniform_type(4265778173ULL), uniform_type(4266173469ULL), uniform_type(4266553161ULL), 
+            uniform_type(4266918154ULL), uniform_type(4267269284ULL), uniform_type(4267607323ULL), uniform_type(4267932985ULL), uniform_type(4268246933ULL), uniform_type(4268549781ULL), uniform_type(4268842102ULL), uniform_type(4269124426ULL), 
+            uniform_type(4269397252ULL), uniform_type(4269661042ULL), uniform_type(4269916228ULL), uniform_type(4270163215ULL), uniform_type(4270402384ULL), uniform_type(4270634089ULL), uniform_type(4270858664ULL), uniform_type(4271076423ULL), 
+            uniform_type(4271287662ULL), uniform_type(4271492658ULL), uniform_type(4271691672ULL), uniform_type(4271884953ULL), uniform_type(4272072732ULL), uniform_type(4272255231ULL), uniform_type(4272432658ULL), uniform_type(4272605209ULL), 
+            uniform_type(4272773073ULL), uniform_type(4272936424ULL), uniform_type(4273095433ULL), uniform_type(4273250257ULL), uniform_type(4273401049ULL), uniform_type(4273547952ULL), uniform_type(4273691103ULL), uniform_type(4273830632ULL), 
+            uniform_type(4273966665ULL), uniform_type(4274099317ULL), uniform_type(4274228704ULL), uniform_type(4274354931ULL), uniform_type(4274478102ULL), uniform_type(4274598315ULL), uniform_type(4274715663ULL), uniform_type(4274830237ULL), 
+            uniform_type(4274942121ULL), uniform_type(4275051398ULL), uniform_type(4275158146ULL), uniform_type(4275262441ULL), uniform_type(4275364354ULL), uniform_type(4275463955ULL), uniform_type(4275561311ULL), uniform_type(4275656484ULL), 
+            uniform_type(4275749536ULL), uniform_type(4275840526ULL), uniform_type(4275929509ULL), uniform_type(4276016541ULL), uniform_type(4276101673ULL), uniform_type(4276184955ULL), uniform_type(4276266437ULL), uniform_type(4276346163ULL), 
+            uniform_type(4276424179ULL), uniform_type(4276500528ULL), uniform_type(4276575252ULL), uniform_type(4276648390ULL), uniform_type(4276719981ULL), uniform_type(4276790062ULL), uniform_type(4276858670ULL), uniform_type(4276925838ULL), 
+            uniform_type(4276991601ULL), uniform_type(4277055991ULL), uniform_type(4277119038ULL), uniform_type(4277180773ULL), uniform_type(4277241226ULL), uniform_type(4277300423ULL), uniform_type(4277358394ULL), uniform_type(4277415163ULL), 
+            uniform_type(4277470756ULL), uniform_type(4277525199ULL), uniform_type(4277578514ULL), uniform_type(4277630726ULL), uniform_type(4277681856ULL), uniform_type(4277731925ULL), uniform_type(4277780956ULL), uniform_type(4277828969ULL), 
+            uniform_type(4277875982ULL), uniform_type(4277922016ULL), uniform_type(4277967088ULL), uniform_type(4278011217ULL), uniform_type(4278054419ULL), uniform_type(4278096713ULL), uniform_type(4278138114ULL), uniform_type(4278178639ULL), 
+            uniform_type(4278218301ULL), uniform_type(4278257118ULL), uniform_type(4278295102ULL), uniform_type(4278332269ULL), uniform_type(4278368632ULL), uniform_type(4278404203ULL), uniform_type(4278438997ULL), uniform_type(4278473026ULL), 
+            uniform_type(4278506301ULL), uniform_type(4278538835ULL), uniform_type(4278570639ULL), uniform_type(4278601724ULL), uniform_type(4278632102ULL), uniform_type(4278661782ULL), uniform_type(4278690775ULL), uniform_type(4278719091ULL), 
+            uniform_type(4278746739ULL), uniform_type(4278773730ULL), uniform_type(4278800071ULL), uniform_type(4278825773ULL), uniform_type(4278850843ULL), uniform_type(4278875291ULL), uniform_type(4278899123ULL), uniform_type(4278922349ULL), 
+            uniform_type(4278944975ULL), uniform_type(4278967010ULL), uniform_type(4278988461ULL), uniform_type(4279009335ULL), uniform_type(4279029638ULL), uniform_type(4279049377ULL), uniform_type(4279068560ULL), uniform_type(4279087191ULL), 
+            uniform_type(4279105278ULL), uniform_type(4279122827ULL), uniform_type(4279139842ULL), uniform_type(4279156331ULL), uniform_type(4279172298ULL), uniform_type(4279187748ULL), uniform_type(4279202687ULL), uniform_type(4279217121ULL), 
+            uniform_type(4279231053ULL), uniform_type(4279244488ULL), uniform_type(4279257432ULL), uniform_type(4279269888ULL), uniform_type(4279281861ULL), uniform_type(4279293355ULL), uniform_type(4279304374ULL), uniform_type(4279314923ULL), 
+            uniform_type(4279325004ULL), uniform_type(4279334622ULL), uniform_type(4279343781ULL), uniform_type(4279352483ULL), uniform_type(4279360732ULL), uniform_type(4279368532ULL), uniform_type(4279375886ULL), uniform_type(4279382795ULL), 
+            uniform_type(4279389265ULL), uniform_type(4279395297ULL), uniform_type(4279400894ULL), uniform_type(4279406059ULL), uniform_type(4279410794ULL), uniform_type(4279415102ULL), uniform_type(4279418985ULL), uniform_type(4279422446ULL), 
+            uniform_type(4279425486ULL), uniform_type(4279428107ULL), uniform_type(4279430313ULL), uniform_type(4279432104ULL), uniform_type(4279433482ULL), uniform_type(4279434450ULL), uniform_type(4279435009ULL), uniform_type(4279435160ULL), 
+            uniform_type(4279434904ULL), uniform_type(4279434245ULL), uniform_type(4279433181ULL), uniform_type(4279431716ULL), uniform_type(4279429850ULL), uniform_type(4279427584ULL), uniform_type(4279424920ULL), uniform_type(4279421858ULL), 
+            uniform_type(4279418399ULL), uniform_type(4279414544ULL), uniform_type(4279410293ULL), uniform_type(4279405648ULL), uniform_type(4279400609ULL), uniform_type(4279395176ULL), uniform_type(4279389351ULL), uniform_type(4279383133ULL), 
+            uniform_type(4279376522ULL), uniform_type(4279369519ULL), uniform_type(4279362125ULL), uniform_type(4279354339ULL), uniform_type(4279346161ULL), uniform_type(4279337591ULL), uniform_type(4279328629ULL), uniform_type(4279319276ULL), 
+            uniform_type(4279309530ULL), uniform_type(4279299392ULL), uniform_type(4279288860ULL), uniform_type(4279277936ULL), uniform_type(4279266618ULL), uniform_type(4279254905ULL), uniform_type(4279242798ULL), uniform_type(4279230294ULL), 
+            uniform_type(4279217395ULL), uniform_type(4279204098ULL), uniform_type(4279190403ULL), uniform_type(4279176309ULL), uniform_type(4279161815ULL), uniform_type(4279146919ULL), uniform_type(4279131621ULL), uniform_type(4279115920ULL), 
+            uniform_type(4279099814ULL), uniform_type(4279083301ULL), uniform_type(4279066381ULL), uniform_type(4279049051ULL), uniform_type(4279031311ULL), uniform_type(4279013158ULL), uniform_type(4278994591ULL), uniform_type(4278975608ULL), 
+            uniform_type(4278956207ULL), uniform_type(4278936386ULL), uniform_type(4278916144ULL), uniform_type(4278895478ULL), uniform_type(4278874385ULL), uniform_type(4278852865ULL), uniform_type(4278830914ULL), uniform_type(4278808530ULL), 
+            uniform_type(4278785710ULL), uniform_type(4278762453ULL), uniform_type(4278738755ULL), uniform_type(4278714613ULL), uniform_type(4278690026ULL), uniform_type(4278664990ULL), uniform_type(4278639501ULL), uniform_type(4278613558ULL), 
+            uniform_type(4278587157ULL), uniform_type(4278560294ULL), uniform_type(4278532967ULL), uniform_type(4278505172ULL), uniform_type(4278476906ULL), uniform_type(4278448164ULL), uniform_type(4278418944ULL), uniform_type(4278389242ULL), 
+            uniform_type(4278359053ULL), uniform_type(4278328374ULL), uniform_type(4278297201ULL), uniform_type(4278265529ULL), uniform_type(4278233355ULL), uniform_type(4278200674ULL), uniform_type(4278167481ULL), uniform_type(4278133772ULL), 
+            uniform_type(4278099542ULL), uniform_type(4278064787ULL), uniform_type(4278029502ULL), uniform_type(4277993681ULL), uniform_type(4277957319ULL), uniform_type(4277920411ULL), uniform_type(4277882952ULL), uniform_type(4277844937ULL), 
+            uniform_type(4277806359ULL), uniform_type(4277767213ULL), uniform_type(4277727492ULL), uniform_type(4277687192ULL), uniform_type(4277646305ULL), uniform_type(4277604825ULL), uniform_type(4277562747ULL), uniform_type(4277520062ULL), 
+            uniform_type(4277476766ULL), uniform_type(4277432850ULL), uniform_type(4277388307ULL), uniform_type(4277343130ULL), uniform_type(4277297313ULL), uniform_type(4277250847ULL), uniform_type(4277203724ULL), uniform_type(4277155937ULL), 
+            uniform_type(4277107478ULL), uniform_type(4277058338ULL), uniform_type(4277008509ULL), uniform_type(4276957982ULL), uniform_type(4276906748ULL), uniform_type(4276854798ULL), uniform_type(4276802124ULL), uniform_type(4276748715ULL), 
+            uniform_type(4276694561ULL), uniform_type(4276639654ULL), uniform_type(4276583982ULL), uniform_type(4276527536ULL), uniform_type(4276470304ULL), uniform_type(4276412276ULL), uniform_type(4276353441ULL), uniform_type(4276293788ULL), 
+            uniform_type(4276233304ULL), uniform_type(4276171978ULL), uniform_type(4276109797ULL), uniform_type(4276046750ULL), uniform_type(4275982822ULL), uniform_type(4275918003ULL), uniform_type(4275852277ULL), uniform_type(4275785631ULL), 
+            uniform_type(4275718051ULL), uniform_type(4275649523ULL), uniform_type(4275580032ULL), uniform_type(4275509563ULL), uniform_type(4275438100ULL), uniform_type(4275365628ULL), uniform_type(4275292130ULL), uniform_type(4275217590ULL), 
+            uniform_type(4275141991ULL), uniform_type(4275065315ULL), uniform_type(4274987544ULL), uniform_type(4274908661ULL), uniform_type(4274828646ULL), uniform_type(4274747480ULL), uniform_type(4274665142ULL), uniform_type(4274581614ULL), 
+            uniform_type(4274496874ULL), uniform_type(4274410901ULL), uniform_type(4274323673ULL), uniform_type(4274235167ULL), uniform_type(4274145360ULL), uniform_type(4274054229ULL), uniform_type(4273961750ULL), uniform_type(4273867897ULL), 
+            uniform_type(4273772645ULL), uniform_type(4273675967ULL), uniform_type(4273577837ULL), uniform_type(4273478226ULL), uniform_type(4273377107ULL), uniform_type(4273274450ULL), uniform_type(4273170224ULL), uniform_type(4273064399ULL), 
+            uniform_type(4272956943ULL), uniform_type(4272847823ULL), uniform_type(4272737005ULL), uniform_type(4272624455ULL), uniform_type(4272510138ULL), uniform_type(4272394015ULL), uniform_type(4272276050ULL), uniform_type(4272156204ULL), 
+            uniform_type(4272034436ULL), uniform_type(4271910705ULL), uniform_type(4271784969ULL), uniform_type(4271657184ULL), uniform_type(4271527305ULL), uniform_type(4271395285ULL), uniform_type(4271261076ULL), uniform_type(4271124629ULL), 
+            uniform_type(4270985892ULL), uniform_type(4270844813ULL), uniform_type(4270701338ULL), uniform_type(4270555410ULL), uniform_type(4270406971ULL), uniform_type(4270255962ULL), uniform_type(4270102320ULL), uniform_type(4269945983ULL), 
+            uniform_type(4269786883ULL), uniform_type(4269624952ULL), uniform_type(4269460120ULL), uniform_type(4269292314ULL), uniform_type(4269121457ULL), uniform_type(4268947473ULL), uniform_type(4268770279ULL), uniform_type(4268589793ULL), 
+            uniform_type(4268405926ULL), uniform_type(4268218589ULL), uniform_type(4268027688ULL), uniform_type(4267833127ULL), uniform_type(4267634805ULL), uniform_type(4267432618ULL), uniform_type(4267226458ULL), uniform_type(4267016212ULL), 
+            uniform_type(4266801764ULL), uniform_type(4266582993ULL), uniform_type(4266359771ULL), uniform_type(4266131969ULL), uniform_type(4265899450ULL), uniform_type(4265662072ULL), uniform_type(4265419688ULL), uniform_type(4265172143ULL), 
+            uniform_type(4264919276ULL), uniform_type(4264660922ULL), uniform_type(4264396906ULL), uniform_type(4264127045ULL), uniform_type(4263851151ULL), uniform_type(4263569024ULL), uniform_type(4263280459ULL), uniform_type(4262985237ULL), 
+            uniform_type(4262683134ULL), uniform_type(4262373911ULL), uniform_type(4262057322ULL), uniform_type(4261733106ULL), uniform_type(4261400991ULL), uniform_type(4261060693ULL), uniform_type(4260711910ULL), uniform_type(4260354330ULL), 
+            uniform_type(4259987622ULL), uniform_type(4259611438ULL), uniform_type(4259225414ULL), uniform_type(4258829166ULL), uniform_type(4258422289ULL), uniform_type(4258004356ULL), uniform_type(4257574919ULL), uniform_type(4257133502ULL), 
+            uniform_type(4256679605ULL), uniform_type(4256212698ULL), uniform_type(4255732221ULL), uniform_type(4255237581ULL), uniform_type(4254728150ULL), uniform_type(4254203261ULL), uniform_type(4253662208ULL), uniform_type(4253104240ULL), 
+            uniform_type(4252528559ULL), uniform_type(4251934315ULL), uniform_type(4251320602ULL), uniform_type(4250686456ULL), uniform_type(4250030846ULL), uniform_type(4249352672ULL), uniform_type(4248650755ULL), uniform_type(4247923834ULL), 
+            uniform_type(4247170556ULL), uniform_type(4246389467ULL), uniform_type(4245579007ULL), uniform_type(4244737493ULL), uniform_type(4243863113ULL), uniform_type(4242953909ULL), uniform_type(4242007767ULL), uniform_type(4241022394ULL), 
+            uniform_type(4239995304ULL), uniform_type(4238923798ULL), uniform_type(4237804935ULL), uniform_type(4236635510ULL), uniform_type(4235412022ULL), uniform_type(4234130637ULL), uniform_type(4232787149ULL), uniform_type(4231376934ULL), 
+            uniform_type(4229894897ULL), uniform_type(4228335410ULL), uniform_type(4226692238ULL), uniform_type(4224958459ULL), uniform_type(4223126366ULL), uniform_type(4221187349ULL), uniform_type(4219131763ULL), uniform_type(4216948762ULL), 
+            uniform_type(4214626116ULL), uniform_type(4212149971ULL), uniform_type(4209504580ULL), uniform_type(4206671963ULL), uniform_type(4203631500ULL), uniform_type(4200359423ULL), uniform_type(4196828199ULL), uniform_type(4193005750ULL), 
+            uniform_type(4188854476ULL), uniform_type(4184330017ULL), uniform_type(4179379659ULL), uniform_type(4173940278ULL), uniform_type(4167935641ULL), uniform_type(4161272817ULL), uniform_type(4153837357ULL), uniform_type(4145486688ULL), 
+            uniform_type(4136040938ULL), uniform_type(4125269914ULL), uniform_type(4112874239ULL), uniform_type(4098457340ULL), uniform_type(4081482682ULL), uniform_type(4061206340ULL), uniform_type(4036566618ULL), uniform_type(4005995199ULL), 
+            uniform_type(3967076375ULL), uniform_type(3915890811ULL), uniform_type(3845644276ULL), uniform_type(3743482411ULL), uniform_type(3581951859ULL), uniform_type(3290840426ULL), uniform_type(2627499579ULL), uniform_type(0ULL)
+        }; // upscaled_high_probabilities[...]
+
+        static inline const value_type layer_left_endpoints[n_boxes] = {
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L)
+        }; // layer_left_endpoints[...]
+
+        static inline const value_type downscaled_layer_widths[n_boxes] = {
+            value_type(2.2076396191097728780026107e-9L), value_type(1.9748089754016931404594637e-9L), value_type(1.8000869951658194198084603e-9L), value_type(1.6937219334060439479041055e-9L), value_type(1.6170927511446439743149821e-9L), value_type(1.5571315234942718578032027e-9L), value_type(1.5078396783706745105311835e-9L), value_type(1.4659655542120738746972316e-9L), 
+            value_type(1.4295487045408184365266285e-9L), value_type(1.3973159347025507831779457e-9L), value_type(1.3683935706638250246247276e-9L), value_type(1.3421560686602903734536982e-9L), value_type(1.3181401405116842598788433e-9L), value_type(1.2959930777059121502719398e-9L), value_type(1.2754401349072291198335627e-9L), value_type(1.2562631159166286398695412e-9L), 
+            value_type(1.2382858412116598450573759e-9L), value_type(1.2213640032538799340108767e-9L), value_type(1.2053779101302725913012127e-9L), value_type(1.1902271837310443507766367e-9L), value_type(1.1758268129000769401431320e-9L), value_type(1.1621041661492125244362466e-9L), value_type(1.1489966969165352540808587e-9L), value_type(1.1364501572037378608694194e-9L), 
+            value_type(1.1244171901456404963874742e-9L), value_type(1.1128562089581850792591009e-9L), value_type(1.1017304950567951122353362e-9L), value_type(1.0910074658482215633608592e-9L), value_type(1.0806580752691309518307503e-9L), value_type(1.0706563191939009629622573e-9L), value_type(1.0609788244344001295901511e-9L), value_type(1.0516045049271523691851327e-9L), 
+            value_type(1.0425142723409039754720766e-9L), value_type(1.0336907910815805034615940e-9L), value_type(1.0251182697615863499919967e-9L), value_type(1.0167822828066622799024600e-9L), value_type(1.0086696171184867072307181e-9L), value_type(1.0007681396838150770098292e-9L), value_type(9.9306668278645243746700467e-10L), value_type(9.8555494408507974762324624e-10L), 
+            value_type(9.7822339930402055517116666e-10L), value_type(9.7106322567265382306743945e-10L), value_type(9.6406623456301625233677340e-10L), value_type(9.5722481203000381584787693e-10L), value_type(9.5053186616665868453052499e-10L), value_type(9.4398078035776231846902229e-10L), value_type(9.3756537165572282063478484e-10L), value_type(9.3127985361933570873256597e-10L), 
+            value_type(9.2511880305298566312546006e-10L), value_type(9.1907713016487451480070402e-10L), value_type(9.1315005173080702598021989e-10L), value_type(9.0733306690726686705228083e-10L), value_type(9.0162193538584557743117761e-10L), value_type(8.9601265762206554876567176e-10L), value_type(8.9050145690649911565909302e-10L), value_type(8.8508476307583833267882141e-10L), 
+            value_type(8.7975919768704111993777745e-10L), value_type(8.7452156049955013673267554e-10L), value_type(8.6936881712941369117591464e-10L), value_type(8.6429808775539985470751612e-10L), value_type(8.5930663677127404470009190e-10L), value_type(8.5439186329063088879284305e-10L), value_type(8.4955129242130476606097162e-10L), value_type(8.4478256723565821430405485e-10L), 
+            value_type(8.4008344137115569561510537e-10L), value_type(8.3545177220273454677027204e-10L), value_type(8.3088551453472305037593275e-10L), value_type(8.2638271476554450515152263e-10L), value_type(8.2194150548328568858020964e-10L), value_type(8.1756010045448339082738947e-10L), value_type(8.1323678997226671138029526e-10L), value_type(8.0896993653334817086150899e-10L), 
+            value_type(8.0475797081633727495192992e-10L), value_type(8.0059938793650242928158889e-10L), value_type(7.9649274395447118567315830e-10L), value_type(7.9243665261846946243343823e-10L), value_type(7.8842978232158778771166738e-10L), value_type(7.8447085325725299089875494e-10L), value_type(7.8055863475759995884460593e-10L), value_type(7.7669194280080002110739369e-10L), 
+            value_type(7.7286963767462766653374871e-10L), value_type(7.6909062178465089429752307e-10L), value_type(7.6535383759642596684574085e-10L), value_type(7.6165826570197643862544723e-10L), value_type(7.5800292300164945290435166e-10L), value_type(7.5438686099317857381758699e-10L), value_type(7.5080916416044992827526495e-10L), value_type(7.4726894845507431644756876e-10L), 
+            value_type(7.4376535986441853877047015e-10L), value_type(7.4029757306025009623513166e-10L), value_type(7.3686479012260563713278510e-10L), value_type(7.3346623933390948501565307e-10L), value_type(7.3010117403874824267839832e-10L), value_type(7.2676887156505435194619081e-10L), value_type(7.2346863220276874881392104e-10L), value_type(7.2019977823634320500020449e-10L), 
+            value_type(7.1696165302770911268022102e-10L), value_type(7.1375362014658361043615318e-10L), value_type(7.1057506254520809509131469e-10L), value_type(7.0742538177482014007106567e-10L), value_type(7.0430399724134928719757639e-10L), value_type(7.0121034549800157326537546e-10L), value_type(6.9814387957255832784925381e-10L), value_type(6.9510406832736293723866181e-10L), 
+            value_type(6.9209039585010599781029046e-10L), value_type(6.8910236087364556334301508e-10L), value_type(6.8613947622321591452265194e-10L), value_type(6.8320126828948625152580656e-10L), value_type(6.8028727652603066355822319e-10L), value_type(6.7739705296986332668134651e-10L), value_type(6.7453016178377872675522099e-10L), value_type(6.7168617881931634687772870e-10L), 
+            value_type(6.6886469119924319816228274e-10L), value_type(6.6606529691851626455412649e-10L), value_type(6.6328760446275079205230138e-10L), value_type(6.6053123244327975936523277e-10L), value_type(6.5779580924794516708581350e-10L), value_type(6.5508097270681329263918809e-10L), value_type(6.5238636977205406833076216e-10L), value_type(6.4971165621126951518131672e-10L), 
+            value_type(6.4705649631359794908387887e-10L), value_type(6.4442056260795969120352289e-10L), value_type(6.4180353559284646618601838e-10L), value_type(6.3920510347709074767668961e-10L), value_type(6.3662496193108318370685100e-10L), value_type(6.3406281384793606365038905e-10L), value_type(6.3151836911411872000825050e-10L), value_type(6.2899134438911692701504579e-10L), 
+            value_type(6.2648146289369288819656284e-10L), value_type(6.2398845420634541110448303e-10L), value_type(6.2151205406759145524644593e-10L), value_type(6.1905200419171050635752671e-10L), value_type(6.1660805208561226685093129e-10L), value_type(6.1417995087450604196977451e-10L), value_type(6.1176745913406702102690127e-10L), value_type(6.0937034072881047462440157e-10L), 
+            value_type(6.0698836465639977808172381e-10L), value_type(6.0462130489762818982222905e-10L), value_type(6.0226894027182751806875972e-10L), value_type(5.9993105429746925267375444e-10L), value_type(5.9760743505773547027438079e-10L), value_type(5.9529787507084788575058601e-10L), value_type(5.9300217116495386349355472e-10L), value_type(5.9072012435737805761831776e-10L), 
+            value_type(5.8845153973805765759349561e-10L), value_type(5.8619622635698800889967565e-10L), value_type(5.8395399711551368901298179e-10L), value_type(5.8172466866130797682563020e-10L), value_type(5.7950806128689108614179943e-10L), value_type(5.7730399883154456685172157e-10L), value_type(5.7511230858648593479813974e-10L), value_type(5.7293282120317389562306547e-10L), 
+            value_type(5.7076537060462049995775103e-10L), value_type(5.6860979389959222676277039e-10L), value_type(5.6646593129958735673313683e-10L), value_type(5.6433362603848208556827959e-10L), value_type(5.6221272429474265358251738e-10L), value_type(5.6010307511610534859083927e-10L), value_type(5.5800453034663058728939362e-10L), value_type(5.5591694455604140961764155e-10L), 
+            value_type(5.5384017497126064317359961e-10L), value_type(5.5177408141006472222168749e-10L), value_type(5.4971852621677568903606998e-10L), value_type(5.4767337419991627444597261e-10L), value_type(5.4563849257175615905626636e-10L), value_type(5.4361375088968056568926030e-10L), value_type(5.4159902099931523557283405e-10L), value_type(5.3959417697934460362036811e-10L), 
+            value_type(5.3759909508796261927102865e-10L), value_type(5.3561365371089816580435546e-10L), value_type(5.3363773331095941941683952e-10L), value_type(5.3167121637904376586948208e-10L), value_type(5.2971398738656206304135935e-10L), value_type(5.2776593273922810777313400e-10L), value_type(5.2582694073216614015686457e-10L), value_type(5.2389690150629110282741946e-10L), 
+            value_type(5.2197570700591817146041682e-10L), value_type(5.2006325093755978994441961e-10L), value_type(5.1815942872987008368825718e-10L), value_type(5.1626413749469809113466317e-10L), value_type(5.1437727598921275044955464e-10L), value_type(5.1249874457906400900981670e-10L), value_type(5.1062844520254579099822458e-10L), value_type(5.0876628133572786622967180e-10L), 
+            value_type(5.0691215795852491420716339e-10L), value_type(5.0506598152167227410954064e-10L), value_type(5.0322765991457901656695475e-10L), value_type(5.0139710243403006916567032e-10L), value_type(4.9957421975371017698969208e-10L), value_type(4.9775892389452348437736366e-10L), value_type(4.9595112819568348655365710e-10L), value_type(4.9415074728654902189005257e-10L), 
+            value_type(4.9235769705918285913626367e-10L), value_type(4.9057189464161028085595944e-10L), value_type(4.8879325837175587618381155e-10L), value_type(4.8702170777203753451800001e-10L), value_type(4.8525716352459737840259843e-10L), value_type(4.8349954744715009009200955e-10L), value_type(4.8174878246942977350525851e-10L), value_type(4.8000479261021715278241891e-10L), 
+            value_type(4.7826750295492954169402740e-10L), value_type(4.7653683963375662591025332e-10L), value_type(4.7481272980032568373436215e-10L), value_type(4.7309510161088043141367181e-10L), value_type(4.7138388420395821757726409e-10L), value_type(4.6967900768055080868000034e-10L), value_type(4.6798040308473450447668138e-10L), value_type(4.6628800238475580038372354e-10L), 
+            value_type(4.6460173845455927294154841e-10L), value_type(4.6292154505574480626208485e-10L), value_type(4.6124735681994170208756786e-10L), value_type(4.5957910923158762461849409e-10L), value_type(4.5791673861110072427542266e-10L), value_type(4.5626018209843366269427163e-10L), value_type(4.5460937763699862514020517e-10L), value_type(4.5296426395795275675442210e-10L), 
+            value_type(4.5132478056483379618684466e-10L), value_type(4.4969086771853600475537830e-10L), value_type(4.4806246642261680182370949e-10L), value_type(4.4643951840892481809554182e-10L), value_type(4.4482196612354036845230951e-10L), value_type(4.4320975271301962526098225e-10L), value_type(4.4160282201093404217553969e-10L), value_type(4.4000111852469683775771445e-10L), 
+            value_type(4.3840458742266859813900606e-10L), value_type(4.3681317452153429880863136e-10L), value_type(4.3522682627394427779627267e-10L), value_type(4.3364548975641191636368077e-10L), value_type(4.3206911265746099914980691e-10L), value_type(4.3049764326601593384026654e-10L), value_type(4.2893103046002821115001973e-10L), value_type(4.2736922369533267950162290e-10L), 
+            value_type(4.2581217299472739552130553e-10L), value_type(4.2425982893727099162067727e-10L), value_type(4.2271214264779167573103199e-10L), value_type(4.2116906578660214594719763e-10L), value_type(4.1963055053941486464564036e-10L), value_type(4.1809654960745229278424249e-10L), value_type(4.1656701619774683577667058e-10L), value_type(4.1504190401362539776144660e-10L), 
+            value_type(4.1352116724537358144513243e-10L), value_type(4.1200476056107470617269471e-10L), value_type(4.1049263909761894764062002e-10L), value_type(4.0898475845187802888674944e-10L), value_type(4.0748107467204101402503997e-10L), value_type(4.0598154424910687379668176e-10L), value_type(4.0448612410852960552784175e-10L), value_type(4.0299477160201179965917802e-10L), 
+            value_type(4.0150744449944265077762212e-10L), value_type(4.0002410098097651316549856e-10L), value_type(3.9854469962924819940910658e-10L), value_type(3.9706919942172131569645151e-10L), value_type(3.9559755972316601919487422e-10L), value_type(3.9412974027826267144205533e-10L), value_type(3.9266570120432794711180450e-10L), value_type(3.9120540298416003992827725e-10L), 
+            value_type(3.8974880645899968699361633e-10L), value_type(3.8829587282160380945521059e-10L), value_type(3.8684656360942864135657727e-10L), value_type(3.8540084069791928977328084e-10L), value_type(3.8395866629390273801163062e-10L), value_type(3.8252000292908136981895415e-10L), value_type(3.8108481345362415629244260e-10L), value_type(3.7965306102985270854805080e-10L), 
+            value_type(3.7822470912601945828770043e-10L), value_type(3.7679972151017528524502152e-10L), value_type(3.7537806224412396515707346e-10L), value_type(3.7395969567746086445906131e-10L), value_type(3.7254458644169335838539903e-10L), value_type(3.7113269944444049763528930e-10L), value_type(3.6972399986370949527342043e-10L), value_type(3.6831845314224665013304108e-10L), 
+            value_type(3.6691602498196036571373484e-10L), value_type(3.6551668133841396446147574e-10L), value_type(3.6412038841538603642348216e-10L), value_type(3.6272711265949609862222532e-10L), value_type(3.6133682075489337712670847e-10L), value_type(3.5994947961800655774768054e-10L), value_type(3.5856505639235238357754146e-10L), value_type(3.5718351844340100826402445e-10L), 
+            value_type(3.5580483335349604297596614e-10L), value_type(3.5442896891682726251426256e-10L), value_type(3.5305589313445396196415955e-10L), value_type(3.5168557420937697969710138e-10L), value_type(3.5031798054165742543030800e-10L), value_type(3.4895308072358017345701991e-10L), value_type(3.4759084353486020108500991e-10L), value_type(3.4623123793788987077871438e-10L), 
+            value_type(3.4487423307302527150252640e-10L), value_type(3.4351979825390975031890584e-10L), value_type(3.4216790296283277941263282e-10L), value_type(3.4081851684612231639754093e-10L), value_type(3.3947160970956882701833275e-10L), value_type(3.3812715151387914918965327e-10L), value_type(3.3678511237015838571763872e-10L), value_type(3.3544546253541802002393541e-10L), 
+            value_type(3.3410817240810845473503536e-10L), value_type(3.3277321252367417710509830e-10L), value_type(3.3144055355012975790064098e-10L), value_type(3.3011016628365489158098252e-10L), value_type(3.2878202164420668534749968e-10L), value_type(3.2745609067114740289383755e-10L), value_type(3.2613234451888586545237194e-10L), value_type(3.2481075445253070798137274e-10L), 
+            value_type(3.2349129184355368205216769e-10L), value_type(3.2217392816546118915354059e-10L), value_type(3.2085863498947221870662669e-10L), value_type(3.1954538398020085405024813e-10L), value_type(3.1823414689134149698399285e-10L), value_type(3.1692489556135494711179137e-10L), value_type(3.1561760190915345617698829e-10L), value_type(3.1431223792978285978283195e-10L), 
+            value_type(3.1300877569009986930888981e-10L), value_type(3.1170718732444258542008441e-10L), value_type(3.1040744503029227127362252e-10L), value_type(3.0910952106392439830956253e-10L), value_type(3.0781338773604695030920696e-10L), value_type(3.0651901740742394216441725e-10L), value_type(3.0522638248448207845908623e-10L), value_type(3.0393545541489844345622014e-10L), 
+            value_type(3.0264620868316707834113418e-10L), value_type(3.0135861480614226351962282e-10L), value_type(3.0007264632855628333160184e-10L), value_type(2.9878827581850940763288810e-10L), value_type(2.9750547586292977923278724e-10L), value_type(2.9622421906300084806009182e-10L), value_type(2.9494447802955394206657335e-10L), value_type(2.9366622537842351116093806e-10L), 
+            value_type(2.9238943372576252378729983e-10L), value_type(2.9111407568331543600390475e-10L), value_type(2.8984012385364608995678150e-10L), value_type(2.8856755082531783234874574e-10L), value_type(2.8729632916802307373880812e-10L), value_type(2.8602643142765943612465819e-10L), value_type(2.8475783012134955910728520e-10L), value_type(2.8349049773240155384887090e-10L), 
+            value_type(2.8222440670520700884041472e-10L), value_type(2.8095952944007336201179309e-10L), value_type(2.7969583828798735975130350e-10L), value_type(2.7843330554530622475028881e-10L), value_type(2.7717190344837305103551528e-10L), value_type(2.7591160416805283586945543e-10L), value_type(2.7465237980418544414515766e-10L), value_type(2.7339420237995168122259367e-10L), 
+            value_type(2.7213704383614852457700256e-10L), value_type(2.7088087602536943287072913e-10L), value_type(2.6962567070608551281551970e-10L), value_type(2.6837139953662317914148054e-10L), value_type(2.6711803406903379079222959e-10L), value_type(2.6586554574285058676330128e-10L), value_type(2.6461390587872807741123131e-10L), value_type(2.6336308567195887117971414e-10L), 
+            value_type(2.6211305618586273208818744e-10L), value_type(2.6086378834504246955259252e-10L), value_type(2.5961525292850105867565087e-10L), value_type(2.5836742056261417554303326e-10L), value_type(2.5712026171395210774904095e-10L), value_type(2.5587374668194476477401718e-10L), value_type(2.5462784559138326533291827e-10L), value_type(2.5338252838475131875921103e-10L), 
+            value_type(2.5213776481437934418845544e-10L), value_type(2.5089352443441398402568671e-10L), value_type(2.4964977659259536613725749e-10L), value_type(2.4840649042183415156819404e-10L), value_type(2.4716363483158007046369503e-10L), value_type(2.4592117849897329732394307e-10L), value_type(2.4467908985976964673901856e-10L), value_type(2.4343733709903018126337916e-10L), 
+            value_type(2.4219588814156541295413325e-10L), value_type(2.4095471064212384809508575e-10L), value_type(2.3971377197531416945840574e-10L), value_type(2.3847303922524987072905781e-10L), value_type(2.3723247917490465195074185e-10L), value_type(2.3599205829516635146135977e-10L), value_type(2.3475174273357662707709066e-10L), value_type(2.3351149830274300544552914e-10L), 
+            value_type(2.3227129046840929158188156e-10L), value_type(2.3103108433716966855327979e-10L), value_type(2.2979084464381111786304573e-10L), value_type(2.2855053573826805192862361e-10L), value_type(2.2731012157217226859191162e-10L), value_type(2.2606956568498051111178148e-10L), value_type(2.2482883118966104262856162e-10L), value_type(2.2358788075791971850577516e-10L), 
+            value_type(2.2234667660494505985807011e-10L), value_type(2.2110518047365079332534305e-10L), value_type(2.1986335361839322183643620e-10L), value_type(2.1862115678813962450897951e-10L), value_type(2.1737855020906264641990916e-10L), value_type(2.1613549356653432586884921e-10L), value_type(2.1489194598649201267871665e-10L), value_type(2.1364786601614695035639730e-10L), 
+            value_type(2.1240321160400472144382732e-10L), value_type(2.1115794007916508251033123e-10L), value_type(2.0991200812986693582257520e-10L), value_type(2.0866537178124229105123472e-10L), value_type(2.0741798637224105407359276e-10L), value_type(2.0616980653168633195922421e-10L), value_type(2.0492078615341765377903747e-10L), value_type(2.0367087837047706533065751e-10L), 
+            value_type(2.0242003552829045069995445e-10L), value_type(2.0116820915679365226909204e-10L), value_type(1.9991534994144998974677468e-10L), value_type(1.9866140769310260326504985e-10L), value_type(1.9740633131660164949069482e-10L), value_type(1.9615006877814274554549453e-10L), value_type(1.9489256707124916426149627e-10L), value_type(1.9363377218132611513669139e-10L), 
+            value_type(1.9237362904871097563150648e-10L), value_type(1.9111208153013854239827327e-10L), value_type(1.8984907235853522460484236e-10L), value_type(1.8858454310105057210057226e-10L), value_type(1.8731843411522858737352568e-10L), value_type(1.8605068450321487655520273e-10L), value_type(1.8478123206388881220340067e-10L), value_type(1.8351001324280246649061078e-10L), 
+            value_type(1.8223696307980008078167861e-10L), value_type(1.8096201515418321475348709e-10L), value_type(1.7968510152727740833917303e-10L), value_type(1.7840615268224613022686850e-10L), value_type(1.7712509746098690831547075e-10L), value_type(1.7584186299793276414343150e-10L), value_type(1.7455637465056932054954798e-10L), value_type(1.7326855592646412641469398e-10L), 
+            value_type(1.7197832840658974095025668e-10L), value_type(1.7068561166470582807822228e-10L), value_type(1.6939032318254780181285080e-10L), value_type(1.6809237826055029486433745e-10L), value_type(1.6679168992381273767325700e-10L), value_type(1.6548816882299145854968564e-10L), value_type(1.6418172312977775211105428e-10L), value_type(1.6287225842659409453616036e-10L), 
+            value_type(1.6155967759011086621412912e-10L), value_type(1.6024388066815330187256003e-10L), value_type(1.5892476474953261877971022e-10L), value_type(1.5760222382629603104921136e-10L), value_type(1.5627614864784725553180416e-10L), value_type(1.5494642656634171657307117e-10L), value_type(1.5361294137270847169572372e-10L), value_type(1.5227557312259335304141736e-10L), 
+            value_type(1.5093419795145432232718315e-10L), value_type(1.4958868787796985870097173e-10L), value_type(1.4823891059484353173760755e-10L), value_type(1.4688472924600183784007953e-10L), value_type(1.4552600218908685188924265e-10L), value_type(1.4416258274203907408610336e-10L), value_type(1.4279431891244767079777183e-10L), value_type(1.4142105310821355596648459e-10L), 
+            value_type(1.4004262182792364396804945e-10L), value_type(1.3865885532917006484707872e-10L), value_type(1.3726957727286379401857385e-10L), value_type(1.3587460434138526887007843e-10L), value_type(1.3447374582818197112619965e-10L), value_type(1.3306680319616096593248640e-10L), value_type(1.3165356960192872751532930e-10L), value_type(1.3023382938259626030296164e-10L), 
+            value_type(1.2880735750148871743020297e-10L), value_type(1.2737391894866860112118370e-10L), value_type(1.2593326809169218627161938e-10L), value_type(1.2448514797146059973724336e-10L), value_type(1.2302928953738886382904926e-10L), value_type(1.2156541081538496545002810e-10L), value_type(1.2009321600129094794220219e-10L), value_type(1.1861239447147043297348625e-10L), 
+            value_type(1.1712261970110949029938892e-10L), value_type(1.1562354807950353294122676e-10L), value_type(1.1411481761009958589883215e-10L), value_type(1.1259604648131176649002010e-10L), value_type(1.1106683149208068649590166e-10L), value_type(1.0952674631374694412327641e-10L), value_type(1.0797533956698420456240824e-10L), value_type(1.0641213268920167732760246e-10L), 
+            value_type(1.0483661756387182014424840e-10L), value_type(1.0324825387853378558254932e-10L), value_type(1.0164646617260062870042268e-10L), value_type(1.0003064052935079085455281e-10L), value_type(9.8400120858350022334901938e-11L), value_type(9.6754204704696890980830180e-11L), value_type(9.5092138509490316349914168e-11L), value_type(9.3413112231238407773242476e-11L), 
+            value_type(9.1716253219863202355164002e-11L), value_type(9.0000619212593718843046969e-11L), value_type(8.8265190293184821305653885e-11L), value_type(8.6508859620972770473769570e-11L), value_type(8.4730422692176593935964342e-11L), value_type(8.2928564839750269181749989e-11L), value_type(8.1101846606147748027469647e-11L), value_type(7.9248686530322193368495609e-11L), 
+            value_type(7.7367340768855243078471831e-11L), value_type(7.5455878811085860295536431e-11L), value_type(7.3512154334980284711632556e-11L), value_type(7.1533769963392373824753096e-11L), value_type(6.9518034288854075311815294e-11L), value_type(6.7461908993951029021377482e-11L), value_type(6.5361943135559504827032850e-11L), value_type(6.3214190580055389419351781e-11L), 
+            value_type(6.1014105008819970631084562e-11L), value_type(5.8756404595443463091663013e-11L), value_type(5.6434894954447710471678038e-11L), value_type(5.4042233542803514243114472e-11L), value_type(5.1569610080293601812210471e-11L), value_type(4.9006303429591293260675044e-11L), value_type(4.6339051389120123277882563e-11L), value_type(4.3551127424923305323057478e-11L), 
+            value_type(4.0620939672079492991085011e-11L), value_type(3.7519813083953221900179201e-11L), value_type(3.4208291049947235743938487e-11L), value_type(3.0629550735144615052437117e-11L), value_type(2.6696637381295330069255088e-11L), value_type(2.2264679410335275022982520e-11L), value_type(1.7059386495384929293650546e-11L), value_type(1.0436291538148871324986329e-11L)
+        }; // downscaled_layer_widths[...]
+
+        static inline const expectation_type layer_bottom_endpoints[n_boxes] = {
+            expectation_type(0.0000000000000000000000000L), expectation_type(0.00020721783744635918968952929L), expectation_type(0.00043886672775980303183094354L), expectation_type(0.00069300017184409350947051025L), expectation_type(0.00096309309483817841638174844L), expectation_type(0.0012459849125208814143141717L), expectation_type(0.0015397701842404248127078010L), expectation_type(0.0018431594067784276767553902L), 
+            expectation_type(0.0021552146978583792443992555L), expectation_type(0.0024752194002373523990148675L), expectation_type(0.0028026058533448324027609604L), expectation_type(0.0031369119459340503444296509L), expectation_type(0.0034777533118636174564826753L), expectation_type(0.0038248046561578975188500416L), expectation_type(0.0041777867172523927845054373L), expectation_type(0.0045364568697845658281215889L), 
+            expectation_type(0.0049006021685972633758703617L), expectation_type(0.0052700340820601560936192836L), expectation_type(0.0056445844261951472869044867L), expectation_type(0.0060241021723627292634277320L), expectation_type(0.0064084509034165849409015468L), expectation_type(0.0067975067598692365989525599L), expectation_type(0.0071911567622168692829048180L), expectation_type(0.0075892974261199805224021902L), 
+            expectation_type(0.0079918336084884426107355654L), expectation_type(0.0083986775377186407732592002L), expectation_type(0.0088097479923293856474262983L), expectation_type(0.0092249696003227712485253983L), expectation_type(0.0096442722376123975796616083L), expectation_type(0.010067590508397449719034718L), expectation_type(0.010494863293820558615207215L), expectation_type(0.010926033357913685982974413L), 
+            expectation_type(0.011361047001911455796817769L), expectation_type(0.011799853759641138239648867L), expectation_type(0.012242406127989293125973420L), expectation_type(0.012688659327475459816740283L), expectation_type(0.013138571088791836084708046L), expectation_type(0.013592101461838746163612364L), expectation_type(0.014049212644332388394157396L), expectation_type(0.014509868827509569093045615L), 
+            expectation_type(0.014974036056823716800398880L), expectation_type(0.015441682105832872858635777L), expectation_type(0.015912776361735672473558046L), expectation_type(0.016387289721225112386365767L), expectation_type(0.016865194495509726590466495L), expectation_type(0.017346464323503713523688989L), expectation_type(0.017831074092316438840416442L), expectation_type(0.018318999864281503417657497L), 
+            expectation_type(0.018810218809859403511079740L), expectation_type(0.019304709145828318342976050L), expectation_type(0.019802450078246870024404949L), expectation_type(0.020303421749732565003043793L), expectation_type(0.020807605190651494658795091L), expectation_type(0.021314982273859948354198356L), expectation_type(0.021825535672677877722626297L), expectation_type(0.022339248821808484778550035L), 
+            expectation_type(0.022856105880948292448309754L), expectation_type(0.023376091700858487252207259L), expectation_type(0.023899191791691601201911081L), expectation_type(0.024425392293388148345987146L), expectation_type(0.024954679947976012099385863L), expectation_type(0.025487042073621500705808740L), expectation_type(0.026022466540295313520693262L), expectation_type(0.026560941746929416387660229L), 
+            expectation_type(0.027102456599952204687659361L), expectation_type(0.027647000493099505356092916L), expectation_type(0.028194563288408079239539246L), expectation_type(0.028745135298306458197520256L), expectation_type(0.029298707268725296426865482L), expectation_type(0.029855270363156027546257022L), expectation_type(0.030414816147592580855817272L), expectation_type(0.030977336576296294289953749L), 
+            expectation_type(0.031542823978329031340065730L), expectation_type(0.032111271044803920310289630L), expectation_type(0.032682670816807135644104703L), expectation_type(0.033257016673947775859080035L), expectation_type(0.033834302323496198926601846L), expectation_type(0.034414521790074187400164158L), expectation_type(0.034997669405863062050113885L), expectation_type(0.035583739801298370661909311L), 
+            expectation_type(0.036172727896222071510612595L), expectation_type(0.036764628891465229763462176L), expectation_type(0.037359438260836168340074791L), expectation_type(0.037957151743490779230938194L), expectation_type(0.038557765336663321830115544L), expectation_type(0.039161275288737524809950295L), expectation_type(0.039767678092639179407851528L), expectation_type(0.040376970479532675440190285L), 
+            expectation_type(0.040989149412805096554162167L), expectation_type(0.041604212082322566860031506L), expectation_type(0.042222155898944534980996732L), expectation_type(0.042842978489282600779497540L), expectation_type(0.043466677690691340948799646L), expectation_type(0.044093251546479378069574486L), expectation_type(0.044722698301329668850268561L), expectation_type(0.045355016396918665836330456L), 
+            expectation_type(0.045990204467724637187825548L), expectation_type(0.046628261337016015095265350L), expectation_type(0.047269186013011188583601999L), expectation_type(0.047912977685201664079943980L), expectation_type(0.048559635720830990140424853L), expectation_type(0.049209159661522283835794440L), expectation_type(0.049861549220047607939970042L), expectation_type(0.050516804277232832495948089L), 
+            expectation_type(0.051174924878991973602865272L), expectation_type(0.051835911233485338257099112L), expectation_type(0.052499763708396118512492842L), expectation_type(0.053166482828320372680853321L), expectation_type(0.053836069272265607225006867L), expectation_type(0.054508523871253431736272548L), expectation_type(0.055183847606022002162327174L), expectation_type(0.055862041604824195388463864L), 
+            expectation_type(0.056543107141317672414440642L), expectation_type(0.057227045632543188668392889L), expectation_type(0.057913858636987699342258919L), expectation_type(0.058603547852728985835529633L), expectation_type(0.059296115115658697209416015L), expectation_type(0.059991562397780858678353181L), expectation_type(0.060689891805583048244588765L), expectation_type(0.061391105578477583211061243L), 
+            expectation_type(0.062095206087310191040577113L), expectation_type(0.062802195832933764377830835L), expectation_type(0.063512077444844918490391167L), expectation_type(0.064224853679881181356613433L), expectation_type(0.064940527420976752542348233L), expectation_type(0.065659101675974867245205261L), expectation_type(0.066380579576494896799241896L), expectation_type(0.067104964376852406853938459L), 
+            expectation_type(0.067832259453030479676157965L), expectation_type(0.068562468301700687858468936L), expectation_type(0.069295594539292183418362750L), expectation_type(0.070031641901107439089233302L), expectation_type(0.070770614240483247767638554L), expectation_type(0.071512515527995651809111797L), expectation_type(0.072257349850707536359194061L), expectation_type(0.073005121411457680356792496L), 
+            expectation_type(0.073755834528190115430578292L), expectation_type(0.074509493633322696791717874L), expectation_type(0.075266103273153841563040100L), expectation_type(0.076025668107306438921245714L), expectation_type(0.076788192908207983101327313L), expectation_type(0.077553682560606024848886782L), expectation_type(0.078322142061118079426533435L), expectation_type(0.079093576517815169897706547L), 
+            expectation_type(0.079867991149838223230945796L), expectation_type(0.080645391287046573889320823L), expectation_type(0.081425782369697865086979537L), expectation_type(0.082209169948158671895599345L), expectation_type(0.082995559682645202950774699L), expectation_type(0.083784957342993468720072076L), expectation_type(0.084577368808458334224147427L), expectation_type(0.085372800067540902819258425L), 
+            expectation_type(0.086171257217843705219084972L), expectation_type(0.086972746465953194417686113L), expectation_type(0.087777274127349072631915081L), expectation_type(0.088584846626340000865708966L), expectation_type(0.089395470496025265262369935L), expectation_type(0.090209152378281997103438937L), expectation_type(0.091025899023777565180560534L), expectation_type(0.091845717292006780353896920L), 
+            expectation_type(0.092668614151353572458891987L), expectation_type(0.093494596679176819372052069L), expectation_type(0.094323672061920027033391770L), expectation_type(0.095155847595244577583863698L), expectation_type(0.095991130684186280544220423L), expectation_type(0.096829528843334979169424088L), expectation_type(0.097671049697036980790413989L), expectation_type(0.098515700979620096131763505L), 
+            expectation_type(0.099363490535641088297102292L), expectation_type(0.10021442632015534737042901L), expectation_type(0.10106851639900862141563864L), expectation_type(0.10192576894915064909261990L), expectation_type(0.10278619225897055316893402L), expectation_type(0.10364979472865386791313183L), expectation_type(0.10451658487056108673000466L), expectation_type(0.10538657130962762945939228L), 
+            expectation_type(0.10625976278378514152763526L), expectation_type(0.10713616814440404963260639L), expectation_type(0.10801579635675731087698425L), expectation_type(0.10889865650050530425683438L), expectation_type(0.10978475777020182517977123L), expectation_type(0.11067410947582115524449970L), expectation_type(0.11156672104330619087630777L), expectation_type(0.11246260201513762559548690L), 
+            expectation_type(0.11336176205092419171156896L), expectation_type(0.11426421092801397809908396L), expectation_type(0.11516995854212685143321128L), expectation_type(0.11607901490800801885875173L), expectation_type(0.11699139016010278054543090L), expectation_type(0.11790709455325253095843644L), expectation_type(0.11882613846341207795673624L), expectation_type(0.11974853238838835903425005L), 
+            expectation_type(0.12067428694860064415119276L), expectation_type(0.12160341288786232467544408L), expectation_type(0.12253592107418439797695025L), expectation_type(0.12347182250060076720202293L), expectation_type(0.12441112828601548570885785L), expectation_type(0.12535384967607208558034817L), expectation_type(0.12629999804404513955484082L), expectation_type(0.12724958489175421563925044L), 
+            expectation_type(0.12820262185050039360113795L), expectation_type(0.12915912068202552248609016L), expectation_type(0.13011909327949440828300779L), expectation_type(0.13108255166850013087163429L), expectation_type(0.13204950800809269944267263L), expectation_type(0.13301997459183126568991347L), expectation_type(0.13399396384886012424465974L), expectation_type(0.13497148834500874006406689L), 
+            expectation_type(0.13595256078391605280548954L), expectation_type(0.13693719400817931862719016L), expectation_type(0.13792540100052776036048214L), expectation_type(0.13891719488502130760822317L), expectation_type(0.13991258892827471904824763L), expectation_type(0.14091159654070739006657376L), expectation_type(0.14191423127781915982283727L), expectation_type(0.14292050684149244296825123L), 
+            expectation_type(0.14393043708132102250340953L), expectation_type(0.14494403599596585168846691L), expectation_type(0.14596131773453822451077043L), expectation_type(0.14698229659801068598412885L), expectation_type(0.14800698704065606550895466L), expectation_type(0.14903540367151502867300512L), expectation_type(0.15006756125589255522803940L), expectation_type(0.15110347471688376354821771L), 
+            expectation_type(0.15214315913692951467148948L), expectation_type(0.15318662975940224205573449L), expectation_type(0.15423390199022246645741594L), expectation_type(0.15528499139950646887257885L), expectation_type(0.15633991372324560827900528L), expectation_type(0.15739868486501778499529132L), expectation_type(0.15846132089773156483886327L), expectation_type(0.15952783806540349393209862L), 
+            expectation_type(0.16059825278496914898564406L), expectation_type(0.16167258164812848319290917L), expectation_type(0.16275084142322604351206088L), expectation_type(0.16383304905716665110448249L), expectation_type(0.16491922167736715305477293L), expectation_type(0.16600937659374487023049486L), expectation_type(0.16710353130074338326396739L), expectation_type(0.16820170347939631616777347L), 
+            expectation_type(0.16930391099942979504507062L), expectation_type(0.17041017192140427774045253L), expectation_type(0.17152050449889646911266605L), expectation_type(0.17263492718072205591308284L), expectation_type(0.17375345861320001504010071L), expectation_type(0.17487611764245926922677625L), expectation_type(0.17600292331678848502468650L), expectation_type(0.17713389488902982928957591L), 
+            expectation_type(0.17826905181901752227265888L), expectation_type(0.17940841377606204789503266L), expectation_type(0.18055200064148090485168316L), expectation_type(0.18169983251117680587688478L), expectation_type(0.18285192969826425682596886L), expectation_type(0.18400831273574547221176333L), expectation_type(0.18516900237923660950056659L), expectation_type(0.18633401960974533084619178L), 
+            expectation_type(0.18750338563650072804612856L), expectation_type(0.18867712189983667436681864L), expectation_type(0.18985525007412969553194616L), expectation_type(0.19103779207079248162597695L), expectation_type(0.19222477004132419196340975L), expectation_type(0.19341620638041873614183667L), expectation_type(0.19461212372913224656454211L), expectation_type(0.19581254497811099071772305L), 
+            expectation_type(0.19701749327088100545139530L), expectation_type(0.19822699200720077047579679L), expectation_type(0.19944106484647827428203414L), expectation_type(0.20065973571125386276360845L), expectation_type(0.20188302879075029899246692L), expectation_type(0.20311096854449150192898849L), expectation_type(0.20434357970599147236098065L), expectation_type(0.20558088728651495611509148L), 
+            expectation_type(0.20682291657891143760944331L), expectation_type(0.20806969316152410116492666L), expectation_type(0.20932124290217544321242887L), expectation_type(0.21057759196223126567418114L), expectation_type(0.21183876680074482941124498L), expectation_type(0.21310479417868299676985153L), expectation_type(0.21437570116323624398294742L), expectation_type(0.21565151513221447754824825L), 
+            expectation_type(0.21693226377853064377108033L), expectation_type(0.21821797511477417749250641L), expectation_type(0.21950867747787639468647349L), expectation_type(0.22080439953386999417249204L), expectation_type(0.22210517028274489622399200L), expectation_type(0.22341101906340271043130413L), expectation_type(0.22472197555871219187959128L), expectation_type(0.22603806980066811360666031L), 
+            expectation_type(0.22735933217565605449747914L), expectation_type(0.22868579342982567533902803L), expectation_type(0.23001748467457513179218156L), expectation_type(0.23135443739214935163191406L), expectation_type(0.23269668344135498486260387L), expectation_type(0.23404425506339491933523672L), expectation_type(0.23539718488782534138602817L), expectation_type(0.23675550593863841089427310L), 
+            expectation_type(0.23811925164047371313890593L), expectation_type(0.23948845582496174604133116L), expectation_type(0.24086315273720280094501299L), expectation_type(0.24224337704238469813426553L), expectation_type(0.24362916383254294497582632L), expectation_type(0.24502054863346699502358466L), expectation_type(0.24641756741175640081234384L), expectation_type(0.24782025658203077154073385L), 
+            expectation_type(0.24922865301429756957366219L), expectation_type(0.25064279404148190685596300L), expectation_type(0.25206271746712263410419590L), expectation_type(0.25348846157323915222434191L), expectation_type(0.25492006512837351698982885L), expectation_type(0.25635756739581255481663801L), expectation_type(0.25780100814199485970979300L), expectation_type(0.25925042764510769935826348L), 
+            expectation_type(0.26070586670387902216409261L), expectation_type(0.26216736664656992695871813L), expectation_type(0.26363496934017313354943175L), expectation_type(0.26510871719982317532887381L), expectation_type(0.26658865319842422526096591L), expectation_type(0.26807482087650166393245648L), expectation_type(0.26956726435228370334990842L), expectation_type(0.27106602833201959310281729L), 
+            expectation_type(0.27257115812054115675650856L), expectation_type(0.27408269963207463625289676L), expectation_type(0.27560069940131006107091638L), expectation_type(0.27712520459473560733874141L), expectation_type(0.27865626302224467042463901L), expectation_type(0.28019392314902364321200323L), expectation_type(0.28173823410772867175926862L), expectation_type(0.28328924571095995085372526L), 
+            expectation_type(0.28484700846404242461207492L), expectation_type(0.28641157357812207230929281L), expectation_type(0.28798299298358728760904376L), expectation_type(0.28956131934382520093190172L), expectation_type(0.29114660606932315047236147L), expectation_type(0.29273890733212587803648223L), expectation_type(0.29433827808065941212928494L), expectation_type(0.29594477405493300332313403L), 
+            expectation_type(0.29755845180213089667401493L), expectation_type(0.29917936869260616365337864L), expectation_type(0.30080758293628927260591461L), expectation_type(0.30244315359952455305317493L), expectation_type(0.30408614062234820621536981L), expectation_type(0.30573660483622203294900436L), expectation_type(0.30739460798223759198393684L), expectation_type(0.30906021272980606703857916L), 
+            expectation_type(0.31073348269584971230987043L), expectation_type(0.31241448246451136325781794L), expectation_type(0.31410327760739914488860165L), expectation_type(0.31579993470438418431921867L), expectation_type(0.31750452136496983979708750L), expectation_type(0.31921710625025169615489831L), expectation_type(0.32093775909548834860323761L), expectation_type(0.32266655073330380460019709L), 
+            expectation_type(0.32440355311754317919403337L), expectation_type(0.32614883934780424473142152L), expectation_type(0.32790248369466832330063397L), expectation_type(0.32966456162565498200612170L), expectation_type(0.33143514983192600955656097L), expectation_type(0.33321432625576522024791874L), expectation_type(0.33500217011886175094935800L), expectation_type(0.33679876195142569103392020L), 
+            expectation_type(0.33860418362216611739875411L), expectation_type(0.34041851836916290004435471L), expectation_type(0.34224185083166500158769467L), expectation_type(0.34407426708284942024932733L), expectation_type(0.34591585466357642419434828L), expectation_type(0.34776670261717829978895728L), expectation_type(0.34962690152532049179642724L), expectation_type(0.35149654354497575450702967L), 
+            expectation_type(0.35337572244655376431578681L), expectation_type(0.35526453365323057170397710L), expectation_type(0.35716307428152429967820294L), expectation_type(0.35907144318316563259323492L), expectation_type(0.36098974098831389046495108L), expectation_type(0.36291807015017185634639378L), expectation_type(0.36485653499105502555174770L), expectation_type(0.36680524174997358344463652L), 
+            expectation_type(0.36876429863178820168931927L), expectation_type(0.37073381585800368042611623L), expectation_type(0.37271390571926756555174397L), expectation_type(0.37470468262964414663418178L), expectation_type(0.37670626318273770319550292L), expectation_type(0.37871876620974252719251213L), expectation_type(0.38074231283950112042969884L), expectation_type(0.38277702656065606121684556L), 
+            expectation_type(0.38482303328598536972646063L), expectation_type(0.38688046141901579221752382L), expectation_type(0.38894944192301328777941080L), expectation_type(0.39103010839245515602585798L), expectation_type(0.39312259712709371016124095L), expectation_type(0.39522704720872719851383330L), expectation_type(0.39734360058079983211427900L), expectation_type(0.39947240213095931113543499L), 
+            expectation_type(0.40161359977670718591535056L), expectation_type(0.40376734455428476791533011L), expectation_type(0.40593379071094515371047045L), expectation_type(0.40811309580077027490418117L), expectation_type(0.41030542078420077540667807L), expectation_type(0.41251093013145598455070025L), expectation_type(0.41472979193003134306873817L), expectation_type(0.41696217799647139566648225L), 
+            expectation_type(0.41920826399262793938461235L), expectation_type(0.42146822954662516605125994L), expectation_type(0.42374225837876671952552988L), expectation_type(0.42603053843263356893689054L), expectation_type(0.42833326201163654824049795L), expectation_type(0.43065062592130340688133137L), expectation_type(0.43298283161759733979580939L), expectation_type(0.43533008536158230852622130L), 
+            expectation_type(0.43769259838077012833032098L), expectation_type(0.44007058703750538743042911L), expectation_type(0.44246427300476690264154800L), expectation_type(0.44487388344978873035286402L), expectation_type(0.44729965122592988531109996L), expectation_type(0.44974181507325002755930982L), expectation_type(0.45220061982827863095631878L), expectation_type(0.45467631664349773234186001L), 
+            expectation_type(0.45716916321709348450499450L), expectation_type(0.45967942403356962506115284L), expectation_type(0.46220737061585687635016598L), expectation_type(0.46475328178959648310421813L), expectation_type(0.46731744396032387772119532L), expectation_type(0.46990015140433017183296364L), expectation_type(0.47250170657403517695442871L), expectation_type(0.47512242041876636510073921L), 
+            expectation_type(0.47776261272190404508635493L), expectation_type(0.48042261245542455373017341L), expectation_type(0.48310275815295100057055003L), expectation_type(0.48580339830250567914604676L), expectation_type(0.48852489176025035636137275L), expectation_type(0.49126760818660104139079809L), expectation_type(0.49403192850621337295710692L), expectation_type(0.49681824539345440459470336L), 
+            expectation_type(0.49962696378510738059604941L), expectation_type(0.50245850142219927763612023L), expectation_type(0.50531328942299778054289970L), expectation_type(0.50819177288939647207828179L), expectation_type(0.51109441154909604007722778L), expectation_type(0.51402168043619714854671228L), expectation_type(0.51697407061304943368494005L), expectation_type(0.51995208993645330108532474L), 
+            expectation_type(0.52295626387158956536998004L), expectation_type(0.52598713635735960266540401L), expectation_type(0.52904527072715911452495956L), expectation_type(0.53213125068948584785827523L), expectation_type(0.53524568137320025605134223L), expectation_type(0.53838919044272334374677622L), expectation_type(0.54156242928897378075356884L), expectation_type(0.54476607430242363526576371L), 
+            expectation_type(0.54800082823529660720651534L), expectation_type(0.55126742166065345839519588L), expectation_type(0.55456661453691682938459769L), expectation_type(0.55789919788729380254294226L), expectation_type(0.56126599560457330305143078L), expectation_type(0.56466786639292282940574891L), expectation_type(0.56810570585960379657641388L), expectation_type(0.57158044877098877888373312L), 
+            expectation_type(0.57509307148892264933083931L), expectation_type(0.57864459460535288910566046L), expectation_type(0.58223608579529725675673425L), expectation_type(0.58586866291066086580200546L), expectation_type(0.58954349734020830710430056L), expectation_type(0.59326181766419755895303927L), expectation_type(0.59702491363585972300130277L), expectation_type(0.60083414052614396452946629L), 
+            expectation_type(0.60469092387303831958656169L), expectation_type(0.60859676468244174638136309L), expectation_type(0.61255324513414244197781892L), expectation_type(0.61656203485412306714709585L), expectation_type(0.62062489782337269319628126L), expectation_type(0.62474370000389090955128904L), expectation_type(0.62892041777493104248579693L), expectation_type(0.63315714728712708681064736L), 
+            expectation_type(0.63745611485945216315842594L), expectation_type(0.64181968856454734937020250L), expectation_type(0.64625039117256444867978180L), expectation_type(0.65075091465319424303599275L), expectation_type(0.65532413647114914812073059L), expectation_type(0.65997313795348840448192621L), expectation_type(0.66470122505966689103991366L), expectation_type(0.66951195194943155768263933L), 
+            expectation_type(0.67440914782275190543588637L), expectation_type(0.67939694760384629445628723L), expectation_type(0.68447982716328846856933622L), expectation_type(0.68966264392506406806322705L), expectation_type(0.69495068389850889641505205L), expectation_type(0.70034971642068549186625387L), expectation_type(0.70586605820975206403776904L), expectation_type(0.71150664873729443325879048L), 
+            expectation_type(0.71727913945936837770152560L), expectation_type(0.72319200014692332390536441L), expectation_type(0.72925464648993591873678824L), expectation_type(0.73547759440747709659004092L), expectation_type(0.74187264821167249929128092L), expectation_type(0.74845313214526635827628608L), expectation_type(0.75523417813929314431455069L), expectation_type(0.76223308737894139898772102L), 
+            expectation_type(0.76946979014354445397615606L), expectation_type(0.77696743855888550001834253L), expectation_type(0.78475318227282791611785888L), expectation_type(0.79285920086473065534814573L), expectation_type(0.80132410465836278942261877L), expectation_type(0.81019487771676995816279493L), expectation_type(0.81952964234332621205215691L), expectation_type(0.82940171123596302000799357L), 
+            expectation_type(0.83990574028828638442358351L), expectation_type(0.85116747651166736686823054L), expectation_type(0.86336002946253700818118862L), expectation_type(0.87673287837407410881274868L), expectation_type(0.89166820379521830373051201L), expectation_type(0.90880378162845308259058488L), expectation_type(0.92935032978672016308870604L), expectation_type(0.95616620079454265269621639L)
+        }; // layer_bottom_endpoints[...]
+
+        static inline const expectation_type downscaled_layer_heights[n_boxes] = {
+            expectation_type(4.8246662480432040097648588e-14L), expectation_type(5.3934960245941486765480538e-14L), expectation_type(5.9170053373896640495737865e-14L), expectation_type(6.2885909121709600098651783e-14L), expectation_type(6.5865884010812473004505913e-14L), expectation_type(6.8402213926414403207610293e-14L), expectation_type(7.0638307977617059840170258e-14L), expectation_type(7.2656034294657316510221584e-14L), 
+            expectation_type(7.4506900844508794941967551e-14L), expectation_type(7.6225598618319631173371464e-14L), expectation_type(7.7836702733080518525506137e-14L), expectation_type(7.9358314631722268342214337e-14L), expectation_type(8.0804187891791632924964154e-14L), expectation_type(8.2185040502036061640230899e-14L), expectation_type(8.3509402492940995401957191e-14L), expectation_type(8.4784184325831414217735695e-14L), 
+            expectation_type(8.6015070217872920438366674e-14L), expectation_type(8.7206797726032787703731083e-14L), expectation_type(8.8363361138837723448426217e-14L), expectation_type(8.9488162459652833625084631e-14L), expectation_type(9.0584125496269153325651367e-14L), expectation_type(9.1653783442286417678590986e-14L), expectation_type(9.2699347062923616394469470e-14L), expectation_type(9.3722758456642005310863554e-14L), 
+            expectation_type(9.4725733931391475828137768e-14L), expectation_type(9.5709798556392703373797892e-14L), expectation_type(9.6676314270603916461044917e-14L), expectation_type(9.7626502948639177271362668e-14L), expectation_type(9.8561465480274894473465376e-14L), expectation_type(9.9482197669006673116586940e-14L), expectation_type(1.0038960357045684273765761e-13L), expectation_type(1.0128450675379818319276778e-13L), 
+            expectation_type(1.0216765986565735719556819e-13L), expectation_type(1.0303975279703611487559712e-13L), expectation_type(1.0390141969315430858638546e-13L), expectation_type(1.0475324499912781477134929e-13L), expectation_type(1.0559576869767761034937458e-13L), expectation_type(1.0642949086615623007788991e-13L), expectation_type(1.0725487565725007433105930e-13L), expectation_type(1.0807235478940886960892808e-13L), 
+            expectation_type(1.0888233061834200957213496e-13L), expectation_type(1.0968517884902767692024269e-13L), expectation_type(1.1048125093800974165688535e-13L), expectation_type(1.1127087622785127729377213e-13L), expectation_type(1.1205436384911679128920927e-13L), expectation_type(1.1283200441989053998779111e-13L), expectation_type(1.1360407156838771160911840e-13L), expectation_type(1.1437082330050666740228180e-13L), 
+            expectation_type(1.1513250323106705563314660e-13L), expectation_type(1.1588934169487120190723097e-13L), expectation_type(1.1664155675152701684049597e-13L), expectation_type(1.1738935509610898113981968e-13L), expectation_type(1.1813293288615220885011776e-13L), expectation_type(1.1887247649412645141642242e-13L), expectation_type(1.1960816319338400361992465e-13L), expectation_type(1.2034016178458645742952485e-13L), 
+            expectation_type(1.2106863316876428133488384e-13L), expectation_type(1.2179373087242890162771826e-13L), expectation_type(1.2251560152952157557140715e-13L), expectation_type(1.2323438532443208124561914e-13L), expectation_type(1.2395021639984073648758186e-13L), expectation_type(1.2466322323271912478777609e-13L), expectation_type(1.2537352898145941923102984e-13L), expectation_type(1.2608125180678198854576638e-13L), 
+            expectation_type(1.2678650516878980528617861e-13L), expectation_type(1.2748939810229076108630308e-13L), expectation_type(1.2819003547229082171183560e-13L), expectation_type(1.2888851821136817977684415e-13L), expectation_type(1.2958494354046789531875585e-13L), expectation_type(1.3027940517450513195590001e-13L), expectation_type(1.3097199351403057287691812e-13L), expectation_type(1.3166279582409184564279227e-13L), 
+            expectation_type(1.3235189640131799192754957e-13L), expectation_type(1.3303937673015862483187389e-13L), expectation_type(1.3372531562912406646750312e-13L), expectation_type(1.3440978938779627366680818e-13L), expectation_type(1.3509287189531171355806835e-13L), expectation_type(1.3577463476095564773089326e-13L), expectation_type(1.3645514742745174076940795e-13L), expectation_type(1.3713447727748084021284361e-13L), 
+            expectation_type(1.3781268973391757872502750e-13L), expectation_type(1.3848984835423259645859898e-13L), expectation_type(1.3916601491947120655860623e-13L), expectation_type(1.3984124951818581872981400e-13L), expectation_type(1.4051561062566903197681996e-13L), expectation_type(1.4118915517880668702536262e-13L), expectation_type(1.4186193864684504712596572e-13L), expectation_type(1.4253401509834340053382920e-13L), 
+            expectation_type(1.4320543726456252465348266e-13L), expectation_type(1.4387625659952042101992904e-13L), expectation_type(1.4454652333692934406868598e-13L), expectation_type(1.4521628654421224627790923e-13L), expectation_type(1.4588559417378220589566564e-13L), expectation_type(1.4655449311175506417775289e-13L), expectation_type(1.4722302922425326315829279e-13L), expectation_type(1.4789124740144764047501130e-13L), 
+            expectation_type(1.4855919159947361309064446e-13L), expectation_type(1.4922690488034868454956394e-13L), expectation_type(1.4989442945000946656614320e-13L), expectation_type(1.5056180669457834846699873e-13L), expectation_type(1.5122907721496251704742889e-13L), expectation_type(1.5189628085988117033510550e-13L), expectation_type(1.5256345675741043238329157e-13L), expectation_type(1.5323064334512961801661016e-13L), 
+            expectation_type(1.5389787839894707608800091e-13L), expectation_type(1.5456519906067882069722013e-13L), expectation_type(1.5523264186444850876576452e-13L), expectation_type(1.5590024276197300919227280e-13L), expectation_type(1.5656803714679380609013003e-13L), expectation_type(1.5723605987751076136066986e-13L), expectation_type(1.5790434530007130732684406e-13L), expectation_type(1.5857292726916492759388489e-13L), 
+            expectation_type(1.5924183916876979477727237e-13L), expectation_type(1.5991111393189564994488037e-13L), expectation_type(1.6058078405956441474386464e-13L), expectation_type(1.6125088163906760875262554e-13L), expectation_type(1.6192143836153738836261970e-13L), expectation_type(1.6259248553886591730975794e-13L), expectation_type(1.6326405412000581170257258e-13L), expectation_type(1.6393617470668256381120364e-13L), 
+            expectation_type(1.6460887756854812959727592e-13L), expectation_type(1.6528219265780325634827277e-13L), expectation_type(1.6595614962331462089102244e-13L), expectation_type(1.6663077782425143838838030e-13L), expectation_type(1.6730610634326487993828318e-13L), expectation_type(1.6798216399923239788875623e-13L), expectation_type(1.6865897935958789523135651e-13L), expectation_type(1.6933658075225758435478507e-13L), 
+            expectation_type(1.7001499627722035594940926e-13L), expectation_type(1.7069425381771051644150262e-13L), expectation_type(1.7137438105107984783165898e-13L), expectation_type(1.7205540545933509335494301e-13L), expectation_type(1.7273735433936617239671979e-13L), expectation_type(1.7342025481287967527637805e-13L), expectation_type(1.7410413383605147978162550e-13L), expectation_type(1.7478901820891166385139975e-13L), 
+            expectation_type(1.7547493458447425992322539e-13L), expectation_type(1.7616190947762380372729377e-13L), expectation_type(1.7684996927377007144488958e-13L), expectation_type(1.7753914023728187203381229e-13L), expectation_type(1.7822944851971026418711514e-13L), expectation_type(1.7892092016781109799967697e-13L), expectation_type(1.7961358113137633826222482e-13L), expectation_type(1.8030745727088320779384382e-13L), 
+            expectation_type(1.8100257436496979387942624e-13L), expectation_type(1.8169895811774538731585722e-13L), expectation_type(1.8239663416594347050081729e-13L), expectation_type(1.8309562808592493721779424e-13L), expectation_type(1.8379596540053881115697213e-13L), expectation_type(1.8449767158584743171492565e-13L), expectation_type(1.8520077207772279325610048e-13L), expectation_type(1.8590529227832045687941535e-13L), 
+            expectation_type(1.8661125756243720095687975e-13L), expectation_type(1.8731869328375833749601757e-13L), expectation_type(1.8802762478100039497364456e-13L), expectation_type(1.8873807738395465399253266e-13L), expectation_type(1.8945007641943681926663001e-13L), expectation_type(1.9016364721714791942824258e-13L), expectation_type(1.9087881511545134439408721e-13L), expectation_type(1.9159560546707075798468146e-13L), 
+            expectation_type(1.9231404364471346065513686e-13L), expectation_type(1.9303415504662362308854334e-13L), expectation_type(1.9375596510206966557865902e-13L), expectation_type(1.9447949927676992016692998e-13L), expectation_type(1.9520478307826058200605342e-13L), expectation_type(1.9593184206120983302851939e-13L), expectation_type(1.9666070183268190435650688e-13L), expectation_type(1.9739138805735473367295743e-13L), 
+            expectation_type(1.9812392646269476967617283e-13L), expectation_type(1.9885834284409237747400048e-13L), expectation_type(1.9959466306996120606810316e-13L), expectation_type(2.0033291308680479167982100e-13L), expectation_type(2.0107311892425358833793300e-13L), expectation_type(2.0181530670007553966085048e-13L), expectation_type(2.0255950262516323291062876e-13L), expectation_type(2.0330573300850060797563791e-13L), 
+            expectation_type(2.0405402426211212976678246e-13L), expectation_type(2.0480440290599727241412303e-13L), expectation_type(2.0555689557305310746263337e-13L), expectation_type(2.0631152901398773583370143e-13L), expectation_type(2.0706833010222725449844712e-13L), expectation_type(2.0782732583881890346456598e-13L), expectation_type(2.0858854335733299668330223e-13L), expectation_type(2.0935200992876620171843800e-13L), 
+            expectation_type(2.1011775296644869737360839e-13L), expectation_type(2.1088580003095770584379095e-13L), expectation_type(2.1165617883503986624430155e-13L), expectation_type(2.1242891724854488948539806e-13L), expectation_type(2.1320404330337291031817653e-13L), expectation_type(2.1398158519843793089926155e-13L), expectation_type(2.1476157130464973133487370e-13L), expectation_type(2.1554403016991660630158608e-13L), 
+            expectation_type(2.1632899052417127293895256e-13L), expectation_type(2.1711648128442228371058577e-13L), expectation_type(2.1790653155983326878224260e-13L), expectation_type(2.1869917065683232561958700e-13L), expectation_type(2.1949442808425386892039757e-13L), expectation_type(2.2029233355851525162606644e-13L), expectation_type(2.2109291700883046756927981e-13L), expectation_type(2.2189620858246324827661050e-13L), 
+            expectation_type(2.2270223865002187052793721e-13L), expectation_type(2.2351103781079799745428047e-13L), expectation_type(2.2432263689815188421044793e-13L), expectation_type(2.2513706698494628957083733e-13L), expectation_type(2.2595435938903144715117976e-13L), expectation_type(2.2677454567878346434446343e-13L), expectation_type(2.2759765767869853346744816e-13L), expectation_type(2.2842372747504535803983358e-13L), 
+            expectation_type(2.2925278742157821755907272e-13L), expectation_type(2.3008487014531311659079471e-13L), expectation_type(2.3092000855236948847151264e-13L), expectation_type(2.3175823583387995042333884e-13L), expectation_type(2.3259958547197063541926899e-13L), expectation_type(2.3344409124581465672453084e-13L), expectation_type(2.3429178723776129368965445e-13L), expectation_type(2.3514270783954352210225660e-13L), 
+            expectation_type(2.3599688775856654923780480e-13L), expectation_type(2.3685436202428005270841550e-13L), expectation_type(2.3771516599463686331944975e-13L), expectation_type(2.3857933536264087543553899e-13L), expectation_type(2.3944690616298701386280518e-13L), expectation_type(2.4031791477879613400741544e-13L), expectation_type(2.4119239794844778211013192e-13L), expectation_type(2.4207039277251379472303379e-13L), 
+            expectation_type(2.4295193672079577133194548e-13L), expectation_type(2.4383706763946951118319455e-13L), expectation_type(2.4472582375833956499613150e-13L), expectation_type(2.4561824369820711438651873e-13L), expectation_type(2.4651436647835445654680972e-13L), expectation_type(2.4741423152414943908716064e-13L), expectation_type(2.4831787867477325999879206e-13L), expectation_type(2.4922534819107512052555559e-13L), 
+            expectation_type(2.5013668076355729439032020e-13L), expectation_type(2.5105191752049425539378930e-13L), expectation_type(2.5197110003618958696206201e-13L), expectation_type(2.5289427033937448184700021e-13L), expectation_type(2.5382147092175172796558593e-13L), expectation_type(2.5475274474668916739039631e-13L), expectation_type(2.5568813525806670986678216e-13L), expectation_type(2.5662768638928108003140213e-13L), 
+            expectation_type(2.5757144257241257884407432e-13L), expectation_type(2.5851944874755824472780363e-13L), expectation_type(2.5947175037233590865254508e-13L), expectation_type(2.6042839343156375001404170e-13L), expectation_type(2.6138942444712007677244687e-13L), expectation_type(2.6235489048798817405435977e-13L), expectation_type(2.6332483918049119041997638e-13L), expectation_type(2.6429931871872216039376513e-13L), 
+            expectation_type(2.6527837787517439579799783e-13L), expectation_type(2.6626206601157761706553189e-13L), expectation_type(2.6725043308994533919998577e-13L), expectation_type(2.6824352968383917556328626e-13L), expectation_type(2.6924140698985587637506681e-13L), expectation_type(2.7024411683934307788559351e-13L), expectation_type(2.7125171171034990282159744e-13L), expectation_type(2.7226424473981872309851439e-13L), 
+            expectation_type(2.7328176973602457214754480e-13L), expectation_type(2.7430434119126887673483921e-13L), expectation_type(2.7533201429483436707538393e-13L), expectation_type(2.7636484494620821959781595e-13L), expectation_type(2.7740288976858068914047856e-13L), expectation_type(2.7844620612262669690606763e-13L), expectation_type(2.7949485212057805743569482e-13L), expectation_type(2.8054888664059425245803944e-13L), 
+            expectation_type(2.8160836934143989201237598e-13L), expectation_type(2.8267336067747724403506777e-13L), expectation_type(2.8374392191398246295011994e-13L), expectation_type(2.8482011514279440604179650e-13L), expectation_type(2.8590200329830519385167337e-13L), expectation_type(2.8698965017380194788937507e-13L), expectation_type(2.8808312043816942594689383e-13L), expectation_type(2.8918247965296357264853866e-13L), 
+            expectation_type(2.9028779428986631095717068e-13L), expectation_type(2.9139913174853221961547244e-13L), expectation_type(2.9251656037483807237052886e-13L), expectation_type(2.9364014947954655777276233e-13L), expectation_type(2.9476996935739585383887068e-13L), expectation_type(2.9590609130662710042729019e-13L), expectation_type(2.9704858764896219432116300e-13L), expectation_type(2.9819753175004472829916518e-13L), 
+            expectation_type(2.9935299804035730647538674e-13L), expectation_type(3.0051506203662889450874962e-13L), expectation_type(3.0168380036374630555098256e-13L), expectation_type(3.0285929077718438167989852e-13L), expectation_type(3.0404161218596990674224210e-13L), expectation_type(3.0523084467619478073049113e-13L), expectation_type(3.0642706953509449879734690e-13L), expectation_type(3.0763036927570851056243897e-13L), 
+            expectation_type(3.0884082766213958831760720e-13L), expectation_type(3.1005852973542990695893808e-13L), expectation_type(3.1128356184007213487582605e-13L), expectation_type(3.1251601165117445456352681e-13L), expectation_type(3.1375596820229907539559984e-13L), expectation_type(3.1500352191399446984414297e-13L), expectation_type(3.1625876462304225956741004e-13L), expectation_type(3.1752178961244040034833988e-13L), 
+            expectation_type(3.1879269164214506607208880e-13L), expectation_type(3.2007156698059441304356289e-13L), expectation_type(3.2135851343703821829743186e-13L), expectation_type(3.2265363039469823053933068e-13L), expectation_type(3.2395701884478495144357924e-13L), expectation_type(3.2526878142139747975873350e-13L), expectation_type(3.2658902243733400265391366e-13L), expectation_type(3.2791784792084150967401999e-13L), 
+            expectation_type(3.2925536565333433634465370e-13L), expectation_type(3.3060168520811221875273693e-13L), expectation_type(3.3195691799010965929742046e-13L), expectation_type(3.3332117727670956933024557e-13L), expectation_type(3.3469457825965536876321212e-13L), expectation_type(3.3607723808809698821117430e-13L), expectation_type(3.3746927591280753826333220e-13L), expectation_type(3.3887081293160878558660433e-13L), 
+            expectation_type(3.4028197243604500942434392e-13L), expectation_type(3.4170287985934630748186261e-13L), expectation_type(3.4313366282572398015013686e-13L), expectation_type(3.4457445120104224963419652e-13L), expectation_type(3.4602537714491226911439499e-13L), expectation_type(3.4748657516425615004640945e-13L), expectation_type(3.4895818216839058675739550e-13L), expectation_type(3.5044033752568159047908889e-13L), 
+            expectation_type(3.5193318312182386394357695e-13L), expectation_type(3.5343686341980045694844327e-13L), expectation_type(3.5495152552158054740787847e-13L), expectation_type(3.5647731923161549613094324e-13L), expectation_type(3.5801439712219573196173102e-13L), expectation_type(3.5956291460073354231801914e-13L), expectation_type(3.6112302997903947821717581e-13L), expectation_type(3.6269490454466283854430543e-13L), 
+            expectation_type(3.6427870263436958190339210e-13L), expectation_type(3.6587459170983403256646859e-13L), expectation_type(3.6748274243562390685397923e-13L), expectation_type(3.6910332875956149520802148e-13L), expectation_type(3.7073652799554730116303612e-13L), expectation_type(3.7238252090893606974548766e-13L), expectation_type(3.7404149180455894341078802e-13L), expectation_type(3.7571362861748947284612631e-13L), 
+            expectation_type(3.7739912300665539278890027e-13L), expectation_type(3.7909817045140245998915657e-13L), expectation_type(3.8081097035112125277785480e-13L), expectation_type(3.8253772612805266127058665e-13L), expectation_type(3.8427864533339286664685929e-13L), expectation_type(3.8603393975682393058419709e-13L), expectation_type(3.8780382553960170601073664e-13L), expectation_type(3.8958852329133865297367038e-13L), 
+            expectation_type(3.9138825821062531465621161e-13L), expectation_type(3.9320326020964069547908186e-13L), expectation_type(3.9503376404290860394479918e-13L), expectation_type(3.9688000944036419673571179e-13L), expectation_type(3.9874224124490250811346534e-13L), expectation_type(4.0062070955458869177240302e-13L), expectation_type(4.0251566986971806428143681e-13L), expectation_type(4.0442738324492284494480030e-13L), 
+            expectation_type(4.0635611644653176279614710e-13L), expectation_type(4.0830214211539847574379534e-13L), expectation_type(4.1026573893542504972386174e-13L), expectation_type(4.1224719180801760923286973e-13L), expectation_type(4.1424679203272272911632676e-13L), expectation_type(4.1626483749430522763486171e-13L), expectation_type(4.1830163285654078177612756e-13L), expectation_type(4.2035748976301025939102440e-13L), 
+            expectation_type(4.2243272704519689377532118e-13L), expectation_type(4.2452767093820246268952315e-13L), expectation_type(4.2664265530441452677759256e-13L), expectation_type(4.2877802186547358680665971e-13L), expectation_type(4.3093412044290679391750802e-13L), expectation_type(4.3311130920781365518406311e-13L), expectation_type(4.3530995494000908582062586e-13L), expectation_type(4.3753043329705024185920807e-13L), 
+            expectation_type(4.3977312909359590087176458e-13L), expectation_type(4.4203843659157082690331404e-13L), expectation_type(4.4432675980163264899365904e-13L), expectation_type(4.4663851279646539700045837e-13L), expectation_type(4.4897412003645207767355080e-13L), expectation_type(4.5133401670830864972952352e-13L), expectation_type(4.5371864907729358923763850e-13L), expectation_type(4.5612847485364105541640821e-13L), 
+            expectation_type(4.5856396357390161146662706e-13L), expectation_type(4.6102559699791267575361891e-13L), expectation_type(4.6351386952216153777203809e-13L), expectation_type(4.6602928861034704603522385e-13L), expectation_type(4.6857237524199215049184775e-13L), expectation_type(4.7114366438000856469541732e-13L), expectation_type(4.7374370545816712374912929e-13L), expectation_type(4.7637306288948319212173855e-13L), 
+            expectation_type(4.7903231659658597960597151e-13L), expectation_type(4.8172206256520413431622803e-13L), expectation_type(4.8444291342196780253880173e-13L), expectation_type(4.8719549903779980596638519e-13L), expectation_type(4.8998046715824604494278274e-13L), expectation_type(4.9279848406217808008843027e-13L), expectation_type(4.9565023525038949595913019e-13L), expectation_type(4.9853642616570256792038318e-13L), 
+            expectation_type(5.0145778294630343628252412e-13L), expectation_type(5.0441505321413298332003665e-13L), expectation_type(5.0740900690027750111441123e-13L), expectation_type(5.1044043710942867668492777e-13L), expectation_type(5.1351016102561710985558981e-13L), expectation_type(5.1661902086156828769005136e-13L), expectation_type(5.1976788485418550730642429e-13L), expectation_type(5.2295764830883158520770572e-13L), 
+            expectation_type(5.2618923469526132134321358e-13L), expectation_type(5.2946359679825070106149614e-13L), expectation_type(5.3278171792617792479853083e-13L), expectation_type(5.3614461318103687762945035e-13L), expectation_type(5.3955333079360704208422149e-13L), expectation_type(5.4300895352776671480522257e-13L), expectation_type(5.4651260015822046682474439e-13L), expectation_type(5.5006542702621902132544186e-13L), 
+            expectation_type(5.5366862967818224099146007e-13L), expectation_type(5.5732344459249606721833860e-13L), expectation_type(5.6103115100014462655320839e-13L), expectation_type(5.6479307280526217795936409e-13L), expectation_type(5.6861058061214928254997606e-13L), expectation_type(5.7248509386579703792807635e-13L), expectation_type(5.7641808311350631263450093e-13L), expectation_type(5.8041107239577994577825803e-13L), 
+            expectation_type(5.8446564177530961994399519e-13L), expectation_type(5.8858343001358088083256187e-13L), expectation_type(5.9276613740538547082281168e-13L), expectation_type(5.9701552878236634325225615e-13L), expectation_type(6.0133343669763476319283971e-13L), expectation_type(6.0572176480449896451774436e-13L), expectation_type(6.1018249144343906961240342e-13L), expectation_type(6.1471767345266362164830271e-13L), 
+            expectation_type(6.1932945021890059440335746e-13L), expectation_type(6.2402004798652298943212903e-13L), expectation_type(6.2879178444470054468638835e-13L), expectation_type(6.3364707361402089915704308e-13L), expectation_type(6.3858843105595406621724658e-13L), expectation_type(6.4361847943066387570917059e-13L), expectation_type(6.4873995443102242239458879e-13L), expectation_type(6.5395571112328481685122037e-13L), 
+            expectation_type(6.5926873072776146484505840e-13L), expectation_type(6.6468212787601748356956281e-13L), expectation_type(6.7019915838467206195154217e-13L), expectation_type(6.7582322758980822435948025e-13L), expectation_type(6.8155789929038527625959516e-13L), expectation_type(6.8740690535392892630344684e-13L), expectation_type(6.9337415604322253643253612e-13L), expectation_type(6.9946375112881139753947789e-13L), 
+            expectation_type(7.0567999185894552787833835e-13L), expectation_type(7.1202739386622310928575903e-13L), expectation_type(7.1851070109876897987314541e-13L), expectation_type(7.2513490087342054907707873e-13L), expectation_type(7.3190524015924728838569405e-13L), expectation_type(7.3882724321197351673724968e-13L), expectation_type(7.4590673069370939463576731e-13L), expectation_type(7.5314984042805661009151736e-13L), 
+            expectation_type(7.6056304995841678200265325e-13L), expectation_type(7.6815320109751173073875601e-13L), expectation_type(7.7592752667909969692669720e-13L), expectation_type(7.8389367974907955812234472e-13L), expectation_type(7.9205976546313290479156694e-13L), expectation_type(8.0043437599237112949074706e-13L), expectation_type(8.0902662877785249988014992e-13L), expectation_type(8.1784620852016765988114302e-13L), 
+            expectation_type(8.2690341334257814757612604e-13L), expectation_type(8.3620920562664439359224438e-13L), expectation_type(8.4577526808934852326301810e-13L), expectation_type(8.5561406575214475580659862e-13L), expectation_type(8.6573891454725311214243087e-13L), expectation_type(8.7616405741738344209289152e-13L), expectation_type(8.8690474889500678448437831e-13L), expectation_type(8.9797734930001488104355887e-13L), 
+            expectation_type(9.0939942987468704224473108e-13L), expectation_type(9.2118989038790703910489945e-13L), expectation_type(9.3336909099342167849427743e-13L), expectation_type(9.4595900042811060548143634e-13L), expectation_type(9.5898336299629875412305686e-13L), expectation_type(9.7246788721825015305684561e-13L), expectation_type(9.8644045954162366324850634e-13L), expectation_type(1.0009313871446083613958166e-12L), 
+            expectation_type(1.0159736746249627057466490e-12L), expectation_type(1.0316033403036889270606888e-12L), expectation_type(1.0478597790183625498854815e-12L), expectation_type(1.0647861796942752004675837e-12L), expectation_type(1.0824300077328659521714982e-12L), expectation_type(1.1008435644394089752870745e-12L), expectation_type(1.1200846384476756866027950e-12L), expectation_type(1.1402172675497282810501685e-12L), 
+            expectation_type(1.1613126337192257992271518e-12L), expectation_type(1.1834501197155621444723925e-12L), expectation_type(1.2067185628652381842853670e-12L), expectation_type(1.2312177509712162666945289e-12L), expectation_type(1.2570602175392340097439131e-12L), expectation_type(1.2843734096621502147003360e-12L), expectation_type(1.3133023234213868958043936e-12L), expectation_type(1.3440127306193944936046628e-12L), 
+            expectation_type(1.3766951600396170662432984e-12L), expectation_type(1.4115698506180580430761643e-12L), expectation_type(1.4488929694029667467474118e-12L), expectation_type(1.4889644937786197278226313e-12L), expectation_type(1.5321383101693348249361136e-12L), expectation_type(1.5788353038033520202310669e-12L), expectation_type(1.6295605435217300468804456e-12L), expectation_type(1.6849261630065695269595856e-12L), 
+            expectation_type(1.7456823068407197364203598e-12L), expectation_type(1.8127597206633481709704961e-12L), expectation_type(1.8873295266623768855233750e-12L), expectation_type(1.9708889991983359385447985e-12L), expectation_type(2.0653878013772323125864809e-12L), expectation_type(2.1734192568645051555304059e-12L), expectation_type(2.2985201550031379123311026e-12L), expectation_type(2.4456598457808197153198431e-12L), 
+            expectation_type(2.6220772941603930058906381e-12L), expectation_type(2.8387999519958256895080910e-12L), expectation_type(3.1136090202840766058871847e-12L), expectation_type(3.4774014317946500027454406e-12L), expectation_type(3.9896876172219557867606235e-12L), expectation_type(4.7838660336683845454336944e-12L), expectation_type(6.2435565083441431903872856e-12L), expectation_type(1.0205851685177348318733499e-11L)
+        }; // downscaled_layer_heights[...]
+    }; // struct ziggurat_layers_exponential_512<...>
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M32_HPP_INCLUDED
@@ -0,0 +1,431 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M48_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M48_HPP_INCLUDED
+
+#include "../arithmetic.hpp"
+#include "../probability/standard_exponential_distribution.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type, std::size_t t_engine_diameter>
+    struct ziggurat_layers_exponential_512;
+
+    /** @brief Ziggurat with 512 layers for exponential distribution and full 48-bit engines. */
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type>
+    struct ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(48ULL)>
+    {
+        using type = ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(48ULL)>;
+        using uniform_type = t_uniform_type;
+        using value_type = t_value_type;
+        using expectation_type = t_expectation_type;
+
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr std::size_t engine_diameter = aftermath::mersenne_number(48ULL); // 281474976710655.
+
+        static inline const uniform_type upscaled_low_probabilities[n_boxes] = {
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL)
+        }; // upscaled_low_probabilities[...]
+
+        static inline const uniform_type upscaled_high_probabilities[n_boxes] = {
+            uniform_type(251788972053026ULL), uniform_type(256571370371855ULL), uniform_type(264842945391023ULL), uniform_type(268740184259211ULL), uniform_type(271037984061666ULL), uniform_type(272564733260535ULL), uniform_type(273658152222353ULL), uniform_type(274482703335854ULL), 
+            uniform_type(275128415652100ULL), uniform_type(275648862843321ULL), uniform_type(276077991206106ULL), uniform_type(276438391939212ULL), uniform_type(276745704157705ULL), uniform_type(277011110973166ULL), uniform_type(277242829057444ULL), uniform_type(277447036293723ULL), 
+            uniform_type(277628470688744ULL), uniform_type(277790829169321ULL), uniform_type(277937040330262ULL), uniform_type(278069455395333ULL), uniform_type(278189984709936ULL), uniform_type(278300197113032ULL), uniform_type(278401393485450ULL), uniform_type(278494661999122ULL), 
+            uniform_type(278580920181628ULL), uniform_type(278660947336442ULL), uniform_type(278735409810861ULL), uniform_type(278804880892425ULL), uniform_type(278869856624323ULL), uniform_type(278930768486956ULL), uniform_type(278987993649153ULL), uniform_type(279041863317245ULL), 
+            uniform_type(279092669582717ULL), uniform_type(279140671075241ULL), uniform_type(279186097658150ULL), uniform_type(279229154350988ULL), uniform_type(279270024624106ULL), uniform_type(279308873179913ULL), uniform_type(279345848312054ULL), uniform_type(279381083915650ULL), 
+            uniform_type(279414701207567ULL), uniform_type(279446810204539ULL), uniform_type(279477510998125ULL), uniform_type(279506894858477ULL), uniform_type(279535045193235ULL), uniform_type(279562038383339ULL), uniform_type(279587944513868ULL), uniform_type(279612828015033ULL), 
+            uniform_type(279636748225986ULL), uniform_type(279659759892136ULL), uniform_type(279681913604949ULL), uniform_type(279703256191901ULL), uniform_type(279723831063064ULL), uniform_type(279743678519870ULL), uniform_type(279762836030806ULL), uniform_type(279781338478116ULL), 
+            uniform_type(279799218379007ULL), uniform_type(279816506084411ULL), uniform_type(279833229957914ULL), uniform_type(279849416537130ULL), uniform_type(279865090679517ULL), uniform_type(279880275694353ULL), uniform_type(279894993462388ULL), uniform_type(279909264544506ULL), 
+            uniform_type(279923108280556ULL), uniform_type(279936542879376ULL), uniform_type(279949585500926ULL), uniform_type(279962252331315ULL), uniform_type(279974558651444ULL), uniform_type(279986518899886ULL), uniform_type(279998146730560ULL), uniform_type(280009455065707ULL), 
+            uniform_type(280020456144598ULL), uniform_type(280031161568377ULL), uniform_type(280041582341399ULL), uniform_type(280051728909369ULL), uniform_type(280061611194576ULL), uniform_type(280071238628476ULL), uniform_type(280080620181852ULL), uniform_type(280089764392769ULL), 
+            uniform_type(280098679392493ULL), uniform_type(280107372929565ULL), uniform_type(280115852392171ULL), uniform_type(280124124828944ULL), uniform_type(280132196968345ULL), uniform_type(280140075236703ULL), uniform_type(280147765775057ULL), uniform_type(280155274454864ULL), 
+            uniform_type(280162606892681ULL), uniform_type(280169768463879ULL), uniform_type(280176764315489ULL), uniform_type(280183599378216ULL), uniform_type(280190278377700ULL), uniform_type(280196805845083ULL), uniform_type(280203186126910ULL), uniform_type(280209423394437ULL), 
+            uniform_type(280215521652370ULL), uniform_type(280221484747088ULL), uniform_type(280227316374370ULL), uniform_type(280233020086679ULL), uniform_type(280238599300019ULL), uniform_type(280244057300396ULL), uniform_type(280249397249914ULL), uniform_type(280254622192531ULL), 
+            uniform_type(280259735059488ULL), uniform_type(280264738674438ULL), uniform_type(280269635758302ULL), uniform_type(280274428933852ULL), uniform_type(280279120730053ULL), uniform_type(280283713586174ULL), uniform_type(280288209855678ULL), uniform_type(280292611809913ULL), 
+            uniform_type(280296921641611ULL), uniform_type(280301141468205ULL), uniform_type(280305273334975ULL), uniform_type(280309319218045ULL), uniform_type(280313281027215ULL), uniform_type(280317160608667ULL), uniform_type(280320959747528ULL), uniform_type(280324680170312ULL), 
+            uniform_type(280328323547241ULL), uniform_type(280331891494459ULL), uniform_type(280335385576133ULL), uniform_type(280338807306465ULL), uniform_type(280342158151600ULL), uniform_type(280345439531450ULL), uniform_type(280348652821431ULL), uniform_type(280351799354125ULL), 
+            uniform_type(280354880420863ULL), uniform_type(280357897273234ULL), uniform_type(280360851124532ULL), uniform_type(280363743151135ULL), uniform_type(280366574493824ULL), uniform_type(280369346259046ULL), uniform_type(280372059520114ULL), uniform_type(280374715318371ULL), 
+            uniform_type(280377314664283ULL), uniform_type(280379858538505ULL), uniform_type(280382347892892ULL), uniform_type(280384783651464ULL), uniform_type(280387166711340ULL), uniform_type(280389497943627ULL), uniform_type(280391778194277ULL), uniform_type(280394008284898ULL), 
+            uniform_type(280396189013550ULL), uniform_type(280398321155490ULL), uniform_type(280400405463900ULL), uniform_type(280402442670580ULL), uniform_type(280404433486615ULL), uniform_type(280406378603014ULL), uniform_type(280408278691329ULL), uniform_type(280410134404243ULL), 
+            uniform_type(280411946376136ULL), uniform_type(280413715223636ULL), uniform_type(280415441546144ULL), uniform_type(280417125926332ULL), uniform_type(280418768930638ULL), uniform_type(280420371109727ULL), uniform_type(280421932998944ULL), uniform_type(280423455118745ULL), 
+            uniform_type(280424937975112ULL), uniform_type(280426382059960ULL), uniform_type(280427787851518ULL), uniform_type(280429155814702ULL), uniform_type(280430486401474ULL), uniform_type(280431780051187ULL), uniform_type(280433037190919ULL), uniform_type(280434258235789ULL), 
+            uniform_type(280435443589272ULL), uniform_type(280436593643492ULL), uniform_type(280437708779511ULL), uniform_type(280438789367605ULL), uniform_type(280439835767531ULL), uniform_type(280440848328785ULL), uniform_type(280441827390848ULL), uniform_type(280442773283427ULL), 
+            uniform_type(280443686326685ULL), uniform_type(280444566831463ULL), uniform_type(280445415099497ULL), uniform_type(280446231423620ULL), uniform_type(280447016087968ULL), uniform_type(280447769368167ULL), uniform_type(280448491531522ULL), uniform_type(280449182837196ULL), 
+            uniform_type(280449843536380ULL), uniform_type(280450473872463ULL), uniform_type(280451074081192ULL), uniform_type(280451644390826ULL), uniform_type(280452185022286ULL), uniform_type(280452696189299ULL), uniform_type(280453178098537ULL), uniform_type(280453630949750ULL), 
+            uniform_type(280454054935900ULL), uniform_type(280454450243276ULL), uniform_type(280454817051623ULL), uniform_type(280455155534254ULL), uniform_type(280455465858157ULL), uniform_type(280455748184110ULL), uniform_type(280456002666778ULL), uniform_type(280456229454815ULL), 
+            uniform_type(280456428690956ULL), uniform_type(280456600512113ULL), uniform_type(280456745049459ULL), uniform_type(280456862428515ULL), uniform_type(280456952769232ULL), uniform_type(280457016186064ULL), uniform_type(280457052788047ULL), uniform_type(280457062678871ULL), 
+            uniform_type(280457045956944ULL), uniform_type(280457002715461ULL), uniform_type(280456933042466ULL), uniform_type(280456837020911ULL), uniform_type(280456714728712ULL), uniform_type(280456566238807ULL), uniform_type(280456391619202ULL), uniform_type(280456190933024ULL), 
+            uniform_type(280455964238565ULL), uniform_type(280455711589329ULL), uniform_type(280455433034069ULL), uniform_type(280455128616831ULL), uniform_type(280454798376987ULL), uniform_type(280454442349269ULL), uniform_type(280454060563804ULL), uniform_type(280453653046143ULL), 
+            uniform_type(280453219817286ULL), uniform_type(280452760893711ULL), uniform_type(280452276287396ULL), uniform_type(280451766005838ULL), uniform_type(280451230052075ULL), uniform_type(280450668424703ULL), uniform_type(280450081117889ULL), uniform_type(280449468121383ULL), 
+            uniform_type(280448829420533ULL), uniform_type(280448164996292ULL), uniform_type(280447474825222ULL), uniform_type(280446758879504ULL), uniform_type(280446017126937ULL), uniform_type(280445249530942ULL), uniform_type(280444456050558ULL), uniform_type(280443636640442ULL), 
+            uniform_type(280442791250863ULL), uniform_type(280441919827695ULL), uniform_type(280441022312410ULL), uniform_type(280440098642064ULL), uniform_type(280439148749290ULL), uniform_type(280438172562279ULL), uniform_type(280437170004765ULL), uniform_type(280436140996007ULL), 
+            uniform_type(280435085450769ULL), uniform_type(280434003279299ULL), uniform_type(280432894387301ULL), uniform_type(280431758675913ULL), uniform_type(280430596041677ULL), uniform_type(280429406376510ULL), uniform_type(280428189567669ULL), uniform_type(280426945497720ULL), 
+            uniform_type(280425674044500ULL), uniform_type(280424375081080ULL), uniform_type(280423048475723ULL), uniform_type(280421694091841ULL), uniform_type(280420311787953ULL), uniform_type(280418901417634ULL), uniform_type(280417462829469ULL), uniform_type(280415995866999ULL), 
+            uniform_type(280414500368669ULL), uniform_type(280412976167771ULL), uniform_type(280411423092386ULL), uniform_type(280409840965320ULL), uniform_type(280408229604045ULL), uniform_type(280406588820630ULL), uniform_type(280404918421674ULL), uniform_type(280403218208231ULL), 
+            uniform_type(280401487975741ULL), uniform_type(280399727513952ULL), uniform_type(280397936606838ULL), uniform_type(280396115032520ULL), uniform_type(280394262563176ULL), uniform_type(280392378964960ULL), uniform_type(280390463997903ULL), uniform_type(280388517415827ULL), 
+            uniform_type(280386538966237ULL), uniform_type(280384528390230ULL), uniform_type(280382485422384ULL), uniform_type(280380409790654ULL), uniform_type(280378301216261ULL), uniform_type(280376159413572ULL), uniform_type(280373984089989ULL), uniform_type(280371774945820ULL), 
+            uniform_type(280369531674157ULL), uniform_type(280367253960743ULL), uniform_type(280364941483838ULL), uniform_type(280362593914083ULL), uniform_type(280360210914352ULL), uniform_type(280357792139607ULL), uniform_type(280355337236748ULL), uniform_type(280352845844449ULL), 
+            uniform_type(280350317593003ULL), uniform_type(280347752104152ULL), uniform_type(280345148990914ULL), uniform_type(280342507857406ULL), uniform_type(280339828298660ULL), uniform_type(280337109900436ULL), uniform_type(280334352239025ULL), uniform_type(280331554881047ULL), 
+            uniform_type(280328717383248ULL), uniform_type(280325839292282ULL), uniform_type(280322920144491ULL), uniform_type(280319959465681ULL), uniform_type(280316956770883ULL), uniform_type(280313911564114ULL), uniform_type(280310823338125ULL), uniform_type(280307691574147ULL), 
+            uniform_type(280304515741621ULL), uniform_type(280301295297929ULL), uniform_type(280298029688106ULL), uniform_type(280294718344551ULL), uniform_type(280291360686726ULL), uniform_type(280287956120847ULL), uniform_type(280284504039556ULL), uniform_type(280281003821599ULL), 
+            uniform_type(280277454831477ULL), uniform_type(280273856419098ULL), uniform_type(280270207919409ULL), uniform_type(280266508652020ULL), uniform_type(280262757920818ULL), uniform_type(280258955013562ULL), uniform_type(280255099201468ULL), uniform_type(280251189738782ULL), 
+            uniform_type(280247225862339ULL), uniform_type(280243206791097ULL), uniform_type(280239131725672ULL), uniform_type(280234999847845ULL), uniform_type(280230810320054ULL), uniform_type(280226562284875ULL), uniform_type(280222254864475ULL), uniform_type(280217887160057ULL), 
+            uniform_type(280213458251278ULL), uniform_type(280208967195649ULL), uniform_type(280204413027914ULL), uniform_type(280199794759409ULL), uniform_type(280195111377397ULL), uniform_type(280190361844376ULL), uniform_type(280185545097368ULL), uniform_type(280180660047177ULL), 
+            uniform_type(280175705577628ULL), uniform_type(280170680544766ULL), uniform_type(280165583776040ULL), uniform_type(280160414069447ULL), uniform_type(280155170192643ULL), uniform_type(280149850882035ULL), uniform_type(280144454841820ULL), uniform_type(280138980743001ULL), 
+            uniform_type(280133427222365ULL), uniform_type(280127792881412ULL), uniform_type(280122076285257ULL), uniform_type(280116275961477ULL), uniform_type(280110390398923ULL), uniform_type(280104418046481ULL), uniform_type(280098357311783ULL), uniform_type(280092206559871ULL), 
+            uniform_type(280085964111804ULL), uniform_type(280079628243216ULL), uniform_type(280073197182806ULL), uniform_type(280066669110771ULL), uniform_type(280060042157185ULL), uniform_type(280053314400290ULL), uniform_type(280046483864741ULL), uniform_type(280039548519754ULL), 
+            uniform_type(280032506277198ULL), uniform_type(280025354989591ULL), uniform_type(280018092448017ULL), uniform_type(280010716379955ULL), uniform_type(280003224447010ULL), uniform_type(279995614242552ULL), uniform_type(279987883289242ULL), uniform_type(279980029036460ULL), 
+            uniform_type(279972048857613ULL), uniform_type(279963940047319ULL), uniform_type(279955699818475ULL), uniform_type(279947325299182ULL), uniform_type(279938813529533ULL), uniform_type(279930161458253ULL), uniform_type(279921365939184ULL), uniform_type(279912423727607ULL), 
+            uniform_type(279903331476383ULL), uniform_type(279894085731920ULL), uniform_type(279884682929944ULL), uniform_type(279875119391058ULL), uniform_type(279865391316102ULL), uniform_type(279855494781264ULL), uniform_type(279845425732969ULL), uniform_type(279835179982500ULL), 
+            uniform_type(279824753200353ULL), uniform_type(279814140910304ULL), uniform_type(279803338483181ULL), uniform_type(279792341130297ULL), uniform_type(279781143896560ULL), uniform_type(279769741653211ULL), uniform_type(279758129090179ULL), uniform_type(279746300708027ULL), 
+            uniform_type(279734250809470ULL), uniform_type(279721973490421ULL), uniform_type(279709462630553ULL), uniform_type(279696711883339ULL), uniform_type(279683714665528ULL), uniform_type(279670464146034ULL), uniform_type(279656953234187ULL), uniform_type(279643174567314ULL), 
+            uniform_type(279629120497589ULL), uniform_type(279614783078123ULL), uniform_type(279600154048218ULL), uniform_type(279585224817752ULL), uniform_type(279569986450609ULL), uniform_type(279554429647102ULL), uniform_type(279538544725313ULL), uniform_type(279522321601266ULL), 
+            uniform_type(279505749767858ULL), uniform_type(279488818272440ULL), uniform_type(279471515692967ULL), uniform_type(279453830112582ULL), uniform_type(279435749092547ULL), uniform_type(279417259643359ULL), uniform_type(279398348193933ULL), uniform_type(279379000558685ULL), 
+            uniform_type(279359201902361ULL), uniform_type(279338936702402ULL), uniform_type(279318188708679ULL), uniform_type(279296940900349ULL), uniform_type(279275175439602ULL), uniform_type(279252873622038ULL), uniform_type(279230015823378ULL), uniform_type(279206581442185ULL), 
+            uniform_type(279182548838252ULL), uniform_type(279157895266270ULL), uniform_type(279132596804329ULL), uniform_type(279106628276804ULL), uniform_type(279079963171085ULL), uniform_type(279052573547577ULL), uniform_type(279024429942324ULL), uniform_type(278995501261545ULL), 
+            uniform_type(278965754667286ULL), uniform_type(278935155453298ULL), uniform_type(278903666910160ULL), uniform_type(278871250178534ULL), uniform_type(278837864089324ULL), uniform_type(278803464989355ULL), uniform_type(278768006550999ULL), uniform_type(278731439564033ULL), 
+            uniform_type(278693711707717ULL), uniform_type(278654767300913ULL), uniform_type(278614547027686ULL), uniform_type(278572987635580ULL), uniform_type(278530021603304ULL), uniform_type(278485576774167ULL), uniform_type(278439575951070ULL), uniform_type(278391936448254ULL), 
+            uniform_type(278342569594342ULL), uniform_type(278291380180356ULL), uniform_type(278238265845504ULL), uniform_type(278183116392360ULL), uniform_type(278125813021808ULL), uniform_type(278066227476550ULL), uniform_type(278004221080176ULL), uniform_type(277939643656635ULL), 
+            uniform_type(277872332312366ULL), uniform_type(277802110060290ULL), uniform_type(277728784261178ULL), uniform_type(277652144853492ULL), uniform_type(277571962337414ULL), uniform_type(277487985472342ULL), uniform_type(277399938639163ULL), uniform_type(277307518808982ULL), 
+            uniform_type(277210392048085ULL), uniform_type(277108189474201ULL), uniform_type(277000502560910ULL), uniform_type(276886877664278ULL), uniform_type(276766809617201ULL), uniform_type(276639734200883ULL), uniform_type(276505019257018ULL), uniform_type(276361954145624ULL), 
+            uniform_type(276209737178000ULL), uniform_type(276047460556352ULL), uniform_type(275874092223634ULL), uniform_type(275688453858458ULL), uniform_type(275489194025607ULL), uniform_type(275274755191643ULL), uniform_type(275043332907065ULL), uniform_type(274792824897439ULL), 
+            uniform_type(274520767031226ULL), uniform_type(274224252045271ULL), uniform_type(273899825363846ULL), uniform_type(273543350118965ULL), uniform_type(273149830215685ULL), uniform_type(272713175423103ULL), uniform_type(272225885090368ULL), uniform_type(271678615652442ULL), 
+            uniform_type(271059578972986ULL), uniform_type(270353689139844ULL), uniform_type(269541326162308ULL), uniform_type(268596500269208ULL), uniform_type(267484049133632ULL), uniform_type(266155218772746ULL), uniform_type(264540429943528ULL), uniform_type(262536901435535ULL), 
+            uniform_type(259986317383318ULL), uniform_type(256631820234555ULL), uniform_type(252028143330649ULL), uniform_type(245332863355739ULL), uniform_type(234746797096071ULL), uniform_type(215668518193778ULL), uniform_type(172195812460240ULL), uniform_type(0ULL)
+        }; // upscaled_high_probabilities[...]
+
+        static inline const value_type layer_left_endpoints[n_boxes] = {
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L)
+        }; // layer_left_endpoints[...]
+
+        static inline const value_type downscaled_layer_widths[n_boxes] = {
+            value_type(3.3685907266170876581435693e-14L), value_type(3.0133193587370363030305588e-14L), value_type(2.7467147746989599628978450e-14L), value_type(2.5844145706355279499627369e-14L), value_type(2.4674877178468947956626944e-14L), value_type(2.3759941454036399154308513e-14L), value_type(2.3007807586969125131407854e-14L), value_type(2.2368859159404867237724436e-14L), 
+            value_type(2.1813182132079784702927707e-14L), value_type(2.1321349096332058395031372e-14L), value_type(2.0880028844379057774441644e-14L), value_type(2.0479676335873414312741069e-14L), value_type(2.0113222354198997886841009e-14L), value_type(1.9775284994570462831284280e-14L), value_type(1.9461671975864747673870041e-14L), value_type(1.9169053888307747697986019e-14L), 
+            value_type(1.8894742445729879072504227e-14L), value_type(1.8636535689842427156894060e-14L), value_type(1.8392607266992614120514123e-14L), value_type(1.8161425528776965607156381e-14L), value_type(1.7941693307896615659273225e-14L), value_type(1.7732302335794726441379522e-14L), value_type(1.7532298227676661615568431e-14L), value_type(1.7340853224779380443865199e-14L), 
+            value_type(1.7157244718686610611003424e-14L), value_type(1.6980838145432769859201609e-14L), value_type(1.6811073223881262299669883e-14L), value_type(1.6647452783114707472128101e-14L), value_type(1.6489533615379706968152036e-14L), value_type(1.6336918929208727520257691e-14L), value_type(1.6189252078054435979430319e-14L), value_type(1.6046211314122167228444570e-14L), 
+            value_type(1.5907505372591833651417742e-14L), value_type(1.5772869733290241754797427e-14L), value_type(1.5642063438765122152309630e-14L), value_type(1.5514866372221798994095728e-14L), value_type(1.5391076917780168068805907e-14L), value_type(1.5270509940350481297937304e-14L), value_type(1.5152995034107049722354261e-14L), value_type(1.5038374997796872818453886e-14L), 
+            value_type(1.4926504502506464337487580e-14L), value_type(1.4817248923440002397385813e-14L), value_type(1.4710483312050712821499662e-14L), value_type(1.4606091488756346854967642e-14L), value_type(1.4503965239644609303054661e-14L), value_type(1.4404003603179596244428596e-14L), value_type(1.4306112235068240395903370e-14L), value_type(1.4210202841224800560961434e-14L), 
+            value_type(1.4116192670251357169136983e-14L), value_type(1.4024004058088507999187567e-14L), value_type(1.3933564018527236264707192e-14L), value_type(1.3844803874145738961340631e-14L), value_type(1.3757658922972466508292019e-14L), value_type(1.3672068136801903201994877e-14L), value_type(1.3587973887621555358422095e-14L), value_type(1.3505321699062601044561542e-14L), 
+            value_type(1.3424060020175313495062663e-14L), value_type(1.3344140019164090360062995e-14L), value_type(1.3265515395004288917992520e-14L), value_type(1.3188142205111203693088621e-14L), value_type(1.3111978707446352847824650e-14L), value_type(1.3036985215632710521544121e-14L), value_type(1.2963123965812777863190295e-14L), value_type(1.2890358994124907633935389e-14L), 
+            value_type(1.2818656023797020138757845e-14L), value_type(1.2747982360965251785697657e-14L), value_type(1.2678306798420263566932203e-14L), value_type(1.2609599526567691370687908e-14L), value_type(1.2541832050963065169304423e-14L), value_type(1.2474977115846759810940571e-14L), value_type(1.2409008633162279591758923e-14L), value_type(1.2343901616592377531133699e-14L), 
+            value_type(1.2279632120192990382321632e-14L), value_type(1.2216177181245440716245042e-14L), value_type(1.2153514766983430437366758e-14L), value_type(1.2091623724883556241606091e-14L), value_type(1.2030483736236877061204888e-14L), value_type(1.1970075272744856631584149e-14L), value_type(1.1910379555906139566127722e-14L), value_type(1.1851378518981400993475306e-14L), 
+            value_type(1.1793054771342203935515826e-14L), value_type(1.1735391565026638216522516e-14L), value_type(1.1678372763339704273960161e-14L), value_type(1.1621982811350124516777107e-14L), value_type(1.1566206708147672079738091e-14L), value_type(1.1511029980736341484512977e-14L), value_type(1.1456438659448871074410257e-14L), value_type(1.1402419254777372147046475e-14L), 
+            value_type(1.1348958735523221034105725e-14L), value_type(1.1296044508177013639365076e-14L), value_type(1.1243664397446343256107848e-14L), value_type(1.1191806627855509555186410e-14L), value_type(1.1140459806347059787520416e-14L), value_type(1.1089612905820356289578452e-14L), value_type(1.1039255249547205380121932e-14L), value_type(1.0989376496409014674952172e-14L), 
+            value_type(1.0939966626904007212678657e-14L), value_type(1.0891015929876746084738061e-14L), value_type(1.0842514989925643468998248e-14L), value_type(1.0794454675447270910265805e-14L), value_type(1.0746826127279178411595524e-14L), value_type(1.0699620747905590948271317e-14L), value_type(1.0652830191192802723856744e-14L), value_type(1.0606446352623350206135707e-14L), 
+            value_type(1.0560461360000131290845712e-14L), value_type(1.0514867564593564839184357e-14L), value_type(1.0469657532706665898046475e-14L), value_type(1.0424824037634559443715150e-14L), value_type(1.0380360051996480651261013e-14L), value_type(1.0336258740419722616987828e-14L), value_type(1.0292513452556302359553329e-14L), value_type(1.0249117716414331174293425e-14L), 
+            value_type(1.0206065231987203641933492e-14L), value_type(1.0163349865164767747442220e-14L), value_type(1.0120965641911612985970316e-14L), value_type(1.0078906742698519806523505e-14L), value_type(1.0037167497173957555938190e-14L), value_type(9.9957423790633040685057017e-15L), value_type(9.9546260012841926221878452e-15L), value_type(9.9138131112670752001298971e-15L), 
+            value_type(9.8732985864707285670964206e-15L), value_type(9.8330774300830249980082701e-15L), value_type(9.7931447668978457037171354e-15L), value_type(9.7534958393595349566649534e-15L), value_type(9.7141260037667792633137000e-15L), value_type(9.6750307266282510868655674e-15L), value_type(9.6362055811627828255022592e-15L), value_type(9.5976462439372360546015541e-15L), 
+            value_type(9.5593484916356053415385239e-15L), value_type(9.5213081979532469868675633e-15L), value_type(9.4835213306104524492435531e-15L), value_type(9.4459839484798954632701939e-15L), value_type(9.4086921988227723363272096e-15L), value_type(9.3716423146287278853435279e-15L), value_type(9.3348306120549161252570170e-15L), value_type(9.2982534879597862379040411e-15L), 
+            value_type(9.2619074175274115433384705e-15L), value_type(9.2257889519783931012336979e-15L), value_type(9.1898947163635710562383740e-15L), value_type(9.1542214074369667135161210e-15L), value_type(9.1187657916045573371224783e-15L), value_type(9.0835247029456544991296822e-15L), value_type(9.0484950413038161172485491e-15L), value_type(9.0136737704443727036187924e-15L), 
+            value_type(8.9790579162757903661652688e-15L), value_type(8.9446445651322272765634159e-15L), value_type(8.9104308621147671298474070e-15L), value_type(8.8764140094889330214396819e-15L), value_type(8.8425912651361985787350812e-15L), value_type(8.8089599410573204988957709e-15L), value_type(8.7755174019254182285469118e-15L), value_type(8.7422610636868227166469351e-15L), 
+            value_type(8.7091883922078072984386727e-15L), value_type(8.6762969019654001246494506e-15L), value_type(8.6435841547805594151600258e-15L), value_type(8.6110477585920704513246126e-15L), value_type(8.5786853662695968703523626e-15L), value_type(8.5464946744643887174209719e-15L), value_type(8.5144734224962160607504230e-15L), value_type(8.4826193912751599824874667e-15L), 
+            value_type(8.4509304022569526121404152e-15L), value_type(8.4194043164306147459531500e-15L), value_type(8.3880390333371936606001071e-15L), value_type(8.3568324901184551383301863e-15L), value_type(8.3257826605944326191069488e-15L), value_type(8.2948875543687829204487602e-15L), value_type(8.2641452159609422463608965e-15L), value_type(8.2335537239641183640441951e-15L), 
+            value_type(8.2031111902281949748171820e-15L), value_type(8.1728157590666625510101295e-15L), value_type(8.1426656064867263542805638e-15L), value_type(8.1126589394417770877581199e-15L), value_type(8.0827939951054427540255238e-15L), value_type(8.0530690401664718773822428e-15L), value_type(8.0234823701437283814729882e-15L), value_type(7.9940323087206071670094238e-15L), 
+            value_type(7.9647172070982068795284893e-15L), value_type(7.9355354433666225604816995e-15L), value_type(7.9064854218937458992591852e-15L), value_type(7.8775655727309847083286360e-15L), value_type(7.8487743510353360845221884e-15L), value_type(7.8201102365072695495448747e-15L), value_type(7.7915717328438973320068783e-15L), value_type(7.7631573672069289089632440e-15L), 
+            value_type(7.7348656897049260117716234e-15L), value_type(7.7066952728893925613250289e-15L), value_type(7.6786447112642514713806644e-15L), value_type(7.6507126208082769836443148e-15L), value_type(7.6228976385100672103228716e-15L), value_type(7.5951984219151568929669419e-15L), value_type(7.5676136486848850727439888e-15L), value_type(7.5401420161666464372772759e-15L), 
+            value_type(7.5127822409751685917352596e-15L), value_type(7.4855330585844704243398303e-15L), value_type(7.4583932229301691248464683e-15L), value_type(7.4313615060218152934679013e-15L), value_type(7.4044366975649469705395133e-15L), value_type(7.3776176045925643461454838e-15L), value_type(7.3509030511057373950030819e-15L), value_type(7.3242918777230687451420905e-15L), 
+            value_type(7.2977829413387437483185065e-15L), value_type(7.2713751147889089937209036e-15L), value_type(7.2450672865261294115231487e-15L), value_type(7.2188583603016826655205710e-15L), value_type(7.1927472548554577499689993e-15L), value_type(7.1667329036132325995797999e-15L), value_type(7.1408142543911131074439140e-15L), value_type(7.1149902691069232368189651e-15L), 
+            value_type(7.0892599234983429219271485e-15L), value_type(7.0636222068475971922793110e-15L), value_type(7.0380761217125064360859416e-15L), value_type(7.0126206836637139520144496e-15L), value_type(6.9872549210279129353604117e-15L), value_type(6.9619778746369008145820803e-15L), value_type(6.9367885975822944065986902e-15L), value_type(6.9116861549757447033268259e-15L), 
+            value_type(6.8866696237144952462572335e-15L), value_type(6.8617380922521329986892857e-15L), value_type(6.8368906603743853943945972e-15L), value_type(6.8121264389798218344673418e-15L), value_type(6.7874445498653223280863819e-15L), value_type(6.7628441255161802346876247e-15L), value_type(6.7383243089007101711388348e-15L), value_type(6.7138842532692361041439638e-15L), 
+            value_type(6.6895231219573384612205687e-15L), value_type(6.6652400881932427688664594e-15L), value_type(6.6410343349092358693813789e-15L), value_type(6.6169050545569991834161485e-15L), value_type(6.5928514489267517786355641e-15L), value_type(6.5688727289700991806340281e-15L), value_type(6.5449681146264869249577733e-15L), value_type(6.5211368346531608030894556e-15L), 
+            value_type(6.4973781264585386046756213e-15L), value_type(6.4736912359389009070805225e-15L), value_type(6.4500754173183111153145039e-15L), value_type(6.4265299329916775141312386e-15L), value_type(6.4030540533708725630785724e-15L), value_type(6.3796470567338270478364234e-15L), value_type(6.3563082290765190004533918e-15L), value_type(6.3330368639677795201366569e-15L), 
+            value_type(6.3098322624068397679626409e-15L), value_type(6.2866937326835454760398786e-15L), value_type(6.2636205902411673069329746e-15L), value_type(6.2406121575417373250964618e-15L), value_type(6.2176677639338437011103158e-15L), value_type(6.1947867455228175639916307e-15L), value_type(6.1719684450432476490170208e-15L), value_type(6.1492122117337600604701943e-15L), 
+            value_type(6.1265174012140020825803593e-15L), value_type(6.1038833753637705296040700e-15L), value_type(6.0813095022042266294066810e-15L), value_type(6.0587951557811408858206376e-15L), value_type(6.0363397160501127652205008e-15L), value_type(6.0139425687637114038094199e-15L), value_type(5.9916031053604848356385850e-15L), value_type(5.9693207228557864988920578e-15L), 
+            value_type(5.9470948237343689909111885e-15L), value_type(5.9249248158446962121898491e-15L), value_type(5.9028101122949261674680204e-15L), value_type(5.8807501313505177793530285e-15L), value_type(5.8587442963334161178153294e-15L), value_type(5.8367920355227714585959251e-15L), value_type(5.8148927820571485561302136e-15L), value_type(5.7930459738381834530934319e-15L), 
+            value_type(5.7712510534356460501127497e-15L), value_type(5.7495074679938675265309609e-15L), value_type(5.7278146691394925372620832e-15L), value_type(5.7061721128905169126220509e-15L), value_type(5.6845792595665723583780335e-15L), value_type(5.6630355737004203929269369e-15L), value_type(5.6415405239506184682370168e-15L), value_type(5.6200935830153219016775589e-15L), 
+            value_type(5.5986942275471858977942859e-15L), value_type(5.5773419380693325631002774e-15L), value_type(5.5560361988923484136461664e-15L), value_type(5.5347764980322784450772046e-15L), value_type(5.5135623271295833786128109e-15L), value_type(5.4923931813690272143979533e-15L), value_type(5.4712685594004627164444623e-15L), value_type(5.4501879632604829213419358e-15L), 
+            value_type(5.4291508982949072064790647e-15L), value_type(5.4081568730820708730533761e-15L), value_type(5.3872053993568875950069191e-15L), value_type(5.3662959919356544575241279e-15L), value_type(5.3454281686415696581535528e-15L), value_type(5.3246014502309332702259959e-15L), value_type(5.3038153603200017722677778e-15L), value_type(5.2830694253124673287508264e-15L), 
+            value_type(5.2623631743275330669541061e-15L), value_type(5.2416961391285558320783462e-15L), value_type(5.2210678540522281181746015e-15L), value_type(5.2004778559382710660050593e-15L), value_type(5.1799256840596105907115131e-15L), value_type(5.1594108800530088521542872e-15L), value_type(5.1389329878501234090046567e-15L), value_type(5.1184915536089665041004483e-15L), 
+            value_type(5.0980861256457370131517251e-15L), value_type(5.0777162543669976515257124e-15L), value_type(5.0573814922021700744317239e-15L), value_type(5.0370813935363205242214388e-15L), value_type(5.0168155146432086745398546e-15L), value_type(4.9965834136185722944980876e-15L), value_type(4.9763846503136203066487943e-15L), value_type(4.9562187862687067400528124e-15L), 
+            value_type(4.9360853846471579838218466e-15L), value_type(4.9159840101692256268616025e-15L), value_type(4.8959142290461370257413800e-15L), value_type(4.8758756089142155742610388e-15L), value_type(4.8558677187690424549171170e-15L), value_type(4.8358901288996314335894323e-15L), value_type(4.8159424108225880138391207e-15L), value_type(4.7960241372162239956472662e-15L), 
+            value_type(4.7761348818545981846040784e-15L), value_type(4.7562742195414536708097085e-15L), value_type(4.7364417260440217413489092e-15L), value_type(4.7166369780266621053822802e-15L), value_type(4.6968595529843086958340131e-15L), value_type(4.6771090291756898654724238e-15L), value_type(4.6573849855562913169407043e-15L), value_type(4.6376870017110295950071261e-15L), 
+            value_type(4.6180146577866034239098238e-15L), value_type(4.5983675344234895920493004e-15L), value_type(4.5787452126875494692413192e-15L), value_type(4.5591472740012115870213157e-15L), value_type(4.5395733000741950187506698e-15L), value_type(4.5200228728337375620975230e-15L), value_type(4.5004955743542919503491064e-15L), value_type(4.4809909867866524993697057e-15L), 
+            value_type(4.4615086922864737321667568e-15L), value_type(4.4420482729421416111879826e-15L), value_type(4.4226093107019570477629429e-15L), value_type(4.4031913873005903465324567e-15L), value_type(4.3837940841847641781741573e-15L), value_type(4.3644169824381215540062262e-15L), value_type(4.3450596627052340987806716e-15L), value_type(4.3257217051147046806739632e-15L), 
+            value_type(4.3064026892013171575152565e-15L), value_type(4.2871021938271846328786572e-15L), value_type(4.2678197971018461818639088e-15L), value_type(4.2485550763012605010881596e-15L), value_type(4.2293076077856433573192582e-15L), value_type(4.2100769669160940508173527e-15L), value_type(4.1908627279699543691337359e-15L), value_type(4.1716644640548416809471969e-15L), 
+            value_type(4.1524817470212959033747662e-15L), value_type(4.1333141473739780657106271e-15L), value_type(4.1141612341813560831027796e-15L), value_type(4.0950225749838111403781230e-15L), value_type(4.0758977357000957638896706e-15L), value_type(4.0567862805320722223932941e-15L), value_type(4.0376877718676573407465419e-15L), value_type(4.0186017701818971264904707e-15L), 
+            value_type(3.9995278339360917925871279e-15L), value_type(3.9804655194748888028042360e-15L), value_type(3.9614143809212584621064133e-15L), value_type(3.9423739700692633151202201e-15L), value_type(3.9233438362745291929992789e-15L), value_type(3.9043235263423221540236277e-15L), value_type(3.8853125844131317866746246e-15L), value_type(3.8663105518456573757983222e-15L), 
+            value_type(3.8473169670970892622461134e-15L), value_type(3.8283313656005733428327974e-15L), value_type(3.8093532796397420486348687e-15L), value_type(3.7903822382201902928560763e-15L), value_type(3.7714177669377697811836917e-15L), value_type(3.7524593878435697133398973e-15L), value_type(3.7335066193054462590496010e-15L), value_type(3.7145589758659572485410334e-15L), 
+            value_type(3.6956159680965522595284503e-15L), value_type(3.6766771024478616907950503e-15L), value_type(3.6577418810959214671492447e-15L), value_type(3.6388098017841627004787699e-15L), value_type(3.6198803576609879142443726e-15L), value_type(3.6009530371127472998582163e-15L), value_type(3.5820273235919198871351888e-15L), value_type(3.5631026954402954497469481e-15L), 
+            value_type(3.5441786257069434007751092e-15L), value_type(3.5252545819607448313949356e-15L), value_type(3.5063300260972531735219980e-15L), value_type(3.4874044141396376885965019e-15L), value_type(3.4684771960334520606231910e-15L), value_type(3.4495478154349577603643019e-15L), value_type(3.4306157094927185043821627e-15L), value_type(3.4116803086221680093296243e-15L), 
+            value_type(3.3927410362728382868029965e-15L), value_type(3.3737973086879198816506480e-15L), value_type(3.3548485346558086671312110e-15L), value_type(3.3358941152532760094607151e-15L), value_type(3.3169334435798802328786731e-15L), value_type(3.2979659044832172798588641e-15L), value_type(3.2789908742745871891510761e-15L), value_type(3.2600077204346304203228450e-15L), 
+            value_type(3.2410158013084640438798971e-15L), value_type(3.2220144657898222899288317e-15L), value_type(3.2030030529936787966351993e-15L), value_type(3.1839808919167990045082782e-15L), value_type(3.1649473010856403762492608e-15L), value_type(3.1459015881909853464469842e-15L), value_type(3.1268430497086569712182637e-15L), value_type(3.1077709705056299928348654e-15L), 
+            value_type(3.0886846234308102825911307e-15L), value_type(3.0695832688897131857523766e-15L), value_type(3.0504661544022259580324778e-15L), value_type(3.0313325141425910282864588e-15L), value_type(3.0121815684606950017864198e-15L), value_type(2.9930125233836928656640784e-15L), value_type(2.9738245700969374820622427e-15L), value_type(2.9546168844031208381948459e-15L), 
+            value_type(2.9353886261584653199232110e-15L), value_type(2.9161389386847301088270017e-15L), value_type(2.8968669481557192591844276e-15L), value_type(2.8775717629568936391306986e-15L), value_type(2.8582524730165982250824746e-15L), value_type(2.8389081491073186785108614e-15L), value_type(2.8195378421152761151370388e-15L), value_type(2.8001405822765558463881383e-15L), 
+            value_type(2.7807153783778439148869880e-15L), value_type(2.7612612169197136717905232e-15L), value_type(2.7417770612402625864453742e-15L), value_type(2.7222618505967459822392191e-15L), value_type(2.7027144992026884024220465e-15L), value_type(2.6831338952177736620501570e-15L), value_type(2.6635188996876200505766252e-15L), value_type(2.6438683454303361905964269e-15L), 
+            value_type(2.6241810358665241553130106e-15L), value_type(2.6044557437891478523098995e-15L), value_type(2.5846912100694144536260878e-15L), value_type(2.5648861422945226352648196e-15L), value_type(2.5450392133328111833999207e-15L), value_type(2.5251490598214924563233829e-15L), value_type(2.5052142805717742787048363e-15L), value_type(2.4852334348857577577489829e-15L), 
+            value_type(2.4652050407790435252012380e-15L), value_type(2.4451275731024808547306317e-15L), value_type(2.4249994615559483051257663e-15L), value_type(2.4048190885864557456974777e-15L), value_type(2.3845847871621999276548602e-15L), value_type(2.3642948384134825260017669e-15L), value_type(2.3439474691306032932304352e-15L), value_type(2.3235408491079631703191149e-15L), 
+            value_type(2.3030730883226433119927216e-15L), value_type(2.2825422339346551462521927e-15L), value_type(2.2619462670948714816233364e-15L), value_type(2.2412830995453352909270512e-15L), value_type(2.2205505699951851828521972e-15L), value_type(2.1997464402538165180030781e-15L), value_type(2.1788683911010938251129250e-15L), value_type(2.1579140178724197932983532e-15L), 
+            value_type(2.1368808257342213092074067e-15L), value_type(2.1157662246229023273878657e-15L), value_type(2.0945675238175005747610951e-15L), value_type(2.0732819261131283570651880e-15L), value_type(2.0519065215587286388731889e-15L), value_type(2.0304382807186799506166572e-15L), value_type(2.0088740474132722456820707e-15L), value_type(1.9872105308879744974641495e-15L), 
+            value_type(1.9654442973556346907262890e-15L), value_type(1.9435717608491897905077123e-15L), value_type(1.9215891733149949616888340e-15L), value_type(1.8994926138683637217680189e-15L), value_type(1.8772779771231737098025582e-15L), value_type(1.8549409604962348097371324e-15L), value_type(1.8324770503742980013880851e-15L), value_type(1.8098815070168190646246844e-15L), 
+            value_type(1.7871493480505397258161197e-15L), value_type(1.7642753303922002959852992e-15L), value_type(1.7412539304127588635483110e-15L), value_type(1.7180793221297661825013684e-15L), value_type(1.6947453531833087039132087e-15L), value_type(1.6712455183143028320145012e-15L), value_type(1.6475729300208224541892690e-15L), value_type(1.6237202860172431950810846e-15L), 
+            value_type(1.5996798330606539223151049e-15L), value_type(1.5754433266371886442162467e-15L), value_type(1.5510019859151394298874737e-15L), value_type(1.5263464432687522554812626e-15L), value_type(1.5014666875524873115125889e-15L), value_type(1.4763520001551802209961517e-15L), value_type(1.4509908826805159052958338e-15L), value_type(1.4253709748762406096919800e-15L), 
+            value_type(1.3994789611588924244087107e-15L), value_type(1.3733004637396108473047310e-15L), value_type(1.3468199199315535555787540e-15L), value_type(1.3200204406865106864572917e-15L), value_type(1.2928836467353676774049692e-15L), value_type(1.2653894778509865215189495e-15L), value_type(1.2375159696543127595868318e-15L), value_type(1.2092389909648277621888663e-15L), 
+            value_type(1.1805319328436589079815792e-15L), value_type(1.1513653380358533864992624e-15L), value_type(1.1217064562662454783488876e-15L), value_type(1.0915187064626674539213805e-15L), value_type(1.0607610210062926272653336e-15L), value_type(1.0293870388526011505286242e-15L), value_type(9.9734410278841360089999849e-16L), value_type(9.6457199959316121399625578e-16L), 
+            value_type(9.3100135795004629601381884e-16L), value_type(8.9655158358403595482789616e-16L), value_type(8.6112815767376919634885678e-16L), value_type(8.2461904190400723601429874e-16L), value_type(7.8688980206736449457238354e-16L), value_type(7.4777684659090115654649300e-16L), value_type(7.0707781033830469888344844e-16L), value_type(6.6453746665624119594645668e-16L), 
+            value_type(6.1982634983248653832973816e-16L), value_type(5.7250691337917469737583361e-16L), value_type(5.2197709719822111286535458e-16L), value_type(4.6736985363789712307691022e-16L), value_type(4.0735835838439376296818421e-16L), value_type(3.3973204658739401985409816e-16L), value_type(2.6030558000813357487038698e-16L), value_type(1.5924517113829070931938765e-16L)
+        }; // downscaled_layer_widths[...]
+
+        static inline const expectation_type layer_bottom_endpoints[n_boxes] = {
+            expectation_type(0.0000000000000000000000000L), expectation_type(0.00020721783744635918968952929L), expectation_type(0.00043886672775980303183094354L), expectation_type(0.00069300017184409350947051025L), expectation_type(0.00096309309483817841638174844L), expectation_type(0.0012459849125208814143141717L), expectation_type(0.0015397701842404248127078010L), expectation_type(0.0018431594067784276767553902L), 
+            expectation_type(0.0021552146978583792443992555L), expectation_type(0.0024752194002373523990148675L), expectation_type(0.0028026058533448324027609604L), expectation_type(0.0031369119459340503444296509L), expectation_type(0.0034777533118636174564826753L), expectation_type(0.0038248046561578975188500416L), expectation_type(0.0041777867172523927845054373L), expectation_type(0.0045364568697845658281215889L), 
+            expectation_type(0.0049006021685972633758703617L), expectation_type(0.0052700340820601560936192836L), expectation_type(0.0056445844261951472869044867L), expectation_type(0.0060241021723627292634277320L), expectation_type(0.0064084509034165849409015468L), expectation_type(0.0067975067598692365989525599L), expectation_type(0.0071911567622168692829048180L), expectation_type(0.0075892974261199805224021902L), 
+            expectation_type(0.0079918336084884426107355654L), expectation_type(0.0083986775377186407732592002L), expectation_type(0.0088097479923293856474262983L), expectation_type(0.0092249696003227712485253983L), expectation_type(0.0096442722376123975796616083L), expectation_type(0.010067590508397449719034718L), expectation_type(0.010494863293820558615207215L), expectation_type(0.010926033357913685982974413L), 
+            expectation_type(0.011361047001911455796817769L), expectation_type(0.011799853759641138239648867L), expectation_type(0.012242406127989293125973420L), expectation_type(0.012688659327475459816740283L), expectation_type(0.013138571088791836084708046L), expectation_type(0.013592101461838746163612364L), expectation_type(0.014049212644332388394157396L), expectation_type(0.014509868827509569093045615L), 
+            expectation_type(0.014974036056823716800398880L), expectation_type(0.015441682105832872858635777L), expectation_type(0.015912776361735672473558046L), expectation_type(0.016387289721225112386365767L), expectation_type(0.016865194495509726590466495L), expectation_type(0.017346464323503713523688989L), expectation_type(0.017831074092316438840416442L), expectation_type(0.018318999864281503417657497L), 
+            expectation_type(0.018810218809859403511079740L), expectation_type(0.019304709145828318342976050L), expectation_type(0.019802450078246870024404949L), expectation_type(0.020303421749732565003043793L), expectation_type(0.020807605190651494658795091L), expectation_type(0.021314982273859948354198356L), expectation_type(0.021825535672677877722626297L), expectation_type(0.022339248821808484778550035L), 
+            expectation_type(0.022856105880948292448309754L), expectation_type(0.023376091700858487252207259L), expectation_type(0.023899191791691601201911081L), expectation_type(0.024425392293388148345987146L), expectation_type(0.024954679947976012099385863L), expectation_type(0.025487042073621500705808740L), expectation_type(0.026022466540295313520693262L), expectation_type(0.026560941746929416387660229L), 
+            expectation_type(0.027102456599952204687659361L), expectation_type(0.027647000493099505356092916L), expectation_type(0.028194563288408079239539246L), expectation_type(0.028745135298306458197520256L), expectation_type(0.029298707268725296426865482L), expectation_type(0.029855270363156027546257022L), expectation_type(0.030414816147592580855817272L), expectation_type(0.030977336576296294289953749L), 
+            expectation_type(0.031542823978329031340065730L), expectation_type(0.032111271044803920310289630L), expectation_type(0.032682670816807135644104703L), expectation_type(0.033257016673947775859080035L), expectation_type(0.033834302323496198926601846L), expectation_type(0.034414521790074187400164158L), expectation_type(0.034997669405863062050113885L), expectation_type(0.035583739801298370661909311L), 
+            expectation_type(0.036172727896222071510612595L), expectation_type(0.036764628891465229763462176L), expectation_type(0.037359438260836168340074791L), expectation_type(0.037957151743490779230938194L), expectation_type(0.038557765336663321830115544L), expectation_type(0.039161275288737524809950295L), expectation_type(0.039767678092639179407851528L), expectation_type(0.040376970479532675440190285L), 
+            expectation_type(0.040989149412805096554162167L), expectation_type(0.041604212082322566860031506L), expectation_type(0.042222155898944534980996732L), expectation_type(0.042842978489282600779497540L), expectation_type(0.043466677690691340948799646L), expectation_type(0.044093251546479378069574486L), expectation_type(0.044722698301329668850268561L), expectation_type(0.045355016396918665836330456L), 
+            expectation_type(0.045990204467724637187825548L), expectation_type(0.046628261337016015095265350L), expectation_type(0.047269186013011188583601999L), expectation_type(0.047912977685201664079943980L), expectation_type(0.048559635720830990140424853L), expectation_type(0.049209159661522283835794440L), expectation_type(0.049861549220047607939970042L), expectation_type(0.050516804277232832495948089L), 
+            expectation_type(0.051174924878991973602865272L), expectation_type(0.051835911233485338257099112L), expectation_type(0.052499763708396118512492842L), expectation_type(0.053166482828320372680853321L), expectation_type(0.053836069272265607225006867L), expectation_type(0.054508523871253431736272548L), expectation_type(0.055183847606022002162327174L), expectation_type(0.055862041604824195388463864L), 
+            expectation_type(0.056543107141317672414440642L), expectation_type(0.057227045632543188668392889L), expectation_type(0.057913858636987699342258919L), expectation_type(0.058603547852728985835529633L), expectation_type(0.059296115115658697209416015L), expectation_type(0.059991562397780858678353181L), expectation_type(0.060689891805583048244588765L), expectation_type(0.061391105578477583211061243L), 
+            expectation_type(0.062095206087310191040577113L), expectation_type(0.062802195832933764377830835L), expectation_type(0.063512077444844918490391167L), expectation_type(0.064224853679881181356613433L), expectation_type(0.064940527420976752542348233L), expectation_type(0.065659101675974867245205261L), expectation_type(0.066380579576494896799241896L), expectation_type(0.067104964376852406853938459L), 
+            expectation_type(0.067832259453030479676157965L), expectation_type(0.068562468301700687858468936L), expectation_type(0.069295594539292183418362750L), expectation_type(0.070031641901107439089233302L), expectation_type(0.070770614240483247767638554L), expectation_type(0.071512515527995651809111797L), expectation_type(0.072257349850707536359194061L), expectation_type(0.073005121411457680356792496L), 
+            expectation_type(0.073755834528190115430578292L), expectation_type(0.074509493633322696791717874L), expectation_type(0.075266103273153841563040100L), expectation_type(0.076025668107306438921245714L), expectation_type(0.076788192908207983101327313L), expectation_type(0.077553682560606024848886782L), expectation_type(0.078322142061118079426533435L), expectation_type(0.079093576517815169897706547L), 
+            expectation_type(0.079867991149838223230945796L), expectation_type(0.080645391287046573889320823L), expectation_type(0.081425782369697865086979537L), expectation_type(0.082209169948158671895599345L), expectation_type(0.082995559682645202950774699L), expectation_type(0.083784957342993468720072076L), expectation_type(0.084577368808458334224147427L), expectation_type(0.085372800067540902819258425L), 
+            expectation_type(0.086171257217843705219084972L), expectation_type(0.086972746465953194417686113L), expectation_type(0.087777274127349072631915081L), expectation_type(0.088584846626340000865708966L), expectation_type(0.089395470496025265262369935L), expectation_type(0.090209152378281997103438937L), expectation_type(0.091025899023777565180560534L), expectation_type(0.091845717292006780353896920L), 
+            expectation_type(0.092668614151353572458891987L), expectation_type(0.093494596679176819372052069L), expectation_type(0.094323672061920027033391770L), expectation_type(0.095155847595244577583863698L), expectation_type(0.095991130684186280544220423L), expectation_type(0.096829528843334979169424088L), expectation_type(0.097671049697036980790413989L), expectation_type(0.098515700979620096131763505L), 
+            expectation_type(0.099363490535641088297102292L), expectation_type(0.10021442632015534737042901L), expectation_type(0.10106851639900862141563864L), expectation_type(0.10192576894915064909261990L), expectation_type(0.10278619225897055316893402L), expectation_type(0.10364979472865386791313183L), expectation_type(0.10451658487056108673000466L), expectation_type(0.10538657130962762945939228L), 
+            expectation_type(0.10625976278378514152763526L), expectation_type(0.10713616814440404963260639L), expectation_type(0.10801579635675731087698425L), expectation_type(0.10889865650050530425683438L), expectation_type(0.10978475777020182517977123L), expectation_type(0.11067410947582115524449970L), expectation_type(0.11156672104330619087630777L), expectation_type(0.11246260201513762559548690L), 
+            expectation_type(0.11336176205092419171156896L), expectation_type(0.11426421092801397809908396L), expectation_type(0.11516995854212685143321128L), expectation_type(0.11607901490800801885875173L), expectation_type(0.11699139016010278054543090L), expectation_type(0.11790709455325253095843644L), expectation_type(0.11882613846341207795673624L), expectation_type(0.11974853238838835903425005L), 
+            expectation_type(0.12067428694860064415119276L), expectation_type(0.12160341288786232467544408L), expectation_type(0.12253592107418439797695025L), expectation_type(0.12347182250060076720202293L), expectation_type(0.12441112828601548570885785L), expectation_type(0.12535384967607208558034817L), expectation_type(0.12629999804404513955484082L), expectation_type(0.12724958489175421563925044L), 
+            expectation_type(0.12820262185050039360113795L), expectation_type(0.12915912068202552248609016L), expectation_type(0.13011909327949440828300779L), expectation_type(0.13108255166850013087163429L), expectation_type(0.13204950800809269944267263L), expectation_type(0.13301997459183126568991347L), expectation_type(0.13399396384886012424465974L), expectation_type(0.13497148834500874006406689L), 
+            expectation_type(0.13595256078391605280548954L), expectation_type(0.13693719400817931862719016L), expectation_type(0.13792540100052776036048214L), expectation_type(0.13891719488502130760822317L), expectation_type(0.13991258892827471904824763L), expectation_type(0.14091159654070739006657376L), expectation_type(0.14191423127781915982283727L), expectation_type(0.14292050684149244296825123L), 
+            expectation_type(0.14393043708132102250340953L), expectation_type(0.14494403599596585168846691L), expectation_type(0.14596131773453822451077043L), expectation_type(0.14698229659801068598412885L), expectation_type(0.14800698704065606550895466L), expectation_type(0.14903540367151502867300512L), expectation_type(0.15006756125589255522803940L), expectation_type(0.15110347471688376354821771L), 
+            expectation_type(0.15214315913692951467148948L), expectation_type(0.15318662975940224205573449L), expectation_type(0.15423390199022246645741594L), expectation_type(0.15528499139950646887257885L), expectation_type(0.15633991372324560827900528L), expectation_type(0.15739868486501778499529132L), expectation_type(0.15846132089773156483886327L), expectation_type(0.15952783806540349393209862L), 
+            expectation_type(0.16059825278496914898564406L), expectation_type(0.16167258164812848319290917L), expectation_type(0.16275084142322604351206088L), expectation_type(0.16383304905716665110448249L), expectation_type(0.16491922167736715305477293L), expectation_type(0.16600937659374487023049486L), expectation_type(0.16710353130074338326396739L), expectation_type(0.16820170347939631616777347L), 
+            expectation_type(0.16930391099942979504507062L), expectation_type(0.17041017192140427774045253L), expectation_type(0.17152050449889646911266605L), expectation_type(0.17263492718072205591308284L), expectation_type(0.17375345861320001504010071L), expectation_type(0.17487611764245926922677625L), expectation_type(0.17600292331678848502468650L), expectation_type(0.17713389488902982928957591L), 
+            expectation_type(0.17826905181901752227265888L), expectation_type(0.17940841377606204789503266L), expectation_type(0.18055200064148090485168316L), expectation_type(0.18169983251117680587688478L), expectation_type(0.18285192969826425682596886L), expectation_type(0.18400831273574547221176333L), expectation_type(0.18516900237923660950056659L), expectation_type(0.18633401960974533084619178L), 
+            expectation_type(0.18750338563650072804612856L), expectation_type(0.18867712189983667436681864L), expectation_type(0.18985525007412969553194616L), expectation_type(0.19103779207079248162597695L), expectation_type(0.19222477004132419196340975L), expectation_type(0.19341620638041873614183667L), expectation_type(0.19461212372913224656454211L), expectation_type(0.19581254497811099071772305L), 
+            expectation_type(0.19701749327088100545139530L), expectation_type(0.19822699200720077047579679L), expectation_type(0.19944106484647827428203414L), expectation_type(0.20065973571125386276360845L), expectation_type(0.20188302879075029899246692L), expectation_type(0.20311096854449150192898849L), expectation_type(0.20434357970599147236098065L), expectation_type(0.20558088728651495611509148L), 
+            expectation_type(0.20682291657891143760944331L), expectation_type(0.20806969316152410116492666L), expectation_type(0.20932124290217544321242887L), expectation_type(0.21057759196223126567418114L), expectation_type(0.21183876680074482941124498L), expectation_type(0.21310479417868299676985153L), expectation_type(0.21437570116323624398294742L), expectation_type(0.21565151513221447754824825L), 
+            expectation_type(0.21693226377853064377108033L), expectation_type(0.21821797511477417749250641L), expectation_type(0.21950867747787639468647349L), expectation_type(0.22080439953386999417249204L), expectation_type(0.22210517028274489622399200L), expectation_type(0.22341101906340271043130413L), expectation_type(0.22472197555871219187959128L), expectation_type(0.22603806980066811360666031L), 
+            expectation_type(0.22735933217565605449747914L), expectation_type(0.22868579342982567533902803L), expectation_type(0.23001748467457513179218156L), expectation_type(0.23135443739214935163191406L), expectation_type(0.23269668344135498486260387L), expectation_type(0.23404425506339491933523672L), expectation_type(0.23539718488782534138602817L), expectation_type(0.23675550593863841089427310L), 
+            expectation_type(0.23811925164047371313890593L), expectation_type(0.23948845582496174604133116L), expectation_type(0.24086315273720280094501299L), expectation_type(0.24224337704238469813426553L), expectation_type(0.24362916383254294497582632L), expectation_type(0.24502054863346699502358466L), expectation_type(0.24641756741175640081234384L), expectation_type(0.24782025658203077154073385L), 
+            expectation_type(0.24922865301429756957366219L), expectation_type(0.25064279404148190685596300L), expectation_type(0.25206271746712263410419590L), expectation_type(0.25348846157323915222434191L), expectation_type(0.25492006512837351698982885L), expectation_type(0.25635756739581255481663801L), expectation_type(0.25780100814199485970979300L), expectation_type(0.25925042764510769935826348L), 
+            expectation_type(0.26070586670387902216409261L), expectation_type(0.26216736664656992695871813L), expectation_type(0.26363496934017313354943175L), expectation_type(0.26510871719982317532887381L), expectation_type(0.26658865319842422526096591L), expectation_type(0.26807482087650166393245648L), expectation_type(0.26956726435228370334990842L), expectation_type(0.27106602833201959310281729L), 
+            expectation_type(0.27257115812054115675650856L), expectation_type(0.27408269963207463625289676L), expectation_type(0.27560069940131006107091638L), expectation_type(0.27712520459473560733874141L), expectation_type(0.27865626302224467042463901L), expectation_type(0.28019392314902364321200323L), expectation_type(0.28173823410772867175926862L), expectation_type(0.28328924571095995085372526L), 
+            expectation_type(0.28484700846404242461207492L), expectation_type(0.28641157357812207230929281L), expectation_type(0.28798299298358728760904376L), expectation_type(0.28956131934382520093190172L), expectation_type(0.29114660606932315047236147L), expectation_type(0.29273890733212587803648223L), expectation_type(0.29433827808065941212928494L), expectation_type(0.29594477405493300332313403L), 
+            expectation_type(0.29755845180213089667401493L), expectation_type(0.29917936869260616365337864L), expectation_type(0.30080758293628927260591461L), expectation_type(0.30244315359952455305317493L), expectation_type(0.30408614062234820621536981L), expectation_type(0.30573660483622203294900436L), expectation_type(0.30739460798223759198393684L), expectation_type(0.30906021272980606703857916L), 
+            expectation_type(0.31073348269584971230987043L), expectation_type(0.31241448246451136325781794L), expectation_type(0.31410327760739914488860165L), expectation_type(0.31579993470438418431921867L), expectation_type(0.31750452136496983979708750L), expectation_type(0.31921710625025169615489831L), expectation_type(0.32093775909548834860323761L), expectation_type(0.32266655073330380460019709L), 
+            expectation_type(0.32440355311754317919403337L), expectation_type(0.32614883934780424473142152L), expectation_type(0.32790248369466832330063397L), expectation_type(0.32966456162565498200612170L), expectation_type(0.33143514983192600955656097L), expectation_type(0.33321432625576522024791874L), expectation_type(0.33500217011886175094935800L), expectation_type(0.33679876195142569103392020L), 
+            expectation_type(0.33860418362216611739875411L), expectation_type(0.34041851836916290004435471L), expectation_type(0.34224185083166500158769467L), expectation_type(0.34407426708284942024932733L), expectation_type(0.34591585466357642419434828L), expectation_type(0.34776670261717829978895728L), expectation_type(0.34962690152532049179642724L), expectation_type(0.35149654354497575450702967L), 
+            expectation_type(0.35337572244655376431578681L), expectation_type(0.35526453365323057170397710L), expectation_type(0.35716307428152429967820294L), expectation_type(0.35907144318316563259323492L), expectation_type(0.36098974098831389046495108L), expectation_type(0.36291807015017185634639378L), expectation_type(0.36485653499105502555174770L), expectation_type(0.36680524174997358344463652L), 
+            expectation_type(0.36876429863178820168931927L), expectation_type(0.37073381585800368042611623L), expectation_type(0.37271390571926756555174397L), expectation_type(0.37470468262964414663418178L), expectation_type(0.37670626318273770319550292L), expectation_type(0.37871876620974252719251213L), expectation_type(0.38074231283950112042969884L), expectation_type(0.38277702656065606121684556L), 
+            expectation_type(0.38482303328598536972646063L), expectation_type(0.38688046141901579221752382L), expectation_type(0.38894944192301328777941080L), expectation_type(0.39103010839245515602585798L), expectation_type(0.39312259712709371016124095L), expectation_type(0.39522704720872719851383330L), expectation_type(0.39734360058079983211427900L), expectation_type(0.39947240213095931113543499L), 
+            expectation_type(0.40161359977670718591535056L), expectation_type(0.40376734455428476791533011L), expectation_type(0.40593379071094515371047045L), expectation_type(0.40811309580077027490418117L), expectation_type(0.41030542078420077540667807L), expectation_type(0.41251093013145598455070025L), expectation_type(0.41472979193003134306873817L), expectation_type(0.41696217799647139566648225L), 
+            expectation_type(0.41920826399262793938461235L), expectation_type(0.42146822954662516605125994L), expectation_type(0.42374225837876671952552988L), expectation_type(0.42603053843263356893689054L), expectation_type(0.42833326201163654824049795L), expectation_type(0.43065062592130340688133137L), expectation_type(0.43298283161759733979580939L), expectation_type(0.43533008536158230852622130L), 
+            expectation_type(0.43769259838077012833032098L), expectation_type(0.44007058703750538743042911L), expectation_type(0.44246427300476690264154800L), expectation_type(0.44487388344978873035286402L), expectation_type(0.44729965122592988531109996L), expectation_type(0.44974181507325002755930982L), expectation_type(0.45220061982827863095631878L), expectation_type(0.45467631664349773234186001L), 
+            expectation_type(0.45716916321709348450499450L), expectation_type(0.45967942403356962506115284L), expectation_type(0.46220737061585687635016598L), expectation_type(0.46475328178959648310421813L), expectation_type(0.46731744396032387772119532L), expectation_type(0.46990015140433017183296364L), expectation_type(0.47250170657403517695442871L), expectation_type(0.47512242041876636510073921L), 
+            expectation_type(0.47776261272190404508635493L), expectation_type(0.48042261245542455373017341L), expectation_type(0.48310275815295100057055003L), expectation_type(0.48580339830250567914604676L), expectation_type(0.48852489176025035636137275L), expectation_type(0.49126760818660104139079809L), expectation_type(0.49403192850621337295710692L), expectation_type(0.49681824539345440459470336L), 
+            expectation_type(0.49962696378510738059604941L), expectation_type(0.50245850142219927763612023L), expectation_type(0.50531328942299778054289970L), expectation_type(0.50819177288939647207828179L), expectation_type(0.51109441154909604007722778L), expectation_type(0.51402168043619714854671228L), expectation_type(0.51697407061304943368494005L), expectation_type(0.51995208993645330108532474L), 
+            expectation_type(0.52295626387158956536998004L), expectation_type(0.52598713635735960266540401L), expectation_type(0.52904527072715911452495956L), expectation_type(0.53213125068948584785827523L), expectation_type(0.53524568137320025605134223L), expectation_type(0.53838919044272334374677622L), expectation_type(0.54156242928897378075356884L), expectation_type(0.54476607430242363526576371L), 
+            expectation_type(0.54800082823529660720651534L), expectation_type(0.55126742166065345839519588L), expectation_type(0.55456661453691682938459769L), expectation_type(0.55789919788729380254294226L), expectation_type(0.56126599560457330305143078L), expectation_type(0.56466786639292282940574891L), expectation_type(0.56810570585960379657641388L), expectation_type(0.57158044877098877888373312L), 
+            expectation_type(0.57509307148892264933083931L), expectation_type(0.57864459460535288910566046L), expectation_type(0.58223608579529725675673425L), expectation_type(0.58586866291066086580200546L), expectation_type(0.58954349734020830710430056L), expectation_type(0.59326181766419755895303927L), expectation_type(0.59702491363585972300130277L), expectation_type(0.60083414052614396452946629L), 
+            expectation_type(0.60469092387303831958656169L), expectation_type(0.60859676468244174638136309L), expectation_type(0.61255324513414244197781892L), expectation_type(0.61656203485412306714709585L), expectation_type(0.62062489782337269319628126L), expectation_type(0.62474370000389090955128904L), expectation_type(0.62892041777493104248579693L), expectation_type(0.63315714728712708681064736L), 
+            expectation_type(0.63745611485945216315842594L), expectation_type(0.64181968856454734937020250L), expectation_type(0.64625039117256444867978180L), expectation_type(0.65075091465319424303599275L), expectation_type(0.65532413647114914812073059L), expectation_type(0.65997313795348840448192621L), expectation_type(0.66470122505966689103991366L), expectation_type(0.66951195194943155768263933L), 
+            expectation_type(0.67440914782275190543588637L), expectation_type(0.67939694760384629445628723L), expectation_type(0.68447982716328846856933622L), expectation_type(0.68966264392506406806322705L), expectation_type(0.69495068389850889641505205L), expectation_type(0.70034971642068549186625387L), expectation_type(0.70586605820975206403776904L), expectation_type(0.71150664873729443325879048L), 
+            expectation_type(0.71727913945936837770152560L), expectation_type(0.72319200014692332390536441L), expectation_type(0.72925464648993591873678824L), expectation_type(0.73547759440747709659004092L), expectation_type(0.74187264821167249929128092L), expectation_type(0.74845313214526635827628608L), expectation_type(0.75523417813929314431455069L), expectation_type(0.76223308737894139898772102L), 
+            expectation_type(0.76946979014354445397615606L), expectation_type(0.77696743855888550001834253L), expectation_type(0.78475318227282791611785888L), expectation_type(0.79285920086473065534814573L), expectation_type(0.80132410465836278942261877L), expectation_type(0.81019487771676995816279493L), expectation_type(0.81952964234332621205215691L), expectation_type(0.82940171123596302000799357L), 
+            expectation_type(0.83990574028828638442358351L), expectation_type(0.85116747651166736686823054L), expectation_type(0.86336002946253700818118862L), expectation_type(0.87673287837407410881274868L), expectation_type(0.89166820379521830373051201L), expectation_type(0.90880378162845308259058488L), expectation_type(0.92935032978672016308870604L), expectation_type(0.95616620079454265269621639L)
+        }; // layer_bottom_endpoints[...]
+
+        static inline const expectation_type downscaled_layer_heights[n_boxes] = {
+            expectation_type(7.3618564558714157142267310e-19L), expectation_type(8.2298218129553172106083829e-19L), expectation_type(9.0286336303894423062008114e-19L), expectation_type(9.5956282206829920679801749e-19L), expectation_type(1.0050336303020799383249567e-18L), expectation_type(1.0437349534681475025215845e-18L), expectation_type(1.0778550409114158338135429e-18L), expectation_type(1.1086431011618198151572528e-18L), 
+            expectation_type(1.1368850834222651666774179e-18L), expectation_type(1.1631103302089271055891939e-18L), expectation_type(1.1876938280480655740323873e-18L), expectation_type(1.2109117830390243958220519e-18L), expectation_type(1.2329740581203953387807259e-18L), expectation_type(1.2540441968216119040121462e-18L), expectation_type(1.2742523570785178246058983e-18L), expectation_type(1.2937039841627709842440090e-18L), 
+            expectation_type(1.3124858123450665567401581e-18L), expectation_type(1.3306701310078229168543876e-18L), expectation_type(1.3483178881571096668819130e-18L), expectation_type(1.3654809942446527875674499e-18L), expectation_type(1.3822040630367845901640896e-18L), expectation_type(1.3985257480002889084787160e-18L), expectation_type(1.4144797827353011640282252e-18L), expectation_type(1.4300958013125733658525597e-18L), 
+            expectation_type(1.4453999925130731011919752e-18L), expectation_type(1.4604156270463389496069523e-18L), expectation_type(1.4751634864516456824737621e-18L), expectation_type(1.4896622150559857573115077e-18L), expectation_type(1.5039286111042345456984078e-18L), expectation_type(1.5179778693518756474758148e-18L), expectation_type(1.5318237845929477444108438e-18L), expectation_type(1.5454789234957337360835075e-18L), 
+            expectation_type(1.5589547705363457971325717e-18L), expectation_type(1.5722618526160532986551930e-18L), expectation_type(1.5854098460229987074992736e-18L), expectation_type(1.5984076686819217143502377e-18L), expectation_type(1.6112635600752571824325707e-18L), expectation_type(1.6239851507778405964550333e-18L), expectation_type(1.6365795231976048834629789e-18L), expectation_type(1.6490532648353072758827778e-18L), 
+            expectation_type(1.6614125151518440746990697e-18L), expectation_type(1.6736630069502257661372214e-18L), expectation_type(1.6858101030317186492546878e-18L), expectation_type(1.6978588287650207958263457e-18L), expectation_type(1.7098139011082076984720708e-18L), expectation_type(1.7216797545413237401391166e-18L), expectation_type(1.7334605642995850541212364e-18L), expectation_type(1.7451602672405706989256308e-18L), 
+            expectation_type(1.7567825806314253209410865e-18L), expectation_type(1.7683310191023105409155311e-18L), expectation_type(1.7798089099787857437027384e-18L), expectation_type(1.7912194071773919538184732e-18L), expectation_type(1.8025655038245797995300605e-18L), expectation_type(1.8138500437385516131811317e-18L), expectation_type(1.8250757318959958332963463e-18L), expectation_type(1.8362451439906007024833308e-18L), 
+            expectation_type(1.8473607351772495066848030e-18L), expectation_type(1.8584248480845950557546696e-18L), expectation_type(1.8694397201690158763504173e-18L), expectation_type(1.8804074904745449494434963e-18L), expectation_type(1.8913302058560450467193559e-18L), expectation_type(1.9022098267165244930309201e-18L), expectation_type(1.9130482323039102965907415e-18L), expectation_type(1.9238472256077096170882499e-18L), 
+            expectation_type(1.9346085378917003191719927e-18L), expectation_type(1.9453338328950161041325490e-18L), expectation_type(1.9560247107306626688431114e-18L), expectation_type(1.9666827115075598301101591e-18L), expectation_type(1.9773093186996003705532796e-18L), expectation_type(1.9879059622829064489700536e-18L), expectation_type(1.9984740216604117528138540e-18L), expectation_type(2.0090148283910702500307701e-18L), 
+            expectation_type(2.0195296687393628678590864e-18L), expectation_type(2.0300197860593178370253727e-18L), expectation_type(2.0404863830259581030962405e-18L), expectation_type(2.0509306237259221406519124e-18L), expectation_type(2.0613536356179570493763267e-18L), expectation_type(2.0717565113730412978520651e-18L), expectation_type(2.0821403106030469627389432e-18L), expectation_type(2.0925060614860873230090932e-18L), 
+            expectation_type(2.1028547622960060284368326e-18L), expectation_type(2.1131873828428406973500781e-18L), expectation_type(2.1235048658305296042963629e-18L), expectation_type(2.1338081281376188264626055e-18L), expectation_type(2.1440980620262632922845574e-18L), expectation_type(2.1543755362843937187618678e-18L), expectation_type(2.1646413973055380956372809e-18L), expectation_type(2.1748964701104373235848473e-18L), 
+            expectation_type(2.1851415593142764173638374e-18L), expectation_type(2.1953774500430622976760581e-18L), expectation_type(2.2056049088024139028111297e-18L), expectation_type(2.2158246843017877307843475e-18L), expectation_type(2.2260375082369398100906763e-18L), expectation_type(2.2362440960332215558216644e-18L), expectation_type(2.2464451475521202628266462e-18L), expectation_type(2.2566413477632835627291270e-18L), 
+            expectation_type(2.2668333673841096294878001e-18L), expectation_type(2.2770218634888400023843944e-18L), expectation_type(2.2872074800889584748711808e-18L), expectation_type(2.2973908486865765534607022e-18L), expectation_type(2.3075725888023726033615044e-18L), expectation_type(2.3177533084795471365030678e-18L), expectation_type(2.3279336047651600122479855e-18L), expectation_type(2.3381140641701259320628295e-18L), 
+            expectation_type(2.3482952631090619012223312e-18L), expectation_type(2.3584777683211037451069739e-18L), expectation_type(2.3686621372727377981796930e-18L), expectation_type(2.3788489185436280699635765e-18L), expectation_type(2.3890386521963581156467615e-18L), expectation_type(2.3992318701309501182325934e-18L), expectation_type(2.4094290964249709772310322e-18L), expectation_type(2.4196308476599861791371861e-18L), 
+            expectation_type(2.4298376332350766083929722e-18L), expectation_type(2.4400499556680909802110527e-18L), expectation_type(2.4502683108852669972287163e-18L), expectation_type(2.4604931884998174296426432e-18L), expectation_type(2.4707250720800428910530304e-18L), expectation_type(2.4809644394075009444123629e-18L), expectation_type(2.4912117627257311542771853e-18L), expectation_type(2.5014675089800076470090288e-18L), 
+            expectation_type(2.5117321400485645063790998e-18L), expectation_type(2.5220061129657147864920064e-18L), expectation_type(2.5322898801372609459013507e-18L), expectation_type(2.5425838895485729847176886e-18L), expectation_type(2.5528885849656903976722789e-18L), expectation_type(2.5632044061297851457973749e-18L), expectation_type(2.5735317889453051102618688e-18L), expectation_type(2.5838711656621008433300488e-18L), 
+            expectation_type(2.5942229650518227989193197e-18L), expectation_type(2.6045876125788615399920407e-18L), expectation_type(2.6149655305660896183755517e-18L), expectation_type(2.6253571383556508456620919e-18L), expectation_type(2.6357628524650304670590221e-18L), expectation_type(2.6461830867386282629118120e-18L), expectation_type(2.6566182524950457882677588e-18L), expectation_type(2.6670687586702887758411660e-18L), 
+            expectation_type(2.6775350119570761317596714e-18L), expectation_type(2.6880174169404379090751533e-18L), expectation_type(2.6985163762297761164247958e-18L), expectation_type(2.7090322905875541760916629e-18L), expectation_type(2.7195655590547732569640557e-18L), expectation_type(2.7301165790733865455423469e-18L), expectation_type(2.7406857466057957561348933e-18L), expectation_type(2.7512734562515677954504573e-18L), 
+            expectation_type(2.7618801013615034643149508e-18L), expectation_type(2.7725060741491843791265691e-18L), expectation_type(2.7831517658001189082439927e-18L), expectation_type(2.7938175665786028254193281e-18L), expectation_type(2.8045038659324055665011682e-18L), expectation_type(2.8152110525953884209343557e-18L), expectation_type(2.8259395146881566811121645e-18L), expectation_type(2.8366896398168436964091175e-18L), 
+            expectation_type(2.8474618151701209216602578e-18L), expectation_type(2.8582564276145243997198806e-18L), expectation_type(2.8690738637881846630781609e-18L), expectation_type(2.8799145101930437696164203e-18L), expectation_type(2.8907787532856400923995291e-18L), expectation_type(2.9016669795665385535293145e-18L), expectation_type(2.9125795756684812186988219e-18L), expectation_type(2.9235169284433305439278976e-18L), 
+            expectation_type(2.9344794250478750812743098e-18L), expectation_type(2.9454674530285650988302619e-18L), expectation_type(2.9564814004052433452092719e-18L), expectation_type(2.9675216557539340836000753e-18L), expectation_type(2.9785886082887515293019235e-18L), expectation_type(2.9896826479429869418160221e-18L), expectation_type(3.0008041654494318427512686e-18L), expectation_type(3.0119535524199931490313269e-18L), 
+            expectation_type(3.0231312014246544224886344e-18L), expectation_type(3.0343375060698359375064571e-18L), expectation_type(3.0455728610762048537954162e-18L), expectation_type(3.0568376623559854477881774e-18L), expectation_type(3.0681323070898180998615697e-18L), expectation_type(3.0794571938032145522257893e-18L), expectation_type(3.0908127224426558406390364e-18L), expectation_type(3.1021992944513782590912691e-18L), 
+            expectation_type(3.1136173128448917374144837e-18L), expectation_type(3.1250671822862740947536736e-18L), expectation_type(3.1365493091612837744699502e-18L), expectation_type(3.1480641016533328659965777e-18L), expectation_type(3.1596119698183614742264134e-18L), expectation_type(3.1711933256596538051091682e-18L), expectation_type(3.1828085832026356953424432e-18L), expectation_type(3.1944581585696927225378608e-18L), 
+            expectation_type(3.2061424700550474883352709e-18L), expectation_type(3.2178619381997341690366835e-18L), expectation_type(3.2296169858667079749545632e-18L), expectation_type(3.2414080383161267494330543e-18L), expectation_type(3.2532355232808415701166621e-18L), expectation_type(3.2650998710421328873098521e-18L), expectation_type(3.2770015145057284460795221e-18L), expectation_type(3.2889408892781389890685958e-18L), 
+            expectation_type(3.3009184337433475248593365e-18L), expectation_type(3.3129345891398877712701899e-18L), expectation_type(3.3249897996383472433822564e-18L), expectation_type(3.3370845124193303516315338e-18L), expectation_type(3.3492191777519168052972357e-18L), expectation_type(3.3613942490726505805543668e-18L), expectation_type(3.3736101830650947093907561e-18L), expectation_type(3.3858674397399871756240478e-18L), 
+            expectation_type(3.3981664825160332665585984e-18L), expectation_type(3.4105077783013698231165952e-18L), expectation_type(3.4228917975757369572359974e-18L), expectation_type(3.4353190144733929626758609e-18L), expectation_type(3.4477899068668083338833159e-18L), expectation_type(3.4603049564511750270811258e-18L), expectation_type(3.4728646488297673481035645e-18L), expectation_type(3.4854694736001911326614934e-18L), 
+            expectation_type(3.4981199244415581966213455e-18L), expectation_type(3.5108164992026233765489153e-18L), expectation_type(3.5235596999909218542538494e-18L), expectation_type(3.5363500332629448634751234e-18L), expectation_type(3.5491880099153923123159119e-18L), expectation_type(3.5620741453775413217558464e-18L), expectation_type(3.5750089597047701787705714e-18L), expectation_type(3.5879929776732777325466352e-18L), 
+            expectation_type(3.6010267288760388243108951e-18L), expectation_type(3.6141107478200369357575588e-18L), expectation_type(3.6272455740248158683556164e-18L), expectation_type(3.6404317521223929264009234e-18L), expectation_type(3.6536698319585767710303935e-18L), expectation_type(3.6669603686957338410744545e-18L), expectation_type(3.6803039229170480001664089e-18L), expectation_type(3.6937010607323188685769625e-18L), 
+            expectation_type(3.7071523538853451334679729e-18L), expectation_type(3.7206583798629400033769244e-18L), expectation_type(3.7342197220056268825154916e-18L), expectation_type(3.7478369696200642887027909e-18L), expectation_type(3.7615107180932500263166833e-18L), expectation_type(3.7752415690085556534452799e-18L), expectation_type(3.7890301302636433514176200e-18L), expectation_type(3.8028770161903184161021608e-18L), 
+            expectation_type(3.8167828476763717448532982e-18L), expectation_type(3.8307482522894678918843946e-18L), expectation_type(3.8447738644031355093328242e-18L), expectation_type(3.8588603253249182825995065e-18L), expectation_type(3.8730082834267458079942936e-18L), expectation_type(3.8872183942775852496642376e-18L), expectation_type(3.9014913207784360526538732e-18L), expectation_type(3.9158277332997314812419739e-18L), 
+            expectation_type(3.9302283098212122979838694e-18L), expectation_type(3.9446937360743395008002880e-18L), expectation_type(3.9592247056873146947051166e-18L), expectation_type(3.9738219203327783931448821e-18L), expectation_type(3.9884860898782583233015882e-18L), expectation_type(4.0032179325394416520402363e-18L), expectation_type(4.0180181750363469565015993e-18L), expectation_type(4.0328875527524737377778703e-18L), 
+            expectation_type(4.0478268098970093198850720e-18L), expectation_type(4.0628366996701750916798553e-18L), expectation_type(4.0779179844317962388785929e-18L), expectation_type(4.0930714358731813794474645e-18L), expectation_type(4.1082978351924008609767834e-18L), expectation_type(4.1235979732730549059782104e-18L), expectation_type(4.1389726508666253032154717e-18L), expectation_type(4.1544226787785069431871646e-18L), 
+            expectation_type(4.1699488780578181868426345e-18L), expectation_type(4.1855520801910918417817733e-18L), expectation_type(4.2012331272999514029604245e-18L), expectation_type(4.2169928723428801988350397e-18L), expectation_type(4.2328321793211941726266062e-18L), expectation_type(4.2487519234893322258179240e-18L), expectation_type(4.2647529915695813611404659e-18L), expectation_type(4.2808362819713572893524213e-18L), 
+            expectation_type(4.2970027050151647124358746e-18L), expectation_type(4.3132531831613651700171383e-18L), expectation_type(4.3295886512438841406086197e-18L), expectation_type(4.3460100567089930296607857e-18L), expectation_type(4.3625183598593057575951521e-18L), expectation_type(4.3791145341031338883890609e-18L), expectation_type(4.3957995662093486185653987e-18L), expectation_type(4.4125744565679024835215453e-18L), 
+            expectation_type(4.4294402194561683391909230e-18L), expectation_type(4.4463978833112580485224005e-18L), expectation_type(4.4634484910084883509311580e-18L), expectation_type(4.4805931001461666257659373e-18L), expectation_type(4.4978327833368746853158382e-18L), expectation_type(4.5151686285054343566419291e-18L), expectation_type(4.5326017391937444426111235e-18L), expectation_type(4.5501332348726846993447392e-18L), 
+            expectation_type(4.5677642512612887386692116e-18L), expectation_type(4.5854959406533942692726148e-18L), expectation_type(4.6033294722519858387528987e-18L), expectation_type(4.6212660325114522406621866e-18L), expectation_type(4.6393068254879880165438355e-18L), expectation_type(4.6574530731983760238542971e-18L), expectation_type(4.6757060159873958681055148e-18L), expectation_type(4.6940669129041111236437812e-18L), 
+            expectation_type(4.7125370420872967048564173e-18L), expectation_type(4.7311177011602765115271763e-18L), expectation_type(4.7498102076354505724350098e-18L), expectation_type(4.7686158993288003646629763e-18L), expectation_type(4.7875361347846708077077526e-18L), expectation_type(4.8065722937111376373442493e-18L), expectation_type(4.8257257774262794710676317e-18L), expectation_type(4.8449980093156849023857395e-18L), 
+            expectation_type(4.8643904353015364237068880e-18L), expectation_type(4.8839045243236248964050658e-18L), expectation_type(4.9035417688326606821444971e-18L), expectation_type(4.9233036852962604430121046e-18L), expectation_type(4.9431918147180020318037584e-18L), expectation_type(4.9632077231699538514210277e-18L), expectation_type(4.9833530023390995884220612e-18L), expectation_type(5.0036292700880943462408796e-18L), 
+            expectation_type(5.0240381710308039456655696e-18L), expectation_type(5.0445813771230955524567744e-18L), expectation_type(5.0652605882693648645677407e-18L), expectation_type(5.0860775329453028759178065e-18L), expectation_type(5.1070339688374237633295021e-18L), expectation_type(5.1281316834998947530503616e-18L), expectation_type(5.1493724950292289500558522e-18L), expectation_type(5.1707582527574230958129880e-18L), 
+            expectation_type(5.1922908379641440991618207e-18L), expectation_type(5.2139721646085910033924134e-18L), expectation_type(5.2358041800816828556941370e-18L), expectation_type(5.2577888659792477805899784e-18L), expectation_type(5.2799282388969144769632323e-18L), expectation_type(5.3022243512474344117759008e-18L), expectation_type(5.3246792921011912283836618e-18L), expectation_type(5.3472951880506833823377313e-18L), 
+            expectation_type(5.3700742040997968248291159e-18L), expectation_type(5.3930185445787167390042922e-18L), expectation_type(5.4161304540853609664292248e-18L), expectation_type(5.4394122184542529130262476e-18L), expectation_type(5.4628661657537884729776560e-18L), expectation_type(5.4864946673128899368523221e-18L), expectation_type(5.5103001387780800426582096e-18L), expectation_type(5.5342850412020513766531537e-18L), 
+            expectation_type(5.5584518821648503307733872e-18L), expectation_type(5.5828032169288408772237788e-18L), expectation_type(5.6073416496286616357722350e-18L), expectation_type(5.6320698344974401995329528e-18L), expectation_type(5.6569904771305815711145923e-18L), expectation_type(5.6821063357885029706616971e-18L), expectation_type(5.7074202227397453458099827e-18L), expectation_type(5.7329350056459527842488509e-18L), 
+            expectation_type(5.7586536089902748543683035e-18L), expectation_type(5.7845790155508138394501894e-18L), expectation_type(5.8107142679208090568983714e-18L), expectation_type(5.8370624700773241473589540e-18L), expectation_type(5.8636267890002805716468471e-18L), expectation_type(5.8904104563437617704228909e-18L), expectation_type(5.9174167701615977394847653e-18L), expectation_type(5.9446490966893293828134598e-18L), 
+            expectation_type(5.9721108721847461710950186e-18L), expectation_type(5.9998056048292896157268067e-18L), expectation_type(6.0277368766927191442800093e-18L), expectation_type(6.0559083457635464276946410e-18L), expectation_type(6.0843237480478593757544340e-18L), expectation_type(6.1129868997392782195497542e-18L), expectation_type(6.1419016994629136933567474e-18L), expectation_type(6.1710721305963316926167435e-18L), 
+            expectation_type(6.2005022636706703234580588e-18L), expectation_type(6.2301962588552044032351440e-18L), expectation_type(6.2601583685288096804061676e-18L), expectation_type(6.2903929399419448061515165e-18L), expectation_type(6.3209044179729439330450648e-18L), expectation_type(6.3516973479825972970637666e-18L), expectation_type(6.3827763787711918558137066e-18L), expectation_type(6.4141462656423896468289387e-18L), 
+            expectation_type(6.4458118735785386782753901e-18L), expectation_type(6.4777781805322406012171407e-18L), expectation_type(6.5100502808392419200449646e-18L), expectation_type(6.5426333887579719134007508e-18L), expectation_type(6.5755328421413216593615091e-18L), expectation_type(6.6087541062465455476060488e-18L), expectation_type(6.6423027776894704491369268e-18L), expectation_type(6.6761845885495194073006332e-18L), 
+            expectation_type(6.7104054106323974998662915e-18L), expectation_type(6.7449712598976486759635656e-18L), expectation_type(6.7798883010586752637048892e-18L), expectation_type(6.8151628523632179468414881e-18L), expectation_type(6.8508013905627249053654671e-18L), expectation_type(6.8868105560794962093654810e-18L), expectation_type(6.9231971583809752817941065e-18L), expectation_type(6.9599681815710752795600678e-18L), 
+            expectation_type(6.9971307902089767123063894e-18L), expectation_type(7.0346923353664158196354636e-18L), expectation_type(7.0726603609351036364862313e-18L), expectation_type(7.1110426101965759655021630e-18L), expectation_type(7.1498470326674775309649480e-18L), expectation_type(7.1890817912340325302569265e-18L), expectation_type(7.2287552695902519982311592e-18L), expectation_type(7.2688760799952795057206911e-18L), 
+            expectation_type(7.3094530713661846750861741e-18L), expectation_type(7.3504953377234830909341820e-18L), expectation_type(7.3920122270076960491969885e-18L), expectation_type(7.4340133502863692505837909e-18L), expectation_type(7.4765085913721514611329986e-18L), expectation_type(7.5195081168737982578200828e-18L), expectation_type(7.5630223867033186883844050e-18L), expectation_type(7.6070621650639310011063081e-18L), 
+            expectation_type(7.6516385319450451576205176e-18L), expectation_type(7.6967628951521529213523574e-18L), expectation_type(7.7424470029012899493555905e-18L), expectation_type(7.7887029570096483553237860e-18L), expectation_type(7.8355432267159734023401794e-18L), expectation_type(7.8829806631665860586316259e-18L), expectation_type(7.9310285146052469285841030e-18L), expectation_type(7.9797004423076305735326634e-18L), 
+            expectation_type(8.0290105373039278037272663e-18L), expectation_type(8.0789733379360539559971444e-18L), expectation_type(8.1296038482991318864084024e-18L), expectation_type(8.1809175576203596041756470e-18L), expectation_type(8.2329304606320863291695409e-18L), expectation_type(8.2856590789999316375865924e-18L), expectation_type(8.3391204838711170649375273e-18L), expectation_type(8.3933323196128675556053621e-18L), 
+            expectation_type(8.4483128288158139739783728e-18L), expectation_type(8.5040808786428233474899392e-18L), expectation_type(8.5606559886096401327364704e-18L), expectation_type(8.6180583598901832555380711e-18L), expectation_type(8.6763089062463582639806519e-18L), expectation_type(8.7354292866898650957745402e-18L), expectation_type(8.7954419399917689083536017e-18L), expectation_type(8.8563701211646198157176453e-18L), 
+            expectation_type(8.9182379400517301149743300e-18L), expectation_type(8.9810704021689256751541130e-18L), expectation_type(9.0448934519557717200143715e-18L), expectation_type(9.1097340186060326300008779e-18L), expectation_type(9.1756200646610725165017932e-18L), expectation_type(9.2425806375651630874504684e-18L), expectation_type(9.3106459243983773069303759e-18L), expectation_type(9.3798473100210677183349053e-18L), 
+            expectation_type(9.4502174388840319850967802e-18L), expectation_type(9.5217902807805514064188855e-18L), expectation_type(9.5946012008407712205053203e-18L), expectation_type(9.6686870340956221668201464e-18L), expectation_type(9.7440861649669399949100899e-18L), expectation_type(9.8208386120729378886105277e-18L), expectation_type(9.8989861187740812076986898e-18L), expectation_type(9.9785722499241060032144414e-18L), 
+            expectation_type(1.0059642495334867006254290e-17L), expectation_type(1.0142244380512412679081012e-17L), expectation_type(1.0226427585275749840610874e-17L), expectation_type(1.0312244070929844181670137e-17L), expectation_type(1.0399748216731264240425211e-17L), expectation_type(1.0488996966459380740931578e-17L), expectation_type(1.0580049985989170055357088e-17L), expectation_type(1.0672969832854572862946206e-17L), 
+            expectation_type(1.0767822138895326358629180e-17L), expectation_type(1.0864675807196713905367435e-17L), expectation_type(1.0963603224662478996687644e-17L), expectation_type(1.1064680491708213799553161e-17L), expectation_type(1.1167987670728148200615451e-17L), expectation_type(1.1273609055175087264905463e-17L), expectation_type(1.1381633461304353338861725e-17L), expectation_type(1.1492154544871565608254751e-17L), 
+            expectation_type(1.1605271145345109552066580e-17L), expectation_type(1.1721087660502088249676915e-17L), expectation_type(1.1839714454627117128136970e-17L), expectation_type(1.1961268303933225602111272e-17L), expectation_type(1.2085872883281248989074939e-17L), expectation_type(1.2213659298797734409178401e-17L), expectation_type(1.2344766671592547354257998e-17L), expectation_type(1.2479342778469099522627670e-17L), 
+            expectation_type(1.2617544756317941762680950e-17L), expectation_type(1.2759539877806888379345462e-17L), expectation_type(1.2905506407050005004953222e-17L), expectation_type(1.3055634545180276823578139e-17L), expectation_type(1.3210127477198572374796673e-17L), expectation_type(1.3369202533163279928864244e-17L), expectation_type(1.3533092478767567929963878e-17L), expectation_type(1.3702046952681601365293153e-17L), 
+            expectation_type(1.3876334070784823890447065e-17L), expectation_type(1.4056242220663895824010758e-17L), expectation_type(1.4242082073610047428356751e-17L), expectation_type(1.4434188845945216724595151e-17L), expectation_type(1.4632924847000449332528485e-17L), expectation_type(1.4838682357663471738328034e-17L), expectation_type(1.5051886891356713877376164e-17L), expectation_type(1.5273000898919134800662334e-17L), 
+            expectation_type(1.5502527990545906228819308e-17L), expectation_type(1.5741017762199458653771917e-17L), expectation_type(1.5989071331396368497061219e-17L), expectation_type(1.6247347708837343319336631e-17L), expectation_type(1.6516571159070540196604704e-17L), expectation_type(1.6797539736680645303320549e-17L), expectation_type(1.7091135226240381448764440e-17L), expectation_type(1.7398334766910626397808702e-17L), 
+            expectation_type(1.7720224509412242996920961e-17L), expectation_type(1.8058015738525739987582346e-17L), expectation_type(1.8413064004276754939421460e-17L), expectation_type(1.8786891947701346121551136e-17L), expectation_type(1.9181216693825627687951794e-17L), expectation_type(1.9597982930955708161129189e-17L), expectation_type(2.0039403123712380009722861e-17L), expectation_type(2.0508006749061155995910121e-17L), 
+            expectation_type(2.1006701045518266861264539e-17L), expectation_type(2.1538846592550755937162490e-17L), expectation_type(2.2108352189111712823450057e-17L), expectation_type(2.2719795126830268191878054e-17L), expectation_type(2.3378575284005913074666844e-17L), expectation_type(2.4091114859554388265577068e-17L), expectation_type(2.4865120592381655975667780e-17L), expectation_type(2.5709932901218766326564741e-17L), 
+            expectation_type(2.6636998084019128466993286e-17L), expectation_type(2.7660518192158334329756078e-17L), expectation_type(2.8798363132064139437638014e-17L), expectation_type(3.0073379497367242222525395e-17L), expectation_type(3.1515316786138215318732629e-17L), expectation_type(3.3163745977149570809345245e-17L), expectation_type(3.5072634192931826037205865e-17L), expectation_type(3.7317807696707212036094010e-17L), 
+            expectation_type(4.0009724327848852192244638e-17L), expectation_type(4.3316649648054140547542529e-17L), expectation_type(4.7509903252550416189106796e-17L), expectation_type(5.3060934921036022084799728e-17L), expectation_type(6.0877801762284064103435220e-17L), expectation_type(7.2996002694008955892442192e-17L), expectation_type(9.5269111738441071951733678e-17L), expectation_type(1.5572893803102340027323309e-16L)
+        }; // downscaled_layer_heights[...]
+    }; // struct ziggurat_layers_exponential_512<...>
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M48_HPP_INCLUDED
@@ -0,0 +1,431 @@
+
+#ifndef ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M64_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M64_HPP_INCLUDED
+
+#include "../arithmetic.hpp"
+#include "../probability/standard_exponential_distribution.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace ropufu::aftermath::random
+{
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type, std::size_t t_engine_diameter>
+    struct ziggurat_layers_exponential_512;
+
+    /** @brief Ziggurat with 512 layers for exponential distribution and full 64-bit engines. */
+    template <typename t_uniform_type,typename t_value_type, typename t_expectation_type>
+    struct ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(64ULL)>
+    {
+        using type = ziggurat_layers_exponential_512<t_uniform_type, t_value_type, t_expectation_type, aftermath::mersenne_number(64ULL)>;
+        using uniform_type = t_uniform_type;
+        using value_type = t_value_type;
+        using expectation_type = t_expectation_type;
+
+        static constexpr std::size_t n_boxes = 512;
+        static constexpr std::size_t engine_diameter = aftermath::mersenne_number(64ULL); // 18446744073709551615.
+
+        static inline const uniform_type upscaled_low_probabilities[n_boxes] = {
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), 
+            uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL), uniform_type(0ULL)
+        }; // upscaled_low_probabilities[...]
+
+        static inline const uniform_type upscaled_high_probabilities[n_boxes] = {
+            uniform_type(16501242072467184599ULL), uniform_type(16814661328689970914ULL), uniform_type(17356747269146144389ULL), uniform_type(17612156715611727470ULL), uniform_type(17762745323465376632ULL), uniform_type(17862802358962503578ULL), uniform_type(17934460664044194711ULL), uniform_type(17988498445818610761ULL), 
+            uniform_type(18030815848176099511ULL), uniform_type(18064923875299943728ULL), uniform_type(18093047231683428605ULL), uniform_type(18116666454128289062ULL), uniform_type(18136806467679391800ULL), uniform_type(18154200168737451752ULL), uniform_type(18169386045108698718ULL), uniform_type(18182768970545462774ULL), 
+            uniform_type(18194659455057601993ULL), uniform_type(18205299780440680072ULL), uniform_type(18214881875084098863ULL), uniform_type(18223559828788630168ULL), uniform_type(18231458837950406060ULL), uniform_type(18238681717999715694ULL), uniform_type(18245313723462496739ULL), uniform_type(18251426168774538997ULL), 
+            uniform_type(18257079185023228755ULL), uniform_type(18262323844641157330ULL), uniform_type(18267203817364671620ULL), uniform_type(18271756674166032344ULL), uniform_type(18276014923731665406ULL), uniform_type(18280006843561240380ULL), uniform_type(18283757151790947019ULL), uniform_type(18287287554359023503ULL), 
+            uniform_type(18290617193772997351ULL), uniform_type(18293763019587080806ULL), uniform_type(18296740096124576257ULL), uniform_type(18299561859546408648ULL), uniform_type(18302240333765477466ULL), uniform_type(18304786312718840295ULL), uniform_type(18307209514978817705ULL), uniform_type(18309518715496073106ULL), 
+            uniform_type(18311721858339199248ULL), uniform_type(18313826153564756172ULL), uniform_type(18315838160773192104ULL), uniform_type(18317763861445213903ULL), uniform_type(18319608721783923932ULL), uniform_type(18321377747490578761ULL), uniform_type(18323075531660950111ULL), uniform_type(18324706296793249929ULL), 
+            uniform_type(18326273931738312483ULL), uniform_type(18327782024291096029ULL), uniform_type(18329233890013990982ULL), uniform_type(18330632597792493067ULL), uniform_type(18331980992549021528ULL), uniform_type(18333281715478246054ULL), uniform_type(18334537222114998494ULL), uniform_type(18335749798501889874ULL), 
+            uniform_type(18336921575686677878ULL), uniform_type(18338054542748056750ULL), uniform_type(18339150558521911053ULL), uniform_type(18340211362177402059ULL), uniform_type(18341238582772896780ULL), uniform_type(18342233747905174405ULL), uniform_type(18343198291551114643ULL), uniform_type(18344133561188823781ULL), 
+            uniform_type(18345040824274584673ULL), uniform_type(18345921274142874050ULL), uniform_type(18346776035388763353ULL), uniform_type(18347606168785130365ULL), uniform_type(18348412675781109182ULL), uniform_type(18349196502622969522ULL), uniform_type(18349958544134036483ULL), uniform_type(18350699647186248248ULL), 
+            uniform_type(18351420613892425049ULL), uniform_type(18352122204545222331ULL), uniform_type(18352805140326008608ULL), uniform_type(18353470105804495951ULL), uniform_type(18354117751247817262ULL), uniform_type(18354748694755854076ULL), uniform_type(18355363524237941081ULL), uniform_type(18355962799244582497ULL), 
+            uniform_type(18356547052666488121ULL), uniform_type(18357116792312053450ULL), uniform_type(18357672502373351706ULL), uniform_type(18358214644789760769ULL), uniform_type(18358743660517502097ULL), uniform_type(18359259970712610180ULL), uniform_type(18359763977834170028ULL), uniform_type(18360256066674047985ULL), 
+            uniform_type(18360736605318790016ULL), uniform_type(18361205946048864943ULL), uniform_type(18361664426179981879ULL), uniform_type(18362112368850806234ULL), uniform_type(18362550083761032386ULL), uniform_type(18362977867863439529ULL), uniform_type(18363396006013256555ULL), uniform_type(18363804771577889048ULL), 
+            uniform_type(18364204427009813635ULL), uniform_type(18364595224385219558ULL), uniform_type(18364977405910772188ULL), uniform_type(18365351204400686269ULL), uniform_type(18365716843726126147ULL), uniform_type(18366074539238794615ULL), uniform_type(18366424498170429711ULL), uniform_type(18366766920009798739ULL), 
+            uniform_type(18367101996858659656ULL), uniform_type(18367429913768050824ULL), uniform_type(18367750849056170058ULL), uniform_type(18368064974609012042ULL), uniform_type(18368372456164848790ULL), uniform_type(18368673453583560264ULL), uniform_type(18368968121101750892ULL), uniform_type(18369256607574521998ULL), 
+            uniform_type(18369539056704709598ULL), uniform_type(18369815607260341186ULL), uniform_type(18370086393281013562ULL), uniform_type(18370351544273846184ULL), uniform_type(18370611185399620530ULL), uniform_type(18370865437649675252ULL), uniform_type(18371114418014089276ULL), uniform_type(18371358239641650126ULL), 
+            uniform_type(18371597011992072425ULL), uniform_type(18371830840980901571ULL), uniform_type(18372059829117509782ULL), uniform_type(18372284075636565870ULL), uniform_type(18372503676623336142ULL), uniform_type(18372718725133151506ULL), uniform_type(18372929311305355122ULL), uniform_type(18373135522472025647ULL), 
+            uniform_type(18373337443261753117ULL), uniform_type(18373535155698727776ULL), uniform_type(18373728739297386539ULL), uniform_type(18373918271152847178ULL), uniform_type(18374103826027346773ULL), uniform_type(18374285476432888203ULL), uniform_type(18374463292710286632ULL), uniform_type(18374637343104796829ULL), 
+            uniform_type(18374807693838491792ULL), uniform_type(18374974409179553422ULL), uniform_type(18375137551508626909ULL), uniform_type(18375297181382381982ULL), uniform_type(18375453357594416172ULL), uniform_type(18375606137233627771ULL), uniform_type(18375755575740179136ULL), uniform_type(18375901726959164408ULL), 
+            uniform_type(18376044643192089518ULL), uniform_type(18376184375246266546ULL), uniform_type(18376320972482219037ULL), uniform_type(18376454482859189739ULL), uniform_type(18376584952978837394ULL), uniform_type(18376712428127204684ULL), uniform_type(18376836952315035132ULL), uniform_type(18376958568316512736ULL), 
+            uniform_type(18377077317706494331ULL), uniform_type(18377193240896301073ULL), uniform_type(18377306377168132069ULL), uniform_type(18377416764708160013ULL), uniform_type(18377524440638365644ULL), uniform_type(18377629441047165050ULL), uniform_type(18377731801018881133ULL), uniform_type(18377831554662108018ULL), 
+            uniform_type(18377928735137014825ULL), uniform_type(18378023374681632922ULL), uniform_type(18378115504637168674ULL), uniform_type(18378205155472381650ULL), uniform_type(18378292356807066351ULL), uniform_type(18378377137434673701ULL), uniform_type(18378459525344106826ULL), uniform_type(18378539547740724018ULL), 
+            uniform_type(18378617231066580234ULL), uniform_type(18378692601019937017ULL), uniform_type(18378765682574069352ULL), uniform_type(18378836499995396614ULL), uniform_type(18378905076860963572ULL), uniform_type(18378971436075296167ULL), uniform_type(18379035599886655695ULL), uniform_type(18379097589902713938ULL), 
+            uniform_type(18379157427105670768ULL), uniform_type(18379215131866834785ULL), uniform_type(18379270723960686618ULL), uniform_type(18379324222578443666ULL), uniform_type(18379375646341144183ULL), uniform_type(18379425013312267866ULL), uniform_type(18379472341009909295ULL), uniform_type(18379517646418519901ULL), 
+            uniform_type(18379560946000233424ULL), uniform_type(18379602255705789167ULL), uniform_type(18379641590985066750ULL), uniform_type(18379678966797245446ULL), uniform_type(18379714397620600632ULL), uniform_type(18379747897461949331ULL), uniform_type(18379779479865756314ULL), uniform_type(18379809157922911729ULL), 
+            uniform_type(18379836944279190758ULL), uniform_type(18379862851143405332ULL), uniform_type(18379886890295257528ULL), uniform_type(18379909073092903841ULL), uniform_type(18379929410480239126ULL), uniform_type(18379947912993908637ULL), uniform_type(18379964590770056214ULL), uniform_type(18379979453550816339ULL), 
+            uniform_type(18379992510690557414ULL), uniform_type(18380003771161883342ULL), uniform_type(18380013243561400136ULL), uniform_type(18380020936115254025ULL), uniform_type(18380026856684447212ULL), uniform_type(18380031012769937190ULL), uniform_type(18380033411517525250ULL), uniform_type(18380034059722539561ULL), 
+            uniform_type(18380032963834317961ULL), uniform_type(18380030129960495378ULL), uniform_type(18380025563871100548ULL), uniform_type(18380019271002466510ULL), uniform_type(18380011256460959127ULL), uniform_type(18380001525026527696ULL), uniform_type(18379990081156081499ULL), uniform_type(18379976928986695979ULL), 
+            uniform_type(18379962072338652020ULL), uniform_type(18379945514718311660ULL), uniform_type(18379927259320833367ULL), uniform_type(18379907309032729869ULL), uniform_type(18379885666434271348ULL), uniform_type(18379862333801736668ULL), uniform_type(18379837313109515147ULL), uniform_type(18379810606032061237ULL), 
+            uniform_type(18379782213945704333ULL), uniform_type(18379752137930315798ULL), uniform_type(18379720378770835151ULL), uniform_type(18379686936958657222ULL), uniform_type(18379651812692881974ULL), uniform_type(18379615005881428539ULL), uniform_type(18379576516142014906ULL), uniform_type(18379536342803004571ULL), 
+            uniform_type(18379494484904121342ULL), uniform_type(18379450941197033378ULL), uniform_type(18379405710145807417ULL), uniform_type(18379358789927234036ULL), uniform_type(18379310178431024692ULL), uniform_type(18379259873259881148ULL), uniform_type(18379207871729437815ULL), uniform_type(18379154170868077398ULL), 
+            uniform_type(18379098767416620164ULL), uniform_type(18379041657827887008ULL), uniform_type(18378982838266136406ULL), uniform_type(18378922304606375245ULL), uniform_type(18378860052433543389ULL), uniform_type(18378796077041571765ULL), uniform_type(18378730373432313623ULL), uniform_type(18378662936314348545ULL), 
+            uniform_type(18378593760101658643ULL), uniform_type(18378522838912176300ULL), uniform_type(18378450166566202714ULL), uniform_type(18378375736584696354ULL), uniform_type(18378299542187430381ULL), uniform_type(18378221576291017954ULL), uniform_type(18378141831506804213ULL), uniform_type(18378060300138623673ULL), 
+            uniform_type(18377976974180421590ULL), uniform_type(18377891845313737796ULL), uniform_type(18377804904905051352ULL), uniform_type(18377716144002984273ULL), uniform_type(18377625553335362447ULL), uniform_type(18377533123306131746ULL), uniform_type(18377438843992127232ULL), uniform_type(18377342705139693184ULL), 
+            uniform_type(18377244696161151602ULL), uniform_type(18377144806131116669ULL), uniform_type(18377043023782652531ULL), uniform_type(18376939337503271635ULL), uniform_type(18376833735330770690ULL), uniform_type(18376726204948901206ULL), uniform_type(18376616733682871391ULL), uniform_type(18376505308494676059ULL), 
+            uniform_type(18376391915978251011ULL), uniform_type(18376276542354448229ULL), uniform_type(18376159173465828036ULL), uniform_type(18376039794771264195ULL), uniform_type(18375918391340357774ULL), uniform_type(18375794947847655386ULL), uniform_type(18375669448566667270ULL), uniform_type(18375541877363680434ULL), 
+            uniform_type(18375412217691361924ULL), uniform_type(18375280452582147063ULL), uniform_type(18375146564641407277ULL), uniform_type(18375010536040391930ULL), uniform_type(18374872348508938334ULL), uniform_type(18374731983327943894ULL), uniform_type(18374589421321594071ULL), uniform_type(18374444642849339618ULL), 
+            uniform_type(18374297627797616270ULL), uniform_type(18374148355571299794ULL), uniform_type(18373996805084889024ULL), uniform_type(18373842954753409225ULL), uniform_type(18373686782483027795ULL), uniform_type(18373528265661374030ULL), uniform_type(18373367381147554329ULL), uniform_type(18373204105261853876ULL), 
+            uniform_type(18373038413775115483ULL), uniform_type(18372870281897785913ULL), uniform_type(18372699684268619599ULL), uniform_type(18372526594943029300ULL), uniform_type(18372350987381072801ULL), uniform_type(18372172834435064327ULL), uniform_type(18371992108336798902ULL), uniform_type(18371808780684377408ULL), 
+            uniform_type(18371622822428619595ULL), uniform_type(18371434203859051812ULL), uniform_type(18371242894589455647ULL), uniform_type(18371048863542963165ULL), uniform_type(18370852078936683800ULL), uniform_type(18370652508265847384ULL), uniform_type(18370450118287447151ULL), uniform_type(18370244875003365893ULL), 
+            uniform_type(18370036743642967750ULL), uniform_type(18369825688645137413ULL), uniform_type(18369611673639747747ULL), uniform_type(18369394661428536051ULL), uniform_type(18369174613965368377ULL), uniform_type(18368951492335870428ULL), uniform_type(18368725256736402687ULL), uniform_type(18368495866452356471ULL), 
+            uniform_type(18368263279835746616ULL), uniform_type(18368027454282075483ULL), uniform_type(18367788346206441858ULL), uniform_type(18367545911018867233ULL), uniform_type(18367300103098810728ULL), uniform_type(18367050875768842685ULL), uniform_type(18366798181267445671ULL), uniform_type(18366541970720910236ULL), 
+            uniform_type(18366282194114291363ULL), uniform_type(18366018800261390018ULL), uniform_type(18365751736773722645ULL), uniform_type(18365480950028439799ULL), uniform_type(18365206385135153332ULL), uniform_type(18364927985901629775ULL), uniform_type(18364645694798305584ULL), uniform_type(18364359452921577944ULL), 
+            uniform_type(18364069199955822660ULL), uniform_type(18363774874134088477ULL), uniform_type(18363476412197414780ULL), uniform_type(18363173749352717200ULL), uniform_type(18362866819229183013ULL), uniform_type(18362555553833115505ULL), uniform_type(18362239883501163597ULL), uniform_type(18361919736851869973ULL), 
+            uniform_type(18361595040735467771ULL), uniform_type(18361265720181852522ULL), uniform_type(18360931698346652462ULL), uniform_type(18360592896455316591ULL), uniform_type(18360249233745135929ULL), uniform_type(18359900627405109184ULL), uniform_type(18359546992513559713ULL), uniform_type(18359188241973405935ULL), 
+            uniform_type(18358824286444982491ULL), uniform_type(18358455034276304217ULL), uniform_type(18358080391430659513ULL), uniform_type(18357700261411413887ULL), uniform_type(18357314545183898299ULL), uniform_type(18356923141094250425ULL), uniform_type(18356525944785070076ULL), uniform_type(18356122849107742730ULL), 
+            uniform_type(18355713744031277368ULL), uniform_type(18355298516547496665ULL), uniform_type(18354877050572408867ULL), uniform_type(18354449226843581491ULL), uniform_type(18354014922813327205ULL), uniform_type(18353574012537501885ULL), uniform_type(18353126366559703814ULL), uniform_type(18352671851790651283ULL), 
+            uniform_type(18352210331382503442ULL), uniform_type(18351741664597875986ULL), uniform_type(18351265706673289219ULL), uniform_type(18350782308676771065ULL), uniform_type(18350291317359321648ULL), uniform_type(18349792574999929097ULL), uniform_type(18349285919243808134ULL), uniform_type(18348771182933513742ULL), 
+            uniform_type(18348248193932561608ULL), uniform_type(18347716774941165128ULL), uniform_type(18347176743303675316ULL), uniform_type(18346627910807284936ULL), uniform_type(18346070083471531452ULL), uniform_type(18345503061328104797ULL), uniform_type(18344926638190435389ULL), uniform_type(18344340601412505115ULL), 
+            uniform_type(18343744731636288944ULL), uniform_type(18343138802527197330ULL), uniform_type(18342522580496849308ULL), uniform_type(18341895824412463070ULL), uniform_type(18341258285292104486ULL), uniform_type(18340609705984984356ULL), uniform_type(18339949820835941784ULL), uniform_type(18339278355333193653ULL), 
+            uniform_type(18338595025738368493ULL), uniform_type(18337899538697776588ULL), uniform_type(18337191590833796669ULL), uniform_type(18336470868315182456ULL), uniform_type(18335737046405009277ULL), uniform_type(18334989788984891322ULL), uniform_type(18334228748054003391ULL), uniform_type(18333453563201336447ULL), 
+            uniform_type(18332663861049503359ULL), uniform_type(18331859254668289011ULL), uniform_type(18331039342956006699ULL), uniform_type(18330203709986579505ULL), uniform_type(18329351924320110018ULL), uniform_type(18328483538274533370ULL), uniform_type(18327598087155765693ULL), uniform_type(18326695088443561454ULL), 
+            uniform_type(18325774040930077174ULL), uniform_type(18324834423807904066ULL), uniform_type(18323875695704076235ULL), uniform_type(18322897293656282247ULL), uniform_type(18321898632027203686ULL), uniform_type(18320879101352572346ULL), uniform_type(18319838067118174864ULL), uniform_type(18318774868460636949ULL), 
+            uniform_type(18317688816786385102ULL), uniform_type(18316579194302708061ULL), uniform_type(18315445252454318533ULL), uniform_type(18314286210258243246ULL), uniform_type(18313101252529240269ULL), uniform_type(18311889527987250750ULL), uniform_type(18310650147237630557ULL), uniform_type(18309382180614067980ULL), 
+            uniform_type(18308084655873167643ULL), uniform_type(18306756555728658122ULL), uniform_type(18305396815212050042ULL), uniform_type(18304004318845319868ULL), uniform_type(18302577897609807630ULL), uniform_type(18301116325693977997ULL), uniform_type(18299618317000984716ULL), uniform_type(18298082521395077177ULL), 
+            uniform_type(18296507520663770600ULL), uniform_type(18294891824170340289ULL), uniform_type(18293233864168564193ULL), uniform_type(18291531990748690347ULL), uniform_type(18289784466380305316ULL), uniform_type(18287989460014079004ULL), uniform_type(18286145040700205363ULL), uniform_type(18284249170676684647ULL), 
+            uniform_type(18282299697875328172ULL), uniform_type(18280294347787426841ULL), uniform_type(18278230714624312509ULL), uniform_type(18276106251700443235ULL), uniform_type(18273918260958027938ULL), uniform_type(18271663881542419018ULL), uniform_type(18269340077326363765ULL), uniform_type(18266943623268506194ULL), 
+            uniform_type(18264471090477023506ULL), uniform_type(18261918829832674883ULL), uniform_type(18259282954006491906ULL), uniform_type(18256559317685444032ULL), uniform_type(18253743495794188308ULL), uniform_type(18250830759471888235ULL), uniform_type(18247816049529380730ULL), uniform_type(18244693947072867534ULL), 
+            uniform_type(18241458640934830927ULL), uniform_type(18238103891499847760ULL), uniform_type(18234622990450982192ULL), uniform_type(18231008715889759168ULL), uniform_type(18227253282197271823ULL), uniform_type(18223348283903214564ULL), uniform_type(18219284632710449232ULL), uniform_type(18215052486681285458ULL), 
+            uniform_type(18210641170423279685ULL), uniform_type(18206039084911202397ULL), uniform_type(18201233605340645246ULL), uniform_type(18196210965118494096ULL), uniform_type(18190956123744835596ULL), uniform_type(18185452615915496593ULL), uniform_type(18179682378656229459ULL), uniform_type(18173625552665498465ULL), 
+            uniform_type(18167260253263382491ULL), uniform_type(18160562305381297892ULL), uniform_type(18153504935831864742ULL), uniform_type(18146058414606180057ULL), uniform_type(18138189635072931952ULL), uniform_type(18129861620589129232ULL), uniform_type(18121032942027988922ULL), uniform_type(18111657026887674789ULL), 
+            uniform_type(18101681335697497021ULL), uniform_type(18091046375021155315ULL), uniform_type(18079684507968111886ULL), uniform_type(18067518512067959073ULL), uniform_type(18054459819662258576ULL), uniform_type(18040406356239582163ULL), uniform_type(18025239865397494611ULL), uniform_type(18008822572478609339ULL), 
+            uniform_type(17990992988158503752ULL), uniform_type(17971560582038960780ULL), uniform_type(17950298955045098341ULL), uniform_type(17926936993396530410ULL), uniform_type(17901147273015227982ULL), uniform_type(17872530664528533025ULL), uniform_type(17840595605282428825ULL), uniform_type(17804729755398473206ULL), 
+            uniform_type(17764160567573645354ULL), uniform_type(17717899371468887349ULL), uniform_type(17664660351373099835ULL), uniform_type(17602740241642847918ULL), uniform_type(17529834644021773691ULL), uniform_type(17442748417490728669ULL), uniform_type(17336921616779084038ULL), uniform_type(17205618372479255825ULL), 
+            uniform_type(17038463296033171910ULL), uniform_type(16818622970891887967ULL), uniform_type(16516916401317465712ULL), uniform_type(16078134532881759322ULL), uniform_type(15384366094488169458ULL), uniform_type(14134052008347507885ULL), uniform_type(11285024765394348750ULL), uniform_type(0ULL)
+        }; // upscaled_high_probabilities[...]
+
+        static inline const value_type layer_left_endpoints[n_boxes] = {
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), 
+            value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L), value_type(0.0000000000000000000000000L)
+        }; // layer_left_endpoints[...]
+
+        static inline const value_type downscaled_layer_widths[n_boxes] = {
+            value_type(5.1400615335343562174802066e-19L), value_type(4.5979604472916040004470928e-19L), value_type(4.1911541361983493114556776e-19L), value_type(3.9435036783378887457547630e-19L), value_type(3.7650874600935150596909938e-19L), value_type(3.6254793478448966588329362e-19L), value_type(3.5107128276014775684360316e-19L), value_type(3.4132170348212871961647247e-19L), 
+            value_type(3.3284274493529826672545873e-19L), value_type(3.2533796838885471569120207e-19L), value_type(3.1860395575529454948134558e-19L), value_type(3.1249506127736422051124601e-19L), value_type(3.0690341726988107958085887e-19L), value_type(3.0174690238297107813157345e-19L), value_type(2.9696154748328672078211699e-19L), value_type(2.9249654980938231806740138e-19L), 
+            value_type(2.8831088936965655435056409e-19L), value_type(2.8437096694705750957685970e-19L), value_type(2.8064891459644392056036013e-19L), value_type(2.7712136121790925729058855e-19L), value_type(2.7376851360926135129618241e-19L), value_type(2.7057346093436681281353343e-19L), value_type(2.6752164043695982863286018e-19L), value_type(2.6460042152068052425718375e-19L), 
+            value_type(2.6179877805613021327446773e-19L), value_type(2.5910702736561141253763100e-19L), value_type(2.5651662023744510766069664e-19L), value_type(2.5401997044547498061214206e-19L), value_type(2.5161031517608106058432470e-19L), value_type(2.4928159987195845765301465e-19L), value_type(2.4702838253867154639481556e-19L), value_type(2.4484575369449020724060072e-19L), 
+            value_type(2.4272926899096339626263668e-19L), value_type(2.4067489217056557799014925e-19L), value_type(2.3867894651435953645911933e-19L), value_type(2.3673807330660619926542366e-19L), value_type(2.3484919613311940596848696e-19L), value_type(2.3300949005661662364220540e-19L), value_type(2.3121635489054864332463034e-19L), value_type(2.2946739193415556933942499e-19L), 
+            value_type(2.2776038364420183271331825e-19L), value_type(2.2609327580932540522378731e-19L), value_type(2.2446416186600739380129753e-19L), value_type(2.2287126905450889533231222e-19L), value_type(2.2131294616156856957100248e-19L), value_type(2.1978765263640663256696790e-19L), value_type(2.1829394889935591997006650e-19L), value_type(2.1683048768958664057845700e-19L), 
+            value_type(2.1539600632097331266954698e-19L), value_type(2.1398931973401578028376406e-19L), value_type(2.1260931424754618474577407e-19L), value_type(2.1125494192727187767741479e-19L), value_type(2.0992521549945705615256926e-19L), value_type(2.0861920374758689315479362e-19L), value_type(2.0733602733797465644802860e-19L), value_type(2.0607485502719960120777176e-19L), 
+            value_type(2.0483490021019387518232306e-19L), value_type(2.0361541777288883900264900e-19L), value_type(2.0241570121771609176839668e-19L), value_type(2.0123508003404475158859775e-19L), value_type(2.0007291728891458534895846e-19L), value_type(1.9892860741626990059776538e-19L), value_type(1.9780157418537493605995474e-19L), value_type(1.9669126883125094358641745e-19L), 
+            value_type(1.9559716833186301572323832e-19L), value_type(1.9451877381843881983119837e-19L), value_type(1.9345560910675382271157087e-19L), value_type(1.9240721933849558369559866e-19L), value_type(1.9137316972294648151315356e-19L), value_type(1.9035304437021965776969907e-19L), value_type(1.8934644520816399393885659e-19L), value_type(1.8835299097583516963889679e-19L), 
+            value_type(1.8737231628712382136490338e-19L), value_type(1.8640407075874934869884503e-19L), value_type(1.8544791819737834564311894e-19L), value_type(1.8450353584111806158728902e-19L), value_type(1.8357061365107474244679153e-19L), value_type(1.8264885364906027383396744e-19L), value_type(1.8173796929788356403511073e-19L), value_type(1.8083768492098020766545401e-19L), 
+            value_type(1.7994773515841922056286817e-19L), value_type(1.7906786445658258857227407e-19L), value_type(1.7819782658904514747129187e-19L), value_type(1.7733738420639165081527447e-19L), value_type(1.7648630841289720136938953e-19L), value_type(1.7564437836816864913548770e-19L), value_type(1.7481138091199997518287622e-19L), value_type(1.7398711021083574887289037e-19L), 
+            value_type(1.7317136742436494011108419e-19L), value_type(1.7236396039088399518380120e-19L), value_type(1.7156470333017430589595130e-19L), value_type(1.7077341656273605033124728e-19L), value_type(1.6998992624430878004852904e-19L), value_type(1.6921406411468989398132565e-19L), value_type(1.6844566725993600710155094e-19L), value_type(1.6768457788709984792235881e-19L), 
+            value_type(1.6693064311071729044651234e-19L), value_type(1.6618371475031596973674307e-19L), value_type(1.6544364913826911848807837e-19L), value_type(1.6471030693736621950140676e-19L), value_type(1.6398355296751617785311775e-19L), value_type(1.6326325604103932092532891e-19L), value_type(1.6254928880604194454923548e-19L), value_type(1.6184152759740161933965520e-19L), 
+            value_type(1.6113985229492330586429852e-19L), value_type(1.6044414618825572942261569e-19L), value_type(1.5975429584818464207334148e-19L), value_type(1.5907019100394473888954656e-19L), value_type(1.5839172442621526753809488e-19L), value_type(1.5771879181548592980621862e-19L), value_type(1.5705129169549966115963676e-19L), value_type(1.5638912531149741764325446e-19L), 
+            value_type(1.5573219653300731480803234e-19L), value_type(1.5508041176093645691713086e-19L), value_type(1.5443367983873866317178186e-19L), value_type(1.5379191196744512938842821e-19L), value_type(1.5315502162435793910675113e-19L), value_type(1.5252292448521833125361469e-19L), value_type(1.5189553834967280970446052e-19L), value_type(1.5127278306987060515942194e-19L), 
+            value_type(1.5065458048203572831159531e-19L), value_type(1.5004085434086593726246081e-19L), value_type(1.4943153025661942919935075e-19L), value_type(1.4882653563475800027184459e-19L), value_type(1.4822579961802283862811237e-19L), value_type(1.4762925303082606071130442e-19L), value_type(1.4703682832584760423805632e-19L), value_type(1.4644845953273318416492841e-19L), 
+            value_type(1.4586408220879472931562180e-19L), value_type(1.4528363339162007386630004e-19L), value_type(1.4470705155350370418581698e-19L), value_type(1.4413427655761508033608823e-19L), value_type(1.4356524961582548386303377e-19L), value_type(1.4299991324811850877517276e-19L), value_type(1.4243821124351322878696677e-19L), value_type(1.4188008862243275763512794e-19L), 
+            value_type(1.4132549160045438597008340e-19L), value_type(1.4077436755338074226604037e-19L), value_type(1.4022666498357449962878256e-19L), value_type(1.3968233348750204760261168e-19L), value_type(1.3914132372443427949909738e-19L), value_type(1.3860358738625522199187679e-19L), value_type(1.3806907716833166459696904e-19L), value_type(1.3753774674139924134987372e-19L), 
+            value_type(1.3700955072442258402450779e-19L), value_type(1.3648444465838921355113537e-19L), value_type(1.3596238498099877127259574e-19L), value_type(1.3544332900221102121831365e-19L), value_type(1.3492723488061778509551232e-19L), value_type(1.3441406160060560918671916e-19L), value_type(1.3390376895027751239199709e-19L), value_type(1.3339631750010363248245833e-19L), 
+            value_type(1.3289166858227197811367899e-19L), value_type(1.3238978427071181183961653e-19L), value_type(1.3189062736176343852918907e-19L), value_type(1.3139416135546935820318997e-19L), value_type(1.3090035043746286610724742e-19L), value_type(1.3040915946143124930779636e-19L), value_type(1.2992055393213174151192929e-19L), value_type(1.2943449998893935923201549e-19L), 
+            value_type(1.2895096438990665571384433e-19L), value_type(1.2846991449631629691584296e-19L), value_type(1.2799131825770818879324053e-19L), value_type(1.2751514419736366957626514e-19L), value_type(1.2704136139823002686212685e-19L), value_type(1.2656993948926930925808637e-19L), value_type(1.2610084863221607798259193e-19L), value_type(1.2563405950872938710070185e-19L), 
+            value_type(1.2516954330792489367609465e-19L), value_type(1.2470727171427358269926204e-19L), value_type(1.2424721689585414773807520e-19L), value_type(1.2378935149294659830083500e-19L), value_type(1.2333364860695517026689001e-19L), value_type(1.2288008178964909771072792e-19L), value_type(1.2242862503271026423297690e-19L), value_type(1.2197925275757719065757521e-19L), 
+            value_type(1.2153193980557523473511487e-19L), value_type(1.2108666142832327832376965e-19L), value_type(1.2064339327840755935987682e-19L), value_type(1.2020211140031367068513052e-19L), value_type(1.1976279222160809632110096e-19L), value_type(1.1932541254436098888177790e-19L), value_type(1.1888994953680221025399453e-19L), value_type(1.1845638072520296217512080e-19L), 
+            value_type(1.1802468398597562457928149e-19L), value_type(1.1759483753798469821260216e-19L), value_type(1.1716681993506201464494055e-19L), value_type(1.1674061005871963200786866e-19L), value_type(1.1631618711105407911321102e-19L), value_type(1.1589353060783584457112658e-19L), value_type(1.1547262037177823162215736e-19L), value_type(1.1505343652597991408875041e-19L), 
+            value_type(1.1463595948753573457913658e-19L), value_type(1.1422016996131048325790301e-19L), value_type(1.1380604893387058452934515e-19L), value_type(1.1339357766756880023759585e-19L), value_type(1.1298273769477723182826797e-19L), value_type(1.1257351081226407067844306e-19L), value_type(1.1216587907570970580669791e-19L), value_type(1.1175982479435795172770996e-19L), 
+            value_type(1.1135533052579830660676330e-19L), value_type(1.1095237907087529237367633e-19L), value_type(1.1055095346872106433511737e-19L), value_type(1.1015103699190760832786658e-19L), value_type(1.0975261314171496881999753e-19L), value_type(1.0935566564351207181729569e-19L), value_type(1.0896017844224682218265593e-19L), value_type(1.0856613569804226623049036e-19L), 
+            value_type(1.0817352178189571741028984e-19L), value_type(1.0778232127147784572807304e-19L), value_type(1.0739251894702883044735972e-19L), value_type(1.0700409978734877072999843e-19L), value_type(1.0661704896587964038121119e-19L), value_type(1.0623135184687616090462438e-19L), value_type(1.0584699398166305179673762e-19L), value_type(1.0546396110497619855437565e-19L), 
+            value_type(1.0508223913138535736488628e-19L), value_type(1.0470181415179609102280396e-19L), value_type(1.0432267243002870338821802e-19L), value_type(1.0394480039947200978548960e-19L), value_type(1.0356818465980984824534963e-19L), value_type(1.0319281197381830152290965e-19L), value_type(1.0281866926423166247813684e-19L), value_type(1.0244574361067523577880096e-19L), 
+            value_type(1.0207402224666312706944135e-19L), value_type(1.0170349255665922683011092e-19L), value_type(1.0133414207319965020824992e-19L), value_type(1.0096595847407494622506337e-19L), value_type(1.0059892957957044000975705e-19L), value_type(1.0023304334976312017312819e-19L), value_type(9.9868287881873530165326364e-20L), value_type(9.9504651407671167537093099e-20L), 
+            value_type(9.9142122290931938502558878e-20L), value_type(9.8780689024946257145081418e-20L), value_type(9.8420340230076419073379498e-20L), value_type(9.8061064651361918378583089e-20L), value_type(9.7702851156171414416625384e-20L), value_type(9.7345688731900091295210272e-20L), value_type(9.6989566483711188028789915e-20L), value_type(9.6634473632320511184894966e-20L), 
+            value_type(9.6280399511822774525105408e-20L), value_type(9.5927333567558641686368750e-20L), value_type(9.5575265354021378393890021e-20L), value_type(9.5224184532802050084329069e-20L), value_type(9.4874080870572229184784867e-20L), value_type(9.4524944237103203674680216e-20L), value_type(9.4176764603320704988325258e-20L), value_type(9.3829532039394198828326497e-20L), 
+            value_type(9.3483236712859807085423337e-20L), value_type(9.3137868886775952828750621e-20L), value_type(9.2793418917910843270643554e-20L), value_type(9.2449877254960927749399698e-20L), value_type(9.2107234436799489138199651e-20L), value_type(9.1765481090754547703848401e-20L), value_type(9.1424607930915276329240114e-20L), value_type(9.1084605756466145201542207e-20L), 
+            value_type(9.0745465450048032576117733e-20L), value_type(9.0407177976145556075280774e-20L), value_type(9.0069734379499896191311388e-20L), value_type(8.9733125783546400254064809e-20L), value_type(8.9397343388876271113463293e-20L), value_type(8.9062378471721660193808491e-20L), value_type(8.8728222382463499417057984e-20L), value_type(8.8394866544161420782070929e-20L), 
+            value_type(8.8062302451105126141709114e-20L), value_type(8.7730521667386582954236059e-20L), value_type(8.7399515825492434513657593e-20L), value_type(8.7069276624916025398798585e-20L), value_type(8.6739795830788454635676596e-20L), value_type(8.6411065272528080354156257e-20L), value_type(8.6083076842507910549387458e-20L), value_type(8.5755822494740324941999454e-20L), 
+            value_type(8.5429294243578582878726595e-20L), value_type(8.5103484162434581736810776e-20L), value_type(8.4778384382512339400353333e-20L), value_type(8.4453987091556683073441646e-20L), value_type(8.4130284532616634991507007e-20L), value_type(8.3807269002822993496632564e-20L), value_type(8.3484932852179615461584610e-20L), value_type(8.3163268482367913187867156e-20L), 
+            value_type(8.2842268345564085671306136e-20L), value_type(8.2521924943268610530298657e-20L), value_type(8.2202230825147528932199819e-20L), value_type(8.1883178587885061537198797e-20L), value_type(8.1564760874047098810845264e-20L), value_type(8.1246970370955114040073193e-20L), value_type(8.0929799809570052026640591e-20L), value_type(8.0613241963385750729434339e-20L), 
+            value_type(8.0297289647331457085720018e-20L), value_type(7.9981935716683001863356408e-20L), value_type(7.9667173065982201683020830e-20L), value_type(7.9352994627964059302950480e-20L), value_type(7.9039393372491335879508735e-20L), value_type(7.8726362305496071205511037e-20L), value_type(7.8413894467927629884730812e-20L), value_type(7.8101982934706853024947586e-20L), 
+            value_type(7.7790620813685896322445352e-20L), value_type(7.7479801244613336366714204e-20L), value_type(7.7169517398104127613486921e-20L), value_type(7.6859762474613992754921439e-20L), value_type(7.6550529703417829155009671e-20L), value_type(7.6241812341591713612956422e-20L), value_type(7.5933603672998086963634437e-20L), value_type(7.5625897007273698918078803e-20L), 
+            value_type(7.5318685678819892083608498e-20L), value_type(7.5011963045794802277289746e-20L), value_type(7.4705722489107050052266483e-20L), value_type(7.4399957411410495787588328e-20L), value_type(7.4094661236099627741587634e-20L), value_type(7.3789827406305149129006597e-20L), value_type(7.3485449383889326544734408e-20L), value_type(7.3181520648440657913310289e-20L), 
+            value_type(7.2878034696267413583729043e-20L), value_type(7.2574985039389599203293865e-20L), value_type(7.2272365204528883581304371e-20L), value_type(7.1970168732096028881488950e-20L), value_type(7.1668389175175354148734270e-20L), value_type(7.1367020098505756367443011e-20L), value_type(7.1066055077457805951505066e-20L), value_type(7.0765487697006425764228616e-20L), 
+            value_type(7.0465311550698654444523976e-20L), value_type(7.0165520239615985956044596e-20L), value_type(6.9866107371330767860699229e-20L), value_type(6.9567066558856130827691399e-20L), value_type(6.9268391419588911303598045e-20L), value_type(6.8970075574245018066337053e-20L), value_type(6.8672112645786681543287511e-20L), value_type(6.8374496258341012267069204e-20L), 
+            value_type(6.8077220036109281645899300e-20L), value_type(6.7780277602266324311876302e-20L), value_type(6.7483662577849446651277144e-20L), value_type(6.7187368580636210685621371e-20L), value_type(6.6891389224010446228738332e-20L), value_type(6.6595718115815827159407168e-20L), value_type(6.6300348857196329685414412e-20L), value_type(6.6005275041422871595120065e-20L), 
+            value_type(6.5710490252705411656691997e-20L), value_type(6.5415988064989767490607529e-20L), value_type(6.5121762040738388362937865e-20L), value_type(6.4827805729694296377849418e-20L), value_type(6.4534112667627385437462454e-20L), value_type(6.4240676375062242032585941e-20L), value_type(6.3947490355986625372704825e-20L), value_type(6.3654548096539716498473182e-20L), 
+            value_type(6.3361843063679216781939226e-20L), value_type(6.3069368703826345542190314e-20L), value_type(6.2777118441487754316542286e-20L), value_type(6.2485085677853341555136070e-20L), value_type(6.2193263789368916070754797e-20L), value_type(6.1901646126282620392045625e-20L), value_type(6.1610226011163986148328362e-20L), value_type(6.1318996737394452663678604e-20L), 
+            value_type(6.1027951567628136957194494e-20L), value_type(6.0737083732221598229457374e-20L), value_type(6.0446386427631292549897819e-20L), value_type(6.0155852814777363726928805e-20L), value_type(5.9865476017372364115824128e-20L), value_type(5.9575249120213444264094284e-20L), value_type(5.9285165167436492667878460e-20L), value_type(5.8995217160730646364037038e-20L), 
+            value_type(5.8705398057511529450058917e-20L), value_type(5.8415700769051509736253695e-20L), value_type(5.8126118158565193409727024e-20L), value_type(5.7836643039248303633403438e-20L), value_type(5.7547268172268011209421563e-20L), value_type(5.7257986264702703584740024e-20L), value_type(5.6968789967429092333556495e-20L), value_type(5.6679671872954468566557553e-20L), 
+            value_type(5.6390624513191820224966256e-20L), value_type(5.6101640357175424633992446e-20L), value_type(5.5812711808714423712736768e-20L), value_type(5.5523831203981777542521252e-20L), value_type(5.5234990809035874237703619e-20L), value_type(5.4946182817271949873326304e-20L), value_type(5.4657399346800341208067330e-20L), value_type(5.4368632437748455677130420e-20L), 
+            value_type(5.4079874049483197166677183e-20L), value_type(5.3791116057750431936124656e-20L), value_type(5.3502350251727916209799659e-20L), value_type(5.3213568330987934860781691e-20L), value_type(5.2924761902365718663098733e-20L), value_type(5.2635922476729515156487926e-20L), value_type(5.2347041465647984566845381e-20L), value_type(5.2058110177950376721058223e-20L), 
+            value_type(5.1769119816174716698447101e-20L), value_type(5.1480061472898985224879362e-20L), value_type(5.1190926126950023628186010e-20L), value_type(5.0901704639484621554029846e-20L), value_type(5.0612387749936957533930476e-20L), value_type(5.0322966071826256764359529e-20L), value_type(5.0033430088418205871781904e-20L), value_type(4.9743770148233319681175980e-20L), 
+            value_type(4.9453976460395088648291358e-20L), value_type(4.9164039089810346118295770e-20L), value_type(4.8873947952173880271241376e-20L), value_type(4.8583692808788874708685522e-20L), value_type(4.8293263261194292179401607e-20L), value_type(4.8002648745589815828398428e-20L), value_type(4.7711838527048429300074707e-20L), value_type(4.7420821693506148559309394e-20L), 
+            value_type(4.7129587149517811730140037e-20L), value_type(4.6838123609767185677617057e-20L), value_type(4.6546419592318956310501258e-20L), value_type(4.6254463411599430221470637e-20L), value_type(4.5962243171091984566208636e-20L), value_type(4.5669746755732455940396077e-20L), value_type(4.5376961823988753007144554e-20L), value_type(4.5083875799608006919055102e-20L), 
+            value_type(4.4790475863013532890121673e-20L), value_type(4.4496748942332759838537432e-20L), value_type(4.4202681704036086541788249e-20L), value_type(4.3908260543165335328645753e-20L), value_type(4.3613471573129090434032629e-20L), value_type(4.3318300615040719495192638e-20L), value_type(4.3022733186573274204700114e-20L), value_type(4.2726754490303739905428849e-20L), 
+            value_type(4.2430349401517242980227193e-20L), value_type(4.2133502455439817229762503e-20L), value_type(4.1836197833866162808916268e-20L), value_type(4.1538419351146489120023793e-20L), value_type(4.1240150439494000253262172e-20L), value_type(4.0941374133571840359331029e-20L), value_type(4.0642073054315347106948641e-20L), value_type(4.0342229391942242398567437e-20L), 
+            value_type(4.0041824888099896736013884e-20L), value_type(3.9740840817095010369347238e-20L), value_type(3.9439257966146931016515910e-20L), value_type(3.9137056614601341600002747e-20L), value_type(3.8834216512036165492893390e-20L), value_type(3.8530716855186210408457423e-20L), value_type(3.8226536263607259804254170e-20L), value_type(3.7921652753993971688245980e-20L), 
+            value_type(3.7616043713059002184558222e-20L), value_type(3.7309685868873171509170639e-20L), value_type(3.7002555260558161772590144e-20L), value_type(3.6694627206214099154574160e-20L), value_type(3.6385876268954337402910418e-20L), value_type(3.6076276220908723853566322e-20L), value_type(3.5765800005044478851063001e-20L), value_type(3.5454419694640425347438300e-20L), 
+            value_type(3.5142106450235521392186086e-20L), value_type(3.4828830473856308550367929e-20L), value_type(3.4514560960309805995155532e-20L), value_type(3.4199266045308339361746606e-20L), value_type(3.3882912750170551971316360e-20L), value_type(3.3565466922818125962113318e-20L), value_type(3.3246893174760224675529545e-20L), value_type(3.2927154813726991683421097e-20L), 
+            value_type(3.2606213771579188806114313e-20L), value_type(3.2284030527082745525985020e-20L), value_type(3.1960564023094072471251660e-20L), value_type(3.1635771577653823721321441e-20L), value_type(3.1309608788432637773865604e-20L), value_type(3.0982029429911388201307275e-20L), value_type(3.0652985342609636060129772e-20L), value_type(3.0322426313598135949429941e-20L), 
+            value_type(2.9990299947443049746276792e-20L), value_type(2.9656551526629377527757157e-20L), value_type(2.9321123860397157820691871e-20L), value_type(2.8983957120794021202355935e-20L), value_type(2.8644988664599106452532614e-20L), value_type(2.8304152839603091732232136e-20L), value_type(2.7961380773533500537431960e-20L), value_type(2.7616600143689157634460622e-20L), 
+            value_type(2.7269734925087484385422765e-20L), value_type(2.6920705114626984071591817e-20L), value_type(2.6569426428417246665436519e-20L), value_type(2.6215809969020997295388743e-20L), value_type(2.5859761858876078537904093e-20L), value_type(2.5501182835606336893436983e-20L), value_type(2.5139967804272714247492963e-20L), value_type(2.4776005340839194130795837e-20L), 
+            value_type(2.4409177140207645251425158e-20L), value_type(2.4039357401080063586465376e-20L), value_type(2.3666412138597624507226296e-20L), value_type(2.3290198414134930921815772e-20L), value_type(2.2910563469733916890148078e-20L), value_type(2.2527343752367782226871326e-20L), value_type(2.2140363810432598120412224e-20L), value_type(2.1749435041446465237949977e-20L), 
+            value_type(2.1354354265730094185432863e-20L), value_type(2.0954902095636077399228442e-20L), value_type(2.0550841063408642132357984e-20L), value_type(2.0141913462623687696444309e-20L), value_type(1.9727838847890672061609493e-20L), value_type(1.9308311124435150543533927e-20L), value_type(1.8882995142430242357086252e-20L), value_type(1.8451522689282584627907030e-20L), 
+            value_type(1.8013487744806743071802214e-20L), value_type(1.7568440826963032472080877e-20L), value_type(1.7115882206210960286069102e-20L), value_type(1.6655253699686639040025523e-20L), value_type(1.6185928665257093181497930e-20L), value_type(1.5707199689523277183029383e-20L), value_type(1.5218263287176667139831973e-20L), value_type(1.4718200677385830493170291e-20L), 
+            value_type(1.4205953337860763374069659e-20L), value_type(1.3680291497559093775717523e-20L), value_type(1.3139772913723238175258692e-20L), value_type(1.2582688017334050085810111e-20L), value_type(1.2006985505178248581251181e-20L), value_type(1.1410169167951942443084694e-20L), value_type(1.0789151158726534833935096e-20L), value_type(1.0140037027835675583971153e-20L), 
+            value_type(9.4577995274732106979032514e-21L), value_type(8.7357622280757547524067215e-21L), value_type(7.9647384216036874154430813e-21L), value_type(7.1314980108321451213222398e-21L), value_type(6.2157952634337206384682486e-21L), value_type(5.1838996366484499038974919e-21L), value_type(3.9719479371358131422928377e-21L), value_type(2.4298884756208823177417384e-21L)
+        }; // downscaled_layer_widths[...]
+
+        static inline const expectation_type layer_bottom_endpoints[n_boxes] = {
+            expectation_type(0.0000000000000000000000000L), expectation_type(0.00020721783744635918968952929L), expectation_type(0.00043886672775980303183094354L), expectation_type(0.00069300017184409350947051025L), expectation_type(0.00096309309483817841638174844L), expectation_type(0.0012459849125208814143141717L), expectation_type(0.0015397701842404248127078010L), expectation_type(0.0018431594067784276767553902L), 
+            expectation_type(0.0021552146978583792443992555L), expectation_type(0.0024752194002373523990148675L), expectation_type(0.0028026058533448324027609604L), expectation_type(0.0031369119459340503444296509L), expectation_type(0.0034777533118636174564826753L), expectation_type(0.0038248046561578975188500416L), expectation_type(0.0041777867172523927845054373L), expectation_type(0.0045364568697845658281215889L), 
+            expectation_type(0.0049006021685972633758703617L), expectation_type(0.0052700340820601560936192836L), expectation_type(0.0056445844261951472869044867L), expectation_type(0.0060241021723627292634277320L), expectation_type(0.0064084509034165849409015468L), expectation_type(0.0067975067598692365989525599L), expectation_type(0.0071911567622168692829048180L), expectation_type(0.0075892974261199805224021902L), 
+            expectation_type(0.0079918336084884426107355654L), expectation_type(0.0083986775377186407732592002L), expectation_type(0.0088097479923293856474262983L), expectation_type(0.0092249696003227712485253983L), expectation_type(0.0096442722376123975796616083L), expectation_type(0.010067590508397449719034718L), expectation_type(0.010494863293820558615207215L), expectation_type(0.010926033357913685982974413L), 
+            expectation_type(0.011361047001911455796817769L), expectation_type(0.011799853759641138239648867L), expectation_type(0.012242406127989293125973420L), expectation_type(0.012688659327475459816740283L), expectation_type(0.013138571088791836084708046L), expectation_type(0.013592101461838746163612364L), expectation_type(0.014049212644332388394157396L), expectation_type(0.014509868827509569093045615L), 
+            expectation_type(0.014974036056823716800398880L), expectation_type(0.015441682105832872858635777L), expectation_type(0.015912776361735672473558046L), expectation_type(0.016387289721225112386365767L), expectation_type(0.016865194495509726590466495L), expectation_type(0.017346464323503713523688989L), expectation_type(0.017831074092316438840416442L), expectation_type(0.018318999864281503417657497L), 
+            expectation_type(0.018810218809859403511079740L), expectation_type(0.019304709145828318342976050L), expectation_type(0.019802450078246870024404949L), expectation_type(0.020303421749732565003043793L), expectation_type(0.020807605190651494658795091L), expectation_type(0.021314982273859948354198356L), expectation_type(0.021825535672677877722626297L), expectation_type(0.022339248821808484778550035L), 
+            expectation_type(0.022856105880948292448309754L), expectation_type(0.023376091700858487252207259L), expectation_type(0.023899191791691601201911081L), expectation_type(0.024425392293388148345987146L), expectation_type(0.024954679947976012099385863L), expectation_type(0.025487042073621500705808740L), expectation_type(0.026022466540295313520693262L), expectation_type(0.026560941746929416387660229L), 
+            expectation_type(0.027102456599952204687659361L), expectation_type(0.027647000493099505356092916L), expectation_type(0.028194563288408079239539246L), expectation_type(0.028745135298306458197520256L), expectation_type(0.029298707268725296426865482L), expectation_type(0.029855270363156027546257022L), expectation_type(0.030414816147592580855817272L), expectation_type(0.030977336576296294289953749L), 
+            expectation_type(0.031542823978329031340065730L), expectation_type(0.032111271044803920310289630L), expectation_type(0.032682670816807135644104703L), expectation_type(0.033257016673947775859080035L), expectation_type(0.033834302323496198926601846L), expectation_type(0.034414521790074187400164158L), expectation_type(0.034997669405863062050113885L), expectation_type(0.035583739801298370661909311L), 
+            expectation_type(0.036172727896222071510612595L), expectation_type(0.036764628891465229763462176L), expectation_type(0.037359438260836168340074791L), expectation_type(0.037957151743490779230938194L), expectation_type(0.038557765336663321830115544L), expectation_type(0.039161275288737524809950295L), expectation_type(0.039767678092639179407851528L), expectation_type(0.040376970479532675440190285L), 
+            expectation_type(0.040989149412805096554162167L), expectation_type(0.041604212082322566860031506L), expectation_type(0.042222155898944534980996732L), expectation_type(0.042842978489282600779497540L), expectation_type(0.043466677690691340948799646L), expectation_type(0.044093251546479378069574486L), expectation_type(0.044722698301329668850268561L), expectation_type(0.045355016396918665836330456L), 
+            expectation_type(0.045990204467724637187825548L), expectation_type(0.046628261337016015095265350L), expectation_type(0.047269186013011188583601999L), expectation_type(0.047912977685201664079943980L), expectation_type(0.048559635720830990140424853L), expectation_type(0.049209159661522283835794440L), expectation_type(0.049861549220047607939970042L), expectation_type(0.050516804277232832495948089L), 
+            expectation_type(0.051174924878991973602865272L), expectation_type(0.051835911233485338257099112L), expectation_type(0.052499763708396118512492842L), expectation_type(0.053166482828320372680853321L), expectation_type(0.053836069272265607225006867L), expectation_type(0.054508523871253431736272548L), expectation_type(0.055183847606022002162327174L), expectation_type(0.055862041604824195388463864L), 
+            expectation_type(0.056543107141317672414440642L), expectation_type(0.057227045632543188668392889L), expectation_type(0.057913858636987699342258919L), expectation_type(0.058603547852728985835529633L), expectation_type(0.059296115115658697209416015L), expectation_type(0.059991562397780858678353181L), expectation_type(0.060689891805583048244588765L), expectation_type(0.061391105578477583211061243L), 
+            expectation_type(0.062095206087310191040577113L), expectation_type(0.062802195832933764377830835L), expectation_type(0.063512077444844918490391167L), expectation_type(0.064224853679881181356613433L), expectation_type(0.064940527420976752542348233L), expectation_type(0.065659101675974867245205261L), expectation_type(0.066380579576494896799241896L), expectation_type(0.067104964376852406853938459L), 
+            expectation_type(0.067832259453030479676157965L), expectation_type(0.068562468301700687858468936L), expectation_type(0.069295594539292183418362750L), expectation_type(0.070031641901107439089233302L), expectation_type(0.070770614240483247767638554L), expectation_type(0.071512515527995651809111797L), expectation_type(0.072257349850707536359194061L), expectation_type(0.073005121411457680356792496L), 
+            expectation_type(0.073755834528190115430578292L), expectation_type(0.074509493633322696791717874L), expectation_type(0.075266103273153841563040100L), expectation_type(0.076025668107306438921245714L), expectation_type(0.076788192908207983101327313L), expectation_type(0.077553682560606024848886782L), expectation_type(0.078322142061118079426533435L), expectation_type(0.079093576517815169897706547L), 
+            expectation_type(0.079867991149838223230945796L), expectation_type(0.080645391287046573889320823L), expectation_type(0.081425782369697865086979537L), expectation_type(0.082209169948158671895599345L), expectation_type(0.082995559682645202950774699L), expectation_type(0.083784957342993468720072076L), expectation_type(0.084577368808458334224147427L), expectation_type(0.085372800067540902819258425L), 
+            expectation_type(0.086171257217843705219084972L), expectation_type(0.086972746465953194417686113L), expectation_type(0.087777274127349072631915081L), expectation_type(0.088584846626340000865708966L), expectation_type(0.089395470496025265262369935L), expectation_type(0.090209152378281997103438937L), expectation_type(0.091025899023777565180560534L), expectation_type(0.091845717292006780353896920L), 
+            expectation_type(0.092668614151353572458891987L), expectation_type(0.093494596679176819372052069L), expectation_type(0.094323672061920027033391770L), expectation_type(0.095155847595244577583863698L), expectation_type(0.095991130684186280544220423L), expectation_type(0.096829528843334979169424088L), expectation_type(0.097671049697036980790413989L), expectation_type(0.098515700979620096131763505L), 
+            expectation_type(0.099363490535641088297102292L), expectation_type(0.10021442632015534737042901L), expectation_type(0.10106851639900862141563864L), expectation_type(0.10192576894915064909261990L), expectation_type(0.10278619225897055316893402L), expectation_type(0.10364979472865386791313183L), expectation_type(0.10451658487056108673000466L), expectation_type(0.10538657130962762945939228L), 
+            expectation_type(0.10625976278378514152763526L), expectation_type(0.10713616814440404963260639L), expectation_type(0.10801579635675731087698425L), expectation_type(0.10889865650050530425683438L), expectation_type(0.10978475777020182517977123L), expectation_type(0.11067410947582115524449970L), expectation_type(0.11156672104330619087630777L), expectation_type(0.11246260201513762559548690L), 
+            expectation_type(0.11336176205092419171156896L), expectation_type(0.11426421092801397809908396L), expectation_type(0.11516995854212685143321128L), expectation_type(0.11607901490800801885875173L), expectation_type(0.11699139016010278054543090L), expectation_type(0.11790709455325253095843644L), expectation_type(0.11882613846341207795673624L), expectation_type(0.11974853238838835903425005L), 
+            expectation_type(0.12067428694860064415119276L), expectation_type(0.12160341288786232467544408L), expectation_type(0.12253592107418439797695025L), expectation_type(0.12347182250060076720202293L), expectation_type(0.12441112828601548570885785L), expectation_type(0.12535384967607208558034817L), expectation_type(0.12629999804404513955484082L), expectation_type(0.12724958489175421563925044L), 
+            expectation_type(0.12820262185050039360113795L), expectation_type(0.12915912068202552248609016L), expectation_type(0.13011909327949440828300779L), expectation_type(0.13108255166850013087163429L), expectation_type(0.13204950800809269944267263L), expectation_type(0.13301997459183126568991347L), expectation_type(0.13399396384886012424465974L), expectation_type(0.13497148834500874006406689L), 
+            expectation_type(0.13595256078391605280548954L), expectation_type(0.13693719400817931862719016L), expectation_type(0.13792540100052776036048214L), expectation_type(0.13891719488502130760822317L), expectation_type(0.13991258892827471904824763L), expectation_type(0.14091159654070739006657376L), expectation_type(0.14191423127781915982283727L), expectation_type(0.14292050684149244296825123L), 
+            expectation_type(0.14393043708132102250340953L), expectation_type(0.14494403599596585168846691L), expectation_type(0.14596131773453822451077043L), expectation_type(0.14698229659801068598412885L), expectation_type(0.14800698704065606550895466L), expectation_type(0.14903540367151502867300512L), expectation_type(0.15006756125589255522803940L), expectation_type(0.15110347471688376354821771L), 
+            expectation_type(0.15214315913692951467148948L), expectation_type(0.15318662975940224205573449L), expectation_type(0.15423390199022246645741594L), expectation_type(0.15528499139950646887257885L), expectation_type(0.15633991372324560827900528L), expectation_type(0.15739868486501778499529132L), expectation_type(0.15846132089773156483886327L), expectation_type(0.15952783806540349393209862L), 
+            expectation_type(0.16059825278496914898564406L), expectation_type(0.16167258164812848319290917L), expectation_type(0.16275084142322604351206088L), expectation_type(0.16383304905716665110448249L), expectation_type(0.16491922167736715305477293L), expectation_type(0.16600937659374487023049486L), expectation_type(0.16710353130074338326396739L), expectation_type(0.16820170347939631616777347L), 
+            expectation_type(0.16930391099942979504507062L), expectation_type(0.17041017192140427774045253L), expectation_type(0.17152050449889646911266605L), expectation_type(0.17263492718072205591308284L), expectation_type(0.17375345861320001504010071L), expectation_type(0.17487611764245926922677625L), expectation_type(0.17600292331678848502468650L), expectation_type(0.17713389488902982928957591L), 
+            expectation_type(0.17826905181901752227265888L), expectation_type(0.17940841377606204789503266L), expectation_type(0.18055200064148090485168316L), expectation_type(0.18169983251117680587688478L), expectation_type(0.18285192969826425682596886L), expectation_type(0.18400831273574547221176333L), expectation_type(0.18516900237923660950056659L), expectation_type(0.18633401960974533084619178L), 
+            expectation_type(0.18750338563650072804612856L), expectation_type(0.18867712189983667436681864L), expectation_type(0.18985525007412969553194616L), expectation_type(0.19103779207079248162597695L), expectation_type(0.19222477004132419196340975L), expectation_type(0.19341620638041873614183667L), expectation_type(0.19461212372913224656454211L), expectation_type(0.19581254497811099071772305L), 
+            expectation_type(0.19701749327088100545139530L), expectation_type(0.19822699200720077047579679L), expectation_type(0.19944106484647827428203414L), expectation_type(0.20065973571125386276360845L), expectation_type(0.20188302879075029899246692L), expectation_type(0.20311096854449150192898849L), expectation_type(0.20434357970599147236098065L), expectation_type(0.20558088728651495611509148L), 
+            expectation_type(0.20682291657891143760944331L), expectation_type(0.20806969316152410116492666L), expectation_type(0.20932124290217544321242887L), expectation_type(0.21057759196223126567418114L), expectation_type(0.21183876680074482941124498L), expectation_type(0.21310479417868299676985153L), expectation_type(0.21437570116323624398294742L), expectation_type(0.21565151513221447754824825L), 
+            expectation_type(0.21693226377853064377108033L), expectation_type(0.21821797511477417749250641L), expectation_type(0.21950867747787639468647349L), expectation_type(0.22080439953386999417249204L), expectation_type(0.22210517028274489622399200L), expectation_type(0.22341101906340271043130413L), expectation_type(0.22472197555871219187959128L), expectation_type(0.22603806980066811360666031L), 
+            expectation_type(0.22735933217565605449747914L), expectation_type(0.22868579342982567533902803L), expectation_type(0.23001748467457513179218156L), expectation_type(0.23135443739214935163191406L), expectation_type(0.23269668344135498486260387L), expectation_type(0.23404425506339491933523672L), expectation_type(0.23539718488782534138602817L), expectation_type(0.23675550593863841089427310L), 
+            expectation_type(0.23811925164047371313890593L), expectation_type(0.23948845582496174604133116L), expectation_type(0.24086315273720280094501299L), expectation_type(0.24224337704238469813426553L), expectation_type(0.24362916383254294497582632L), expectation_type(0.24502054863346699502358466L), expectation_type(0.24641756741175640081234384L), expectation_type(0.24782025658203077154073385L), 
+            expectation_type(0.24922865301429756957366219L), expectation_type(0.25064279404148190685596300L), expectation_type(0.25206271746712263410419590L), expectation_type(0.25348846157323915222434191L), expectation_type(0.25492006512837351698982885L), expectation_type(0.25635756739581255481663801L), expectation_type(0.25780100814199485970979300L), expectation_type(0.25925042764510769935826348L), 
+            expectation_type(0.26070586670387902216409261L), expectation_type(0.26216736664656992695871813L), expectation_type(0.26363496934017313354943175L), expectation_type(0.26510871719982317532887381L), expectation_type(0.26658865319842422526096591L), expectation_type(0.26807482087650166393245648L), expectation_type(0.26956726435228370334990842L), expectation_type(0.27106602833201959310281729L), 
+            expectation_type(0.27257115812054115675650856L), expectation_type(0.27408269963207463625289676L), expectation_type(0.27560069940131006107091638L), expectation_type(0.27712520459473560733874141L), expectation_type(0.27865626302224467042463901L), expectation_type(0.28019392314902364321200323L), expectation_type(0.28173823410772867175926862L), expectation_type(0.28328924571095995085372526L), 
+            expectation_type(0.28484700846404242461207492L), expectation_type(0.28641157357812207230929281L), expectation_type(0.28798299298358728760904376L), expectation_type(0.28956131934382520093190172L), expectation_type(0.29114660606932315047236147L), expectation_type(0.29273890733212587803648223L), expectation_type(0.29433827808065941212928494L), expectation_type(0.29594477405493300332313403L), 
+            expectation_type(0.29755845180213089667401493L), expectation_type(0.29917936869260616365337864L), expectation_type(0.30080758293628927260591461L), expectation_type(0.30244315359952455305317493L), expectation_type(0.30408614062234820621536981L), expectation_type(0.30573660483622203294900436L), expectation_type(0.30739460798223759198393684L), expectation_type(0.30906021272980606703857916L), 
+            expectation_type(0.31073348269584971230987043L), expectation_type(0.31241448246451136325781794L), expectation_type(0.31410327760739914488860165L), expectation_type(0.31579993470438418431921867L), expectation_type(0.31750452136496983979708750L), expectation_type(0.31921710625025169615489831L), expectation_type(0.32093775909548834860323761L), expectation_type(0.32266655073330380460019709L), 
+            expectation_type(0.32440355311754317919403337L), expectation_type(0.32614883934780424473142152L), expectation_type(0.32790248369466832330063397L), expectation_type(0.32966456162565498200612170L), expectation_type(0.33143514983192600955656097L), expectation_type(0.33321432625576522024791874L), expectation_type(0.33500217011886175094935800L), expectation_type(0.33679876195142569103392020L), 
+            expectation_type(0.33860418362216611739875411L), expectation_type(0.34041851836916290004435471L), expectation_type(0.34224185083166500158769467L), expectation_type(0.34407426708284942024932733L), expectation_type(0.34591585466357642419434828L), expectation_type(0.34776670261717829978895728L), expectation_type(0.34962690152532049179642724L), expectation_type(0.35149654354497575450702967L), 
+            expectation_type(0.35337572244655376431578681L), expectation_type(0.35526453365323057170397710L), expectation_type(0.35716307428152429967820294L), expectation_type(0.35907144318316563259323492L), expectation_type(0.36098974098831389046495108L), expectation_type(0.36291807015017185634639378L), expectation_type(0.36485653499105502555174770L), expectation_type(0.36680524174997358344463652L), 
+            expectation_type(0.36876429863178820168931927L), expectation_type(0.37073381585800368042611623L), expectation_type(0.37271390571926756555174397L), expectation_type(0.37470468262964414663418178L), expectation_type(0.37670626318273770319550292L), expectation_type(0.37871876620974252719251213L), expectation_type(0.38074231283950112042969884L), expectation_type(0.38277702656065606121684556L), 
+            expectation_type(0.38482303328598536972646063L), expectation_type(0.38688046141901579221752382L), expectation_type(0.38894944192301328777941080L), expectation_type(0.39103010839245515602585798L), expectation_type(0.39312259712709371016124095L), expectation_type(0.39522704720872719851383330L), expectation_type(0.39734360058079983211427900L), expectation_type(0.39947240213095931113543499L), 
+            expectation_type(0.40161359977670718591535056L), expectation_type(0.40376734455428476791533011L), expectation_type(0.40593379071094515371047045L), expectation_type(0.40811309580077027490418117L), expectation_type(0.41030542078420077540667807L), expectation_type(0.41251093013145598455070025L), expectation_type(0.41472979193003134306873817L), expectation_type(0.41696217799647139566648225L), 
+            expectation_type(0.41920826399262793938461235L), expectation_type(0.42146822954662516605125994L), expectation_type(0.42374225837876671952552988L), expectation_type(0.42603053843263356893689054L), expectation_type(0.42833326201163654824049795L), expectation_type(0.43065062592130340688133137L), expectation_type(0.43298283161759733979580939L), expectation_type(0.43533008536158230852622130L), 
+            expectation_type(0.43769259838077012833032098L), expectation_type(0.44007058703750538743042911L), expectation_type(0.44246427300476690264154800L), expectation_type(0.44487388344978873035286402L), expectation_type(0.44729965122592988531109996L), expectation_type(0.44974181507325002755930982L), expectation_type(0.45220061982827863095631878L), expectation_type(0.45467631664349773234186001L), 
+            expectation_type(0.45716916321709348450499450L), expectation_type(0.45967942403356962506115284L), expectation_type(0.46220737061585687635016598L), expectation_type(0.46475328178959648310421813L), expectation_type(0.46731744396032387772119532L), expectation_type(0.46990015140433017183296364L), expectation_type(0.47250170657403517695442871L), expectation_type(0.47512242041876636510073921L), 
+            expectation_type(0.47776261272190404508635493L), expectation_type(0.48042261245542455373017341L), expectation_type(0.48310275815295100057055003L), expectation_type(0.48580339830250567914604676L), expectation_type(0.48852489176025035636137275L), expectation_type(0.49126760818660104139079809L), expectation_type(0.49403192850621337295710692L), expectation_type(0.49681824539345440459470336L), 
+            expectation_type(0.49962696378510738059604941L), expectation_type(0.50245850142219927763612023L), expectation_type(0.50531328942299778054289970L), expectation_type(0.50819177288939647207828179L), expectation_type(0.51109441154909604007722778L), expectation_type(0.51402168043619714854671228L), expectation_type(0.51697407061304943368494005L), expectation_type(0.51995208993645330108532474L), 
+            expectation_type(0.52295626387158956536998004L), expectation_type(0.52598713635735960266540401L), expectation_type(0.52904527072715911452495956L), expectation_type(0.53213125068948584785827523L), expectation_type(0.53524568137320025605134223L), expectation_type(0.53838919044272334374677622L), expectation_type(0.54156242928897378075356884L), expectation_type(0.54476607430242363526576371L), 
+            expectation_type(0.54800082823529660720651534L), expectation_type(0.55126742166065345839519588L), expectation_type(0.55456661453691682938459769L), expectation_type(0.55789919788729380254294226L), expectation_type(0.56126599560457330305143078L), expectation_type(0.56466786639292282940574891L), expectation_type(0.56810570585960379657641388L), expectation_type(0.57158044877098877888373312L), 
+            expectation_type(0.57509307148892264933083931L), expectation_type(0.57864459460535288910566046L), expectation_type(0.58223608579529725675673425L), expectation_type(0.58586866291066086580200546L), expectation_type(0.58954349734020830710430056L), expectation_type(0.59326181766419755895303927L), expectation_type(0.59702491363585972300130277L), expectation_type(0.60083414052614396452946629L), 
+            expectation_type(0.60469092387303831958656169L), expectation_type(0.60859676468244174638136309L), expectation_type(0.61255324513414244197781892L), expectation_type(0.61656203485412306714709585L), expectation_type(0.62062489782337269319628126L), expectation_type(0.62474370000389090955128904L), expectation_type(0.62892041777493104248579693L), expectation_type(0.63315714728712708681064736L), 
+            expectation_type(0.63745611485945216315842594L), expectation_type(0.64181968856454734937020250L), expectation_type(0.64625039117256444867978180L), expectation_type(0.65075091465319424303599275L), expectation_type(0.65532413647114914812073059L), expectation_type(0.65997313795348840448192621L), expectation_type(0.66470122505966689103991366L), expectation_type(0.66951195194943155768263933L), 
+            expectation_type(0.67440914782275190543588637L), expectation_type(0.67939694760384629445628723L), expectation_type(0.68447982716328846856933622L), expectation_type(0.68966264392506406806322705L), expectation_type(0.69495068389850889641505205L), expectation_type(0.70034971642068549186625387L), expectation_type(0.70586605820975206403776904L), expectation_type(0.71150664873729443325879048L), 
+            expectation_type(0.71727913945936837770152560L), expectation_type(0.72319200014692332390536441L), expectation_type(0.72925464648993591873678824L), expectation_type(0.73547759440747709659004092L), expectation_type(0.74187264821167249929128092L), expectation_type(0.74845313214526635827628608L), expectation_type(0.75523417813929314431455069L), expectation_type(0.76223308737894139898772102L), 
+            expectation_type(0.76946979014354445397615606L), expectation_type(0.77696743855888550001834253L), expectation_type(0.78475318227282791611785888L), expectation_type(0.79285920086473065534814573L), expectation_type(0.80132410465836278942261877L), expectation_type(0.81019487771676995816279493L), expectation_type(0.81952964234332621205215691L), expectation_type(0.82940171123596302000799357L), 
+            expectation_type(0.83990574028828638442358351L), expectation_type(0.85116747651166736686823054L), expectation_type(0.86336002946253700818118862L), expectation_type(0.87673287837407410881274868L), expectation_type(0.89166820379521830373051201L), expectation_type(0.90880378162845308259058488L), expectation_type(0.92935032978672016308870604L), expectation_type(0.95616620079454265269621639L)
+        }; // layer_bottom_endpoints[...]
+
+        static inline const expectation_type downscaled_layer_heights[n_boxes] = {
+            expectation_type(1.1233301476854537292568490e-23L), expectation_type(1.2557711506584606892172231e-23L), expectation_type(1.3776601608870560044159020e-23L), expectation_type(1.4641766694157345547455931e-23L), expectation_type(1.5335596165497991451762598e-23L), expectation_type(1.5926131492128658973491200e-23L), expectation_type(1.6446762709219543526636137e-23L), expectation_type(1.6916551226223997139371370e-23L), 
+            expectation_type(1.7347489676242998164548667e-23L), expectation_type(1.7747655185072677207248934e-23L), expectation_type(1.8122769593018514321299182e-23L), expectation_type(1.8477047470688172818982546e-23L), expectation_type(1.8813691072393660864925592e-23L), expectation_type(1.9135195874353141003725528e-23L), expectation_type(1.9443547929054463159503119e-23L), expectation_type(1.9740356203655492983311462e-23L), 
+            expectation_type(2.0026944158097257902908469e-23L), expectation_type(2.0304414840817538290962937e-23L), expectation_type(2.0573698244584730175286878e-23L), expectation_type(2.0835586460031859382300817e-23L), expectation_type(2.1090760239208674311275290e-23L), expectation_type(2.1339809387211363830459216e-23L), expectation_type(2.1583248637928713056384762e-23L), expectation_type(2.1821530171395390094134063e-23L), 
+            expectation_type(2.2055053596695983370636074e-23L), expectation_type(2.2284173996678676776848551e-23L), expectation_type(2.2509208472467658107303376e-23L), expectation_type(2.2730441513915717545302340e-23L), expectation_type(2.2948129441898028606448171e-23L), expectation_type(2.3162504109983371805074524e-23L), expectation_type(2.3373776010024144017983568e-23L), expectation_type(2.3582136894160892418261357e-23L), 
+            expectation_type(2.3787762001592105998186415e-23L), expectation_type(2.3990811960083735854251634e-23L), expectation_type(2.4191434418075455857513007e-23L), expectation_type(2.4389765452299744197877484e-23L), expectation_type(2.4585930787281058626736869e-23L), expectation_type(2.4780046856351239425488439e-23L), expectation_type(2.4972221728478989704181512e-23L), expectation_type(2.5162555920948813131074251e-23L), 
+            expectation_type(2.5351143114499483829744970e-23L), expectation_type(2.5538070784762875674171331e-23L), expectation_type(2.5723420761592295229270368e-23L), expectation_type(2.5907269726028667662232989e-23L), expectation_type(2.6089689653140283570640950e-23L), expectation_type(2.6270748207722742059283975e-23L), expectation_type(2.6450509098809492427461991e-23L), expectation_type(2.6629032398079902633140305e-23L), 
+            expectation_type(2.6806374826529221797040054e-23L), expectation_type(2.6982590013157718790246465e-23L), expectation_type(2.7157728728924246530880156e-23L), expectation_type(2.7331839098776025241483853e-23L), expectation_type(2.7504966794198202447947012e-23L), expectation_type(2.7677155208412859637292465e-23L), expectation_type(2.7848445616088704672603856e-23L), expectation_type(2.8018877319192416060327654e-23L), 
+            expectation_type(2.8188487780414473627337572e-23L), expectation_type(2.8357312745431342367615298e-23L), expectation_type(2.8525386355117938764460667e-23L), expectation_type(2.8692741248695957473694157e-23L), expectation_type(2.8859408658691991080737177e-23L), expectation_type(2.9025418498482021104845700e-23L), expectation_type(2.9190799443113761904629897e-23L), expectation_type(2.9355579004023785130526544e-23L), 
+            expectation_type(2.9519783598200888765970647e-23L), expectation_type(2.9683438612289568985349851e-23L), expectation_type(2.9846568462076655880026273e-23L), expectation_type(3.0009196647759290209292635e-23L), expectation_type(3.0171345805352681668801971e-23L), expectation_type(3.0333037754560842691301175e-23L), expectation_type(3.0494293543402170607241791e-23L), expectation_type(3.0655133489853868296588399e-23L), 
+            expectation_type(3.0815577220754328814054664e-23L), expectation_type(3.0975643708180398941899996e-23L), expectation_type(3.1135351303496564543807542e-23L), expectation_type(3.1294717769255292578030585e-23L), expectation_type(3.1453760309111781709118878e-23L), expectation_type(3.1612495595902007104594087e-23L), expectation_type(3.1770939798020012902884730e-23L), expectation_type(3.1929108604218748307001046e-23L), 
+            expectation_type(3.2087017246948220179900360e-23L), expectation_type(3.2244680524335223234785665e-23L), expectation_type(3.2402112820900299990946876e-23L), expectation_type(3.2559328127099780971816326e-23L), expectation_type(3.2716340057773676682041558e-23L), expectation_type(3.2873161869573761978137508e-23L), expectation_type(3.3029806477440344320732490e-23L), expectation_type(3.3186286470190881300633382e-23L), 
+            expectation_type(3.3342614125278757542419225e-23L), expectation_type(3.3498801422776100131951491e-23L), expectation_type(3.3654860058630463669555149e-23L), expectation_type(3.3810801457241513957424955e-23L), expectation_type(3.3966636783400450160788650e-23L), expectation_type(3.4122376953631799487425268e-23L), expectation_type(3.4278032646974369536926603e-23L), expectation_type(3.4433614315235527735151297e-23L), 
+            expectation_type(3.4589132192750573367321373e-23L), expectation_type(3.4744596305676756483476420e-23L), expectation_type(3.4900016480849462115507046e-23L), expectation_type(3.5055402354226202264608007e-23L), expectation_type(3.5210763378942327962370256e-23L), expectation_type(3.5366108833000776707684789e-23L), expectation_type(3.5521447826616695280343964e-23L), expectation_type(3.5676789309236413963924568e-23L), 
+            expectation_type(3.5832142076248986183607932e-23L), expectation_type(3.5987514775407338962380959e-23L), expectation_type(3.6142915912974996690822188e-23L), expectation_type(3.6298353859613336467337669e-23L), expectation_type(3.6453836856023401309295238e-23L), expectation_type(3.6609373018355432046184882e-23L), expectation_type(3.6764970343398474385832804e-23L), expectation_type(3.6920636713561669662670050e-23L), 
+            expectation_type(3.7076379901658141723744158e-23L), expectation_type(3.7232207575501744255744531e-23L), expectation_type(3.7388127302326328922421277e-23L), expectation_type(3.7544146553036631597110282e-23L), expectation_type(3.7700272706299348654300057e-23L), expectation_type(3.7856513052482484899758235e-23L), expectation_type(3.8012874797450596677400634e-23L), expectation_type(3.8169365066223125612591514e-23L), 
+            expectation_type(3.8325990906502618149568629e-23L), expectation_type(3.8482759292079251505479570e-23L), expectation_type(3.8639677126117736046413124e-23L), expectation_type(3.8796751244332335690047584e-23L), expectation_type(3.8953988418055440187507248e-23L), expectation_type(3.9111395357204834588698903e-23L), expectation_type(3.9268978713154540517880109e-23L), expectation_type(3.9426745081513849849177342e-23L), 
+            expectation_type(3.9584701004818932838875412e-23L), expectation_type(3.9742852975141178692309523e-23L), expectation_type(3.9901207436616215946861255e-23L), expectation_type(4.0059770787897362040133600e-23L), expectation_type(4.0218549384537065171679185e-23L), expectation_type(4.0377549541299726286688430e-23L), expectation_type(4.0536777534409123996090231e-23L), expectation_type(4.0696239603733509836640730e-23L), 
+            expectation_type(4.0855941954911294851525244e-23L), expectation_type(4.1015890761420110465463638e-23L), expectation_type(4.1176092166591896507492682e-23L), expectation_type(4.1336552285576546506079784e-23L), expectation_type(4.1497277207256524586085839e-23L), expectation_type(4.1658272996114759008298212e-23L), expectation_type(4.1819545694058014212215041e-23L), expectation_type(4.1981101322197845781139557e-23L), 
+            expectation_type(4.2142945882591150700309102e-23L), expectation_type(4.2305085359942238301950269e-23L), expectation_type(4.2467525723268265085655504e-23L), expectation_type(4.2630272927529798888197271e-23L), expectation_type(4.2793332915228204392302763e-23L), expectation_type(4.2956711617971472464724019e-23L), expectation_type(4.3120414958010050071890101e-23L), expectation_type(4.3284448849744165323132459e-23L), 
+            expectation_type(4.3448819201204083337373023e-23L), expectation_type(4.3613531915504672932557970e-23L), expectation_type(4.3778592892275611423274724e-23L), expectation_type(4.3944008029068504917310588e-23L), expectation_type(4.4109783222742154273178396e-23L), expectation_type(4.4275924370827152174295724e-23L), expectation_type(4.4442437372870954457022310e-23L), expectation_type(4.4609328131764528773007201e-23L), 
+            expectation_type(4.4776602555051645752993694e-23L), expectation_type(4.4944266556221841958426287e-23L), expectation_type(4.5112326055988049954797832e-23L), expectation_type(4.5280786983549858718966162e-23L), expectation_type(4.5449655277843337209944167e-23L), expectation_type(4.5618936888778325202814552e-23L), expectation_type(4.5788637778464068327574714e-23L), expectation_type(4.5958763922424048592926324e-23L), 
+            expectation_type(4.6129321310800837437941690e-23L), expectation_type(4.6300315949551775475137099e-23L), expectation_type(4.6471753861636261503786524e-23L), expectation_type(4.6643641088195413023146239e-23L), expectation_type(4.6815983689724841306034512e-23L), expectation_type(4.6988787747241266051681996e-23L), expectation_type(4.7162059363443677673857911e-23L), expectation_type(4.7335804663869739349877501e-23L), 
+            expectation_type(4.7510029798048106014899526e-23L), expectation_type(4.7684740940647323493258028e-23L), expectation_type(4.7859944292621957876256530e-23L), expectation_type(4.8035646082356593048047468e-23L), expectation_type(4.8211852566808322894302848e-23L), expectation_type(4.8388570032648354170824779e-23L), expectation_type(4.8565804797403326231497086e-23L), expectation_type(4.8743563210596944789365180e-23L), 
+            expectation_type(4.8921851654892518585248821e-23L), expectation_type(4.9100676547236980240921017e-23L), expectation_type(4.9280044340006965655902070e-23L), expectation_type(4.9459961522157520047212144e-23L), expectation_type(4.9640434620373993110331366e-23L), expectation_type(4.9821470200227680778837266e-23L), expectation_type(5.0003074867335766662735942e-23L), expectation_type(5.0185255268526112435632378e-23L), 
+            expectation_type(5.0368018093007443204043694e-23L), expectation_type(5.0551370073545471214931529e-23L), expectation_type(5.0735317987645499127590354e-23L), expectation_type(5.0919868658742042482095992e-23L), expectation_type(5.1105028957396009928314378e-23L), expectation_type(5.1290805802499979227680356e-23L), expectation_type(5.1477206162492106996194391e-23L), expectation_type(5.1664237056579210613861515e-23L), 
+            expectation_type(5.1851905555969561676487245e-23L), expectation_type(5.2040218785115931804563043e-23L), expectation_type(5.2229183922969433545944862e-23L), expectation_type(5.2418808204244701509967593e-23L), expectation_type(5.2609098920696961747129169e-23L), expectation_type(5.2800063422411540737853359e-23L), expectation_type(5.2991709119106369174165136e-23L), expectation_type(5.3184043481448040008169025e-23L), 
+            expectation_type(5.3377074042381985000495504e-23L), expectation_type(5.3570808398477339230551705e-23L), expectation_type(5.3765254211287068729341396e-23L), expectation_type(5.3960419208723942566340532e-23L), expectation_type(5.4156311186452937366630894e-23L), expectation_type(5.4352938009300669356070032e-23L), expectation_type(5.4550307612682456634233704e-23L), expectation_type(5.4748428004047622461386254e-23L), 
+            expectation_type(5.4947307264343658921649014e-23L), expectation_type(5.5146953549499879395336757e-23L), expectation_type(5.5347375091931197845264932e-23L), expectation_type(5.5548580202062683001504350e-23L), expectation_type(5.5750577269875546124048913e-23L), expectation_type(5.5953374766475232141311330e-23L), expectation_type(5.6156981245682295613095543e-23L), expectation_type(5.6361405345646755159224160e-23L), 
+            expectation_type(5.6566655790486632739533401e-23L), expectation_type(5.6772741391951397478404257e-23L), expectation_type(5.6979671051111047609015473e-23L), expectation_type(5.7187453760071578581455898e-23L), expectation_type(5.7396098603717600447845674e-23L), expectation_type(5.7605614761482883320580645e-23L), expectation_type(5.7816011509149626011411295e-23L), expectation_type(5.8027298220677259914781509e-23L), 
+            expectation_type(5.8239484370061617814995949e-23L), expectation_type(5.8452579533225315590520385e-23L), expectation_type(5.8666593389940213778084562e-23L), expectation_type(5.8881535725782845663190206e-23L), expectation_type(5.9097416434123719001994983e-23L), expectation_type(5.9314245518151419673172032e-23L), expectation_type(5.9532033092932467529049536e-23L), expectation_type(5.9750789387507897485954277e-23L), 
+            expectation_type(5.9970524747027562488114172e-23L), expectation_type(6.0191249634923179422710196e-23L), expectation_type(6.0412974635121164381835590e-23L), expectation_type(6.0635710454296329887524565e-23L), expectation_type(6.0859467924167543847178882e-23L), expectation_type(6.1084258003836478118440903e-23L), expectation_type(6.1310091782170603665943670e-23L), expectation_type(6.1536980480231619419887082e-23L), 
+            expectation_type(6.1764935453750533131940127e-23L), expectation_type(6.1993968195650644802926399e-23L), expectation_type(6.2224090338619716666025589e-23L), expectation_type(6.2455313657732648287330198e-23L), expectation_type(6.2687650073126011132714524e-23L), expectation_type(6.2921111652725833988019189e-23L), expectation_type(6.3155710615030068952256668e-23L), expectation_type(6.3391459331947207396516387e-23L), 
+            expectation_type(6.3628370331692556342075636e-23L), expectation_type(6.3866456301743728209541990e-23L), expectation_type(6.4105730091856940878445047e-23L), expectation_type(6.4346204717145770527578466e-23L), expectation_type(6.4587893361224046856922682e-23L), expectation_type(6.4830809379414629080950515e-23L), expectation_type(6.5074966302025851591878795e-23L), expectation_type(6.5320377837697480483991551e-23L), 
+            expectation_type(6.5567057876818076273323481e-23L), expectation_type(6.5815020495015714210470220e-23L), expectation_type(6.6064279956724071640846288e-23L), expectation_type(6.6314850718825951992294413e-23L), expectation_type(6.6566747434376377243850611e-23L), expectation_type(6.6819984956407445234471845e-23L), expectation_type(6.7074578341817214993079335e-23L), expectation_type(6.7330542855344952501634534e-23L), 
+            expectation_type(6.7587893973635141035433752e-23L), expectation_type(6.7846647389392734557874432e-23L), expectation_type(6.8106819015632209683511557e-23L), expectation_type(6.8368424990023051570807415e-23L), expectation_type(6.8631481679334391876947203e-23L), expectation_type(6.8896005683981602718892644e-23L), expectation_type(6.9162013842677739560251418e-23L), expectation_type(6.9429523237192818210919472e-23L), 
+            expectation_type(6.9698551197224006820042322e-23L), expectation_type(6.9969115305379913003037149e-23L), expectation_type(7.0241233402282249217084680e-23L), expectation_type(7.0514923591788266340296308e-23L), expectation_type(7.0790204246337456278480740e-23L), expectation_type(7.1067094012426139488365732e-23L), expectation_type(7.1345611816213672743442753e-23L), expectation_type(7.1625776869264136462745917e-23L), 
+            expectation_type(7.1907608674427489667008563e-23L), expectation_type(7.2191127031864314323075527e-23L), expectation_type(7.2476352045218409698132342e-23L), expectation_type(7.2763304127941641592324051e-23L), expectation_type(7.3052004009775601184420343e-23L), expectation_type(7.3342472743394783954310274e-23L), expectation_type(7.3634731711216160994068226e-23L), expectation_type(7.3928802632380183254359220e-23L), 
+            expectation_type(7.4224707569908434176393870e-23L), expectation_type(7.4522468938043328026663411e-23L), expectation_type(7.4822109509775440392004425e-23L), expectation_type(7.5123652424564254031229398e-23L), expectation_type(7.5427121196258307957863651e-23L), expectation_type(7.5732539721220950604768599e-23L), expectation_type(7.6039932286668119571927362e-23L), expectation_type(7.6349323579224801178741079e-23L), 
+            expectation_type(7.6660738693707063247204441e-23L), expectation_type(7.6974203142136804668838186e-23L), expectation_type(7.7289742862996625815151221e-23L), expectation_type(7.7607384230732495221195993e-23L), expectation_type(7.7927154065512170711928037e-23L), expectation_type(7.8249079643247627785412285e-23L), expectation_type(7.8573188705890055177137754e-23L), expectation_type(7.8899509472006297696986709e-23L), 
+            expectation_type(7.9228070647645960277108932e-23L), expectation_type(7.9558901437508735350415548e-23L), expectation_type(7.9892031556421878885877082e-23L), expectation_type(8.0227491241138139365487354e-23L), expectation_type(8.0565311262464839464968572e-23L), expectation_type(8.0905522937735223003820103e-23L), expectation_type(8.1248158143633610711843215e-23L), expectation_type(8.1593249329386358417035669e-23L), 
+            expectation_type(8.1940829530331081341310838e-23L), expectation_type(8.2290932381877099295744247e-23L), expectation_type(8.2643592133870570751374564e-23L), expectation_type(8.2998843665378320139265832e-23L), expectation_type(8.3356722499904923481360566e-23L), expectation_type(8.3717264821058203814774969e-23L), expectation_type(8.4080507488678901160251560e-23L), expectation_type(8.4446488055450923389022822e-23L), 
+            expectation_type(8.4815244784009255729471997e-23L), expectation_type(8.5186816664563309378434270e-23L), expectation_type(8.5561243433054225384473103e-23L), expectation_type(8.5938565589865420390422469e-23L), expectation_type(8.6318824419106467800198508e-23L), expectation_type(8.6702062008491253419079912e-23L), expectation_type(8.7088321269832230671531472e-23L), expectation_type(8.7477645960173529313400570e-23L), 
+            expectation_type(8.7870080703586645444229623e-23L), expectation_type(8.8265671013653462048504294e-23L), expectation_type(8.8664463316662420858906671e-23L), expectation_type(8.9066504975544790806025701e-23L), expectation_type(8.9471844314579158633081273e-23L), expectation_type(8.9880530644893506527716198e-23L), expectation_type(9.0292614290795543165863748e-23L), expectation_type(9.0708146616963321891777930e-23L), 
+            expectation_type(9.1127180056529616611004340e-23L), expectation_type(9.1549768140095036322946387e-23L), expectation_type(9.1975965525706447292839348e-23L), expectation_type(9.2405828029838942155678023e-23L), expectation_type(9.2839412659421352542481383e-23L), expectation_type(9.3276777644947151217482953e-23L), expectation_type(9.3717982474714536640495590e-23L), expectation_type(9.4163087930241543104536541e-23L), 
+            expectation_type(9.4612156122904179308852861e-23L), expectation_type(9.5065250531847873984823810e-23L), expectation_type(9.5522436043224906008838869e-23L), expectation_type(9.5983778990813025795402170e-23L), expectation_type(9.6449347198073142654787195e-23L), expectation_type(9.6919210021706767755829484e-23L), expectation_type(9.7393438396776873473858155e-23L), expectation_type(9.7872104883458966973136513e-23L), 
+            expectation_type(9.8355283715492489295971740e-23L), expectation_type(9.8843050850406152158770012e-23L), expectation_type(9.9335484021594525025225719e-23L), expectation_type(9.9832662792327097620426820e-23L), expectation_type(1.0033466861177518156024926e-22L), expectation_type(1.0084158487314639387440791e-22L), expectation_type(1.0135349697402110063624679e-22L), expectation_type(1.0187049237899010756058105e-22L), 
+            expectation_type(1.0239266068469808441285661e-22L), expectation_type(1.0292009368740272084621510e-22L), expectation_type(1.0345288545316545375168640e-22L), expectation_type(1.0399113239079580283948746e-22L), expectation_type(1.0453493332767792612916624e-22L), expectation_type(1.0508438958861498631092453e-22L), expectation_type(1.0563960507783433053637952e-22L), expectation_type(1.0620068636430436024724130e-22L), 
+            expectation_type(1.0676774277052233663762564e-22L), expectation_type(1.0734088646494126629286391e-22L), expectation_type(1.0792023255821347823688402e-22L), expectation_type(1.0850589920343857883284457e-22L), expectation_type(1.0909800770061419876088238e-22L), expectation_type(1.0969668260549937423549545e-22L), expectation_type(1.1030205184311258418159948e-22L), expectation_type(1.1091424682609945193297209e-22L), 
+            expectation_type(1.1153340257821897441236129e-22L), expectation_type(1.1215965786321192897227968e-22L), expectation_type(1.1279315531933089886314022e-22L), expectation_type(1.1343404159982822937112231e-22L), expectation_type(1.1408246751971626128607115e-22L), expectation_type(1.1473858820913347692212481e-22L), expectation_type(1.1540256327367083464876268e-22L), expectation_type(1.1607455696203466759956174e-22L), 
+            expectation_type(1.1675473834144619711234186e-22L), expectation_type(1.1744328148120308803367278e-22L), expectation_type(1.1814036564485568913387962e-22L), expectation_type(1.1884617549147980781119502e-22L), expectation_type(1.1956090128655922798650120e-22L), expectation_type(1.2028473912302487263619585e-22L), expectation_type(1.2101789115303373340363394e-22L), expectation_type(1.2176056583110965308188369e-22L), 
+            expectation_type(1.2251297816930998656291133e-22L), expectation_type(1.2327535000512733847283963e-22L), expectation_type(1.2404791028288426215659049e-22L), expectation_type(1.2483089534943131317384984e-22L), expectation_type(1.2562454926501551941484352e-22L), expectation_type(1.2642912413024753115022905e-22L), expectation_type(1.2724488043016185667239654e-22L), expectation_type(1.2807208739643612269521825e-22L), 
+            expectation_type(1.2891102338891271911620799e-22L), expectation_type(1.2976197629765004173868535e-22L), expectation_type(1.3062524396682143737245047e-22L), expectation_type(1.3150113464187854978197383e-22L), expectation_type(1.3238996744150279907241307e-22L), expectation_type(1.3329207285598501681166034e-22L), expectation_type(1.3420779327379970796422596e-22L), expectation_type(1.3513748353827802050858270e-22L), 
+            expectation_type(1.3608151153643338671130170e-22L), expectation_type(1.3704025882215719251204391e-22L), expectation_type(1.3801412127618010843792734e-22L), expectation_type(1.3900350980538940835904021e-22L), expectation_type(1.4000885108430541868054641e-22L), expectation_type(1.4103058834175308611616289e-22L), expectation_type(1.4206918219601965682031209e-22L), expectation_type(1.4312511154206900627031776e-22L), 
+            expectation_type(1.4419887449468991717059806e-22L), expectation_type(1.4529098939179256559357430e-22L), expectation_type(1.4640199586243800558707452e-22L), expectation_type(1.4753245596459331996563118e-22L), expectation_type(1.4868295539805458644851856e-22L), expectation_type(1.4985410479847569272636783e-22L), expectation_type(1.5104654111898873962359504e-22L), expectation_type(1.5226092910650742420570761e-22L), 
+            expectation_type(1.5349796288047533062393383e-22L), expectation_type(1.5475836762256434092926757e-22L), expectation_type(1.5604290138665334334710818e-22L), expectation_type(1.5735235703933422158475640e-22L), expectation_type(1.5868756434221233053071956e-22L), expectation_type(1.6004939218840550959926130e-22L), expectation_type(1.6143875100691425274722787e-22L), expectation_type(1.6285659534995323098020737e-22L), 
+            expectation_type(1.6430392667992077795751802e-22L), expectation_type(1.6578179637446098795889366e-22L), expectation_type(1.6729130897006897043974056e-22L), expectation_type(1.6883362566693381485765449e-22L), expectation_type(1.7040996812024091376584329e-22L), expectation_type(1.7202162254600596944597636e-22L), expectation_type(1.7366994417273426672048705e-22L), expectation_type(1.7535636207384528778904864e-22L), 
+            expectation_type(1.7708238441993817630752806e-22L), expectation_type(1.7884960419467234205084007e-22L), expectation_type(1.8065970542338676552830973e-22L), expectation_type(1.8251446996968358013608054e-22L), expectation_type(1.8441578496217660601935124e-22L), expectation_type(1.8636565092159562710885690e-22L), expectation_type(1.8836619066761022182473440e-22L), expectation_type(1.9041965909529197979389016e-22L), 
+            expectation_type(1.9252845392330775355287322e-22L), expectation_type(1.9469512753001164320442656e-22L), expectation_type(1.9692240000991758966192149e-22L), expectation_type(1.9921317360199326234976886e-22L), expectation_type(2.0157054866330757818164381e-22L), expectation_type(2.0399784138737842457031670e-22L), expectation_type(2.0649860349681884539023961e-22L), expectation_type(2.0907664417543873117960061e-22L), 
+            expectation_type(2.1173605454688681934444333e-22L), expectation_type(2.1448123505651620310926420e-22L), expectation_type(2.1731692617202753953688077e-22L), expectation_type(2.2024824288856758796443901e-22L), expectation_type(2.2328071360779414896742970e-22L), expectation_type(2.2642032406102629122226949e-22L), expectation_type(2.2967356706782013554607662e-22L), expectation_type(2.3304749906797913422990532e-22L), 
+            expectation_type(2.3654980454324113698755574e-22L), expectation_type(2.4018886966246647234033382e-22L), expectation_type(2.4397386675104235371910947e-22L), expectation_type(2.4791485151424080807560657e-22L), expectation_type(2.5202287535202761106646401e-22L), expectation_type(2.5631011561097085002719044e-22L), expectation_type(2.6079002725586426894807506e-22L), expectation_type(2.6547752024704840984268116e-22L), 
+            expectation_type(2.7038916792926300114437211e-22L), expectation_type(2.7554345304146844228518291e-22L), expectation_type(2.8096105963556960333366817e-22L), expectation_type(2.8666522136995360379213822e-22L), expectation_type(2.9268213949318785924714182e-22L), expectation_type(2.9904148759392758996840763e-22L), expectation_type(3.0577702520312971216655893e-22L), expectation_type(3.1292734907624943752968994e-22L), 
+            expectation_type(3.2053682015256030626845037e-22L), expectation_type(3.2865671680527770106468503e-22L), expectation_type(3.3734668257311453674321465e-22L), expectation_type(3.4667656138351726495640213e-22L), expectation_type(3.5672874884042099027328486e-22L), expectation_type(3.6760123992239841732864000e-22L), expectation_type(3.7941163013277538510683697e-22L), expectation_type(3.9230244295072441082654084e-22L), 
+            expectation_type(4.0644833502226308952041359e-22L), expectation_type(4.2206601245358636568228476e-22L), expectation_type(4.3942814837744197276093369e-22L), expectation_type(4.5888335414683739291456555e-22L), expectation_type(4.8088557107754674309606994e-22L), expectation_type(5.0603860438765644820936710e-22L), expectation_type(5.3516592701616976068237164e-22L), expectation_type(5.6942455591899230130967935e-22L), 
+            expectation_type(6.1049994396741806108579505e-22L), expectation_type(6.6095961987387064603022773e-22L), expectation_type(7.2494359211044689029844893e-22L), expectation_type(8.0964561341912587856089573e-22L), expectation_type(9.2892153567938000221765680e-22L), expectation_type(1.1138306075135604333877875e-21L), expectation_type(1.4536912801886098250277983e-21L), expectation_type(2.3762350163425117038169380e-21L)
+        }; // downscaled_layer_heights[...]
+    }; // struct ziggurat_layers_exponential_512<...>
+} // namespace ropufu::aftermath::random
+
+#endif // ROPUFU_AFTERMATH_RANDOM_ZIGGURAT_LAYERS_EXPONENTIAL_512_M64_HPP_INCLUDED
@@ -3,8 +3,14 @@
 #define ROPUFU_AFTERMATH_SEQUENTIAL_HPP_INCLUDED
 
 #include "sequential/scalar_process.hpp"
+#include "sequential/batched_cusum.hpp"
+#include "sequential/batched_finite_moving_average.hpp"
+#include "sequential/batched_window_limited_cusum.hpp"
 #include "sequential/iid_process.hpp"
 #include "sequential/iid_transient_process.hpp"
+#include "sequential/importance_sampled_process.hpp"
+#include "sequential/multilevel_splitting.hpp"
+#include "sequential/run_length.hpp"
 
 namespace ropufu
 {
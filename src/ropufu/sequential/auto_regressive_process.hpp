@@ -18,6 +18,7 @@
 #include <optional>    // std::optional, std::nullopt
 #include <random>      // std::seed_seq
 #include <ranges>      // std::ranges::...
+#include <span>        // std::span
 #include <stdexcept>   // std::logic_error, std::runtime_error
 #include <string>      // std::string
 #include <string_view> // std::string_view
@@ -28,9 +29,10 @@
 #ifdef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #undef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #endif
-#define ROPUFU_TMP_TYPENAME auto_regressive_process<t_sampler_type, t_container_type>
+#define ROPUFU_TMP_TYPENAME auto_regressive_process<t_sampler_type, t_container_type, t_history_type>
 #define ROPUFU_TMP_TEMPLATE_SIGNATURE                                                                       \
-    template <typename t_sampler_type, std::ranges::random_access_range t_container_type>                   \
+    template <typename t_sampler_type, std::ranges::random_access_range t_container_type,                   \
+        ropufu::aftermath::sliding_window<typename t_sampler_type::value_type> t_history_type>             \
         requires                                                                                            \
             std::floating_point<typename t_sampler_type::value_type> &&                                     \
             std::same_as<std::ranges::range_value_t<t_container_type>, typename t_sampler_type::value_type> \
@@ -38,9 +40,13 @@
 
 namespace ropufu::aftermath::sequential
 {
-    /** Auto-regressive process driven by an arbitrary distribution. */
+    /** @brief Auto-regressive process driven by an arbitrary distribution.
+     *  @param t_history_type Keeps the p most recent observations, e.g., \c sliding_vector (O(p) copying per
+     *  observation) or \c mirrored_sliding_vector (O(1) per observation).
+     */
     template <typename t_sampler_type,
-        std::ranges::random_access_range t_container_type = aftermath::simple_vector<typename t_sampler_type::value_type>>
+        std::ranges::random_access_range t_container_type = aftermath::simple_vector<typename t_sampler_type::value_type>,
+        ropufu::aftermath::sliding_window<typename t_sampler_type::value_type> t_history_type = aftermath::sliding_vector<typename t_sampler_type::value_type>>
         requires
             std::floating_point<typename t_sampler_type::value_type> &&
             std::same_as<std::ranges::range_value_t<t_container_type>, typename t_sampler_type::value_type>
@@ -55,17 +61,21 @@ namespace ropufu::aftermath::sequential
 #endif
     
     ROPUFU_TMP_TEMPLATE_SIGNATURE
-    struct auto_regressive_process : public discrete_process<typename t_sampler_type::value_type, t_container_type>
+    struct auto_regressive_process : public static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>
     {
         using type = ROPUFU_TMP_TYPENAME;
-        using base_type = discrete_process<typename t_sampler_type::value_type, t_container_type>;
+        using base_type = static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>;
         using sampler_type = t_sampler_type;
         using container_type = t_container_type;
 
         using engine_type = typename sampler_type::engine_type;
 	    using distribution_type = typename sampler_type::distribution_type;
         using value_type = typename sampler_type::value_type;
-        using history_type = ropufu::aftermath::sliding_vector<value_type>;
+        using history_type = t_history_type;
+
+        /** Indicates if blocks of innovations are drawn with a single call to the sampler. */
+        static constexpr bool is_block_sampled =
+            requires(sampler_type& sampler, engine_type& engine, std::span<value_type> values) { sampler(engine, values); };
 
         static constexpr std::string_view name = "autoregression";
         static constexpr std::size_t parameter_dim = 2;
@@ -79,6 +89,7 @@ namespace ropufu::aftermath::sequential
         friend ropufu::noexcept_json_serializer<type>;
 #endif
         friend std::hash<type>;
+        friend base_type;
 
     private:
         engine_type m_engine;
@@ -89,6 +100,8 @@ namespace ropufu::aftermath::sequential
         container_type m_ar_parameters;
         // Collection of most recent observations [X_{t - 1}, X_{t - 2}, ..., X_{t - p}].
         history_type m_history;
+        // Scratch space for blocks: p most recent observations, oldest first, followed by the block.
+        ropufu::aftermath::simple_vector<value_type> m_block_buffer = {};
 
         /** @brief Validates the structure and returns an error message, if any. */
         std::optional<std::string> error_message() const noexcept
@@ -117,24 +130,61 @@ namespace ropufu::aftermath::sequential
             this->m_history.wipe();
         } // on_clear(...)
 
-        value_type on_next() noexcept override
+        /** Adds the autoregression term to the \p innovation and records the result in history. */
+        value_type regress(value_type innovation) noexcept
         {
-            value_type newest = this->m_sampler(this->m_engine);
-            
-            auto it = this->m_ar_parameters.cbegin();
-            for (value_type x : this->m_history)
-            {
-                newest += x * (*it);
-                ++it;
-            } // for (...)
+            value_type newest = innovation;
+
+            // Oldest observations first, in the same order as \c regress_block.
+            for (std::size_t i = this->m_history.size(); i != 0; --i)
+                newest += this->m_history[i - 1] * this->m_ar_parameters[i - 1];
 
             this->m_history.displace_front(newest);
             return newest;
+        } // regress(...)
+
+        /** @brief Runs the autoregression over a block of innovations, overwriting them with observations.
+         *  @param buffer Contains the p most recent observations, oldest first, followed by \p count innovations.
+         *  @remark Every observation, once known, adds its contribution to the p observations that follow it.
+         *    The inner loop is then an element-wise multiply-add over contiguous memory, with no reduction,
+         *    and can be vectorized. The sums are formed in exactly the same order as in \c regress.
+         */
+        void regress_block(value_type* buffer, std::size_t count) noexcept
+        {
+            std::size_t order = this->m_history.size();
+            std::size_t total = order + count;
+            for (std::size_t j = 0; j + 1 < total; ++j)
+            {
+                // Observation in position j contributes to positions max(p, j + 1), ..., min(j + p, total - 1).
+                const value_type x = buffer[j];
+                std::size_t from = (j < order) ? (order - j) : 1;
+                std::size_t to = (total - 1 - j < order) ? (total - 1 - j) : order;
+                value_type* target = buffer + j;
+                for (std::size_t i = from; i <= to; ++i) target[i] += this->m_ar_parameters[i - 1] * x;
+            } // for (...)
+
+            for (std::size_t i = 0; i < order; ++i) this->m_history.set(i, buffer[total - 1 - i]);
+        } // regress_block(...)
+
+        value_type on_next() noexcept override final
+        {
+            return this->regress(this->m_sampler(this->m_engine));
         } // on_next(...)
 
-        void on_next(container_type& values) noexcept override
+        void on_next(container_type& values) noexcept override final
         {
-            for (value_type& x : values) x = this->on_next();
+            std::size_t order = this->m_history.size();
+            std::size_t count = std::ranges::size(values);
+            if (this->m_block_buffer.size() < order + count) this->m_block_buffer = ropufu::aftermath::simple_vector<value_type>(order + count);
+
+            // Lay out the history followed by the innovations.
+            value_type* buffer = this->m_block_buffer.data();
+            for (std::size_t i = 0; i < order; ++i) buffer[i] = this->m_history[order - 1 - i];
+            if constexpr (type::is_block_sampled) this->m_sampler(this->m_engine, std::span<value_type>(buffer + order, count));
+            else for (std::size_t k = 0; k < count; ++k) buffer[order + k] = this->m_sampler(this->m_engine);
+
+            this->regress_block(buffer, count);
+            for (std::size_t k = 0; k < count; ++k) values[k] = buffer[order + k];
         } // on_next(...)
 
     public:
@@ -0,0 +1,75 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_CUSUM_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_CUSUM_HPP_INCLUDED
+
+#include "batched_statistic.hpp"
+
+#include <concepts>    // std::totally_ordered
+#include <cstddef>     // std::size_t
+#include <string_view> // std::string_view
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief CUSUM statistics of \c t_batch_size independent replications advanced in lockstep.
+     *  @remark Lane k follows the same recursion as \c cusum, max(0, S) + x, with all lanes updated in a single loop.
+     */
+    template <std::totally_ordered t_observation_value_type,
+        std::totally_ordered t_statistic_value_type = t_observation_value_type,
+        std::size_t t_batch_size = 8>
+    struct batched_cusum
+        : public batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>
+    {
+        using type = batched_cusum<t_observation_value_type, t_statistic_value_type, t_batch_size>;
+        using base_type = batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>;
+        using observation_value_type = t_observation_value_type;
+        using statistic_value_type = t_statistic_value_type;
+
+        using observation_batch_type = typename base_type::observation_batch_type;
+        using statistic_batch_type = typename base_type::statistic_batch_type;
+
+        /** Names the statistic. */
+        static constexpr std::string_view name = "CUSUM";
+
+    private:
+        /** Latest statistic value of every lane, including the inactive ones. */
+        statistic_batch_type m_latest_statistics = {};
+
+    public:
+        batched_cusum() noexcept = default;
+
+        /** The underlying processes have been cleared. */
+        void reset() noexcept
+        {
+            this->m_latest_statistics.fill(0);
+            this->clear_batch();
+        } // reset(...)
+
+        /** Observe a single value in every lane. */
+        const statistic_batch_type& observe(const observation_batch_type& values) noexcept
+        {
+            for (std::size_t k = 0; k < t_batch_size; ++k)
+            {
+                statistic_value_type s = this->m_latest_statistics[k];
+                if (s < 0) s = 0;
+                this->m_latest_statistics[k] = s + values[k];
+            } // for (...)
+            this->commit(this->m_latest_statistics);
+            return this->m_statistics;
+        } // observe(...)
+
+        bool operator ==(const type& other) const noexcept
+        {
+            return
+                this->m_latest_statistics == other.m_latest_statistics &&
+                this->m_statistics == other.m_statistics &&
+                this->active() == other.active();
+        } // operator ==(...)
+
+        bool operator !=(const type& other) const noexcept
+        {
+            return !this->operator ==(other);
+        } // operator !=(...)
+    }; // struct batched_cusum
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_CUSUM_HPP_INCLUDED
@@ -0,0 +1,121 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_FINITE_MOVING_AVERAGE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_FINITE_MOVING_AVERAGE_HPP_INCLUDED
+
+#include "../simple_vector.hpp"
+#include "batched_statistic.hpp"
+#include "timed_transform.hpp"
+
+#include <concepts>    // std::floating_point, std::totally_ordered
+#include <cstddef>     // std::size_t
+#include <stdexcept>   // std::logic_error
+#include <string_view> // std::string_view
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief FMA statistics, sums of the last L observations, of \c t_batch_size independent replications advanced in lockstep.
+     *  @remark The last L observations of all lanes are kept in a circular buffer of L rows, each row holding
+     *    one observation per lane. Every observation updates the sums in O(1) time per lane, as \c finite_moving_average
+     *    does in \c window_update_mode::incremental; for floating point statistics the sums are recalculated
+     *    from the buffer every L observations.
+     */
+    template <std::totally_ordered t_observation_value_type,
+        std::totally_ordered t_statistic_value_type = t_observation_value_type,
+        std::size_t t_batch_size = 8,
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>>
+    struct batched_finite_moving_average
+        : public batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>
+    {
+        using type = batched_finite_moving_average<t_observation_value_type, t_statistic_value_type, t_batch_size, t_transform_type>;
+        using base_type = batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>;
+        using observation_value_type = t_observation_value_type;
+        using statistic_value_type = t_statistic_value_type;
+        using transform_type = t_transform_type;
+
+        using observation_batch_type = typename base_type::observation_batch_type;
+        using statistic_batch_type = typename base_type::statistic_batch_type;
+
+        static constexpr bool is_exact = !std::floating_point<statistic_value_type>;
+
+        /** Names the statistic. */
+        static constexpr std::string_view name = "FMA";
+
+    private:
+        std::size_t m_window_size;
+        transform_type m_transform;
+        /** Last L observations: row (i) holds the observations of all lanes, and rows are overwritten in a circular manner. */
+        ropufu::aftermath::simple_vector<observation_value_type> m_history;
+        /** Row to be overwritten by the next observation. */
+        std::size_t m_row_index = 0;
+        /** Number of observations since the sums were last recalculated from scratch. */
+        std::size_t m_count_since_resum = 0;
+        /** Sums of the last L observations in every lane. */
+        statistic_batch_type m_sums = {};
+        statistic_batch_type m_transformed = {};
+
+        /** Recalculates the sums from the buffer. */
+        void resum() noexcept
+        {
+            this->m_sums.fill(0);
+            const observation_value_type* row = this->m_history.data();
+            for (std::size_t i = 0; i < this->m_window_size; ++i, row += t_batch_size)
+                for (std::size_t k = 0; k < t_batch_size; ++k) this->m_sums[k] += row[k];
+            this->m_count_since_resum = 0;
+        } // resum(...)
+
+    public:
+        batched_finite_moving_average() noexcept
+            : batched_finite_moving_average(1)
+        {
+        } // batched_finite_moving_average(...)
+
+        /** @exception std::logic_error \p window_size is zero. */
+        explicit batched_finite_moving_average(std::size_t window_size, const transform_type& transform = {})
+            : m_window_size(window_size), m_transform(transform), m_history(window_size * t_batch_size)
+        {
+            if (window_size == 0) throw std::logic_error("Window size cannot be zero.");
+            this->reset();
+        } // batched_finite_moving_average(...)
+
+        std::size_t window_size() const noexcept { return this->m_window_size; }
+
+        /** The underlying processes have been cleared. */
+        void reset() noexcept
+        {
+            this->m_history.wipe();
+            this->m_row_index = 0;
+            this->m_count_since_resum = 0;
+            this->m_sums.fill(0);
+            this->clear_batch();
+        } // reset(...)
+
+        /** Observe a single value in every lane. */
+        const statistic_batch_type& observe(const observation_batch_type& values) noexcept
+        {
+            // Before the first L observations, the buffer is filled with zeros.
+            observation_value_type* row = this->m_history.data() + this->m_row_index * t_batch_size;
+            for (std::size_t k = 0; k < t_batch_size; ++k)
+            {
+                this->m_sums[k] -= row[k];
+                this->m_sums[k] += values[k];
+                row[k] = values[k];
+            } // for (...)
+            if (++this->m_row_index == this->m_window_size) this->m_row_index = 0;
+            if constexpr (!is_exact)
+            {
+                if (++this->m_count_since_resum >= this->m_window_size) this->resum();
+            } // if constexpr (...)
+
+            std::size_t time = this->count_observations();
+            if (time < this->m_window_size) [[unlikely]]
+            {
+                for (std::size_t k = 0; k < t_batch_size; ++k) this->m_transformed[k] = this->m_transform(time, this->m_sums[k]);
+                this->commit(this->m_transformed);
+            } // if (...)
+            else this->commit(this->m_sums);
+            return this->m_statistics;
+        } // observe(...)
+    }; // struct batched_finite_moving_average
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_FINITE_MOVING_AVERAGE_HPP_INCLUDED
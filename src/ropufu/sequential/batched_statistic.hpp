@@ -0,0 +1,111 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
+
+#include <array>    // std::array
+#include <concepts> // std::totally_ordered
+#include <cstddef>  // std::size_t
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief Implements base functionality for statistics of \c t_batch_size independent replications
+     *    (lanes), advanced in lockstep, one observation per lane at a time.
+     *  @remark The state of every lane is stored in contiguous arrays indexed by lane, so that updates
+     *    are simple loops over the batch that the compiler may vectorize.
+     *  @remark Lanes that have finished, e.g., crossed a threshold, are masked out: they keep being
+     *    updated along with the others, but their statistics are held at the latest active values.
+     */
+    template <std::totally_ordered t_observation_value_type,
+        std::totally_ordered t_statistic_value_type,
+        std::size_t t_batch_size>
+        requires (t_batch_size > 0)
+    struct batched_statistic
+    {
+        using type = batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>;
+        using observation_value_type = t_observation_value_type;
+        using statistic_value_type = t_statistic_value_type;
+
+        using observation_batch_type = std::array<observation_value_type, t_batch_size>;
+        using statistic_batch_type = std::array<statistic_value_type, t_batch_size>;
+        using mask_type = std::array<bool, t_batch_size>;
+        using time_batch_type = std::array<std::size_t, t_batch_size>;
+
+        static constexpr std::size_t batch_size = t_batch_size;
+
+    private:
+        std::size_t m_count_observations = 0;
+        std::size_t m_count_active = t_batch_size;
+        mask_type m_is_active = {};
+        /** Number of observations when each lane was deactivated, or zero for active lanes. */
+        time_batch_type m_when = {};
+
+    protected:
+        /** Latest statistics of every lane. */
+        statistic_batch_type m_statistics = {};
+
+        batched_statistic() noexcept
+        {
+            this->clear_batch();
+        } // batched_statistic(...)
+
+        /** Activates all lanes and sets their statistics to zero. */
+        void clear_batch() noexcept
+        {
+            this->m_count_observations = 0;
+            this->m_count_active = t_batch_size;
+            this->m_is_active.fill(true);
+            this->m_when.fill(0);
+            this->m_statistics.fill(0);
+        } // clear_batch(...)
+
+        /** Overwrites the statistics of active lanes with \p updated, and advances time. */
+        void commit(const statistic_batch_type& updated) noexcept
+        {
+            for (std::size_t k = 0; k < t_batch_size; ++k)
+                this->m_statistics[k] = this->m_is_active[k] ? updated[k] : this->m_statistics[k];
+            ++this->m_count_observations;
+        } // commit(...)
+
+    public:
+        /** Number of observations in each lane since the last reset. */
+        std::size_t count_observations() const noexcept { return this->m_count_observations; }
+
+        /** Number of lanes that have not been deactivated since the last reset. */
+        std::size_t count_active() const noexcept { return this->m_count_active; }
+
+        /** Indicates if there are any lanes left to update. */
+        bool is_running() const noexcept { return this->m_count_active != 0; }
+
+        const mask_type& active() const noexcept { return this->m_is_active; }
+
+        bool is_active(std::size_t lane) const noexcept { return this->m_is_active[lane]; }
+
+        /** Number of observations when each lane was deactivated, or zero for active lanes. */
+        const time_batch_type& when() const noexcept { return this->m_when; }
+
+        /** Latest statistics of every lane; inactive lanes hold the values they had when they were deactivated. */
+        const statistic_batch_type& statistics() const noexcept { return this->m_statistics; }
+
+        /** Masks out the replication in \p lane. */
+        void deactivate(std::size_t lane) noexcept
+        {
+            if (!this->m_is_active[lane]) return;
+            this->m_is_active[lane] = false;
+            this->m_when[lane] = this->m_count_observations;
+            --this->m_count_active;
+        } // deactivate(...)
+
+        /** @brief Masks out the active lanes whose statistics exceed \p threshold.
+         *  @return Number of lanes deactivated.
+         */
+        std::size_t deactivate_above(const statistic_value_type& threshold) noexcept
+        {
+            std::size_t count_before = this->m_count_active;
+            for (std::size_t k = 0; k < t_batch_size; ++k)
+                if (this->m_statistics[k] > threshold) this->deactivate(k);
+            return count_before - this->m_count_active;
+        } // deactivate_above(...)
+    }; // struct batched_statistic
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
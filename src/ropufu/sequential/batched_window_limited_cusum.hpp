@@ -0,0 +1,155 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_WINDOW_LIMITED_CUSUM_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_WINDOW_LIMITED_CUSUM_HPP_INCLUDED
+
+#include "../simple_vector.hpp"
+#include "batched_statistic.hpp"
+#include "timed_transform.hpp"
+
+#include <concepts>    // std::totally_ordered
+#include <cstddef>     // std::size_t
+#include <stdexcept>   // std::logic_error
+#include <string_view> // std::string_view
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief Window-limited CUSUM statistics of \c t_batch_size independent replications advanced in lockstep.
+     *  @remark With S_n denoting the n-th partial sum (and S_j = 0 for j <= 0), the statistic is
+     *    S_n - min{S_j : n - L <= j <= n}. The monotone deque used by \c window_limited_cusum does not
+     *    vectorize across lanes; instead, time is split into blocks of (L + 1) consecutive partial sums.
+     *    The window minimum is the smaller of the running minimum within the current block and a suffix
+     *    minimum of the previous block, and the suffix minima are recalculated once per block. This takes
+     *    O(1) amortized time per observation, with every step being a branch-free loop over the lanes.
+     */
+    template <std::totally_ordered t_observation_value_type,
+        std::totally_ordered t_statistic_value_type = t_observation_value_type,
+        std::size_t t_batch_size = 8,
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>>
+    struct batched_window_limited_cusum
+        : public batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>
+    {
+        using type = batched_window_limited_cusum<t_observation_value_type, t_statistic_value_type, t_batch_size, t_transform_type>;
+        using base_type = batched_statistic<t_observation_value_type, t_statistic_value_type, t_batch_size>;
+        using observation_value_type = t_observation_value_type;
+        using statistic_value_type = t_statistic_value_type;
+        using transform_type = t_transform_type;
+
+        using observation_batch_type = typename base_type::observation_batch_type;
+        using statistic_batch_type = typename base_type::statistic_batch_type;
+
+        /** Names the statistic. */
+        static constexpr std::string_view name = "Window-limited CUSUM";
+
+    private:
+        std::size_t m_window_size;
+        transform_type m_transform;
+        /** Partial sums of the current block: row (i) holds the partial sums of all lanes. */
+        ropufu::aftermath::simple_vector<statistic_value_type> m_block;
+        /** Row (i) holds the minima of rows i, i + 1, ..., L of the previous block. */
+        ropufu::aftermath::simple_vector<statistic_value_type> m_suffix_minima;
+        /** Position of the latest partial sum within the current block. */
+        std::size_t m_position = 0;
+        /** Latest partial sums, relative to the end of the previous block. */
+        statistic_batch_type m_partial_sums = {};
+        /** Minima of the partial sums in the current block so far. */
+        statistic_batch_type m_prefix_minima = {};
+        statistic_batch_type m_latest_statistics = {};
+
+        static void minimize(statistic_value_type& x, const statistic_value_type& y) noexcept
+        {
+            x = (y < x) ? y : x;
+        } // minimize(...)
+
+        /** Calculates the suffix minima of the completed block, and shifts all partial sums so that the latest one becomes zero. */
+        void on_block_completed() noexcept
+        {
+            std::size_t block_size = this->m_window_size + 1;
+            statistic_value_type* suffix = this->m_suffix_minima.data() + (block_size - 1) * t_batch_size;
+            const statistic_value_type* row = this->m_block.data() + (block_size - 1) * t_batch_size;
+            for (std::size_t k = 0; k < t_batch_size; ++k) suffix[k] = row[k] - this->m_partial_sums[k];
+            for (std::size_t i = 1; i < block_size; ++i)
+            {
+                suffix -= t_batch_size;
+                row -= t_batch_size;
+                for (std::size_t k = 0; k < t_batch_size; ++k)
+                {
+                    suffix[k] = row[k] - this->m_partial_sums[k];
+                    type::minimize(suffix[k], suffix[k + t_batch_size]);
+                } // for (...)
+            } // for (...)
+            this->m_partial_sums.fill(0);
+        } // on_block_completed(...)
+
+    public:
+        batched_window_limited_cusum() noexcept
+            : batched_window_limited_cusum(1)
+        {
+        } // batched_window_limited_cusum(...)
+
+        /** @exception std::logic_error \p window_size is zero. */
+        explicit batched_window_limited_cusum(std::size_t window_size, const transform_type& transform = {})
+            : m_window_size(window_size), m_transform(transform),
+            m_block((window_size + 1) * t_batch_size), m_suffix_minima((window_size + 1) * t_batch_size)
+        {
+            if (window_size == 0) throw std::logic_error("Window size cannot be zero.");
+            this->reset();
+        } // batched_window_limited_cusum(...)
+
+        std::size_t window_size() const noexcept { return this->m_window_size; }
+
+        /** The underlying processes have been cleared. */
+        void reset() noexcept
+        {
+            // Partial sums S_j, j < 0, make up the previous block; S_0 starts the current one.
+            this->m_suffix_minima.wipe();
+            this->m_block.wipe();
+            this->m_position = 0;
+            this->m_partial_sums.fill(0);
+            this->m_prefix_minima.fill(0);
+            this->clear_batch();
+        } // reset(...)
+
+        /** Observe a single value in every lane. */
+        const statistic_batch_type& observe(const observation_batch_type& values) noexcept
+        {
+            std::size_t block_size = this->m_window_size + 1;
+            if (++this->m_position == block_size) this->m_position = 0;
+
+            statistic_value_type* row = this->m_block.data() + this->m_position * t_batch_size;
+            for (std::size_t k = 0; k < t_batch_size; ++k)
+            {
+                this->m_partial_sums[k] += values[k];
+                row[k] = this->m_partial_sums[k];
+            } // for (...)
+
+            if (this->m_position == 0) this->m_prefix_minima = this->m_partial_sums;
+            else for (std::size_t k = 0; k < t_batch_size; ++k) type::minimize(this->m_prefix_minima[k], this->m_partial_sums[k]);
+
+            // The window, S_{n - L}, ..., S_n, covers positions after the current one in the previous block.
+            if (this->m_position + 1 == block_size)
+            {
+                for (std::size_t k = 0; k < t_batch_size; ++k)
+                    this->m_latest_statistics[k] = this->m_partial_sums[k] - this->m_prefix_minima[k];
+                this->on_block_completed();
+            } // if (...)
+            else
+            {
+                const statistic_value_type* suffix = this->m_suffix_minima.data() + (this->m_position + 1) * t_batch_size;
+                for (std::size_t k = 0; k < t_batch_size; ++k)
+                {
+                    statistic_value_type window_minimum = this->m_prefix_minima[k];
+                    type::minimize(window_minimum, suffix[k]);
+                    this->m_latest_statistics[k] = this->m_partial_sums[k] - window_minimum;
+                } // for (...)
+            } // else (...)
+
+            std::size_t time = this->count_observations();
+            if (time < this->m_window_size) [[unlikely]]
+                for (std::size_t k = 0; k < t_batch_size; ++k) this->m_latest_statistics[k] = this->m_transform(time, this->m_latest_statistics[k]);
+            this->commit(this->m_latest_statistics);
+            return this->m_statistics;
+        } // observe(...)
+    }; // struct batched_window_limited_cusum
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_BATCHED_WINDOW_LIMITED_CUSUM_HPP_INCLUDED
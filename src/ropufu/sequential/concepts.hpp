@@ -2,8 +2,46 @@
 #ifndef ROPUFU_AFTERMATH_SEQUENTIAL_CONCEPTS_HPP_INCLUDED
 #define ROPUFU_AFTERMATH_SEQUENTIAL_CONCEPTS_HPP_INCLUDED
 
+#include <concepts> // std::convertible_to, std::same_as
+#include <cstddef>  // std::size_t
+#include <utility>  // std::declval
+
 namespace ropufu::aftermath::sequential
 {
+    /** Discrete-time process generating one observation at a time. */
+    template <typename t_process_type>
+    concept process = requires(t_process_type& p, const t_process_type& cp)
+    {
+        typename t_process_type::value_type;
+
+        {p.next()} -> std::same_as<typename t_process_type::value_type>;
+        {p.clear()};
+        {cp.count()} -> std::convertible_to<std::size_t>;
+    }; // concept process
+
+    /** Statistic observing a discrete process and producing a value after each observation. */
+    template <typename t_statistic_type>
+    concept detection_statistic = requires(t_statistic_type& s)
+    {
+        typename t_statistic_type::observation_value_type;
+        typename t_statistic_type::statistic_value_type;
+
+        {s.reset()};
+        {s.observe(std::declval<const typename t_statistic_type::observation_value_type&>())}
+            -> std::same_as<typename t_statistic_type::statistic_value_type>;
+    }; // concept detection_statistic
+
+    /** Rule observing a detection statistic and deciding when to stop. */
+    template <typename t_stopping_rule_type>
+    concept stopping_rule = requires(t_stopping_rule_type& r, const t_stopping_rule_type& cr)
+    {
+        typename t_stopping_rule_type::value_type;
+
+        {r.reset()};
+        {r.observe(std::declval<const typename t_stopping_rule_type::value_type&>())};
+        {cr.is_stopped()} -> std::same_as<bool>;
+        {cr.is_running()} -> std::same_as<bool>;
+    }; // concept stopping_rule
 } // namespace ropufu::aftermath::sequential
 
 #endif // ROPUFU_AFTERMATH_SEQUENTIAL_CONCEPTS_HPP_INCLUDED
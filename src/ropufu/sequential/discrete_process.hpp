@@ -31,6 +31,12 @@ namespace ropufu::aftermath::sequential
         /** Called when a block of observations is to be generated. */
         virtual void on_next(container_type& values) noexcept = 0;
 
+        /** Accounts for \p count observations generated bypassing \c next. */
+        void add_count(std::size_t count) noexcept
+        {
+            this->m_count += count;
+        } // add_count(...)
+
     public:
         discrete_process() noexcept = default;
 
@@ -39,6 +45,7 @@ namespace ropufu::aftermath::sequential
         /** Purges past observations. Observers are left intact. */
         void clear() noexcept
         {
+            this->on_clear();
             this->m_count = 0;
         } // clear(...)
 
@@ -64,6 +71,42 @@ namespace ropufu::aftermath::sequential
 
         void operator ()(container_type& values) noexcept { this->next(values); }
     }; // struct discrete_process
+
+    /** @brief Discrete-time process whose most derived type, \c t_derived_type, is known at compile time (CRTP).
+     *  @remark Hides \c next of \c discrete_process with versions that invoke the overriders in \c t_derived_type
+     *    directly, bypassing virtual dispatch. Calls through a reference to \c discrete_process are still
+     *    dispatched at runtime. The derived type is expected to be a friend of this class.
+     */
+    template <typename t_derived_type, typename t_value_type, std::ranges::random_access_range t_container_type>
+        requires std::same_as<std::ranges::range_value_t<t_container_type>, t_value_type>
+    struct static_discrete_process
+        : public discrete_process<t_value_type, t_container_type>
+    {
+        using type = static_discrete_process<t_derived_type, t_value_type, t_container_type>;
+        using base_type = discrete_process<t_value_type, t_container_type>;
+        using derived_type = t_derived_type;
+        using value_type = t_value_type;
+        using container_type = t_container_type;
+
+        /** Generate a single observation. */
+        value_type next() noexcept
+        {
+            value_type result = static_cast<derived_type*>(this)->derived_type::on_next();
+            this->add_count(1);
+            return result;
+        } // next(...)
+
+        /** Generate a block of observation. */
+        void next(container_type& values) noexcept
+        {
+            static_cast<derived_type*>(this)->derived_type::on_next(values);
+            this->add_count(std::ranges::size(values));
+        } // next(...)
+
+        value_type operator ()() noexcept { return this->next(); }
+
+        void operator ()(container_type& values) noexcept { this->next(values); }
+    }; // struct static_discrete_process
 } // namespace ropufu::aftermath::sequential
 
 #endif // ROPUFU_AFTERMATH_SEQUENTIAL_DISCRETE_PROCESS_HPP_INCLUDED
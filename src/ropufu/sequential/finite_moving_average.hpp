@@ -7,10 +7,11 @@
 #include "../noexcept_json.hpp"
 #endif
 
+#include "../sliding_array.hpp"
 #include "timed_transform.hpp"
 #include "window_limited_statistic.hpp"
 
-#include <concepts>    // std::same_as, std::totally_ordered
+#include <concepts>    // std::floating_point, std::same_as, std::totally_ordered
 #include <cstddef>     // std::size_t
 #include <functional>  // std::hash
 #include <stdexcept>   // std::runtime_error
@@ -22,18 +23,22 @@
 #ifdef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #undef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #endif
-#define ROPUFU_TMP_TYPENAME finite_moving_average<t_observation_value_type, t_statistic_value_type, t_transform_type>
+#define ROPUFU_TMP_TYPENAME finite_moving_average<t_observation_value_type, t_statistic_value_type, t_transform_type, t_update_mode, t_history_type>
 #define ROPUFU_TMP_TEMPLATE_SIGNATURE                                                             \
     template <std::totally_ordered t_observation_value_type,                                      \
         std::totally_ordered t_statistic_value_type,                                              \
-        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type>  \
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type,  \
+        ropufu::aftermath::sequential::window_update_mode t_update_mode,                          \
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type>               \
 
 
 namespace ropufu::aftermath::sequential
 {
     template <std::totally_ordered t_observation_value_type,
         std::totally_ordered t_statistic_value_type = t_observation_value_type,
-        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>>
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>,
+        ropufu::aftermath::sequential::window_update_mode t_update_mode = window_update_mode::incremental,
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type = ropufu::aftermath::sliding_vector<t_observation_value_type>>
     struct finite_moving_average;
 
 #ifndef ROPUFU_NO_JSON
@@ -43,21 +48,133 @@ namespace ropufu::aftermath::sequential
     void from_json(const nlohmann::json& j, ROPUFU_TMP_TYPENAME& x);
 #endif
 
+    namespace detail
+    {
+        /** Recalculates the sum of the last L observations from the entire history. */
+        template <typename t_observation_value_type, typename t_statistic_value_type, window_update_mode t_update_mode>
+        struct finite_moving_average_module
+        {
+            using observation_value_type = t_observation_value_type;
+            using statistic_value_type = t_statistic_value_type;
+
+        protected:
+            void on_initialized(std::size_t /*window_size*/) noexcept
+            {
+            } // on_initialized(...)
+
+            template <typename t_history_type>
+            statistic_value_type on_updated(const t_history_type& history) noexcept
+            {
+                statistic_value_type sum = 0;
+                for (const observation_value_type& x : history) sum += x;
+                return sum;
+            } // on_updated(...)
+        }; // struct finite_moving_average_module
+
+        /** Updates the sum of the last L observations in O(1) amortized time: the newest
+         *  observation is added and the one leaving the window is subtracted. For floating
+         *  point statistics the sum is recalculated from scratch every L observations to
+         *  keep the accumulated rounding error bounded.
+         */
+        template <typename t_observation_value_type, typename t_statistic_value_type>
+        struct finite_moving_average_module<t_observation_value_type, t_statistic_value_type, window_update_mode::incremental>
+        {
+            using observation_value_type = t_observation_value_type;
+            using statistic_value_type = t_statistic_value_type;
+
+            static constexpr bool is_exact = !std::floating_point<statistic_value_type>;
+
+        private:
+            std::size_t m_window_size = 0;
+            /** Number of observations since the sum was last recalculated from scratch. */
+            std::size_t m_count_since_resum = 0;
+            /** Sum of the last L observations. */
+            statistic_value_type m_sum = 0;
+            /** Oldest observation in the window; it will be discarded with the next observation. */
+            observation_value_type m_oldest = {};
+
+        protected:
+            void on_initialized(std::size_t window_size) noexcept
+            {
+                this->m_window_size = window_size;
+                this->m_count_since_resum = 0;
+                this->m_sum = 0;
+                this->m_oldest = {};
+            } // on_initialized(...)
+
+            template <typename t_history_type>
+            statistic_value_type on_updated(const t_history_type& history) noexcept
+            {
+                if constexpr (!is_exact)
+                {
+                    if (++this->m_count_since_resum >= this->m_window_size)
+                    {
+                        this->m_count_since_resum = 0;
+                        this->m_sum = 0;
+                        for (const observation_value_type& x : history) this->m_sum += x;
+                        this->m_oldest = history[this->m_window_size - 1];
+                        return this->m_sum;
+                    } // if (...)
+                } // if constexpr (...)
+
+                this->m_sum -= this->m_oldest;
+                this->m_sum += history[0];
+                this->m_oldest = history[this->m_window_size - 1];
+                return this->m_sum;
+            } // on_updated(...)
+
+            /** Updates the sum with a block of observations, in exactly the same way as \c on_updated would.
+             *  @param buffer Contains the L observations preceding the block followed by the \p count observations in the block, oldest first.
+             */
+            template <typename t_statistic_container_type>
+            void on_block_updated(const observation_value_type* buffer, std::size_t count, t_statistic_container_type& statistics) noexcept
+            {
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    // The window consists of buffer[k + 1], ..., buffer[k + L].
+                    const observation_value_type* newest = buffer + k + this->m_window_size;
+                    if constexpr (!is_exact)
+                    {
+                        if (++this->m_count_since_resum >= this->m_window_size)
+                        {
+                            this->m_count_since_resum = 0;
+                            this->m_sum = 0;
+                            for (std::size_t i = 0; i < this->m_window_size; ++i) this->m_sum += *(newest - i);
+                            statistics[k] = this->m_sum;
+                            continue;
+                        } // if (...)
+                    } // if constexpr (...)
+
+                    this->m_sum -= buffer[k];
+                    this->m_sum += *newest;
+                    statistics[k] = this->m_sum;
+                } // for (...)
+                this->m_oldest = buffer[count];
+            } // on_block_updated(...)
+        }; // struct finite_moving_average_module<...>
+    } // namespace detail
+
     /** FMA chart that stops when the sum of the last L observations exceeds the threshold.
      *  When time n is less than L, only takes the first n observations.
+     *  @remark With \c window_update_mode::reference the statistic is recalculated
+     *  from the entire window with every observation, and may be used for validation.
      */
     ROPUFU_TMP_TEMPLATE_SIGNATURE
     struct finite_moving_average
-        : public window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type>
+        : public static_window_limited_statistic<ROPUFU_TMP_TYPENAME, t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>,
+        public detail::finite_moving_average_module<t_observation_value_type, t_statistic_value_type, t_update_mode>
     {
         using type = ROPUFU_TMP_TYPENAME;
-        using base_type = window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type>;
+        using base_type = static_window_limited_statistic<ROPUFU_TMP_TYPENAME, t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>;
+        using module_type = detail::finite_moving_average_module<t_observation_value_type, t_statistic_value_type, t_update_mode>;
         using observation_value_type = t_observation_value_type;
         using statistic_value_type = t_statistic_value_type;
         using transform_type = t_transform_type;
 
         using history_type = typename base_type::history_type;
 
+        static constexpr window_update_mode update_mode = t_update_mode;
+
         /** Names the statistic type. */
         constexpr std::string_view name() const noexcept override
         {
@@ -68,8 +185,19 @@ namespace ropufu::aftermath::sequential
         friend ropufu::noexcept_json_serializer<type>;
 #endif
         friend std::hash<type>;
+        friend base_type;
+
+        finite_moving_average() noexcept
+            : base_type()
+        {
+            this->on_initialized(this->window_size());
+        } // finite_moving_average(...)
 
-        using base_type::base_type;
+        explicit finite_moving_average(std::size_t window_size, const transform_type& transform = {})
+            : base_type(window_size, transform)
+        {
+            this->on_initialized(this->window_size());
+        } // finite_moving_average(...)
 
         bool operator ==(const type& other) const noexcept
         {
@@ -98,15 +226,14 @@ namespace ropufu::aftermath::sequential
         /** Occurs when the most recent observation has been added to the history.
          *  @param history Contains most recent observations (newest first, oldest last).
          */
-        statistic_value_type on_history_updated(const history_type& history) noexcept override
+        statistic_value_type on_history_updated(const history_type& history) noexcept override final
         {
-            statistic_value_type sum = 0;
-            for (const observation_value_type& x : history) sum += x;
-            return sum;
+            return this->on_updated(history);
         } // on_history_updated(...)
 
-        constexpr void on_reset() noexcept override
+        void on_reset() noexcept override final
         {
+            this->on_initialized(this->window_size());
         } // on_reset(...)
     }; // struct finite_moving_average
 } // namespace ropufu::aftermath::sequential
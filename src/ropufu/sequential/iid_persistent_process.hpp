@@ -53,10 +53,10 @@ namespace ropufu::aftermath::sequential
 #endif
 
     ROPUFU_TMP_TEMPLATE_SIGNATURE
-    struct iid_persistent_process : public discrete_process<typename t_no_change_sampler_type::value_type, t_container_type>
+    struct iid_persistent_process : public static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_no_change_sampler_type::value_type, t_container_type>
     {
         using type = ROPUFU_TMP_TYPENAME;
-        using base_type = discrete_process<typename t_no_change_sampler_type::value_type, t_container_type>;
+        using base_type = static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_no_change_sampler_type::value_type, t_container_type>;
         using no_change_sampler_type = t_no_change_sampler_type;
         using under_change_sampler_type = t_under_change_sampler_type;
         using container_type = t_container_type;
@@ -80,6 +80,7 @@ namespace ropufu::aftermath::sequential
         friend ropufu::noexcept_json_serializer<type>;
 #endif
         friend std::hash<type>;
+        friend base_type;
 
     private:
         no_change_engine_type m_no_change_engine;
@@ -95,14 +96,14 @@ namespace ropufu::aftermath::sequential
     protected:
         void on_clear() noexcept override { }
 
-        value_type on_next() noexcept override
+        value_type on_next() noexcept override final
         {
             std::size_t count = this->count();
             return (count >= this->m_first_under_change_index) ?
                 this->m_under_change_sampler(this->m_under_change_engine) : this->m_no_change_sampler(this->m_no_change_engine);
         } // on_next(...)
 
-        void on_next(container_type& values) noexcept override
+        void on_next(container_type& values) noexcept override final
         {
             std::size_t count = this->count();
             std::size_t length = std::ranges::size(values);
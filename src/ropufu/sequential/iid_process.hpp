@@ -15,6 +15,7 @@
 #include <functional>  // std::hash
 #include <random>      // std::seed_seq
 #include <ranges>      // std::ranges::...
+#include <span>        // std::span
 #include <stdexcept>   // std::runtime_error
 #include <string>      // std::string
 #include <string_view> // std::string_view
@@ -52,10 +53,10 @@ namespace ropufu::aftermath::sequential
 #endif
 
     ROPUFU_TMP_TEMPLATE_SIGNATURE
-    struct iid_process : public discrete_process<typename t_sampler_type::value_type, t_container_type>
+    struct iid_process : public static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>
     {
         using type = ROPUFU_TMP_TYPENAME;
-        using base_type = discrete_process<typename t_sampler_type::value_type, t_container_type>;
+        using base_type = static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>;
         using sampler_type = t_sampler_type;
         using container_type = t_container_type;
 
@@ -63,6 +64,10 @@ namespace ropufu::aftermath::sequential
 	    using distribution_type = typename sampler_type::distribution_type;
         using value_type = typename sampler_type::value_type;
 
+        /** Indicates if blocks of observations are drawn with a single call to the sampler. */
+        static constexpr bool is_block_sampled = std::ranges::contiguous_range<container_type> &&
+            requires(sampler_type& sampler, engine_type& engine, std::span<value_type> values) { sampler(engine, values); };
+
         static constexpr std::string_view name = "iid";
         static constexpr std::size_t parameter_dim = 1;
         
@@ -74,6 +79,7 @@ namespace ropufu::aftermath::sequential
         friend ropufu::noexcept_json_serializer<type>;
 #endif
         friend std::hash<type>;
+        friend base_type;
 
     private:
         engine_type m_engine;
@@ -84,14 +90,17 @@ namespace ropufu::aftermath::sequential
     protected:
         void on_clear() noexcept override { }
 
-        value_type on_next() noexcept override
+        value_type on_next() noexcept override final
         {
             return this->m_sampler(this->m_engine);
         } // on_next(...)
 
-        void on_next(container_type& values) noexcept override
+        void on_next(container_type& values) noexcept override final
         {
-            for (value_type& x : values) x = this->m_sampler(this->m_engine);
+            if constexpr (type::is_block_sampled)
+                this->m_sampler(this->m_engine, std::span<value_type>(std::ranges::data(values), std::ranges::size(values)));
+            else
+                for (value_type& x : values) x = this->m_sampler(this->m_engine);
         } // on_next(...)
 
     public:
@@ -0,0 +1,251 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
+
+#ifndef ROPUFU_NO_JSON
+#include <nlohmann/json.hpp>
+#include "../noexcept_json.hpp"
+#endif
+
+#include "../simple_vector.hpp"
+#include "discrete_process.hpp"
+
+#include <cmath>       // std::exp, std::log
+#include <concepts>    // std::same_as, std::totally_ordered
+#include <cstddef>     // std::size_t
+#include <functional>  // std::hash
+#include <random>      // std::seed_seq
+#include <ranges>      // std::ranges::...
+#include <span>        // std::span
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+#include <string_view> // std::string_view
+
+#ifdef ROPUFU_TMP_TYPENAME
+#undef ROPUFU_TMP_TYPENAME
+#endif
+#ifdef ROPUFU_TMP_TEMPLATE_SIGNATURE
+#undef ROPUFU_TMP_TEMPLATE_SIGNATURE
+#endif
+#define ROPUFU_TMP_TYPENAME importance_sampled_process<t_sampler_type, t_container_type>
+#define ROPUFU_TMP_TEMPLATE_SIGNATURE                                                                       \
+    template <typename t_sampler_type, std::ranges::random_access_range t_container_type>                   \
+        requires                                                                                            \
+            std::totally_ordered<typename t_sampler_type::value_type> &&                                    \
+            std::same_as<std::ranges::range_value_t<t_container_type>, typename t_sampler_type::value_type> \
+
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief Independent identically distributed (iid) sequence of observations drawn from a tilted
+     *  distribution in place of the nominal one, together with the likelihood ratio of the path.
+     */
+    template <typename t_sampler_type,
+        std::ranges::random_access_range t_container_type = aftermath::simple_vector<typename t_sampler_type::value_type>>
+        requires
+            std::totally_ordered<typename t_sampler_type::value_type> &&
+            std::same_as<std::ranges::range_value_t<t_container_type>, typename t_sampler_type::value_type>
+    struct importance_sampled_process;
+
+#ifndef ROPUFU_NO_JSON
+    ROPUFU_TMP_TEMPLATE_SIGNATURE
+    void to_json(nlohmann::json& j, const ROPUFU_TMP_TYPENAME& x) noexcept;
+
+    ROPUFU_TMP_TEMPLATE_SIGNATURE
+    void from_json(const nlohmann::json& j, ROPUFU_TMP_TYPENAME& x);
+#endif
+
+    /** @brief Independent identically distributed (iid) sequence of observations drawn from a tilted
+     *  distribution in place of the nominal one, together with the likelihood ratio of the path.
+     *  @remark The log-likelihood ratio, log(nominal / tilted), is accumulated over all observations since
+     *    the process was last cleared. For a rule stopped at time T, weighting f(X_1, ..., X_T) by the
+     *    likelihood ratio at time T gives an unbiased estimate of the nominal expectation of f.
+     *  @remark To record the weights for each threshold of a \c stopping_time, use it with a stopped value
+     *    type and pass \c log_likelihood_ratio to \c if_stopped before every observation.
+     */
+    ROPUFU_TMP_TEMPLATE_SIGNATURE
+    struct importance_sampled_process
+        : public static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>
+    {
+        using type = ROPUFU_TMP_TYPENAME;
+        using base_type = static_discrete_process<ROPUFU_TMP_TYPENAME, typename t_sampler_type::value_type, t_container_type>;
+        using sampler_type = t_sampler_type;
+        using container_type = t_container_type;
+
+        using engine_type = typename sampler_type::engine_type;
+        using distribution_type = typename sampler_type::distribution_type;
+        using value_type = typename sampler_type::value_type;
+        using likelihood_type = typename distribution_type::expectation_type;
+
+        /** Indicates if blocks of observations are drawn with a single call to the sampler. */
+        static constexpr bool is_block_sampled = std::ranges::contiguous_range<container_type> &&
+            requires(sampler_type& sampler, engine_type& engine, std::span<value_type> values) { sampler(engine, values); };
+
+        static constexpr std::string_view name = "importance sampled iid";
+        static constexpr std::size_t parameter_dim = 2;
+
+        // ~~ Json names ~~
+        static constexpr std::string_view jstr_type = "type";
+        static constexpr std::string_view jstr_nominal_distribution = "nominal";
+        static constexpr std::string_view jstr_tilted_distribution = "tilted";
+
+#ifndef ROPUFU_NO_JSON
+        friend ropufu::noexcept_json_serializer<type>;
+#endif
+        friend std::hash<type>;
+        friend base_type;
+
+    private:
+        engine_type m_engine;
+        /** Draws from the tilted distribution. */
+        sampler_type m_sampler;
+        distribution_type m_nominal_distribution;
+        distribution_type m_tilted_distribution;
+        likelihood_type m_log_likelihood_ratio = 0;
+
+        /** Logarithm of the density (or mass) of \p dist at \p x. */
+        static likelihood_type log_density(const distribution_type& dist, const value_type& x) noexcept
+        {
+            if constexpr (requires { dist.pdf(x); }) return static_cast<likelihood_type>(std::log(dist.pdf(x)));
+            else return static_cast<likelihood_type>(std::log(dist.pmf(x)));
+        } // log_density(...)
+
+        likelihood_type log_likelihood_ratio(const value_type& x) const noexcept
+        {
+            return type::log_density(this->m_nominal_distribution, x) - type::log_density(this->m_tilted_distribution, x);
+        } // log_likelihood_ratio(...)
+
+    protected:
+        void on_clear() noexcept override
+        {
+            this->m_log_likelihood_ratio = 0;
+        } // on_clear(...)
+
+        value_type on_next() noexcept override final
+        {
+            value_type x = this->m_sampler(this->m_engine);
+            this->m_log_likelihood_ratio += this->log_likelihood_ratio(x);
+            return x;
+        } // on_next(...)
+
+        void on_next(container_type& values) noexcept override final
+        {
+            if constexpr (type::is_block_sampled)
+                this->m_sampler(this->m_engine, std::span<value_type>(std::ranges::data(values), std::ranges::size(values)));
+            else
+                for (value_type& x : values) x = this->m_sampler(this->m_engine);
+            for (const value_type& x : values) this->m_log_likelihood_ratio += this->log_likelihood_ratio(x);
+        } // on_next(...)
+
+    public:
+        importance_sampled_process() noexcept
+            : importance_sampled_process(distribution_type{}, distribution_type{})
+        {
+        } // importance_sampled_process(...)
+
+        /** Observations are drawn from \p tilted to estimate quantities under \p nominal. */
+        explicit importance_sampled_process(const distribution_type& nominal, const distribution_type& tilted) noexcept
+            : m_engine(), m_sampler(tilted), m_nominal_distribution(nominal), m_tilted_distribution(tilted)
+        {
+        } // importance_sampled_process(...)
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->m_engine.seed(sequence);
+        } // seed(...)
+
+        const distribution_type& nominal_distribution() const noexcept { return this->m_nominal_distribution; }
+
+        const distribution_type& tilted_distribution() const noexcept { return this->m_tilted_distribution; }
+
+        /** Logarithm of the likelihood ratio, nominal over tilted, of the observations generated so far. */
+        likelihood_type log_likelihood_ratio() const noexcept { return this->m_log_likelihood_ratio; }
+
+        /** Likelihood ratio, nominal over tilted, of the observations generated so far. */
+        likelihood_type likelihood_ratio() const noexcept { return std::exp(this->m_log_likelihood_ratio); }
+
+        /** Check for parameter equality. */
+        bool operator ==(const type& other) const noexcept
+        {
+            return
+                this->m_nominal_distribution == other.m_nominal_distribution &&
+                this->m_tilted_distribution == other.m_tilted_distribution;
+        } // operator ==(...)
+
+        /** Check for parameter inequality. */
+        bool operator !=(const type& other) const noexcept
+        {
+            return !this->operator ==(other);
+        } // operator !=(...)
+
+#ifndef ROPUFU_NO_JSON
+        friend void to_json(nlohmann::json& j, const type& x) noexcept
+        {
+            j = nlohmann::json{
+                {type::jstr_type, type::name},
+                {type::jstr_nominal_distribution, x.m_nominal_distribution},
+                {type::jstr_tilted_distribution, x.m_tilted_distribution}
+            };
+        } // to_json(...)
+
+        friend void from_json(const nlohmann::json& j, type& x)
+        {
+            if (!noexcept_json::try_get(j, x))
+                throw std::runtime_error("Parsing <importance_sampled_process> failed: " + j.dump());
+        } // from_json(...)
+#endif
+    }; // struct importance_sampled_process
+} // namespace ropufu::aftermath::sequential
+
+#ifndef ROPUFU_NO_JSON
+namespace ropufu
+{
+    ROPUFU_TMP_TEMPLATE_SIGNATURE
+    struct noexcept_json_serializer<ropufu::aftermath::sequential::ROPUFU_TMP_TYPENAME>
+    {
+        using result_type = ropufu::aftermath::sequential::ROPUFU_TMP_TYPENAME;
+        static bool try_get(const nlohmann::json& j, result_type& x) noexcept
+        {
+            std::string name;
+            typename result_type::distribution_type nominal {};
+            typename result_type::distribution_type tilted {};
+
+            if (!noexcept_json::required(j, result_type::jstr_type, name)) return false;
+            if (!noexcept_json::required(j, result_type::jstr_nominal_distribution, nominal)) return false;
+            if (!noexcept_json::required(j, result_type::jstr_tilted_distribution, tilted)) return false;
+
+            if (name != result_type::name) return false;
+
+            x = result_type(nominal, tilted);
+            return true;
+        } // try_get(...)
+    }; // struct noexcept_json_serializer<...>
+} // namespace ropufu
+#endif
+
+namespace std
+{
+    ROPUFU_TMP_TEMPLATE_SIGNATURE
+    struct hash<ropufu::aftermath::sequential::ROPUFU_TMP_TYPENAME>
+    {
+        using argument_type = ropufu::aftermath::sequential::ROPUFU_TMP_TYPENAME;
+        using result_type = std::size_t;
+
+        result_type operator ()(argument_type const& x) const noexcept
+        {
+            result_type result = 0;
+            constexpr result_type total_width = sizeof(result_type);
+            constexpr result_type width = total_width / (argument_type::parameter_dim);
+            constexpr result_type shift = (width == 0 ? 1 : width);
+
+            std::hash<typename argument_type::distribution_type> distribution_hasher = {};
+
+            result ^= (distribution_hasher(x.m_nominal_distribution) << ((shift * 0) % total_width));
+            result ^= (distribution_hasher(x.m_tilted_distribution) << ((shift * 1) % total_width));
+
+            return result;
+        } // operator ()(...)
+    }; // struct hash<...>
+} // namespace std
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
@@ -0,0 +1,208 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
+
+#include "../random/monte_carlo.hpp"
+
+#include <array>     // std::array
+#include <concepts>  // std::copyable, std::same_as, std::totally_ordered
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <optional>  // std::optional, std::nullopt
+#include <random>    // std::mt19937_64, std::seed_seq
+#include <stdexcept> // std::logic_error
+#include <utility>   // std::declval, std::move, std::pair
+#include <vector>    // std::vector
+
+namespace ropufu::aftermath::sequential
+{
+    /** @brief Simulation state that can be cloned (by copying) and advanced one observation at a time.
+     *  @remark \c next generates an observation and returns the updated value of the statistic
+     *    whose level crossings are tracked; \c is_terminated indicates that the trajectory has ended
+     *    without reaching the levels (e.g., the time horizon has been exhausted).
+     */
+    template <typename t_trajectory_type>
+    concept splitting_trajectory = std::copyable<t_trajectory_type> &&
+        requires(t_trajectory_type& x, const t_trajectory_type& y, std::seed_seq& sequence)
+        {
+            {x.seed(sequence)};
+            {x.next()} -> std::totally_ordered;
+            {y.is_terminated()} -> std::same_as<bool>;
+        }; // concept splitting_trajectory
+
+    namespace detail
+    {
+        /** Continues trajectories from entrance states at one level until they cross the next level or terminate. */
+        template <splitting_trajectory t_trajectory_type>
+        struct splitting_stage_simulator
+        {
+            using type = splitting_stage_simulator<t_trajectory_type>;
+            using trajectory_type = t_trajectory_type;
+            using level_type = decltype(std::declval<trajectory_type&>().next());
+            /** Trajectory, together with the value of its statistic, at the time it entered a level. */
+            using entrance_type = std::pair<level_type, trajectory_type>;
+            using engine_type = std::mt19937_64;
+
+        private:
+            const std::vector<entrance_type>* m_entrance_states = nullptr;
+            level_type m_target_level = {};
+            engine_type m_engine = {};
+            /** Trajectory being advanced; restored from entrance states by assignment to reuse its memory. */
+            std::optional<trajectory_type> m_current = std::nullopt;
+
+        public:
+            splitting_stage_simulator() noexcept = default;
+
+            splitting_stage_simulator(const std::vector<entrance_type>* entrance_states, const level_type& target_level) noexcept
+                : m_entrance_states(entrance_states), m_target_level(target_level)
+            {
+            } // splitting_stage_simulator(...)
+
+            void seed(std::seed_seq& sequence) noexcept
+            {
+                this->m_engine.seed(sequence);
+            } // seed(...)
+
+            /** Runs a clone of a randomly picked entrance state, with a fresh random stream.
+             *  @return Entrance state at the target level, if the level has been crossed.
+             */
+            std::optional<entrance_type> operator ()()
+            {
+                const std::vector<entrance_type>& starts = *(this->m_entrance_states);
+                // The modulo bias is negligible for any reasonable number of entrance states.
+                const entrance_type& start = starts[static_cast<std::size_t>(this->m_engine() % starts.size())];
+                std::uint64_t stream = this->m_engine();
+                // The statistic may have overshot several levels at once.
+                if (start.first > this->m_target_level) return start;
+
+                if (this->m_current.has_value()) *(this->m_current) = start.second;
+                else this->m_current.emplace(start.second);
+
+                trajectory_type& x = *(this->m_current);
+                std::seed_seq sequence{static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+                x.seed(sequence);
+
+                while (!x.is_terminated())
+                {
+                    level_type value = x.next();
+                    if (value > this->m_target_level) return entrance_type(value, x);
+                } // while (...)
+                return std::nullopt;
+            } // operator ()(...)
+        }; // struct splitting_stage_simulator
+
+        /** Collects entrance states at the target level. */
+        template <splitting_trajectory t_trajectory_type>
+        struct splitting_stage_aggregator
+        {
+            using type = splitting_stage_aggregator<t_trajectory_type>;
+            using trajectory_type = t_trajectory_type;
+            using entrance_type = typename splitting_stage_simulator<trajectory_type>::entrance_type;
+
+            std::vector<entrance_type> entrance_states = {};
+
+            void operator ()(const std::optional<entrance_type>& x)
+            {
+                if (x.has_value()) this->entrance_states.push_back(*x);
+            } // operator ()(...)
+
+            void operator ()(const type& other)
+            {
+                this->entrance_states.insert(this->entrance_states.end(), other.entrance_states.begin(), other.entrance_states.end());
+            } // operator ()(...)
+        }; // struct splitting_stage_aggregator
+    } // namespace detail
+
+    /** @brief Fixed-effort multilevel splitting estimator of the probability that a trajectory crosses
+     *    the highest of increasing levels before it terminates.
+     *  @remark Every stage runs the same number of trajectories, each continued from an entrance state at
+     *    the previous level, picked at random and re-seeded, until it either crosses the next level or
+     *    terminates. The fraction of crossings estimates the conditional probability of reaching the next
+     *    level, and the product of these fractions estimates the probability of crossing the highest level.
+     *  @remark Stages are run by \c random::monte_carlo on \c t_count_threads threads. Its streams are
+     *    derived from \c seed, so the estimates do not depend on the number of threads.
+     */
+    template <splitting_trajectory t_trajectory_type, std::size_t t_count_threads = 1>
+        requires (t_count_threads > 0)
+    struct multilevel_splitting
+    {
+        using type = multilevel_splitting<t_trajectory_type, t_count_threads>;
+        using trajectory_type = t_trajectory_type;
+        using simulator_type = detail::splitting_stage_simulator<trajectory_type>;
+        using aggregator_type = detail::splitting_stage_aggregator<trajectory_type>;
+        using monte_carlo_type = random::monte_carlo<simulator_type, aggregator_type, t_count_threads>;
+        using level_type = typename simulator_type::level_type;
+        using entrance_type = typename simulator_type::entrance_type;
+
+        static constexpr std::size_t count_threads = t_count_threads;
+
+    private:
+        trajectory_type m_initial_state;
+        /** Intermediate levels, in ascending order, followed by the target level. */
+        std::vector<level_type> m_levels;
+        random::monte_carlo_seed m_seed = {};
+        std::vector<double> m_conditional_probabilities = {};
+
+    public:
+        /** @brief Prepares to estimate the probability that \p initial_state, assumed to be below the first level,
+         *    eventually crosses the last of \p levels.
+         *  @exception std::logic_error \p levels is empty or not strictly increasing.
+         */
+        multilevel_splitting(const trajectory_type& initial_state, const std::vector<level_type>& levels)
+            : m_initial_state(initial_state), m_levels(levels)
+        {
+            if (levels.empty()) throw std::logic_error("Levels cannot be empty.");
+            for (std::size_t i = 1; i < levels.size(); ++i)
+                if (!(levels[i - 1] < levels[i])) throw std::logic_error("Levels must be strictly increasing.");
+        } // multilevel_splitting(...)
+
+        const trajectory_type& initial_state() const noexcept { return this->m_initial_state; }
+
+        const std::vector<level_type>& levels() const noexcept { return this->m_levels; }
+
+        /** Probabilities of crossing each level having crossed the previous one, estimated by the latest run. */
+        const std::vector<double>& conditional_probabilities() const noexcept { return this->m_conditional_probabilities; }
+
+        /** Re-seeds the streams of subsequent runs; each run continues with the streams following those of the previous run. */
+        void seed(const random::monte_carlo_seed& value) noexcept
+        {
+            this->m_seed = value;
+        } // seed(...)
+
+        /** @brief Estimates the probability of crossing the highest level with \p count_per_level trajectories per level.
+         *  @exception std::logic_error \p count_per_level is zero.
+         */
+        double estimate(std::size_t count_per_level)
+        {
+            if (count_per_level == 0) throw std::logic_error("Number of trajectories per level must be positive.");
+
+            this->m_conditional_probabilities.clear();
+            // The initial state has not crossed any level yet.
+            std::vector<entrance_type> entrance_states {entrance_type(this->m_levels.front(), this->m_initial_state)};
+            double probability = 1;
+            for (const level_type& level : this->m_levels)
+            {
+                if (entrance_states.empty())
+                {
+                    this->m_conditional_probabilities.push_back(0);
+                    continue;
+                } // if (...)
+
+                std::array<simulator_type, count_threads> simulators {};
+                simulators.fill(simulator_type(&entrance_states, level));
+                monte_carlo_type stage {simulators};
+                stage.seed(this->m_seed);
+                this->m_seed.first_block += this->m_seed.count_blocks(count_per_level);
+
+                aggregator_type result = stage.execute_sync(count_per_level);
+                double p = static_cast<double>(result.entrance_states.size()) / static_cast<double>(count_per_level);
+                this->m_conditional_probabilities.push_back(p);
+                probability *= p;
+                entrance_states = std::move(result.entrance_states);
+            } // for (...)
+            return probability;
+        } // estimate(...)
+    }; // struct multilevel_splitting
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
@@ -7,15 +7,17 @@
 #include "../simple_vector.hpp"
 #include "../vector_extender.hpp"
 #include "statistic.hpp"
+#include "threshold_search.hpp"
 
-#include <algorithm>   // std::sort
-#include <concepts>    // std::totally_ordered, std::constructible_from
+#include <algorithm>   // std::min, std::sort
+#include <concepts>    // std::totally_ordered, std::constructible_from, std::same_as
 #include <cstddef>     // std::size_t
 #include <optional>    // std::optional, std::nullopt
 #include <ranges>      // std::ranges::...
 #include <stdexcept>   // std::logic_error, std::runtime_error
 #include <string>      // std::string
 #include <string_view> // std::string_view
+#include <type_traits> // std::is_void_v
 #include <utility>     // std::pair
 
 namespace ropufu::aftermath::sequential
@@ -125,6 +127,58 @@ namespace ropufu::aftermath::sequential
             this->on_initialized(height, width);
         } // initialize(...)
 
+        /** Records the stopping \p time for every uncrossed pair of thresholds exceeded by either of the values. */
+        void record_crossings(const value_type& vertical_value, const value_type& horizontal_value, std::size_t time) noexcept
+        {
+            //         |  0    1   ...   n-1    | c (horizontal) 
+            // --------|------------------------|         
+            //     0   |           ...          |         
+            //     1   |           ...          |         
+            //    ...  |           ...          |         
+            //    m-1  |           ...          |         
+            // ----------------------------------         
+            //  b (vertical)                                  
+            //
+            
+            std::size_t m = this->m_thresholds.first.size(); // Height of the threshold matrix.
+            std::size_t n = this->m_thresholds.second.size(); // Width of the threshold matrix.
+
+            // Traverse vertical thresholds.
+            std::size_t next_uncrossed_vertical_index = this->m_first_uncrossed_index.first;
+            for (std::size_t i = this->m_first_uncrossed_index.first; i < m; ++i)
+            {
+                value_type b = this->m_thresholds.first[i];
+                if (vertical_value <= b) break; // The smallest uncrossed index still hasn't been crossed.
+                
+                next_uncrossed_vertical_index = i + 1;
+                for (std::size_t j = this->m_first_uncrossed_index.second; j < n; ++j)
+                {
+                    this->m_which_triggered(i, j) |= type::decide_vertical; // Mark threshold as crossed.
+                    this->m_when_stopped(i, j) = time; // Record the freshly stopped times.
+                    this->on_stopped(i, j);
+                } // for (...)
+            } // for (...)
+
+            // Traverse horizontal thresholds.
+            std::size_t next_uncrossed_horizontal_index = this->m_first_uncrossed_index.second;
+            for (std::size_t j = this->m_first_uncrossed_index.second; j < n; ++j)
+            {
+                value_type c = this->m_thresholds.second[j];
+                if (horizontal_value <= c) break; // The smallest uncrossed index still hasn't been crossed.
+
+                next_uncrossed_horizontal_index = j + 1;
+                for (std::size_t i = this->m_first_uncrossed_index.first; i < m; ++i)
+                {
+                    this->m_which_triggered(i, j) |= type::decide_horizontal; // Mark threshold as crossed.
+                    this->m_when_stopped(i, j) = time; // Record the freshly stopped times.
+                    this->on_stopped(i, j);
+                } // for (...)
+            } // for (...)
+
+            this->m_first_uncrossed_index.first = next_uncrossed_vertical_index;
+            this->m_first_uncrossed_index.second = next_uncrossed_horizontal_index;
+        } // record_crossings(...)
+
     public:
         parallel_stopping_time() noexcept = default;
 
@@ -194,56 +248,41 @@ namespace ropufu::aftermath::sequential
         /** Observe a single value. */
         void observe(const std::pair<value_type, value_type>& value) noexcept override
         {
-            //         |  0    1   ...   n-1    | c (horizontal) 
-            // --------|------------------------|         
-            //     0   |           ...          |         
-            //     1   |           ...          |         
-            //    ...  |           ...          |         
-            //    m-1  |           ...          |         
-            // ----------------------------------         
-            //  b (vertical)                                  
-            //
-            
-            std::size_t m = this->m_thresholds.first.size(); // Height of the threshold matrix.
-            std::size_t n = this->m_thresholds.second.size(); // Width of the threshold matrix.
-            std::size_t time = this->m_count_observations + 1;
+            this->record_crossings(value.first, value.second, this->m_count_observations + 1);
+            ++this->m_count_observations;
+        } // observe(...)
 
-            // Traverse vertical thresholds.
-            std::size_t next_uncrossed_vertical_index = this->m_first_uncrossed_index.first;
-            for (std::size_t i = this->m_first_uncrossed_index.first; i < m; ++i)
-            {
-                value_type b = this->m_thresholds.first[i];
-                if (value.first <= b) break; // The smallest uncrossed index still hasn't been crossed.
-                
-                next_uncrossed_vertical_index = i + 1;
-                for (std::size_t j = this->m_first_uncrossed_index.second; j < n; ++j)
-                {
-                    this->m_which_triggered(i, j) |= type::decide_vertical; // Mark threshold as crossed.
-                    this->m_when_stopped(i, j) = time; // Record the freshly stopped times.
-                    this->on_stopped(i, j);
-                } // for (...)
-            } // for (...)
+        /** Observe a block of values, with the vertical and horizontal statistics in separate containers.
+         *  @remark Only complete pairs are observed: if the containers differ in size, the trailing values
+         *  of the longer one are ignored.
+         *  @remark Observations are scanned for the smallest uncrossed pair of thresholds, and only the ones
+         *  crossing it are examined individually. The scan stops as soon as the rule has stopped.
+         *  @remark For stopped statistics observe one value at a time, since \c if_stopped has to be
+         *  called before each observation.
+         */
+        template <std::ranges::contiguous_range t_container_type>
+            requires
+                std::ranges::sized_range<t_container_type> &&
+                std::same_as<std::ranges::range_value_t<t_container_type>, value_type> &&
+                std::is_void_v<t_stopped_value_type>
+        void observe(const t_container_type& vertical_values, const t_container_type& horizontal_values) noexcept
+        {
+            const value_type* vertical_data = std::ranges::data(vertical_values);
+            const value_type* horizontal_data = std::ranges::data(horizontal_values);
+            std::size_t count = std::min(std::ranges::size(vertical_values), std::ranges::size(horizontal_values));
 
-            // Traverse horizontal thresholds.
-            std::size_t next_uncrossed_horizontal_index = this->m_first_uncrossed_index.second;
-            for (std::size_t j = this->m_first_uncrossed_index.second; j < n; ++j)
+            std::size_t k = 0;
+            while (this->is_running())
             {
-                value_type c = this->m_thresholds.second[j];
-                if (value.second <= c) break; // The smallest uncrossed index still hasn't been crossed.
-
-                next_uncrossed_horizontal_index = j + 1;
-                for (std::size_t i = this->m_first_uncrossed_index.first; i < m; ++i)
-                {
-                    this->m_which_triggered(i, j) |= type::decide_horizontal; // Mark threshold as crossed.
-                    this->m_when_stopped(i, j) = time; // Record the freshly stopped times.
-                    this->on_stopped(i, j);
-                } // for (...)
-            } // for (...)
-
-            this->m_first_uncrossed_index.first = next_uncrossed_vertical_index;
-            this->m_first_uncrossed_index.second = next_uncrossed_horizontal_index;
-
-            ++this->m_count_observations;
+                k = detail::first_exceeding_either(vertical_data, horizontal_data, k, count,
+                    this->m_thresholds.first[this->m_first_uncrossed_index.first],
+                    this->m_thresholds.second[this->m_first_uncrossed_index.second]);
+                if (k == count) break;
+
+                this->record_crossings(vertical_data[k], horizontal_data[k], this->m_count_observations + k + 1);
+                ++k;
+            } // while (...)
+            this->m_count_observations += count;
         } // observe(...)
 
         bool operator ==(const type& other) const noexcept
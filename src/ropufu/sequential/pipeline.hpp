@@ -0,0 +1,88 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_PIPELINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_PIPELINE_HPP_INCLUDED
+
+#include "concepts.hpp"
+
+#include <concepts> // std::convertible_to
+#include <cstddef>  // std::size_t
+#include <utility>  // std::move
+
+namespace ropufu::aftermath::sequential
+{
+    /** Chains a process, a detection statistic, and a stopping rule: process -> statistic -> stopping rule.
+     *  @remark All calls in the chain are qualified with the static type of the component, so
+     *  virtual dispatch is bypassed and the whole step can be inlined into a single loop. For processes,
+     *  this requires them to derive from \c static_discrete_process, as the built-in processes do.
+     *  Components are stored by value; their most derived type has to be known at compile time.
+     */
+    template <process t_process_type, detection_statistic t_statistic_type, stopping_rule t_stopping_rule_type>
+        requires
+            std::convertible_to<typename t_process_type::value_type, typename t_statistic_type::observation_value_type> &&
+            std::convertible_to<typename t_statistic_type::statistic_value_type, typename t_stopping_rule_type::value_type>
+    struct pipeline
+    {
+        using type = pipeline<t_process_type, t_statistic_type, t_stopping_rule_type>;
+        using process_type = t_process_type;
+        using statistic_type = t_statistic_type;
+        using stopping_rule_type = t_stopping_rule_type;
+
+    private:
+        process_type m_process;
+        statistic_type m_statistic;
+        stopping_rule_type m_stopping_rule;
+
+    public:
+        pipeline(process_type process, statistic_type statistic, stopping_rule_type stopping_rule) noexcept
+            : m_process(std::move(process)), m_statistic(std::move(statistic)), m_stopping_rule(std::move(stopping_rule))
+        {
+        } // pipeline(...)
+
+        const process_type& process() const noexcept { return this->m_process; }
+        process_type& process() noexcept { return this->m_process; }
+
+        const statistic_type& statistic() const noexcept { return this->m_statistic; }
+        statistic_type& statistic() noexcept { return this->m_statistic; }
+
+        const stopping_rule_type& stopping_rule() const noexcept { return this->m_stopping_rule; }
+        stopping_rule_type& stopping_rule() noexcept { return this->m_stopping_rule; }
+
+        /** Indicates if the stopping rule has terminated. */
+        bool is_stopped() const noexcept { return this->m_stopping_rule.t_stopping_rule_type::is_stopped(); }
+
+        /** Indicates if the stopping rule is still running. */
+        bool is_running() const noexcept { return this->m_stopping_rule.t_stopping_rule_type::is_running(); }
+
+        /** Clears the process, and resets the statistic and the stopping rule. */
+        void reset() noexcept
+        {
+            this->m_process.t_process_type::clear();
+            this->m_statistic.t_statistic_type::reset();
+            this->m_stopping_rule.t_stopping_rule_type::reset();
+        } // reset(...)
+
+        /** Generates one observation and passes it down the chain. */
+        void step() noexcept
+        {
+            this->m_stopping_rule.t_stopping_rule_type::observe(
+                this->m_statistic.t_statistic_type::observe(
+                    this->m_process.t_process_type::next()));
+        } // step(...)
+
+        /** Keeps stepping until the stopping rule terminates, or \p max_count steps have been taken.
+         *  @return Number of steps taken.
+         */
+        std::size_t run(std::size_t max_count) noexcept
+        {
+            std::size_t count = 0;
+            while (count < max_count && this->is_running())
+            {
+                this->step();
+                ++count;
+            } // while (...)
+            return count;
+        } // run(...)
+    }; // struct pipeline
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_PIPELINE_HPP_INCLUDED
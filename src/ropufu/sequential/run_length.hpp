@@ -0,0 +1,218 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
+
+#include "../probability/moment_statistic.hpp"
+#include "../random/monte_carlo.hpp"
+#include "../simple_vector.hpp"
+#include "concepts.hpp"
+#include "pipeline.hpp"
+#include "stopping_time.hpp"
+
+#include <array>       // std::array
+#include <cmath>       // std::sqrt
+#include <concepts>    // std::convertible_to, std::invocable, std::same_as
+#include <cstddef>     // std::size_t
+#include <random>      // std::seed_seq
+#include <ranges>      // std::ranges::...
+#include <stdexcept>   // std::logic_error
+#include <type_traits> // std::invoke_result_t
+#include <utility>     // std::index_sequence, std::make_index_sequence, std::move
+#include <vector>      // std::vector
+
+namespace ropufu::aftermath::sequential
+{
+    /** Sample moments of the run lengths of a stopping time, one for each of its thresholds. */
+    struct run_length_statistic
+    {
+        using type = run_length_statistic;
+        using statistic_type = ropufu::aftermath::probability::moment_statistic<double>;
+
+    private:
+        std::vector<statistic_type> m_run_lengths = {};
+
+    public:
+        run_length_statistic() noexcept = default;
+
+        /** Number of replications observed. */
+        std::size_t count() const noexcept { return this->m_run_lengths.empty() ? 0 : this->m_run_lengths.front().count(); }
+
+        /** Run length statistics, one for each threshold. */
+        const std::vector<statistic_type>& run_lengths() const noexcept { return this->m_run_lengths; }
+
+        /** Average run length for every threshold. */
+        std::vector<double> mean() const noexcept
+        {
+            std::vector<double> result {};
+            result.reserve(this->m_run_lengths.size());
+            for (const statistic_type& x : this->m_run_lengths) result.push_back(x.mean());
+            return result;
+        } // mean(...)
+
+        /** Standard error of the average run length for every threshold. */
+        std::vector<double> standard_error() const noexcept
+        {
+            std::vector<double> result {};
+            result.reserve(this->m_run_lengths.size());
+            for (const statistic_type& x : this->m_run_lengths) result.push_back(std::sqrt(x.variance() / static_cast<double>(x.count())));
+            return result;
+        } // standard_error(...)
+
+        /** Records the stopping times of a single replication. */
+        template <std::ranges::range t_container_type>
+            requires std::convertible_to<std::ranges::range_value_t<t_container_type>, double>
+        void operator ()(const t_container_type& when) noexcept
+        {
+            if (this->m_run_lengths.empty()) this->m_run_lengths.resize(std::ranges::size(when));
+            auto it = this->m_run_lengths.begin();
+            for (const auto& x : when)
+            {
+                it->observe(static_cast<double>(x));
+                ++it;
+            } // for (...)
+        } // operator ()(...)
+
+        /** Includes replications recorded by \p other. */
+        void operator ()(const type& other) noexcept
+        {
+            if (this->m_run_lengths.empty()) this->m_run_lengths.resize(other.m_run_lengths.size());
+            for (std::size_t i = 0; i < other.m_run_lengths.size(); ++i) this->m_run_lengths[i].observe(other.m_run_lengths[i]);
+        } // operator ()(...)
+    }; // struct run_length_statistic
+
+    namespace detail
+    {
+        /** Runs a single replication of process -> statistic -> stopping time, generating observations in blocks. */
+        template <process t_process_type, detection_statistic t_statistic_type>
+        struct run_length_simulator
+        {
+            using type = run_length_simulator<t_process_type, t_statistic_type>;
+            using process_type = t_process_type;
+            using statistic_type = t_statistic_type;
+            using stopping_rule_type = stopping_time<typename statistic_type::statistic_value_type>;
+            using pipeline_type = pipeline<process_type, statistic_type, stopping_rule_type>;
+
+            using value_container_type = typename process_type::container_type;
+            using statistic_container_type = ropufu::aftermath::simple_vector<typename statistic_type::statistic_value_type>;
+            using result_type = ropufu::aftermath::simple_vector<std::size_t>;
+
+        private:
+            pipeline_type m_pipeline;
+            value_container_type m_values;
+            statistic_container_type m_statistics;
+
+        public:
+            run_length_simulator() noexcept
+                : run_length_simulator(process_type{}, statistic_type{}, stopping_rule_type{}, 1)
+            {
+            } // run_length_simulator(...)
+
+            run_length_simulator(process_type process, statistic_type statistic, stopping_rule_type stopping_rule, std::size_t block_size) noexcept
+                : m_pipeline(std::move(process), std::move(statistic), std::move(stopping_rule)),
+                m_values(block_size), m_statistics(block_size)
+            {
+            } // run_length_simulator(...)
+
+            void seed(std::seed_seq& sequence) noexcept
+            {
+                this->m_pipeline.process().seed(sequence);
+            } // seed(...)
+
+            /** @return Number of observations when the stopping time terminated, for every threshold. */
+            result_type operator ()() noexcept
+            {
+                process_type& process = this->m_pipeline.process();
+                statistic_type& statistic = this->m_pipeline.statistic();
+                stopping_rule_type& stopping_rule = this->m_pipeline.stopping_rule();
+
+                this->m_pipeline.reset();
+                std::size_t block_size = std::ranges::size(this->m_values);
+                while (this->m_pipeline.is_running())
+                {
+                    // Observations generated after the rule has stopped are discarded.
+                    process.t_process_type::next(this->m_values);
+                    for (std::size_t k = 0; k < block_size; ++k)
+                        this->m_statistics[k] = statistic.t_statistic_type::observe(this->m_values[k]);
+                    stopping_rule.stopping_rule_type::observe(this->m_statistics);
+                } // while (...)
+                return stopping_rule.when();
+            } // operator ()(...)
+        }; // struct run_length_simulator
+    } // namespace detail
+
+    /** @brief Estimates the average run lengths of a stopping time for several thresholds at once.
+     *  @remark Every replication runs a fresh chain, process -> statistic -> stopping time, until
+     *    the largest threshold has been crossed. The process generates its observations in blocks,
+     *    and the statistic and the stopping time go through each block in a single loop.
+     *  @remark Replications are distributed among \c t_count_threads threads by \c random::monte_carlo,
+     *    with processes re-seeded from \c seed, so that the results do not depend on the number of threads.
+     *  @remark Unless \c seed is called, the master seed is zero and the number of replications sharing
+     *    a random stream is chosen for every run, so that a run uses at most \c random::monte_carlo_seed::max_count_blocks
+     *    streams. Replications are summarized in a bounded number of \c run_length_statistic, regardless of the size of the run.
+     */
+    template <process t_process_type, detection_statistic t_statistic_type, std::size_t t_count_threads = 1>
+        requires
+            (t_count_threads > 0) &&
+            std::convertible_to<typename t_process_type::value_type, typename t_statistic_type::observation_value_type> &&
+            requires(t_process_type& p, std::seed_seq& sequence) { p.seed(sequence); }
+    struct run_length_engine
+    {
+        using type = run_length_engine<t_process_type, t_statistic_type, t_count_threads>;
+        using process_type = t_process_type;
+        using statistic_type = t_statistic_type;
+        using simulator_type = detail::run_length_simulator<process_type, statistic_type>;
+        using stopping_rule_type = typename simulator_type::stopping_rule_type;
+        using threshold_type = typename stopping_rule_type::value_type;
+        using monte_carlo_type = random::monte_carlo<simulator_type, run_length_statistic, t_count_threads>;
+
+        static constexpr std::size_t count_threads = t_count_threads;
+        static constexpr std::size_t default_block_size = 64;
+
+    private:
+        monte_carlo_type m_monte_carlo;
+
+        template <typename t_process_factory_type, typename t_statistic_factory_type, std::size_t... t_indices>
+        static std::array<simulator_type, count_threads> make_simulators(
+            t_process_factory_type& make_process, t_statistic_factory_type& make_statistic,
+            const std::vector<threshold_type>& thresholds, std::size_t block_size, std::index_sequence<t_indices...>)
+        {
+            return {((void)t_indices, simulator_type(make_process(), make_statistic(), stopping_rule_type{thresholds}, block_size))...};
+        } // make_simulators(...)
+
+    public:
+        /** @brief Sets up \c t_count_threads chains, each with a process, a statistic, and a stopping time for \p thresholds.
+         *  @param block_size Number of observations generated at once.
+         *  @exception std::logic_error \p thresholds is empty.
+         *  @exception std::logic_error \p block_size is zero.
+         */
+        template <std::invocable t_process_factory_type, std::invocable t_statistic_factory_type>
+            requires
+                std::same_as<std::invoke_result_t<t_process_factory_type&>, process_type> &&
+                std::same_as<std::invoke_result_t<t_statistic_factory_type&>, statistic_type>
+        run_length_engine(t_process_factory_type make_process, t_statistic_factory_type make_statistic,
+            const std::vector<threshold_type>& thresholds, std::size_t block_size = type::default_block_size)
+            : m_monte_carlo(type::make_simulators(make_process, make_statistic, thresholds, block_size, std::make_index_sequence<count_threads>{}))
+        {
+            if (thresholds.empty()) throw std::logic_error("Thresholds cannot be empty.");
+            if (block_size == 0) throw std::logic_error("Block size must be positive.");
+            // Automatic block size: the number of random streams does not grow with the number of replications.
+            this->m_monte_carlo.seed(random::monte_carlo_seed{0});
+        } // run_length_engine(...)
+
+        /** Re-seeds the streams of subsequent runs; each run continues with the streams following those of the previous run.
+         *  @remark Seeds with an explicit block size should use blocks large enough to keep re-seeding rare.
+         */
+        void seed(const random::monte_carlo_seed& value)
+        {
+            this->m_monte_carlo.seed(value);
+        } // seed(...)
+
+        /** Runs \p count_replications replications and summarizes their run lengths. */
+        run_length_statistic execute(std::size_t count_replications)
+        {
+            return this->m_monte_carlo.execute_sync(count_replications);
+        } // execute(...)
+    }; // struct run_length_engine
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
@@ -6,15 +6,17 @@
 #include "../simple_vector.hpp"
 #include "../vector_extender.hpp"
 #include "statistic.hpp"
+#include "threshold_search.hpp"
 
 #include <algorithm>   // std::sort
-#include <concepts>    // std::totally_ordered, std::constructible_from
+#include <concepts>    // std::totally_ordered, std::constructible_from, std::same_as
 #include <cstddef>     // std::size_t
 #include <optional>    // std::optional, std::nullopt
 #include <ranges>      // std::ranges::...
 #include <stdexcept>   // std::logic_error, std::runtime_error
 #include <string>      // std::string
 #include <string_view> // std::string_view
+#include <type_traits> // std::is_void_v
 
 namespace ropufu::aftermath::sequential
 {
@@ -105,6 +107,22 @@ namespace ropufu::aftermath::sequential
             this->on_initialized(this->m_thresholds.size());
         } // initialize(...)
 
+        /** Records the stopping \p time for every uncrossed threshold exceeded by \p value. */
+        void record_crossings(const value_type& value, std::size_t time) noexcept
+        {
+            while (this->m_first_uncrossed_index < this->m_thresholds.size())
+            {
+                // Don't do anything if the smallest threshold has not been crossed.
+                if (value <= this->m_thresholds[this->m_first_uncrossed_index]) break;
+
+                // Smallest uncrossed threshold has been crossed. Record the stopping time...
+                this->m_when_stopped[this->m_first_uncrossed_index] = time;
+                this->on_stopped(this->m_first_uncrossed_index);
+                // ...and move on the next thresholds.
+                ++this->m_first_uncrossed_index;
+            } // while (...)
+        } // record_crossings(...)
+
     public:
         stopping_time() noexcept = default;
 
@@ -150,24 +168,38 @@ namespace ropufu::aftermath::sequential
         /** Observe a single value. */
         void observe(const value_type& value) noexcept override
         {
-            if (this->is_running())
-            {
-                std::size_t time = this->m_count_observations + 1;
-                while (this->m_first_uncrossed_index < this->m_thresholds.size())
-                {
-                    // Don't do anything if the smallest threshold has not been crossed.
-                    if (value <= this->m_thresholds[this->m_first_uncrossed_index]) break;
-
-                    // Smallest uncrossed threshold has been crossed. Record the stopping time...
-                    this->m_when_stopped[this->m_first_uncrossed_index] = time;
-                    this->on_stopped(this->m_first_uncrossed_index);
-                    // ...and move on the next thresholds.
-                    ++this->m_first_uncrossed_index;
-                } // while (...)
-            } // if (...)
+            if (this->is_running()) this->record_crossings(value, this->m_count_observations + 1);
             ++this->m_count_observations;
         } // observe(...)
 
+        /** Observe a block of values.
+         *  @remark Observations are scanned for the smallest uncrossed threshold, and only the ones
+         *  crossing it are examined individually. The scan stops as soon as the rule has stopped.
+         *  @remark For stopped statistics observe one value at a time, since \c if_stopped has to be
+         *  called before each observation.
+         */
+        template <std::ranges::contiguous_range t_container_type>
+            requires
+                std::ranges::sized_range<t_container_type> &&
+                std::same_as<std::ranges::range_value_t<t_container_type>, value_type> &&
+                std::is_void_v<t_stopped_value_type>
+        void observe(const t_container_type& values) noexcept
+        {
+            const value_type* data = std::ranges::data(values);
+            std::size_t count = std::ranges::size(values);
+
+            std::size_t k = 0;
+            while (this->is_running())
+            {
+                k = detail::first_exceeding(data, k, count, this->m_thresholds[this->m_first_uncrossed_index]);
+                if (k == count) break;
+
+                this->record_crossings(data[k], this->m_count_observations + k + 1);
+                ++k;
+            } // while (...)
+            this->m_count_observations += count;
+        } // observe(...)
+
         bool operator ==(const type& other) const noexcept
         {
             return
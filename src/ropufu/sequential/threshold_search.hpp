@@ -0,0 +1,63 @@
+
+#ifndef ROPUFU_AFTERMATH_SEQUENTIAL_THRESHOLD_SEARCH_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_SEQUENTIAL_THRESHOLD_SEARCH_HPP_INCLUDED
+
+#include <concepts> // std::totally_ordered
+#include <cstddef>  // std::size_t
+
+namespace ropufu::aftermath::sequential
+{
+    namespace detail
+    {
+        /** Number of consecutive elements checked without branching by the threshold searches. */
+        static constexpr std::size_t threshold_search_block_size = 16;
+
+        /** Finds the first index k in [from, count) such that values[k] > threshold.
+         *  @return The found index, or \p count if no element exceeds the threshold.
+         *  @remark Each block is reduced without an early exit so that the inner loop can be vectorized.
+         */
+        template <std::totally_ordered t_value_type>
+        std::size_t first_exceeding(const t_value_type* values, std::size_t from, std::size_t count,
+            const t_value_type& threshold) noexcept
+        {
+            constexpr std::size_t block_size = detail::threshold_search_block_size;
+
+            std::size_t k = from;
+            for (; k + block_size <= count; k += block_size)
+            {
+                bool is_crossed = false;
+                for (std::size_t i = 0; i < block_size; ++i) is_crossed |= (values[k + i] > threshold);
+                if (is_crossed) break;
+            } // for (...)
+
+            for (; k < count; ++k) if (values[k] > threshold) return k;
+            return count;
+        } // first_exceeding(...)
+
+        /** Finds the first index k in [from, count) such that either
+         *  first_values[k] > first_threshold or second_values[k] > second_threshold.
+         *  @return The found index, or \p count if no such index exists.
+         */
+        template <std::totally_ordered t_value_type>
+        std::size_t first_exceeding_either(
+            const t_value_type* first_values, const t_value_type* second_values, std::size_t from, std::size_t count,
+            const t_value_type& first_threshold, const t_value_type& second_threshold) noexcept
+        {
+            constexpr std::size_t block_size = detail::threshold_search_block_size;
+
+            std::size_t k = from;
+            for (; k + block_size <= count; k += block_size)
+            {
+                bool is_crossed = false;
+                for (std::size_t i = 0; i < block_size; ++i)
+                    is_crossed |= (first_values[k + i] > first_threshold) | (second_values[k + i] > second_threshold);
+                if (is_crossed) break;
+            } // for (...)
+
+            for (; k < count; ++k) if (first_values[k] > first_threshold || second_values[k] > second_threshold) return k;
+            return count;
+        } // first_exceeding_either(...)
+    } // namespace detail
+} // namespace ropufu::aftermath::sequential
+
+#endif // ROPUFU_AFTERMATH_SEQUENTIAL_THRESHOLD_SEARCH_HPP_INCLUDED
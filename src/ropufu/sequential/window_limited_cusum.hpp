@@ -7,6 +7,8 @@
 #include "../noexcept_json.hpp"
 #endif
 
+#include "../simple_vector.hpp"
+#include "../sliding_array.hpp"
 #include "timed_transform.hpp"
 #include "window_limited_statistic.hpp"
 
@@ -22,18 +24,22 @@
 #ifdef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #undef ROPUFU_TMP_TEMPLATE_SIGNATURE
 #endif
-#define ROPUFU_TMP_TYPENAME window_limited_cusum<t_observation_value_type, t_statistic_value_type, t_transform_type>
+#define ROPUFU_TMP_TYPENAME window_limited_cusum<t_observation_value_type, t_statistic_value_type, t_transform_type, t_update_mode, t_history_type>
 #define ROPUFU_TMP_TEMPLATE_SIGNATURE                                                             \
     template <std::totally_ordered t_observation_value_type,                                      \
         std::totally_ordered t_statistic_value_type,                                              \
-        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type>  \
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type,  \
+        ropufu::aftermath::sequential::window_update_mode t_update_mode,                          \
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type>               \
 
 
 namespace ropufu::aftermath::sequential
 {
     template <std::totally_ordered t_observation_value_type,
         std::totally_ordered t_statistic_value_type = t_observation_value_type,
-        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>>
+        ropufu::aftermath::sequential::timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>,
+        ropufu::aftermath::sequential::window_update_mode t_update_mode = window_update_mode::incremental,
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type = ropufu::aftermath::sliding_vector<t_observation_value_type>>
     struct window_limited_cusum;
 
 #ifndef ROPUFU_NO_JSON
@@ -43,19 +49,165 @@ namespace ropufu::aftermath::sequential
     void from_json(const nlohmann::json& j, ROPUFU_TMP_TYPENAME& x);
 #endif
 
-    /** Window-limited CUSUM chart. */
+    namespace detail
+    {
+        /** Recalculates the window-limited CUSUM statistic from the entire history. */
+        template <typename t_observation_value_type, typename t_statistic_value_type, window_update_mode t_update_mode>
+        struct window_limited_cusum_module
+        {
+            using observation_value_type = t_observation_value_type;
+            using statistic_value_type = t_statistic_value_type;
+
+        protected:
+            void on_initialized(std::size_t /*window_size*/) noexcept
+            {
+            } // on_initialized(...)
+
+            template <typename t_history_type>
+            statistic_value_type on_updated(const t_history_type& history) noexcept
+            {
+                statistic_value_type sum = 0;
+                statistic_value_type max = 0;
+                for (const observation_value_type& x : history)
+                {
+                    sum += x;
+                    if (sum > max) max = sum;
+                } // for (...)
+                return max;
+            } // on_updated(...)
+        }; // struct window_limited_cusum_module
+
+        /** Updates the window-limited CUSUM statistic in O(1) amortized time.
+         *  With S_n denoting the n-th partial sum (and S_j = 0 for j <= 0), the statistic
+         *  is S_n - min{S_j : n - L <= j <= n}. The minimum over the sliding window is
+         *  tracked by a monotone deque of candidate minimizers.
+         */
+        template <typename t_observation_value_type, typename t_statistic_value_type>
+        struct window_limited_cusum_module<t_observation_value_type, t_statistic_value_type, window_update_mode::incremental>
+        {
+            using observation_value_type = t_observation_value_type;
+            using statistic_value_type = t_statistic_value_type;
+
+            template <typename t_data_type>
+            using vector_t = ropufu::aftermath::simple_vector<t_data_type>;
+
+        private:
+            std::size_t m_window_size = 0;
+            /** Number of observations since the statistic was initialized. */
+            std::size_t m_time = 0;
+            /** Number of observations since the partial sums were last rebased. */
+            std::size_t m_count_since_rebase = 0;
+            /** Latest partial sum, relative to the most recent rebase. */
+            statistic_value_type m_partial_sum = 0;
+            /** Circular buffer of candidate minimizers: times and partial sums are strictly increasing from front to back. */
+            vector_t<std::size_t> m_candidate_times = {};
+            vector_t<statistic_value_type> m_candidate_sums = {};
+            std::size_t m_front_index = 0;
+            std::size_t m_count_candidates = 0;
+
+            std::size_t back_index() const noexcept
+            {
+                std::size_t index = this->m_front_index + this->m_count_candidates - 1;
+                return (index >= this->m_candidate_times.size()) ? (index - this->m_candidate_times.size()) : index;
+            } // back_index(...)
+
+            void push_back(std::size_t time, const statistic_value_type& partial_sum) noexcept
+            {
+                ++this->m_count_candidates;
+                std::size_t index = this->back_index();
+                this->m_candidate_times[index] = time;
+                this->m_candidate_sums[index] = partial_sum;
+            } // push_back(...)
+
+            void pop_front() noexcept
+            {
+                ++this->m_front_index;
+                if (this->m_front_index == this->m_candidate_times.size()) this->m_front_index = 0;
+                --this->m_count_candidates;
+            } // pop_front(...)
+
+            /** Shifts all stored partial sums so that the latest one becomes zero. Prevents loss of precision (or overflow) in long runs. */
+            void rebase() noexcept
+            {
+                for (statistic_value_type& x : this->m_candidate_sums) x -= this->m_partial_sum;
+                this->m_partial_sum = 0;
+                this->m_count_since_rebase = 0;
+            } // rebase(...)
+
+            /** Adds the newest observation and returns the updated statistic. */
+            statistic_value_type update(const observation_value_type& newest) noexcept
+            {
+                ++this->m_time;
+                this->m_partial_sum += newest;
+
+                // Discard partial sums that have left the window.
+                while (this->m_candidate_times[this->m_front_index] + this->m_window_size < this->m_time) this->pop_front();
+                // Discard partial sums that can no longer be minimizers.
+                while (this->m_count_candidates != 0 && this->m_candidate_sums[this->back_index()] >= this->m_partial_sum) --this->m_count_candidates;
+                this->push_back(this->m_time, this->m_partial_sum);
+
+                statistic_value_type result = this->m_partial_sum - this->m_candidate_sums[this->m_front_index];
+                if (++this->m_count_since_rebase >= this->m_window_size) this->rebase();
+                return result;
+            } // update(...)
+
+        protected:
+            void on_initialized(std::size_t window_size) noexcept
+            {
+                this->m_window_size = window_size;
+                this->m_time = 0;
+                this->m_count_since_rebase = 0;
+                this->m_partial_sum = 0;
+                // At most (L + 1) partial sums, S_{n - L}, ..., S_n, can be in the window at any given time.
+                if (this->m_candidate_times.size() != window_size + 1)
+                {
+                    this->m_candidate_times = vector_t<std::size_t>(window_size + 1);
+                    this->m_candidate_sums = vector_t<statistic_value_type>(window_size + 1);
+                } // if (...)
+                this->m_front_index = 0;
+                this->m_count_candidates = 0;
+                // Partial sums S_j, j <= 0, are all zero, and are represented by S_0.
+                this->push_back(0, 0);
+            } // on_initialized(...)
+
+            template <typename t_history_type>
+            statistic_value_type on_updated(const t_history_type& history) noexcept
+            {
+                return this->update(history[0]);
+            } // on_updated(...)
+
+            /** Updates the statistic with a block of observations; only the newest observations are needed.
+             *  @param buffer Contains the L observations preceding the block followed by the \p count observations in the block, oldest first.
+             */
+            template <typename t_statistic_container_type>
+            void on_block_updated(const observation_value_type* buffer, std::size_t count, t_statistic_container_type& statistics) noexcept
+            {
+                const observation_value_type* block = buffer + this->m_window_size;
+                for (std::size_t k = 0; k < count; ++k) statistics[k] = this->update(block[k]);
+            } // on_block_updated(...)
+        }; // struct window_limited_cusum_module<...>
+    } // namespace detail
+
+    /** Window-limited CUSUM chart.
+     *  @remark With \c window_update_mode::reference the statistic is recalculated
+     *  from the entire window with every observation, and may be used for validation.
+     */
     ROPUFU_TMP_TEMPLATE_SIGNATURE
     struct window_limited_cusum
-        : public window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type>
+        : public static_window_limited_statistic<ROPUFU_TMP_TYPENAME, t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>,
+        public detail::window_limited_cusum_module<t_observation_value_type, t_statistic_value_type, t_update_mode>
     {
         using type = ROPUFU_TMP_TYPENAME;
-        using base_type = window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type>;
+        using base_type = static_window_limited_statistic<ROPUFU_TMP_TYPENAME, t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>;
+        using module_type = detail::window_limited_cusum_module<t_observation_value_type, t_statistic_value_type, t_update_mode>;
         using observation_value_type = t_observation_value_type;
         using statistic_value_type = t_statistic_value_type;
         using transform_type = t_transform_type;
 
         using history_type = typename base_type::history_type;
 
+        static constexpr window_update_mode update_mode = t_update_mode;
+
         /** Names the statistic type. */
         constexpr std::string_view name() const noexcept override
         {
@@ -66,8 +218,19 @@ namespace ropufu::aftermath::sequential
         friend ropufu::noexcept_json_serializer<type>;
 #endif
         friend std::hash<type>;
+        friend base_type;
 
-        using base_type::base_type;
+        window_limited_cusum() noexcept
+            : base_type()
+        {
+            this->on_initialized(this->window_size());
+        } // window_limited_cusum(...)
+
+        explicit window_limited_cusum(std::size_t window_size, const transform_type& transform = {})
+            : base_type(window_size, transform)
+        {
+            this->on_initialized(this->window_size());
+        } // window_limited_cusum(...)
 
         bool operator ==(const type& other) const noexcept
         {
@@ -96,20 +259,14 @@ namespace ropufu::aftermath::sequential
         /** Occurs when the most recent observation has been added to the history.
          *  @param history Contains most recent observations (newest first, oldest last).
          */
-        statistic_value_type on_history_updated(const history_type& history) noexcept override
+        statistic_value_type on_history_updated(const history_type& history) noexcept override final
         {
-            statistic_value_type sum = 0;
-            statistic_value_type max = 0;
-            for (const observation_value_type& x : history)
-            {
-                sum += x;
-                if (sum > max) max = sum;
-            } // for (...)
-            return max;
+            return this->on_updated(history);
         } // on_history_updated(...)
 
-        constexpr void on_reset() noexcept override
+        void on_reset() noexcept override final
         {
+            this->on_initialized(this->window_size());
         } // on_reset(...)
     }; // struct window_limited_cusum
 } // namespace ropufu::aftermath::sequential
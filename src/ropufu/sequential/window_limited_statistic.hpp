@@ -6,6 +6,7 @@
 #include <nlohmann/json.hpp>
 #endif
 
+#include "../simple_vector.hpp"
 #include "../sliding_array.hpp"
 #include "statistic.hpp"
 #include "timed_transform.hpp"
@@ -22,19 +23,33 @@
 
 namespace ropufu::aftermath::sequential
 {
-    /** Implements base functionality for window-limited statistics. */
+    /** Determines how window-limited statistics are updated with every new observation. */
+    enum struct window_update_mode : char
+    {
+        /** Recalculate the statistic from the entire window: O(L) per observation. */
+        reference = 0,
+        /** Maintain auxiliary running quantities: O(1) amortized per observation. */
+        incremental = 1
+    }; // enum struct window_update_mode
+
+    /** Implements base functionality for window-limited statistics.
+     *  @param t_history_type Keeps the most recent L observations, e.g., \c sliding_vector (O(L) copying per
+     *  observation) or \c mirrored_sliding_vector (O(1) per observation).
+     */
     template <std::totally_ordered t_observation_value_type,
         std::totally_ordered t_statistic_value_type,
-        timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>>
+        timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>,
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type = ropufu::aftermath::sliding_vector<t_observation_value_type>>
     struct window_limited_statistic
         : public statistic<t_observation_value_type, t_statistic_value_type>
     {
-        using type = window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type>;
+        using type = window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>;
         using observation_value_type = t_observation_value_type;
         using statistic_value_type = t_statistic_value_type;
         using transform_type = t_transform_type;
         
-        using history_type = ropufu::aftermath::sliding_vector<observation_value_type>;
+        using history_type = t_history_type;
+        using buffer_type = ropufu::aftermath::simple_vector<observation_value_type>;
 
         /** Names the statistic type. */
         constexpr virtual std::string_view name() const noexcept = 0;
@@ -49,6 +64,8 @@ namespace ropufu::aftermath::sequential
         history_type m_history;
         // Transform for first L - 1 observations.
         transform_type m_transform;
+        /** Scratch space for block observations: the history followed by the block, oldest first. */
+        buffer_type m_block_buffer = {};
         
     protected:
         /** @brief Validates the structure and returns an error message, if any. */
@@ -65,6 +82,81 @@ namespace ropufu::aftermath::sequential
             if (message.has_value()) throw std::logic_error(message.value());
         } // validate(...)
 
+        /** Observe a single value, with \p history_updated taking the place of \c on_history_updated. */
+        template <typename t_history_updated_type>
+        statistic_value_type observe_with(const observation_value_type& value, t_history_updated_type&& history_updated) noexcept
+        {
+            this->m_history.displace_front(value);
+            statistic_value_type statistic = history_updated(this->m_history);
+
+            std::size_t time = this->m_count_observations;
+            if (time < this->m_history.size()) statistic = this->m_transform(time, statistic);
+            ++this->m_count_observations;
+            return statistic;
+        } // observe_with(...)
+
+        /** Observe a block of values one at a time, with \p history_updated taking the place of \c on_history_updated. */
+        template <typename t_observation_container_type, typename t_statistic_container_type, typename t_history_updated_type>
+        void observe_with(const t_observation_container_type& values, t_statistic_container_type& statistics, t_history_updated_type&& history_updated) noexcept
+        {
+            statistics = t_statistic_container_type(values.size());
+            std::size_t time = this->m_count_observations;
+            std::size_t count = values.size();
+            std::size_t offset = this->transformed_count(count);
+
+            for (std::size_t k = 0; k < offset; ++k)
+            {
+                this->m_history.displace_front(values[k]);
+                statistics[k] = history_updated(this->m_history);
+                statistics[k] = this->m_transform(time + k, statistics[k]);
+            } // for (...)
+
+            for (std::size_t k = offset; k < count; ++k)
+            {
+                this->m_history.displace_front(values[k]);
+                statistics[k] = history_updated(this->m_history);
+            } // for (...)
+
+            this->m_count_observations += count;
+        } // observe_with(...)
+
+        /** @brief Observe a block of values at once.
+         *  @param block_updated Called with a contiguous buffer holding the history followed by the block, oldest first;
+         *    the number of observations in the block; and the statistics to be filled in.
+         */
+        template <typename t_observation_container_type, typename t_statistic_container_type, typename t_block_updated_type>
+        void observe_block_with(const t_observation_container_type& values, t_statistic_container_type& statistics, t_block_updated_type&& block_updated) noexcept
+        {
+            statistics = t_statistic_container_type(values.size());
+            std::size_t time = this->m_count_observations;
+            std::size_t count = values.size();
+            std::size_t offset = this->transformed_count(count);
+
+            std::size_t window_size = this->m_history.size();
+            if (this->m_block_buffer.size() < window_size + count) this->m_block_buffer = buffer_type(window_size + count);
+
+            // Oldest observations first.
+            observation_value_type* buffer = this->m_block_buffer.data();
+            for (std::size_t i = 0; i < window_size; ++i) buffer[i] = this->m_history[window_size - 1 - i];
+            for (std::size_t k = 0; k < count; ++k) buffer[window_size + k] = values[k];
+
+            block_updated(static_cast<const observation_value_type*>(buffer), count, statistics);
+            for (std::size_t i = 0; i < window_size; ++i) this->m_history.set(i, buffer[window_size + count - 1 - i]);
+
+            for (std::size_t k = 0; k < offset; ++k) statistics[k] = this->m_transform(time + k, statistics[k]);
+            this->m_count_observations += count;
+        } // observe_block_with(...)
+
+    private:
+        /** Number of the first \p count upcoming observations that fall within the first L - 1, and are to be transformed. */
+        std::size_t transformed_count(std::size_t count) const noexcept
+        {
+            std::size_t time = this->m_count_observations;
+            std::size_t offset = 0;
+            if (time < this->m_history.size()) [[unlikely]] offset = this->m_history.size() - time;
+            return (offset > count) ? count : offset;
+        } // transformed_count(...)
+
     public:
         window_limited_statistic() noexcept : window_limited_statistic(1, transform_type{})
         {
@@ -89,16 +181,11 @@ namespace ropufu::aftermath::sequential
         /** Observe a single value. */
         statistic_value_type observe(const observation_value_type& value) noexcept override
         {
-            this->m_history.displace_front(value);
-            statistic_value_type statistic = this->on_history_updated(this->m_history);
-
-            std::size_t time = this->m_count_observations;
-            if (time < this->m_history.size()) statistic = this->m_transform(time, statistic);
-            ++this->m_count_observations;
-            return statistic;
+            return this->observe_with(value,
+                [this] (const history_type& history) { return this->on_history_updated(history); });
         } // observe(...)
 
-        /** Observe a block of values. */
+        /** Observe a block of values, calling \c on_history_updated for every observation. */
         template <std::ranges::random_access_range t_observation_container_type,
             std::ranges::random_access_range t_statistic_container_type>
             requires
@@ -108,26 +195,8 @@ namespace ropufu::aftermath::sequential
                 std::same_as<std::ranges::range_value_t<t_statistic_container_type>, statistic_value_type>
         void observe(const t_observation_container_type& values, t_statistic_container_type& statistics) noexcept
         {
-            statistics = t_statistic_container_type(values.size());
-            std::size_t time = this->m_count_observations;
-
-            std::size_t offset = 0;
-            if (time < this->m_history.size()) [[unlikely]] offset = this->m_history.size() - time;
-
-            for (std::size_t k = 0; k < offset; ++k)
-            {
-                this->m_history.displace_front(values[k]);
-                statistics[k] = this->on_history_updated(this->m_history);
-                statistics[k] = this->m_transform(time + k, statistics[k]);
-            } // for (...)
-
-            for (std::size_t k = offset; k < values.size(); ++k)
-            {
-                this->m_history.displace_front(values[k]);
-                statistics[k] = this->on_history_updated(this->m_history);
-            } // for (...)
-
-            this->m_count_observations += values.size();
+            this->observe_with(values, statistics,
+                [this] (const history_type& history) { return this->on_history_updated(history); });
         } // observe(...)
         
     protected:
@@ -172,6 +241,8 @@ namespace ropufu::aftermath::sequential
             if (!noexcept_json::required(j, type::jstr_window_size, window_size)) return false;
 
             this->m_history = history_type(window_size);
+            this->m_count_observations = 0;
+            this->on_reset();
             if (statistic_name != this->name()) return false;
             if (this->error_message().has_value()) return false;
             
@@ -185,6 +256,90 @@ namespace ropufu::aftermath::sequential
         } // serialize_core(...)
 #endif
     }; // struct window_limited_statistic
+
+    /** @brief Window-limited statistic whose most derived type, \c t_derived_type, is known at compile time (CRTP).
+     *  @remark Calls to \c on_history_updated bypass virtual dispatch and invoke the overrider in \c t_derived_type
+     *    directly. Single observations made through a reference to \c window_limited_statistic still reach this
+     *    implementation, since \c observe is virtual; block observations made that way call \c on_history_updated
+     *    through the vtable. The derived type is expected to be a friend of this class, and to mark its overrider \c final.
+     */
+    template <typename t_derived_type,
+        std::totally_ordered t_observation_value_type,
+        std::totally_ordered t_statistic_value_type,
+        timed_transform<t_statistic_value_type> t_transform_type = identity_transform<t_statistic_value_type>,
+        ropufu::aftermath::sliding_window<t_observation_value_type> t_history_type = ropufu::aftermath::sliding_vector<t_observation_value_type>>
+    struct static_window_limited_statistic
+        : public window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>
+    {
+        using type = static_window_limited_statistic<t_derived_type, t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>;
+        using base_type = window_limited_statistic<t_observation_value_type, t_statistic_value_type, t_transform_type, t_history_type>;
+        using derived_type = t_derived_type;
+        using observation_value_type = t_observation_value_type;
+        using statistic_value_type = t_statistic_value_type;
+        using transform_type = t_transform_type;
+        using history_type = t_history_type;
+
+        /** Indicates if \c t_derived_type can process an entire block of observations laid out in a contiguous buffer. */
+        template <typename t_statistic_container_type>
+        static constexpr bool has_block_update =
+            requires(derived_type& x, const observation_value_type* buffer, std::size_t count, t_statistic_container_type& statistics)
+            {
+                x.derived_type::on_block_updated(buffer, count, statistics);
+            };
+
+    protected:
+        /** Calls \c on_history_updated, bypassing virtual dispatch. */
+        statistic_value_type history_updated(const history_type& history) noexcept
+        {
+            return static_cast<derived_type*>(this)->derived_type::on_history_updated(history);
+        } // history_updated(...)
+
+    public:
+        static_window_limited_statistic() noexcept
+            : base_type()
+        {
+        } // static_window_limited_statistic(...)
+
+        explicit static_window_limited_statistic(std::size_t window_size, const transform_type& transform = {})
+            : base_type(window_size, transform)
+        {
+        } // static_window_limited_statistic(...)
+
+        /** Observe a single value. */
+        statistic_value_type observe(const observation_value_type& value) noexcept override
+        {
+            return this->observe_with(value,
+                [this] (const history_type& history) { return this->history_updated(history); });
+        } // observe(...)
+
+        /** @brief Observe a block of values.
+         *  @remark If \c t_derived_type provides \c on_block_updated, the history followed by the block is laid out
+         *    in a single contiguous buffer, and the entire block is processed at once. Otherwise the history
+         *    is shifted and \c on_history_updated is called for every observation.
+         */
+        template <std::ranges::random_access_range t_observation_container_type,
+            std::ranges::random_access_range t_statistic_container_type>
+            requires
+                std::ranges::sized_range<t_observation_container_type> &&
+                std::ranges::sized_range<t_statistic_container_type> &&
+                std::same_as<std::ranges::range_value_t<t_observation_container_type>, observation_value_type> &&
+                std::same_as<std::ranges::range_value_t<t_statistic_container_type>, statistic_value_type>
+        void observe(const t_observation_container_type& values, t_statistic_container_type& statistics) noexcept
+        {
+            if constexpr (type::template has_block_update<t_statistic_container_type>)
+            {
+                this->observe_block_with(values, statistics,
+                    [this] (const observation_value_type* buffer, std::size_t count, t_statistic_container_type& block_statistics) {
+                        static_cast<derived_type*>(this)->derived_type::on_block_updated(buffer, count, block_statistics);
+                    });
+            } // if constexpr (...)
+            else
+            {
+                this->observe_with(values, statistics,
+                    [this] (const history_type& history) { return this->history_updated(history); });
+            } // else (...)
+        } // observe(...)
+    }; // struct static_window_limited_statistic
 } // namespace ropufu::aftermath::sequential
 
 #endif // ROPUFU_AFTERMATH_SEQUENTIAL_WINDOW_LIMITED_STATISTIC_HPP_INCLUDED
@@ -5,13 +5,35 @@
 #include "simple_vector.hpp"
 
 #include <array>    // std::array
-#include <concepts> // std::default_initializable
+#include <concepts> // std::constructible_from, std::copyable, std::default_initializable, std::same_as
 #include <cstddef>  // std::size_t
 #include <cstring>  // std::memcpy
 #include <utility>  // std::swap, std::move
 
 namespace ropufu::aftermath
 {
+    /** @brief Window of the most recent observations, stored contiguously.
+     *  @remark Elements are modified either by displacing old observations, or through \c set.
+     */
+    template <typename t_window_type, typename t_value_type>
+    concept sliding_window =
+        std::copyable<t_window_type> &&
+        std::default_initializable<t_window_type> &&
+        std::constructible_from<t_window_type, std::size_t> &&
+        requires(t_window_type& x, const t_window_type& y, std::size_t index, const t_value_type& value)
+        {
+            {y.size()} -> std::same_as<std::size_t>;
+            {y.data()} -> std::same_as<const t_value_type*>;
+            {y.begin()} -> std::same_as<const t_value_type*>;
+            {y.end()} -> std::same_as<const t_value_type*>;
+            {y[index]} -> std::same_as<const t_value_type&>;
+            {y == y} -> std::same_as<bool>;
+            {x.wipe()};
+            {x.set(index, value)};
+            {x.displace_back(value)};
+            {x.displace_front(value)};
+        }; // concept sliding_window
+
     /** An auxiliary structure to discard old observations. */
     template <std::default_initializable t_value_type,
         typename t_allocator_type = typename simple_vector<t_value_type>::allocator_type>
@@ -112,6 +134,20 @@ namespace ropufu::aftermath
             if (other.m_passive_ptr < other.m_active_ptr) std::swap(this->m_passive_ptr, this->m_active_ptr);
         } // sliding_vector(...)
 
+        /** @brief Overwrites the vector with values from \p other.
+         *  @remark No memory is allocated if both vectors have the same size, so that a copy
+         *    may serve as a cheap snapshot of the window to be restored later.
+         */
+        type& operator =(const type& other) noexcept
+        {
+            if (this == &other) return *this; // Do nothing if this is self-assignment.
+
+            this->m_storage = other.m_storage;
+            this->initialize(other.m_count);
+            if (other.m_passive_ptr < other.m_active_ptr) std::swap(this->m_passive_ptr, this->m_active_ptr);
+            return *this;
+        } // operator =(...)
+
         std::size_t size() const noexcept { return this->m_count; }
         bool empty() const noexcept { return this->m_count == 0; }
 
@@ -142,6 +178,12 @@ namespace ropufu::aftermath
             return *(this->m_active_ptr + index);
         } // operator [](...)
 
+        /** Overwrites the element at \p index. */
+        void set(std::size_t index, const value_type& value) noexcept
+        {
+            *(this->m_active_ptr + index) = value;
+        } // set(...)
+
         /** Adds another element to the back of the sequence, discarding the first element. */
         void displace_back(const value_type& value) noexcept
         {
@@ -182,6 +224,109 @@ namespace ropufu::aftermath
         } // operator !=(...)
     }; // struct sliding_vector
 
+    /** @brief An auxiliary structure to discard old observations in O(1) time.
+     *  @remark Elements are kept in a ring buffer of twice the window size, with every element stored at
+     *    two positions, i and (i + n). Adding an element writes these two positions and moves the start of
+     *    the window, so the n most recent elements always occupy a contiguous block of memory.
+     */
+    template <std::default_initializable t_value_type,
+        typename t_allocator_type = typename simple_vector<t_value_type>::allocator_type>
+    struct mirrored_sliding_vector
+    {
+        using type = mirrored_sliding_vector<t_value_type, t_allocator_type>;
+        using value_type = t_value_type;
+        using allocator_type = t_allocator_type;
+
+        using container_type = simple_vector<t_value_type, t_allocator_type>;
+
+    private:
+        /** Stores two copies of the window one after another, each rotated by \c m_head. */
+        container_type m_storage;
+        /** Position of the first element of the window in the storage. */
+        std::size_t m_head = 0;
+        std::size_t m_count;
+
+    public:
+        mirrored_sliding_vector() noexcept
+            : mirrored_sliding_vector(0)
+        {
+        } // mirrored_sliding_vector(...)
+
+        mirrored_sliding_vector(std::size_t size) noexcept
+            : m_storage(size + size), m_count(size)
+        {
+        } // mirrored_sliding_vector(...)
+
+        std::size_t size() const noexcept { return this->m_count; }
+        bool empty() const noexcept { return this->m_count == 0; }
+
+        void wipe() noexcept
+        {
+            this->m_storage.wipe();
+            this->m_head = 0;
+        } // wipe(...)
+
+        const value_type* data() const noexcept { return this->m_storage.data() + this->m_head; }
+        value_type* data() noexcept { return this->m_storage.data() + this->m_head; }
+
+        const value_type* cbegin() const noexcept { return this->data(); }
+        const value_type* cend() const noexcept { return this->data() + this->m_count; }
+
+        const value_type* begin() const noexcept { return this->data(); }
+        const value_type* end() const noexcept { return this->data() + this->m_count; }
+
+        /** @remark Elements should be changed through \c set, or displaced, to keep both copies in sync. */
+        const value_type& operator [](std::size_t index) const
+        {
+            return *(this->data() + index);
+        } // operator [](...)
+
+        /** Overwrites the element at \p index. */
+        void set(std::size_t index, const value_type& value) noexcept
+        {
+            std::size_t position = this->m_head + index;
+            if (position >= this->m_count) position -= this->m_count;
+            this->m_storage[position] = value;
+            this->m_storage[position + this->m_count] = value;
+        } // set(...)
+
+        /** Adds another element to the back of the sequence, discarding the first element. */
+        void displace_back(const value_type& value) noexcept
+        {
+            if (this->m_count == 0) return;
+            // The first element and the position right after the last element are copies of each other.
+            this->m_storage[this->m_head] = value;
+            this->m_storage[this->m_head + this->m_count] = value;
+            if (++this->m_head == this->m_count) this->m_head = 0;
+        } // displace_back(...)
+
+        /** Adds another element to the front of the sequence, discarding the last element. */
+        void displace_front(const value_type& value) noexcept
+        {
+            if (this->m_count == 0) return;
+            this->m_head = (this->m_head == 0) ? (this->m_count - 1) : (this->m_head - 1);
+            this->m_storage[this->m_head] = value;
+            this->m_storage[this->m_head + this->m_count] = value;
+        } // displace_front(...)
+
+        bool operator ==(const type& other) const noexcept
+        {
+            if (this->m_count != other.m_count) return false;
+            auto it = this->cbegin();
+            for (const value_type& x : other)
+            {
+                if (x != (*it)) return false;
+                ++it;
+            } // for (...)
+            return true;
+        } // operator ==(...)
+
+        bool operator !=(const type& other) const noexcept
+        {
+            return !this->operator ==(other);
+        } // operator !=(...)
+    }; // struct mirrored_sliding_vector
+
     /** An auxiliary structure to discard old observations. */
     template <std::default_initializable t_value_type, std::size_t t_size>
     struct sliding_array : public std::array<t_value_type, t_size>
@@ -7,6 +7,7 @@
 #include "../ropufu/noexcept_json.hpp"
 #endif
 #include "../ropufu/metadata.hpp"
+#include "../ropufu/random/philox_engine.hpp"
 
 #include <array>   // std::array
 #include <chrono>  // std::chrono::steady_clock, std::chrono::system_clock
@@ -23,11 +24,16 @@
 
 namespace ropufu
 {
+    ROPUFU_MAKE_METADATA(std::ranlux24_base, "::std::ranlux24_base", false)
     ROPUFU_MAKE_METADATA(std::ranlux24, "::std::ranlux24", false)
+    ROPUFU_MAKE_METADATA(std::ranlux48_base, "::std::ranlux48_base", false)
     ROPUFU_MAKE_METADATA(std::ranlux48, "::std::ranlux48", false)
     ROPUFU_MAKE_METADATA(std::minstd_rand, "::std::minstd_rand", false)
+    ROPUFU_MAKE_METADATA(std::minstd_rand0, "::std::minstd_rand0", false)
+    ROPUFU_MAKE_METADATA(std::knuth_b, "::std::knuth_b", false)
     ROPUFU_MAKE_METADATA(std::mt19937, "::std::mt19937", false)
     ROPUFU_MAKE_METADATA(std::mt19937_64, "::std::mt19937_64", false)
+    ROPUFU_MAKE_METADATA(ropufu::aftermath::random::philox_engine, "::ropufu::aftermath::random::philox_engine", false)
 } // namespace ropufu
 
 namespace ropufu::tests
@@ -72,6 +78,19 @@ namespace ropufu::tests
         return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(toc - tic).count()) / 1'000.00;
     } // benchmark(...)
     
+    /** Draws \p sample_size numbers from \p engine and returns the number of seconds it took. */
+    template <typename t_engine_type>
+    double engine_timing(std::size_t sample_size, t_engine_type& engine) noexcept
+    {
+        ropufu::tests::seed(engine);
+        return ropufu::tests::benchmark(
+            [&engine, sample_size] () {
+                typename t_engine_type::result_type sum = 0;
+                for (std::size_t k = 0; k < sample_size; ++k) sum ^= engine();
+                if (sum == 0) ++ropufu::tests::g_aux_test_counter; // Keep the loop from being optimized away.
+            });
+    } // engine_timing(...)
+
     /** Samples from a distribution \p sample_size times and returns the number of seconds it took. */
     template <typename t_engine_type, typename t_sampler_type>
     double sample_timing(std::size_t sample_size, t_engine_type& engine, t_sampler_type& sampler) noexcept
@@ -29,7 +29,10 @@
 
 #include "random/bernoulli_sampler.hpp"
 #include "random/binomial_sampler.hpp"
+#include "random/buffered_engine.hpp"
 #include "random/monte_carlo.hpp"
+#include "random/philox_engine.hpp"
+#include "random/standard_exponential_sampler_512.hpp"
 #include "random/standard_normal_sampler_512.hpp"
 #include "random/uniform_int_sampler.hpp"
 
@@ -41,12 +44,17 @@
 #include "ropufu/sliding_array.hpp"
 
 #include "sequential/auto_regressive_process.hpp"
+#include "sequential/batched_statistic.hpp"
 #include "sequential/cusum.hpp"
 #include "sequential/finite_moving_average.hpp"
 #include "sequential/iid_persistent_process.hpp"
 #include "sequential/iid_process.hpp"
 #include "sequential/iid_transient_process.hpp"
+#include "sequential/importance_sampled_process.hpp"
+#include "sequential/multilevel_splitting.hpp"
 #include "sequential/parallel_stopping_time.hpp"
+#include "sequential/pipeline.hpp"
+#include "sequential/run_length.hpp"
 #include "sequential/stopping_time.hpp"
 #include "sequential/window_limited_cusum.hpp"
 
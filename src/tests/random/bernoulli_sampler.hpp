@@ -11,10 +11,15 @@
 #include "../../ropufu/random/bernoulli_sampler.hpp"
 
 #include <array>      // std::array
+#include <bit>        // std::popcount
 #include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
 #include <limits>     // std::numeric_limits
+#include <memory>     // std::unique_ptr, std::make_unique
 #include <random>     // std::mt19937, ...
+#include <span>       // std::span
 #include <stdexcept>  // std::logic_error
+#include <vector>     // std::vector
 
 #define ROPUFU_AFTERMATH_TESTS_RANDOM_BERNOULLI_SAMPLER_ALL_TYPES                                 \
     ropufu::tests::engine_distribution_tuple<std::ranlux24, bool, float, float>,       \
@@ -73,6 +78,62 @@ TEST_CASE_TEMPLATE("testing (randomized) bernoulli_sampler", tested_t, ROPUFU_AF
     CHECK(estimate_p == doctest::Approx(0.1729).epsilon(0.05));
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing (randomized) bernoulli_sampler batch", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BERNOULLI_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using sampler_type = ropufu::aftermath::random::bernoulli_sampler<engine_type, probability_type, expectation_type>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using value_type = typename sampler_type::value_type;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    sampler_type sampler_always_0 { distribution_type{0} };
+    sampler_type sampler_always_1 { distribution_type{1} };
+    sampler_type sampler_generic { distribution_type{static_cast<probability_type>(0.1729)} };
+
+    // The sizes are deliberately not multiples of the internal batch size.
+    std::size_t count_reps = 10'001;
+    std::unique_ptr<value_type[]> values = std::make_unique<value_type[]>(count_reps);
+    std::span<value_type> span {values.get(), count_reps};
+    std::vector<std::uint64_t> words(157);
+
+    std::size_t count_always_0 = 0;
+    std::size_t count_always_1 = 0;
+    std::size_t count_generic = 0;
+    sampler_always_0(engine, span);
+    for (value_type x : span) if (x) ++count_always_0;
+    sampler_always_1(engine, span);
+    for (value_type x : span) if (x) ++count_always_1;
+    sampler_generic(engine, span);
+    for (value_type x : span) if (x) ++count_generic;
+    double estimate_p = static_cast<double>(count_generic) / static_cast<double>(count_reps);
+
+    REQUIRE(count_always_0 == 0);
+    REQUIRE(count_always_1 == count_reps);
+    CHECK(estimate_p == doctest::Approx(0.1729).epsilon(0.05));
+
+    std::size_t count_bits_always_0 = 0;
+    std::size_t count_bits_always_1 = 0;
+    std::size_t count_bits_generic = 0;
+    sampler_always_0.sample_bits(engine, words);
+    for (std::uint64_t w : words) count_bits_always_0 += static_cast<std::size_t>(std::popcount(w));
+    sampler_always_1.sample_bits(engine, words);
+    for (std::uint64_t w : words) count_bits_always_1 += static_cast<std::size_t>(std::popcount(w));
+    sampler_generic.sample_bits(engine, words);
+    for (std::uint64_t w : words) count_bits_generic += static_cast<std::size_t>(std::popcount(w));
+    double estimate_bits_p = static_cast<double>(count_bits_generic) / static_cast<double>(64 * words.size());
+
+    REQUIRE(count_bits_always_0 == 0);
+    REQUIRE(count_bits_always_1 == 64 * words.size());
+    CHECK(estimate_bits_p == doctest::Approx(0.1729).epsilon(0.05));
+} // TEST_CASE_TEMPLATE(...)
+
 TEST_CASE_TEMPLATE("testing (trivial) bernoulli_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BERNOULLI_SAMPLER_ALL_TYPES)
 {
     using engine_type = typename tested_t::engine_type;
@@ -153,6 +214,39 @@ TEST_SUITE("Benchmarks")
 
         BENCH_COMPARE_TIMING(engine_name, "aftermath", "builtin", seconds_fast, seconds_slow);
     } // TEST_CASE_TEMPLATE(...)
+    TEST_CASE_TEMPLATE("bernoulli_sampler batch vs single", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BERNOULLI_SAMPLER_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using sampler_type = ropufu::aftermath::random::bernoulli_sampler<engine_type, probability_type, expectation_type>;
+        using distribution_type = typename sampler_type::distribution_type;
+        using value_type = typename sampler_type::value_type;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        sampler_type sampler { distribution_type{static_cast<probability_type>(0.1729)} };
+
+        constexpr std::size_t block_size = 1'000;
+        constexpr std::size_t count_blocks = 10'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(10);
+        std::unique_ptr<value_type[]> values = std::make_unique<value_type[]>(block_size);
+        std::span<value_type> span {values.get(), block_size};
+
+        ropufu::tests::seed(engine);
+        double seconds_fast = ropufu::tests::benchmark([&engine, &sampler, span] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) sampler(engine, span);
+        });
+        ropufu::tests::seed(engine);
+        double seconds_slow = ropufu::tests::benchmark([&engine, &sampler, span] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) for (value_type& x : span) x = sampler(engine);
+        });
+
+        BENCH_COMPARE_TIMING(engine_name, "batch", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
 } // TEST_SUITE(..)
 
 #endif // ROPUFU_AFTERMATH_TESTS_RANDOM_BERNOULLI_SAMPLER_HPP_INCLUDED
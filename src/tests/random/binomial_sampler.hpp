@@ -11,13 +11,18 @@
 #include "../../ropufu/random/alias_sampler.hpp"
 #include "../../ropufu/random/alias_multisampler.hpp"
 #include "../../ropufu/random/binomial_sampler.hpp"
+#include "../../ropufu/random/btpe_binomial_sampler.hpp"
+#include "../../ropufu/random/inversion_sampler.hpp"
+#include "../../ropufu/random/packed_alias_sampler.hpp"
 
 #include <array>      // std::array
+#include <cmath>      // std::sqrt
 #include <cstddef>    // std::size_t
 #include <cstdint>    // std::int_fast32_t
 #include <limits>     // std::numeric_limits
 #include <random>     // std::mt19937, ...
 #include <stdexcept>  // std::logic_error
+#include <vector>     // std::vector
 
 #define ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES                                              \
     ropufu::tests::engine_distribution_tuple<std::ranlux24, int, float, float>,                    \
@@ -140,6 +145,245 @@ TEST_CASE_TEMPLATE("testing (randomized) binomial alias_multisampler", tested_t,
     CHECK(estimate_p == doctest::Approx(0.1729).epsilon(0.05));
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing (randomized) btpe_binomial_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using sampler_type = ropufu::aftermath::random::btpe_binomial_sampler<engine_type, value_type, probability_type, expectation_type>;
+    using distribution_type = typename sampler_type::distribution_type;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    // Small counts go through inversion, large counts through BTPE; 0.8271 exercises the flip.
+    for (value_type count_trials : {value_type(64), value_type(4096)})
+    {
+        for (probability_type p : {static_cast<probability_type>(0.1729), static_cast<probability_type>(0.8271)})
+        {
+            CAPTURE(count_trials);
+            CAPTURE(p);
+            distribution_type distribution_always_0 { count_trials, 0 };
+            distribution_type distribution_always_1 { count_trials, 1 };
+            distribution_type distribution_generic { count_trials, p };
+
+            sampler_type sampler_always_0 { distribution_always_0 };
+            sampler_type sampler_always_1 { distribution_always_1 };
+            sampler_type sampler_generic { distribution_generic };
+
+            std::size_t count_reps = 10'000;
+
+            std::size_t count_always_0 = 0;
+            std::size_t count_always_1 = 0;
+            double sum = 0;
+            double sum_of_squares = 0;
+            bool is_in_range = true;
+            for (std::size_t k = 0; k < count_reps; ++k)
+            {
+                count_always_0 += (sampler_always_0(engine));
+                count_always_1 += (sampler_always_1(engine));
+                value_type x = sampler_generic(engine);
+                if (x < 0 || x > count_trials) is_in_range = false;
+                sum += static_cast<double>(x);
+                sum_of_squares += static_cast<double>(x) * static_cast<double>(x);
+            } // for (...)
+            double mean = sum / count_reps;
+            double variance = sum_of_squares / count_reps - mean * mean;
+            double expected_mean = static_cast<double>(distribution_generic.expected_value());
+            double expected_variance = static_cast<double>(distribution_generic.variance());
+
+            REQUIRE(count_always_0 == 0);
+            REQUIRE(count_always_1 == count_trials * count_reps);
+            REQUIRE(is_in_range);
+            CHECK(mean == doctest::Approx(expected_mean).epsilon(5 * std::sqrt(expected_variance / count_reps) / expected_mean));
+            CHECK(variance == doctest::Approx(expected_variance).epsilon(0.1));
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing (randomized) binomial alias_multisampler updates", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using distribution_type = ropufu::aftermath::probability::binomial_distribution<value_type, probability_type, expectation_type>;
+    using alias_multisampler_type = ropufu::aftermath::random::alias_multisampler<engine_type, distribution_type>;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    value_type count_trials = 64;
+    distribution_type distribution_always_0 { count_trials, 0 };
+    distribution_type distribution_always_1 { count_trials, 1 };
+    distribution_type distribution_generic { count_trials, static_cast<probability_type>(0.1729) };
+
+    alias_multisampler_type multisampler {};
+    multisampler.push_back(distribution_always_0);
+    multisampler.push_back(distribution_generic);
+    multisampler.push_back(distribution_always_1);
+
+    std::size_t count_reps = 1'000;
+    auto estimate_p = [&] (std::size_t distribution_index, value_type n) {
+        std::size_t count = 0;
+        for (std::size_t k = 0; k < count_reps; ++k) count += (multisampler(distribution_index, engine));
+        return static_cast<double>(count) / static_cast<double>(n * count_reps);
+    };
+
+    // Re-weight the middle distribution in place, many times over to trigger compaction.
+    for (std::size_t k = 0; k < 16; ++k)
+    {
+        value_type n = count_trials + static_cast<value_type>(k % 2 == 0 ? k : 0);
+        multisampler.replace(1, distribution_type{ n, static_cast<probability_type>(0.5) });
+        CHECK(estimate_p(1, n) == doctest::Approx(0.5).epsilon(0.05));
+    } // for (...)
+    CHECK(estimate_p(0, count_trials) == 0);
+    CHECK(estimate_p(2, count_trials) == 1);
+
+    // Erase the first distribution; the others keep their indices.
+    multisampler.erase(0);
+    CHECK_FALSE(multisampler.contains(0));
+    CHECK(multisampler.contains(1));
+    CHECK(multisampler.size() == 3);
+    multisampler.compact();
+    CHECK(estimate_p(2, count_trials) == 1);
+
+    // Restore it with a wider support.
+    multisampler.replace(0, distribution_type{ 2 * count_trials, static_cast<probability_type>(0.1729) });
+    CHECK(multisampler.contains(0));
+    CHECK(estimate_p(0, 2 * count_trials) == doctest::Approx(0.1729).epsilon(0.05));
+    CHECK(estimate_p(2, count_trials) == 1);
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing (randomized) binomial packed_alias_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using distribution_type = ropufu::aftermath::probability::binomial_distribution<value_type, probability_type, expectation_type>;
+    using alias_sampler_type = ropufu::aftermath::random::alias_sampler<engine_type, distribution_type>;
+    using packed_sampler_type = ropufu::aftermath::random::packed_alias_sampler<engine_type, distribution_type>;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    value_type count_trials = 64;
+    distribution_type distribution_always_0 { count_trials, 0 };
+    distribution_type distribution_always_1 { count_trials, 1 };
+    distribution_type distribution_generic { count_trials, static_cast<probability_type>(0.1729) };
+
+    alias_sampler_type alias_generic { distribution_generic };
+    packed_sampler_type sampler_always_0 { distribution_always_0 };
+    packed_sampler_type sampler_always_1 { distribution_always_1 };
+    packed_sampler_type sampler_generic { distribution_generic };
+
+    REQUIRE(sampler_generic.slots().size() == alias_generic.support().size());
+    for (std::size_t i = 0; i < alias_generic.support().size(); ++i)
+    {
+        CHECK(sampler_generic.slots()[i].support == alias_generic.support()[i]);
+        CHECK(sampler_generic.slots()[i].alias == alias_generic.alias()[i]);
+    } // for (...)
+
+    std::size_t count_reps = 1'000;
+
+    std::size_t count_always_0 = 0;
+    std::size_t count_always_1 = 0;
+    std::size_t count_generic = 0;
+    for (std::size_t k = 0; k < count_reps; ++k)
+    {
+        count_always_0 += (sampler_always_0(engine));
+        count_always_1 += (sampler_always_1(engine));
+        count_generic += (sampler_generic(engine));
+    } // for (...) 
+    double estimate_p = static_cast<double>(count_generic) / static_cast<double>(count_trials * count_reps);
+
+    REQUIRE(count_always_0 == 0);
+    REQUIRE(count_always_1 == count_trials * count_reps);
+    CHECK(estimate_p == doctest::Approx(0.1729).epsilon(0.05));
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing binomial inversion_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using distribution_type = ropufu::aftermath::probability::binomial_distribution<value_type, probability_type, expectation_type>;
+    using sampler_type = ropufu::aftermath::random::inversion_sampler<engine_type, distribution_type>;
+    using uniform_type = typename sampler_type::uniform_type;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    value_type count_trials = 64;
+    distribution_type distribution_always_0 { count_trials, 0 };
+    distribution_type distribution_always_1 { count_trials, 1 };
+    distribution_type distribution_generic { count_trials, static_cast<probability_type>(0.1729) };
+
+    sampler_type sampler_always_0 { distribution_always_0 };
+    sampler_type sampler_always_1 { distribution_always_1 };
+    sampler_type sampler_generic { distribution_generic };
+
+    // The share of engine outputs mapped to each support element should match the p.m.f.
+    constexpr long double full_scale = static_cast<long double>(sampler_type::engine_diameter) + 1;
+    const long double tolerance = 4 * (count_trials + 1) * std::numeric_limits<probability_type>::epsilon() + 2 / full_scale;
+    const std::vector<uniform_type>& cutoff = sampler_generic.cutoff();
+    for (std::size_t i = 0; i < cutoff.size(); ++i)
+    {
+        CAPTURE(i);
+        uniform_type previous = (i == 0) ? 0 : cutoff[i - 1];
+        long double mass = (i + 1 == cutoff.size()) ?
+            (full_scale - static_cast<long double>(previous)) / full_scale :
+            static_cast<long double>(cutoff[i] - previous) / full_scale;
+        long double expected_mass = static_cast<long double>(distribution_generic.pmf(sampler_generic.support()[i]));
+        long double error = (mass > expected_mass) ? (mass - expected_mass) : (expected_mass - mass);
+        CHECK(error <= tolerance);
+    } // for (...)
+
+    // The mapping from engine outputs to values is monotone.
+    constexpr std::size_t count_steps = 10'000;
+    value_type previous_value = sampler_generic.quantile(engine_type::min());
+    CHECK(previous_value == 0);
+    for (std::size_t k = 1; k <= count_steps; ++k)
+    {
+        uniform_type u = engine_type::min() + static_cast<uniform_type>(static_cast<long double>(sampler_type::engine_diameter) * k / count_steps);
+        value_type x = sampler_generic.quantile(u);
+        REQUIRE(x >= previous_value);
+        previous_value = x;
+    } // for (...)
+
+    std::size_t count_reps = 1'000;
+
+    std::size_t count_always_0 = 0;
+    std::size_t count_always_1 = 0;
+    std::size_t count_generic = 0;
+    for (std::size_t k = 0; k < count_reps; ++k)
+    {
+        count_always_0 += (sampler_always_0(engine));
+        count_always_1 += (sampler_always_1(engine));
+        count_generic += (sampler_generic(engine));
+    } // for (...) 
+    double estimate_p = static_cast<double>(count_generic) / static_cast<double>(count_trials * count_reps);
+
+    REQUIRE(count_always_0 == 0);
+    REQUIRE(count_always_1 == count_trials * count_reps);
+    CHECK(estimate_p == doctest::Approx(0.1729).epsilon(0.05));
+} // TEST_CASE_TEMPLATE(...)
+
 TEST_SUITE("Benchmarks")
 {
     TEST_CASE_TEMPLATE("binomial_sampler vs STL", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
@@ -203,6 +447,122 @@ TEST_SUITE("Benchmarks")
 
         BENCH_COMPARE_TIMING(engine_name, "alias", "accurate", seconds_fast, seconds_slow);
     } // TEST_CASE_TEMPLATE(...)
+    TEST_CASE_TEMPLATE("binomial_sampler inversion vs alias", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using value_type = typename tested_t::value_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using distribution_type = ropufu::aftermath::probability::binomial_distribution<value_type, probability_type, expectation_type>;
+        using inversion_sampler_type = ropufu::aftermath::random::inversion_sampler<engine_type, distribution_type>;
+        using alias_sampler_type = ropufu::aftermath::random::alias_sampler<engine_type, distribution_type>;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+
+        value_type count_trials = 64;
+        distribution_type distribution { count_trials, static_cast<probability_type>(0.1729) };
+        inversion_sampler_type inversion_sampler { distribution };
+        alias_sampler_type alias_sampler { distribution };
+
+        constexpr std::size_t sample_size = 1'000'000 / ropufu::tests::template engine_slowdown_factor<engine_type>();
+
+        double seconds_fast = ropufu::tests::sample_timing(sample_size, engine, inversion_sampler);
+        double seconds_slow = ropufu::tests::sample_timing(sample_size, engine, alias_sampler);
+
+        BENCH_COMPARE_TIMING(engine_name, "inversion", "alias", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
+
+    TEST_CASE_TEMPLATE("btpe_binomial_sampler vs accurate vs STL", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using value_type = typename tested_t::value_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using btpe_sampler_type = ropufu::aftermath::random::btpe_binomial_sampler<engine_type, value_type, probability_type, expectation_type>;
+        using accurate_sampler_type = ropufu::aftermath::random::binomial_sampler<engine_type, value_type, probability_type, expectation_type>;
+        using distribution_type = typename btpe_sampler_type::distribution_type;
+        using builtin_sampler_type = typename distribution_type::std_type;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+
+        value_type count_trials = 4096;
+        distribution_type distribution { count_trials, static_cast<probability_type>(0.1729) };
+        btpe_sampler_type btpe_sampler { distribution };
+        accurate_sampler_type accurate_sampler { distribution };
+        builtin_sampler_type builtin_sampler = distribution.to_std();
+
+        constexpr std::size_t sample_size = 10'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(10);
+
+        double seconds_btpe = ropufu::tests::sample_timing(sample_size, engine, btpe_sampler);
+        double seconds_accurate = ropufu::tests::sample_timing(sample_size, engine, accurate_sampler);
+        double seconds_builtin = ropufu::tests::sample_timing(sample_size, engine, builtin_sampler);
+
+        BENCH_COMPARE_TIMING(engine_name, "btpe", "accurate", seconds_btpe, seconds_accurate);
+        BENCH_COMPARE_TIMING(engine_name, "btpe", "builtin", seconds_btpe, seconds_builtin);
+    } // TEST_CASE_TEMPLATE(...)
+    TEST_CASE_TEMPLATE("binomial alias_multisampler vs alias_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using value_type = typename tested_t::value_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using distribution_type = ropufu::aftermath::probability::binomial_distribution<value_type, probability_type, expectation_type>;
+        using alias_sampler_type = ropufu::aftermath::random::alias_sampler<engine_type, distribution_type>;
+        using alias_multisampler_type = ropufu::aftermath::random::alias_multisampler<engine_type, distribution_type>;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+
+        // Many small distributions sampled in a tight loop.
+        constexpr std::size_t count_distributions = 4'096;
+        value_type count_trials = 16;
+        std::vector<alias_sampler_type> samplers {};
+        alias_multisampler_type multisampler {};
+        samplers.reserve(count_distributions);
+        multisampler.reserve(count_distributions, count_distributions * (count_trials + 1));
+        for (std::size_t i = 0; i < count_distributions; ++i)
+        {
+            probability_type p = static_cast<probability_type>(i + 1) / static_cast<probability_type>(count_distributions + 2);
+            distribution_type distribution { count_trials, p };
+            samplers.emplace_back(distribution);
+            multisampler.push_back(distribution);
+        } // for (...)
+
+        constexpr std::size_t count_sweeps = 1'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(10);
+
+        ropufu::tests::seed(engine);
+        double seconds_fast = ropufu::tests::benchmark([&engine, &multisampler] () {
+            std::size_t sum = 0;
+            for (std::size_t k = 0; k < count_sweeps; ++k)
+                for (std::size_t i = 0; i < count_distributions; ++i) sum += static_cast<std::size_t>(multisampler(i, engine));
+            CHECK_NE(sum, 0); // Keep the loop from being optimized away.
+        });
+        ropufu::tests::seed(engine);
+        double seconds_slow = ropufu::tests::benchmark([&engine, &samplers] () {
+            std::size_t sum = 0;
+            for (std::size_t k = 0; k < count_sweeps; ++k)
+                for (std::size_t i = 0; i < count_distributions; ++i) sum += static_cast<std::size_t>(samplers[i](engine));
+            CHECK_NE(sum, 0); // Keep the loop from being optimized away.
+        });
+
+        BENCH_COMPARE_TIMING(engine_name, "multisampler", "separate", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
 } // TEST_SUITE(..)
 
 #endif // ROPUFU_AFTERMATH_TESTS_RANDOM_BINOMIAL_SAMPLER_HPP_INCLUDED
@@ -0,0 +1,104 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
+
+#include "../core.hpp"
+#include "../../ropufu/random/buffered_engine.hpp"
+#include "../../ropufu/random/philox_engine.hpp"
+#include "../../ropufu/random/standard_normal_sampler_512.hpp"
+
+#include <cstddef> // std::size_t
+#include <random>  // std::mt19937, ...
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#define ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_ALL_TYPES \
+    std::ranlux24_base,                                         \
+    std::ranlux24,                                              \
+    std::minstd_rand,                                           \
+    std::minstd_rand0,                                          \
+    std::knuth_b,                                               \
+    std::mt19937,                                               \
+    std::ranlux48_base,                                         \
+    std::ranlux48,                                              \
+    std::mt19937_64,                                            \
+    ropufu::aftermath::random::philox_engine                    \
+
+
+TEST_CASE_TEMPLATE("testing buffered_engine sequence", engine_type, ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_ALL_TYPES)
+{
+    using buffered_type = ropufu::aftermath::random::buffered_engine<engine_type, 64>;
+    using result_type = typename engine_type::result_type;
+
+    std::string engine_name {ropufu::qualified_name<engine_type>()};
+    CAPTURE(engine_name);
+
+    CHECK_EQ(buffered_type::min(), engine_type::min());
+    CHECK_EQ(buffered_type::max(), engine_type::max());
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    buffered_type buffered {engine};
+
+    // Single draws, bulk draws shorter and longer than the buffer, and skips.
+    for (std::size_t count : {0, 1, 5, 63, 64, 65, 200, 1001})
+    {
+        CAPTURE(count);
+        for (std::size_t i = 0; i < count; ++i) REQUIRE_EQ(buffered(), engine());
+
+        std::vector<result_type> values(count);
+        buffered.generate(values);
+        for (std::size_t i = 0; i < count; ++i) REQUIRE_EQ(values[i], engine());
+
+        buffered.discard(count);
+        engine.discard(count);
+        CHECK_EQ(buffered(), engine());
+    } // for (...)
+
+    buffered_type copy = buffered;
+    CHECK(copy == buffered);
+    copy();
+    CHECK_FALSE(copy == buffered);
+
+    buffered.seed(1729);
+    engine.seed(1729);
+    CHECK_EQ(buffered.count_buffered(), 0);
+    CHECK_EQ(buffered(), engine());
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE_TEMPLATE("buffered_engine vs unbuffered", engine_type, ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_ALL_TYPES)
+    {
+        using buffered_type = ropufu::aftermath::random::buffered_engine<engine_type>;
+        using sampler_type = ropufu::aftermath::random::standard_normal_sampler_512<engine_type, double, double, double>;
+        using buffered_sampler_type = ropufu::aftermath::random::standard_normal_sampler_512<buffered_type, double, double, double>;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {ropufu::qualified_name<engine_type>()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        buffered_type buffered {};
+
+        constexpr std::size_t sample_size = 10'000'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(5);
+
+        // Raw engine outputs.
+        double seconds_fast = ropufu::tests::engine_timing(sample_size, buffered);
+        double seconds_slow = ropufu::tests::engine_timing(sample_size, engine);
+        BENCH_COMPARE_TIMING(engine_name, "buffered", "unbuffered", seconds_fast, seconds_slow);
+
+        // Engine feeding a sampler.
+        sampler_type sampler {};
+        buffered_sampler_type buffered_sampler {};
+        seconds_fast = ropufu::tests::sample_timing(sample_size, buffered, buffered_sampler);
+        seconds_slow = ropufu::tests::sample_timing(sample_size, engine, sampler);
+        BENCH_COMPARE_TIMING(engine_name, "buffered normal", "unbuffered normal", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
+} // TEST_SUITE(..)
+
+#endif // ROPUFU_AFTERMATH_TESTS_RANDOM_BUFFERED_ENGINE_HPP_INCLUDED
@@ -5,12 +5,23 @@
 #include <doctest/doctest.h>
 
 #include "../core.hpp"
+#include "../../ropufu/random/antithetic_engine.hpp"
 #include "../../ropufu/random/monte_carlo.hpp"
+#include "../../ropufu/random/monte_carlo_pairing.hpp"
+#include "../../ropufu/random/monte_carlo_pool.hpp"
+#include "../../ropufu/probability/moment_statistic.hpp"
 
-#include <chrono>    // std::chrono::milliseconds
+#include <algorithm> // std::adjacent_find, std::sort
+#include <array>     // std::array
+#include <atomic>    // std::atomic
+#include <chrono>    // std::chrono::milliseconds, std::chrono::steady_clock, std::chrono::duration
+#include <cmath>     // std::sqrt
 #include <cstddef>   // std::size_t
+#include <random>    // std::mt19937_64, std::seed_seq, std::uniform_real_distribution
 #include <stdexcept> // std::logic_error
 #include <thread>    // std::this_thread::sleep_for
+#include <utility>   // std::pair
+#include <vector>    // std::vector
 
 namespace ropufu::tests
 {
@@ -37,6 +48,234 @@ namespace ropufu::tests
             sum += other.sum;
         } // operator ()(...)
     }; // struct simple_aggregator
+
+    /** Simulator taking \c delay_milliseconds per simulation, and reporting its own \c id. */
+    struct uneven_simulator
+    {
+        std::size_t id = 0;
+        std::size_t delay_milliseconds = 0;
+
+        std::size_t operator ()() const
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(this->delay_milliseconds));
+            return this->id;
+        } // operator ()(...)
+    }; // struct uneven_simulator
+
+    /** Counts how many simulations have been run by each of the two simulators. */
+    struct uneven_aggregator
+    {
+        std::array<std::size_t, 2> counts = {};
+
+        void operator()(std::size_t id)
+        {
+            ++this->counts[id];
+        } // operator ()(...)
+
+        void operator()(const uneven_aggregator& other)
+        {
+            for (std::size_t i = 0; i < this->counts.size(); ++i) this->counts[i] += other.counts[i];
+        } // operator ()(...)
+    }; // struct uneven_aggregator
+
+    /** Simulator drawing a uniform random number from its own engine. */
+    struct seedable_simulator
+    {
+        std::mt19937_64 engine = {};
+        std::uniform_real_distribution<double> distribution = {};
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->engine.seed(sequence);
+        } // seed(...)
+
+        double operator ()()
+        {
+            return this->distribution(this->engine);
+        } // operator ()(...)
+    }; // struct seedable_simulator
+
+    /** Sums the observations; floating point addition makes the result sensitive to the order of aggregation. */
+    struct real_aggregator
+    {
+        std::size_t count = 0;
+        double sum = 0;
+
+        void operator()(double value)
+        {
+            ++this->count;
+            this->sum += value;
+        } // operator ()(...)
+
+        void operator()(const real_aggregator& other)
+        {
+            this->count += other.count;
+            this->sum += other.sum;
+        } // operator ()(...)
+    }; // struct real_aggregator
+
+    /** Simulator drawing a uniform random number from its own engine, counting how many times it has been re-seeded. */
+    struct counted_seedable_simulator
+    {
+        static inline std::atomic<std::size_t> count_seeded = 0;
+
+        std::mt19937_64 engine = {};
+        std::uniform_real_distribution<double> distribution = {};
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            ++counted_seedable_simulator::count_seeded;
+            this->engine.seed(sequence);
+        } // seed(...)
+
+        double operator ()()
+        {
+            return this->distribution(this->engine);
+        } // operator ()(...)
+    }; // struct counted_seedable_simulator
+
+    /** Sums the observations, keeping track of the largest number of aggregators alive at the same time. */
+    struct counted_aggregator
+    {
+        static inline std::atomic<std::size_t> count_alive = 0;
+        static inline std::atomic<std::size_t> max_count_alive = 0;
+
+        real_aggregator value = {};
+
+        counted_aggregator() noexcept
+        {
+            counted_aggregator::on_created();
+        } // counted_aggregator(...)
+
+        counted_aggregator(const counted_aggregator& other) noexcept
+            : value(other.value)
+        {
+            counted_aggregator::on_created();
+        } // counted_aggregator(...)
+
+        counted_aggregator& operator =(const counted_aggregator& other) noexcept = default;
+
+        ~counted_aggregator() noexcept
+        {
+            --counted_aggregator::count_alive;
+        } // ~counted_aggregator(...)
+
+        static void on_created() noexcept
+        {
+            std::size_t count = ++counted_aggregator::count_alive;
+            std::size_t max_count = counted_aggregator::max_count_alive.load();
+            while (count > max_count && !counted_aggregator::max_count_alive.compare_exchange_weak(max_count, count)) { }
+        } // on_created(...)
+
+        void operator()(double value)
+        {
+            this->value(value);
+        } // operator ()(...)
+
+        void operator()(const counted_aggregator& other)
+        {
+            this->value(other.value);
+        } // operator ()(...)
+    }; // struct counted_aggregator
+
+    /** Keeps track of the mean and variance of the observations. */
+    struct moment_aggregator
+    {
+        ropufu::aftermath::probability::moment_statistic<double> statistic = {};
+
+        void operator()(double value)
+        {
+            this->statistic.observe(value);
+        } // operator ()(...)
+
+        void operator()(const moment_aggregator& other)
+        {
+            this->statistic.observe(other.statistic);
+        } // operator ()(...)
+
+        double standard_error() const noexcept
+        {
+            return std::sqrt(this->statistic.variance() / static_cast<double>(this->statistic.count()));
+        } // standard_error(...)
+    }; // struct moment_aggregator
+
+    /** Simulator drawing a uniform random number from its own engine, shifted by \c shift. */
+    struct shifted_simulator
+    {
+        std::mt19937_64 engine = {};
+        std::uniform_real_distribution<double> distribution = {};
+        double shift = 0.25;
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->engine.seed(sequence);
+        } // seed(...)
+
+        double operator ()()
+        {
+            return this->distribution(this->engine) + this->shift;
+        } // operator ()(...)
+    }; // struct shifted_simulator
+
+    /** Simulator drawing a uniform random number from an engine that can be switched to the antithetic stream. */
+    struct antithetic_simulator
+    {
+        ropufu::aftermath::random::antithetic_engine<std::mt19937_64> engine = {};
+        std::uniform_real_distribution<double> distribution = {};
+
+        void seed(std::seed_seq& sequence) noexcept
+        {
+            this->engine.seed(sequence);
+        } // seed(...)
+
+        void set_antithetic(bool value) noexcept
+        {
+            this->engine.set_antithetic(value);
+        } // set_antithetic(...)
+
+        double operator ()()
+        {
+            return this->distribution(this->engine);
+        } // operator ()(...)
+    }; // struct antithetic_simulator
+
+    /** Keeps track of the mean and variance of either observation in a pair, as well as their difference and average. */
+    struct paired_moment_aggregator
+    {
+        ropufu::aftermath::probability::moment_statistic<double> first = {};
+        ropufu::aftermath::probability::moment_statistic<double> difference = {};
+        ropufu::aftermath::probability::moment_statistic<double> average = {};
+
+        void operator()(const std::pair<double, double>& value)
+        {
+            this->first.observe(value.first);
+            this->difference.observe(value.first - value.second);
+            this->average.observe((value.first + value.second) / 2);
+        } // operator ()(...)
+
+        void operator()(const paired_moment_aggregator& other)
+        {
+            this->first.observe(other.first);
+            this->difference.observe(other.difference);
+            this->average.observe(other.average);
+        } // operator ()(...)
+    }; // struct paired_moment_aggregator
+
+    /** Collects the outcomes of paired simulations. */
+    struct paired_outcome_aggregator
+    {
+        std::vector<std::pair<double, double>> outcomes = {};
+
+        void operator()(const std::pair<double, double>& value)
+        {
+            this->outcomes.push_back(value);
+        } // operator ()(...)
+
+        void operator()(const paired_outcome_aggregator& other)
+        {
+            this->outcomes.insert(this->outcomes.end(), other.outcomes.begin(), other.outcomes.end());
+        } // operator ()(...)
+    }; // struct paired_outcome_aggregator
 } // namespace ropufu::tests
 
 TEST_CASE("testing monte_carlo sync")
@@ -89,4 +328,341 @@ TEST_CASE("testing monte_carlo async")
     CHECK_EQ(task3.wait().sum, 8);
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE("testing monte_carlo schedules")
+{
+    using simulator_type = ropufu::tests::simple_simulator;
+    using aggregator_type = ropufu::tests::simple_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+
+    using mc_type_static = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 3, schedule_type::static_split>;
+    using mc_type_guided = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 3, schedule_type::guided>;
+
+    mc_type_static mc_static{};
+    mc_type_guided mc_guided{};
+
+    for (std::size_t count_simulations : {0, 1, 2, 3, 4, 7})
+    {
+        CAPTURE(count_simulations);
+        CHECK_EQ(mc_static.execute_sync(count_simulations).sum, count_simulations);
+        CHECK_EQ(mc_guided.execute_sync(count_simulations).sum, count_simulations);
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo guided load balance")
+{
+    using simulator_type = ropufu::tests::uneven_simulator;
+    using aggregator_type = ropufu::tests::uneven_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+
+    using mc_type_static = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2, schedule_type::static_split>;
+    using mc_type_guided = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2, schedule_type::guided>;
+
+    constexpr std::size_t count_simulations = 40;
+    std::array<simulator_type, 2> simulators = {simulator_type{0, 10}, simulator_type{1, 1}};
+
+    mc_type_static mc_static{simulators};
+    mc_type_guided mc_guided{simulators};
+
+    aggregator_type static_result = mc_static.execute_sync(count_simulations);
+    aggregator_type guided_result = mc_guided.execute_sync(count_simulations);
+
+    CHECK_EQ(static_result.counts[0], count_simulations / 2);
+    CHECK_EQ(static_result.counts[1], count_simulations / 2);
+    CHECK_EQ(guided_result.counts[0] + guided_result.counts[1], count_simulations);
+    CHECK_LT(guided_result.counts[0], guided_result.counts[1]); // The slow simulator should have run fewer simulations.
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo_pool")
+{
+    using simulator_type = ropufu::tests::simple_simulator;
+    using aggregator_type = ropufu::tests::simple_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+
+    using pool_type_static = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type, schedule_type::static_split>;
+    using pool_type_guided = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type, schedule_type::guided>;
+
+    CHECK_THROWS_AS(pool_type_guided(0), std::logic_error);
+    CHECK_THROWS_AS(pool_type_guided(std::vector<simulator_type>{}), std::logic_error);
+
+    pool_type_static pool_static{3};
+    pool_type_guided pool_guided{3};
+    CHECK_EQ(pool_static.count_threads(), 3);
+    CHECK_EQ(pool_guided.count_threads(), 3);
+
+    // Workers are reused across runs.
+    for (std::size_t count_simulations : {0, 1, 2, 3, 4, 7})
+    {
+        CAPTURE(count_simulations);
+        CHECK_EQ(pool_static.execute_sync(count_simulations).sum, count_simulations);
+        CHECK_EQ(pool_guided.execute_sync(count_simulations).sum, count_simulations);
+    } // for (...)
+
+    auto& task_interrupted = pool_guided.begin_async(100);
+    CHECK_THROWS_AS(pool_guided.execute_sync(1), std::logic_error);
+    task_interrupted.request_stop();
+    CHECK_NE(task_interrupted.wait().sum, 100);
+    CHECK_EQ(pool_guided.execute_sync(8).sum, 8);
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo reproducible seeding")
+{
+    using simulator_type = ropufu::tests::seedable_simulator;
+    using aggregator_type = ropufu::tests::real_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+    using seed_type = ropufu::aftermath::random::monte_carlo_seed;
+
+    using mc_type_1 = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 1>;
+    using mc_type_static = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 3, schedule_type::static_split>;
+    using mc_type_guided = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 4, schedule_type::guided>;
+    using pool_type_static = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type, schedule_type::static_split>;
+    using pool_type_guided = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type, schedule_type::guided>;
+
+    CHECK_THROWS_AS(seed_type(1729, 0), std::logic_error);
+
+    seed_type seed{1729, 16};
+    mc_type_1 mc1{};
+    mc_type_static mc_static{};
+    mc_type_guided mc_guided{};
+    pool_type_static pool_static{2};
+    pool_type_guided pool_guided{5};
+
+    mc1.seed(seed);
+    mc_static.seed(seed);
+    mc_guided.seed(seed);
+    pool_static.seed(seed);
+    pool_guided.seed(seed);
+
+    for (std::size_t count_simulations : {1000, 1, 0, 37})
+    {
+        CAPTURE(count_simulations);
+        aggregator_type expected = mc1.execute_sync(count_simulations);
+        REQUIRE_EQ(expected.count, count_simulations);
+
+        // Results have to be bitwise equal.
+        CHECK_EQ(mc_static.execute_sync(count_simulations).sum, expected.sum);
+        CHECK_EQ(mc_guided.execute_sync(count_simulations).sum, expected.sum);
+        CHECK_EQ(pool_static.execute_sync(count_simulations).sum, expected.sum);
+        CHECK_EQ(pool_guided.execute_sync(count_simulations).sum, expected.sum);
+    } // for (...)
+
+    // Subsequent runs continue with fresh streams.
+    mc1.seed(seed);
+    double first_run = mc1.execute_sync(100).sum;
+    double second_run = mc1.execute_sync(100).sum;
+    CHECK_NE(first_run, second_run);
+
+    mc1.seed(seed);
+    CHECK_EQ(mc1.execute_sync(100).sum, first_run);
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo seeded memory and time")
+{
+    using simulator_type = ropufu::tests::counted_seedable_simulator;
+    using aggregator_type = ropufu::tests::counted_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+    using seed_type = ropufu::aftermath::random::monte_carlo_seed;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 4, schedule_type::guided>;
+    using pool_type = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type, schedule_type::static_split>;
+    using clock_type = std::chrono::steady_clock;
+
+    constexpr std::size_t count_simulations = 1'000'000;
+    constexpr std::size_t max_count_chunks = mc_type::run_type::max_count_chunks;
+
+    // Largest number of aggregators alive at the same time during a run on \p engine, on top of those alive before the run.
+    auto peak_growth = [](auto& engine, aggregator_type& result) {
+        std::size_t baseline = aggregator_type::count_alive.load();
+        aggregator_type::max_count_alive = baseline;
+        result = engine.execute_sync(count_simulations);
+        return aggregator_type::max_count_alive.load() - baseline;
+    }; // peak_growth(...)
+
+    mc_type mc{};
+    aggregator_type expected {};
+    aggregator_type result {};
+
+    // With one simulation per block, blocks are still folded into a bounded number of aggregators.
+    mc.seed(seed_type{1729, 1});
+    CHECK_LE(peak_growth(mc, expected), max_count_chunks + 16);
+    CHECK_EQ(expected.value.count, count_simulations);
+    {
+        pool_type pool{3};
+        pool.seed(seed_type{1729, 1});
+        CHECK_LE(peak_growth(pool, result), max_count_chunks + 16);
+        CHECK_EQ(result.value.sum, expected.value.sum);
+    } // pool
+
+    // By default, the block size grows with the run, so the simulators are re-seeded a bounded number of times.
+    mc.seed(seed_type{1729});
+    simulator_type::count_seeded = 0;
+    clock_type::time_point start = clock_type::now();
+    CHECK_LE(peak_growth(mc, expected), max_count_chunks + 16);
+    double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+    CHECK_EQ(expected.value.count, count_simulations);
+    CHECK_LE(simulator_type::count_seeded.load(), seed_type::max_count_blocks);
+    CHECK_LT(seconds, 10.0);
+    {
+        pool_type pool{3};
+        pool.seed(seed_type{1729});
+        CHECK_LE(peak_growth(pool, result), max_count_chunks + 16);
+        CHECK_EQ(result.value.sum, expected.value.sum);
+    } // pool
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo progress")
+{
+    using simulator_type = ropufu::tests::uneven_simulator;
+    using aggregator_type = ropufu::tests::uneven_aggregator;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2>;
+    using pool_type = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type>;
+
+    constexpr std::size_t count_simulations = 40;
+    std::array<simulator_type, 2> simulators = {simulator_type{0, 5}, simulator_type{1, 5}};
+
+    mc_type mc{simulators};
+    pool_type pool{std::vector<simulator_type>(simulators.begin(), simulators.end())};
+    CHECK_THROWS_AS(mc.set_report_interval(0), std::logic_error);
+    mc.set_report_interval(2);
+    pool.set_report_interval(2);
+
+    auto& mc_task = mc.begin_async(count_simulations);
+    auto& pool_task = pool.begin_async(count_simulations);
+    CHECK_EQ(mc_task.count_simulations(), count_simulations);
+    CHECK_EQ(pool_task.count_simulations(), count_simulations);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::size_t mc_partial_count = mc_task.count_completed();
+    std::size_t pool_partial_count = pool_task.count_completed();
+    CHECK_LE(mc_partial_count, count_simulations);
+    CHECK_LE(pool_partial_count, count_simulations);
+    aggregator_type mc_snapshot = mc_task.snapshot();
+    CHECK_LE(mc_partial_count, mc_snapshot.counts[0] + mc_snapshot.counts[1]);
+
+    aggregator_type mc_result = mc_task.wait();
+    aggregator_type pool_result = pool_task.wait();
+    CHECK_EQ(mc_result.counts[0] + mc_result.counts[1], count_simulations);
+    CHECK_EQ(pool_result.counts[0] + pool_result.counts[1], count_simulations);
+    CHECK_EQ(mc_task.count_completed(), count_simulations);
+    CHECK_EQ(pool_task.count_completed(), count_simulations);
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo stop condition")
+{
+    using simulator_type = ropufu::tests::seedable_simulator;
+    using aggregator_type = ropufu::tests::moment_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+    using seed_type = ropufu::aftermath::random::monte_carlo_seed;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 3, schedule_type::static_split>;
+    using pool_type = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type>;
+
+    // Standard error of the mean of n uniform observations is 1 / sqrt(12 n), i.e., about 833 observations are needed.
+    constexpr double target_standard_error = 0.01;
+    constexpr std::size_t count_simulations = 1'000'000;
+    auto is_precise = [](const aggregator_type& x) {
+        return x.statistic.count() >= 100 && x.standard_error() < target_standard_error;
+    }; // is_precise(...)
+
+    mc_type mc{};
+    pool_type pool{4};
+    mc.seed(seed_type{1729, 8});
+    pool.seed(seed_type{1729, 8});
+    mc.set_report_interval(4);
+    pool.set_report_interval(4);
+
+    aggregator_type mc_result = mc.execute_sync(count_simulations, is_precise);
+    aggregator_type pool_result = pool.execute_sync(count_simulations, is_precise);
+
+    CHECK_LT(mc_result.statistic.count(), count_simulations);
+    CHECK_LT(pool_result.statistic.count(), count_simulations);
+    CHECK_LT(mc_result.standard_error(), target_standard_error);
+    CHECK_LT(pool_result.standard_error(), target_standard_error);
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo common random numbers")
+{
+    using simulator_type = ropufu::aftermath::random::common_random_numbers_simulator<
+        ropufu::tests::seedable_simulator, ropufu::tests::shifted_simulator>;
+    using aggregator_type = ropufu::tests::paired_moment_aggregator;
+    using seed_type = ropufu::aftermath::random::monte_carlo_seed;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2>;
+    using pool_type = ropufu::aftermath::random::monte_carlo_pool<simulator_type, aggregator_type>;
+
+    constexpr std::size_t count_simulations = 1'000;
+
+    mc_type mc{};
+    pool_type pool{3};
+    mc.seed(seed_type{1729, 16});
+    pool.seed(seed_type{1729, 16});
+
+    aggregator_type mc_result = mc.execute_sync(count_simulations);
+    aggregator_type pool_result = pool.execute_sync(count_simulations);
+
+    // Identical streams: the difference is the shift alone.
+    REQUIRE_EQ(mc_result.difference.count(), count_simulations);
+    CHECK(mc_result.difference.mean() == doctest::Approx(-0.25));
+    CHECK_LT(mc_result.difference.variance(), 1e-20);
+    CHECK(mc_result.first.variance() == doctest::Approx(1.0 / 12).epsilon(0.2));
+
+    // Results do not depend on the threads.
+    CHECK_EQ(pool_result.first.mean(), doctest::Approx(mc_result.first.mean()));
+    CHECK_EQ(pool_result.first.variance(), doctest::Approx(mc_result.first.variance()));
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo common random numbers unseeded")
+{
+    using simulator_type = ropufu::aftermath::random::common_random_numbers_simulator<
+        ropufu::tests::seedable_simulator, ropufu::tests::shifted_simulator>;
+    using aggregator_type = ropufu::tests::paired_outcome_aggregator;
+    using schedule_type = ropufu::aftermath::random::monte_carlo_schedule;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2, schedule_type::static_split>;
+
+    constexpr std::size_t count_simulations = 1'000;
+
+    // Without a monte carlo seed, each pair draws the seeds of its simulators from its own seed.
+    ropufu::tests::seedable_simulator first {};
+    ropufu::tests::shifted_simulator second {};
+    mc_type mc{{simulator_type(first, second, 1729), simulator_type(first, second, 271828)}};
+    aggregator_type result = mc.execute_sync(count_simulations);
+    REQUIRE_EQ(result.outcomes.size(), count_simulations);
+
+    // The threads do not repeat each other's outcomes.
+    std::vector<double> firsts {};
+    for (const std::pair<double, double>& x : result.outcomes)
+    {
+        CHECK(x.second - x.first == doctest::Approx(0.25));
+        firsts.push_back(x.first);
+    } // for (...)
+    std::sort(firsts.begin(), firsts.end());
+    CHECK(std::adjacent_find(firsts.begin(), firsts.end()) == firsts.end());
+} // TEST_CASE(...)
+
+TEST_CASE("testing monte_carlo antithetic pairs")
+{
+    using simulator_type = ropufu::aftermath::random::antithetic_simulator<ropufu::tests::antithetic_simulator>;
+    using aggregator_type = ropufu::tests::paired_moment_aggregator;
+    using seed_type = ropufu::aftermath::random::monte_carlo_seed;
+
+    using mc_type = ropufu::aftermath::random::monte_carlo<simulator_type, aggregator_type, 2>;
+
+    constexpr std::size_t count_simulations = 1'000;
+
+    simulator_type pair {};
+    CHECK_FALSE(pair.first().engine.is_antithetic());
+    CHECK(pair.second().engine.is_antithetic());
+
+    mc_type mc{};
+    mc.seed(seed_type{1729, 16});
+    aggregator_type result = mc.execute_sync(count_simulations);
+
+    // Uniform and its reflection average to one half.
+    REQUIRE_EQ(result.average.count(), count_simulations);
+    CHECK(result.average.mean() == doctest::Approx(0.5));
+    CHECK_LT(result.average.variance(), 1e-20);
+    CHECK(result.first.variance() == doctest::Approx(1.0 / 12).epsilon(0.2));
+} // TEST_CASE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_RANDOM_MONTE_CARLO_HPP_INCLUDED
@@ -0,0 +1,138 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
+
+#include "../core.hpp"
+#include "../../ropufu/random/philox_engine.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <random>  // std::mt19937_64, std::seed_seq
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+TEST_CASE("testing philox_engine known answers")
+{
+    using engine_type = ropufu::aftermath::random::philox_engine;
+    using counter_type = typename engine_type::counter_type;
+
+    // Known answers from the reference implementation of Philox-4x32-10.
+    CHECK_EQ(engine_type::bijection({0, 0, 0, 0}, {0, 0}),
+        counter_type{0x6627E8D5U, 0xE169C58DU, 0xBC57AC4CU, 0x9B00DBD8U});
+    CHECK_EQ(engine_type::bijection({0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU}, {0xFFFFFFFFU, 0xFFFFFFFFU}),
+        counter_type{0x408F276DU, 0x41C83B0EU, 0xA20BC7C6U, 0x6D5451FDU});
+    CHECK_EQ(engine_type::bijection({0x243F6A88U, 0x85A308D3U, 0x13198A2EU, 0x03707344U}, {0xA4093822U, 0x299F31D0U}),
+        counter_type{0xD16CFE09U, 0x94FDCCEBU, 0x5001E420U, 0x24126EA1U});
+
+    engine_type engine {0};
+    CHECK_EQ(engine(), 0xE169C58D6627E8D5ULL);
+    CHECK_EQ(engine(), 0x9B00DBD8BC57AC4CULL);
+} // TEST_CASE(...)
+
+TEST_CASE("testing philox_engine skip-ahead")
+{
+    using engine_type = ropufu::aftermath::random::philox_engine;
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    engine_type copy = engine;
+
+    constexpr std::size_t count = 1003;
+    std::vector<std::uint64_t> sequence {};
+    for (std::size_t i = 0; i < count; ++i) sequence.push_back(engine());
+    CHECK_EQ(engine.position(), count);
+
+    for (std::size_t skip : {0, 1, 2, 3, 500, 999})
+    {
+        CAPTURE(skip);
+        engine_type skipped = copy;
+        skipped.discard(skip);
+        CHECK_EQ(skipped.position(), skip);
+        CHECK_EQ(skipped(), sequence[skip]);
+        skipped.discard(1);
+        CHECK_EQ(skipped(), sequence[skip + 2]);
+    } // for (...)
+
+    engine_type rewound = engine;
+    rewound.set_position(7);
+    CHECK_EQ(rewound(), sequence[7]);
+
+    engine.set_position(count);
+    copy.discard(count);
+    CHECK(engine == copy);
+} // TEST_CASE(...)
+
+TEST_CASE("testing philox_engine streams")
+{
+    using engine_type = ropufu::aftermath::random::philox_engine;
+
+    engine_type engine {1729};
+    engine_type first = engine.split(1);
+    engine_type second = engine.split(2);
+    engine_type second_copy {1729, 2};
+
+    CHECK_EQ(first.stream(), 1);
+    CHECK_EQ(second.stream(), 2);
+    CHECK(second == second_copy);
+    CHECK_FALSE(first == second);
+
+    std::size_t count_equal = 0;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        std::uint64_t x = second();
+        if (first() == x) ++count_equal;
+        CHECK_EQ(second_copy(), x);
+    } // for (...)
+    CHECK_EQ(count_equal, 0);
+
+    std::seed_seq sequence {1, 7, 2, 9};
+    engine_type seeded {sequence};
+    CHECK_EQ(seeded.stream(), 0);
+    CHECK_EQ(seeded.position(), 0);
+} // TEST_CASE(...)
+
+TEST_CASE("testing philox_engine bulk generation")
+{
+    using engine_type = ropufu::aftermath::random::philox_engine;
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    engine_type copy = engine;
+
+    for (std::size_t count : {0, 1, 2, 5, 64, 1001})
+    {
+        CAPTURE(count);
+        std::vector<std::uint64_t> values(count);
+        engine.generate(values);
+        for (std::size_t i = 0; i < count; ++i) CHECK_EQ(values[i], copy());
+        CHECK(engine == copy);
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("philox_engine vs mt19937_64")
+    {
+        using engine_type = ropufu::aftermath::random::philox_engine;
+        using builtin_engine_type = std::mt19937_64;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {ropufu::qualified_name<engine_type>()};
+
+        engine_type engine {};
+        builtin_engine_type builtin_engine {};
+
+        constexpr std::size_t sample_size = 100'000'000;
+
+        double seconds_fast = ropufu::tests::engine_timing(sample_size, engine);
+        double seconds_slow = ropufu::tests::engine_timing(sample_size, builtin_engine);
+
+        BENCH_COMPARE_TIMING(engine_name, "philox", "mt19937_64", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(..)
+
+#endif // ROPUFU_AFTERMATH_TESTS_RANDOM_PHILOX_ENGINE_HPP_INCLUDED
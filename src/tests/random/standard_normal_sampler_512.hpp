@@ -15,7 +15,9 @@
 #include <limits>     // std::numeric_limits
 #include <random>     // std::mt19937, ...
 #include <set>        // std::multiset
+#include <span>       // std::span
 #include <stdexcept>  // std::logic_error
+#include <vector>     // std::vector
 
 #define ROPUFU_AFTERMATH_TESTS_RANDOM_NORMAL_SAMPLER_512_ALL_TYPES                                 \
     ropufu::tests::engine_distribution_tuple<std::ranlux24, float, float, float>,       \
@@ -37,7 +39,9 @@
     ropufu::tests::engine_distribution_tuple<std::mt19937_64, float, float, float>,     \
     ropufu::tests::engine_distribution_tuple<std::mt19937_64, float, float, double>,    \
     ropufu::tests::engine_distribution_tuple<std::mt19937_64, float, double, double>,   \
-    ropufu::tests::engine_distribution_tuple<std::mt19937_64, double, double, double>   \
+    ropufu::tests::engine_distribution_tuple<std::mt19937_64, double, double, double>,  \
+    ropufu::tests::engine_distribution_tuple<ropufu::aftermath::random::philox_engine, float, float, float>,    \
+    ropufu::tests::engine_distribution_tuple<ropufu::aftermath::random::philox_engine, double, double, double>  \
 
 
 TEST_CASE_TEMPLATE("testing (randomized) standard_normal_sampler_512 Anderson-Darling", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_NORMAL_SAMPLER_512_ALL_TYPES)
@@ -94,6 +98,54 @@ TEST_CASE_TEMPLATE("testing (randomized) standard_normal_sampler_512 Anderson-Da
     CHECK(count_bad / count_reps < doctest::Approx(chance_of_failure_0_01));
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing (randomized) standard_normal_sampler_512 batch Anderson-Darling", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_NORMAL_SAMPLER_512_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using sampler_type = ropufu::aftermath::random::standard_normal_sampler_512<engine_type, value_type, probability_type, expectation_type>;
+    using distribution_type = typename sampler_type::distribution_type;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    distribution_type distribution {};
+    sampler_type sampler { distribution };
+
+    double count_reps = 16;
+    double count_bad = 0;
+    constexpr long double significance_0_01_threshold = 3.8781250216053948842L; // P(at least 1 of 16 fails) = 14.9%.
+    constexpr double chance_of_failure_0_01 = 0.149;
+
+    for (std::size_t k = 0; k < count_reps; ++k)
+    {
+        // Initialize the sample; the size is deliberately not a multiple of the internal batch size.
+        constexpr std::size_t sample_size = 1000;
+        std::vector<value_type> values(sample_size);
+        sampler(engine, std::span<value_type>(values));
+        std::multiset<value_type> sample(values.begin(), values.end());
+
+        // Calculate Anderson-Darling statistic.
+        long double a = 0;
+        std::size_t index = 1;
+        for (const value_type& x : sample)
+        {
+            a += (2 * index - 1) * std::log(distribution.cdf(x));
+            a += (2 * (sample_size - index) + 1) * std::log(1 - distribution.cdf(x));
+            ++index;
+        } // for (...)
+        a = -static_cast<long double>(sample_size) - (a / sample_size);
+        
+        if (a >= significance_0_01_threshold) ++count_bad;
+    } // for (...) 
+
+    CHECK(count_bad / count_reps < doctest::Approx(chance_of_failure_0_01));
+} // TEST_CASE_TEMPLATE(...)
+
 TEST_SUITE("Benchmarks")
 {
     TEST_CASE_TEMPLATE("standard_normal_sampler_512 vs STL", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_NORMAL_SAMPLER_512_ALL_TYPES)
@@ -125,6 +177,38 @@ TEST_SUITE("Benchmarks")
 
         BENCH_COMPARE_TIMING(engine_name, "aftermath", "builtin", seconds_fast, seconds_slow);
     } // TEST_CASE_TEMPLATE(...)
+
+    TEST_CASE_TEMPLATE("standard_normal_sampler_512 batch vs single", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_NORMAL_SAMPLER_512_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using value_type = typename tested_t::value_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using sampler_type = ropufu::aftermath::random::standard_normal_sampler_512<engine_type, value_type, probability_type, expectation_type>;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        sampler_type sampler {};
+
+        constexpr std::size_t block_size = 1'000;
+        constexpr std::size_t count_blocks = 10'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(5);
+        std::vector<value_type> values(block_size);
+
+        ropufu::tests::seed(engine);
+        double seconds_fast = ropufu::tests::benchmark([&engine, &sampler, &values] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) sampler(engine, std::span<value_type>(values));
+        });
+        ropufu::tests::seed(engine);
+        double seconds_slow = ropufu::tests::benchmark([&engine, &sampler, &values] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) for (value_type& x : values) x = sampler(engine);
+        });
+
+        BENCH_COMPARE_TIMING(engine_name, "batch", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
 } // TEST_SUITE(..)
 
 #endif // ROPUFU_AFTERMATH_TESTS_RANDOM_STANDARD_NORMAL_SAMPLER_512_HPP_INCLUDED
@@ -7,6 +7,8 @@
 
 #include "../core.hpp"
 #include "../../ropufu/probability/uniform_int_distribution.hpp"
+#include "../../ropufu/arithmetic.hpp"
+#include "../../ropufu/random/inversion_sampler.hpp"
 #include "../../ropufu/random/uniform_int_sampler.hpp"
 
 #include <array>      // std::array
@@ -14,7 +16,9 @@
 #include <cstdint>    // std::int_fast32_t
 #include <limits>     // std::numeric_limits
 #include <random>     // std::mt19937, ...
+#include <span>       // std::span
 #include <stdexcept>  // std::logic_error
+#include <vector>     // std::vector
 
 #define ROPUFU_AFTERMATH_TESTS_RANDOM_UNIFORM_INT_SAMPLER_ALL_TYPES                                           \
     ropufu::tests::engine_distribution_tuple<std::ranlux24, int, float, float>,                    \
@@ -80,6 +84,71 @@ TEST_CASE_TEMPLATE("testing (randomized) uniform_int_sampler", tested_t, ROPUFU_
     CHECK(estimate_midpoint == doctest::Approx(midpoint).epsilon(0.05));
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing uniform_int inversion_sampler", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_UNIFORM_INT_SAMPLER_ALL_TYPES)
+{
+    using engine_type = typename tested_t::engine_type;
+    using value_type = typename tested_t::value_type;
+    using probability_type = typename tested_t::probability_type;
+    using expectation_type = typename tested_t::expectation_type;
+    using distribution_type = ropufu::aftermath::probability::uniform_int_distribution<value_type, probability_type, expectation_type>;
+    using sampler_type = ropufu::aftermath::random::inversion_sampler<engine_type, distribution_type>;
+    using uniform_type = typename sampler_type::uniform_type;
+
+    value_type a = 2;
+    value_type b = 8;
+
+    std::string engine_name {tested_t::engine_name()};
+    CAPTURE(engine_name);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    distribution_type distribution_always_a { a, a };
+    distribution_type distribution_always_b { b, b };
+    distribution_type distribution_a_b { a, b };
+
+    sampler_type sampler_always_a { distribution_always_a };
+    sampler_type sampler_always_b { distribution_always_b };
+    sampler_type sampler_a_b { distribution_a_b };
+
+    // The share of engine outputs mapped to each support element should match the p.m.f.
+    constexpr long double full_scale = static_cast<long double>(sampler_type::engine_diameter) + 1;
+    const long double tolerance = 4 * std::numeric_limits<probability_type>::epsilon() + 2 / full_scale;
+    const std::vector<uniform_type>& cutoff = sampler_a_b.cutoff();
+    REQUIRE(cutoff.size() == static_cast<std::size_t>(b - a + 1));
+    for (std::size_t i = 0; i < cutoff.size(); ++i)
+    {
+        CAPTURE(i);
+        uniform_type previous = (i == 0) ? 0 : cutoff[i - 1];
+        long double mass = (i + 1 == cutoff.size()) ?
+            (full_scale - static_cast<long double>(previous)) / full_scale :
+            static_cast<long double>(cutoff[i] - previous) / full_scale;
+        long double expected_mass = static_cast<long double>(distribution_a_b.pmf(sampler_a_b.support()[i]));
+        long double error = (mass > expected_mass) ? (mass - expected_mass) : (expected_mass - mass);
+        CHECK(error <= tolerance);
+    } // for (...)
+
+    // The extreme engine outputs are mapped to the extreme values.
+    CHECK(sampler_a_b.quantile(engine_type::min()) == a);
+    CHECK(sampler_a_b.quantile(engine_type::max()) == b);
+
+    std::size_t count_reps = 10'000;
+    double sum_always_a = 0;
+    double sum_always_b = 0;
+    double sum_a_b = 0;
+    for (std::size_t k = 0; k < count_reps; ++k)
+    {
+        sum_always_a += sampler_always_a(engine);
+        sum_always_b += sampler_always_b(engine);
+        sum_a_b += sampler_a_b(engine);
+    } // for (...) 
+    double estimate_midpoint = sum_a_b / static_cast<double>(count_reps);
+
+    REQUIRE(sum_always_a == a * count_reps);
+    REQUIRE(sum_always_b == b * count_reps);
+    CHECK(estimate_midpoint == doctest::Approx(static_cast<double>(a + b) / 2).epsilon(0.05));
+} // TEST_CASE_TEMPLATE(...)
+
 TEST_SUITE("Benchmarks")
 {
     TEST_CASE_TEMPLATE("uniform_int_sampler vs STL", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_UNIFORM_INT_SAMPLER_ALL_TYPES)
@@ -111,6 +180,38 @@ TEST_SUITE("Benchmarks")
 
         BENCH_COMPARE_TIMING(engine_name, "aftermath", "builtin", seconds_fast, seconds_slow);
     } // TEST_CASE_TEMPLATE(...)
+    TEST_CASE_TEMPLATE("uniform_int_sampler batch vs single", tested_t, ROPUFU_AFTERMATH_TESTS_RANDOM_UNIFORM_INT_SAMPLER_ALL_TYPES)
+    {
+        using engine_type = typename tested_t::engine_type;
+        using value_type = typename tested_t::value_type;
+        using probability_type = typename tested_t::probability_type;
+        using expectation_type = typename tested_t::expectation_type;
+        using sampler_type = ropufu::aftermath::random::uniform_int_sampler<engine_type, value_type, probability_type, expectation_type>;
+        using distribution_type = typename sampler_type::distribution_type;
+        
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        std::string engine_name {tested_t::engine_name()};
+        CAPTURE(engine_name);
+
+        engine_type engine {};
+        sampler_type sampler { distribution_type{100, 1729} };
+
+        constexpr std::size_t block_size = 1'000;
+        constexpr std::size_t count_blocks = 10'000 / ropufu::tests::template engine_slowdown_factor<engine_type>(5);
+        std::vector<value_type> values(block_size);
+
+        ropufu::tests::seed(engine);
+        double seconds_fast = ropufu::tests::benchmark([&engine, &sampler, &values] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) sampler(engine, std::span<value_type>(values));
+        });
+        ropufu::tests::seed(engine);
+        double seconds_slow = ropufu::tests::benchmark([&engine, &sampler, &values] () {
+            for (std::size_t k = 0; k < count_blocks; ++k) for (value_type& x : values) x = sampler(engine);
+        });
+
+        BENCH_COMPARE_TIMING(engine_name, "batch", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE_TEMPLATE(...)
 } // TEST_SUITE(..)
 
 #endif // ROPUFU_AFTERMATH_TESTS_RANDOM_UNIFORM_INT_SAMPLER_HPP_INCLUDED
@@ -136,4 +136,87 @@ TEST_CASE_TEMPLATE("testing sliding_vector displace_front", sliding_array_type,
     for (std::size_t i = 0; i < ref.size(); ++i) CHECK_EQ(a[i], ref[i]);
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing sliding_vector copy assignment", sliding_array_type, ROPUFU_AFTERMATH_TESTS_SLIDING_ARRAY_ALL_TYPES)
+{
+    using value_type = typename sliding_array_type::value_type;
+    using sliding_vector_type = ropufu::aftermath::sliding_vector<value_type>;
+
+    value_type one = 1;
+    value_type two = 2;
+
+    sliding_vector_type a = sliding_vector_type(3);
+    a.displace_front(one); // Active and passive blocks have been swapped.
+
+    sliding_vector_type snapshot = sliding_vector_type(3);
+    snapshot = a;
+    REQUIRE(snapshot == a);
+
+    a.displace_front(two);
+    REQUIRE(snapshot != a);
+
+    a = snapshot; // Restore.
+    REQUIRE(a == snapshot);
+    a.displace_front(two);
+    snapshot.displace_front(two);
+    CHECK(a == snapshot);
+
+    sliding_vector_type b {};
+    b = a; // Different sizes.
+    REQUIRE_EQ(b.size(), 3);
+    CHECK(b == a);
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing (randomized) mirrored_sliding_vector vs sliding_vector", sliding_array_type, ROPUFU_AFTERMATH_TESTS_SLIDING_ARRAY_ALL_TYPES)
+{
+    using engine_type = std::mt19937;
+    using value_type = typename sliding_array_type::value_type;
+    using sliding_vector_type = ropufu::aftermath::sliding_vector<value_type>;
+    using mirrored_type = ropufu::aftermath::mirrored_sliding_vector<value_type>;
+
+    static_assert(ropufu::aftermath::sliding_window<sliding_vector_type, value_type>);
+    static_assert(ropufu::aftermath::sliding_window<mirrored_type, value_type>);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    for (std::size_t size : {0, 1, 2, 5, 13})
+    {
+        CAPTURE(size);
+        sliding_vector_type reference(size);
+        mirrored_type window(size);
+        REQUIRE_EQ(window.size(), size);
+        REQUIRE_EQ(window.empty(), size == 0);
+
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            value_type x = static_cast<value_type>(engine());
+            switch (engine() % 4)
+            {
+                case 0: reference.displace_back(x); window.displace_back(x); break;
+                case 1:
+                    if (size == 0) break;
+                    reference.set(i % size, x);
+                    window.set(i % size, x);
+                    break;
+                default: reference.displace_front(x); window.displace_front(x); break;
+            } // switch (...)
+
+            // The window is contiguous.
+            const value_type* data = window.data();
+            for (std::size_t k = 0; k < size; ++k)
+            {
+                REQUIRE_EQ(window[k], reference[k]);
+                REQUIRE_EQ(data[k], reference[k]);
+            } // for (...)
+        } // for (...)
+
+        mirrored_type copy = window;
+        REQUIRE(copy == window);
+        REQUIRE_EQ(copy.size(), size);
+
+        window.wipe();
+        for (const value_type& x : window) REQUIRE_EQ(x, 0);
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_ROPUFU_SLIDING_ARRAY_HPP_INCLUDED
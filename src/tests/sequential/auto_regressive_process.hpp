@@ -10,12 +10,14 @@
 #include "../../ropufu/sequential/auto_regressive_process.hpp"
 
 #include <array>      // std::array
-#include <cmath>      // std::log
+#include <cmath>      // std::isfinite, std::log
 #include <cstddef>    // std::size_t
 #include <limits>     // std::numeric_limits
 #include <random>     // std::mt19937, ...
 #include <set>        // std::multiset
+#include <span>       // std::span
 #include <stdexcept>  // std::logic_error
+#include <vector>     // std::vector
 
 #ifdef ROPUFU_TMP_TEST_TYPES
 #undef ROPUFU_TMP_TEST_TYPES
@@ -95,4 +97,174 @@ TEST_CASE_TEMPLATE("testing auto_regressive_process bulk", sampler_type, ROPUFU_
     CHECK_EQ(proc.count(), 0);
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing auto_regressive_process blocks vs recursion", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using engine_type = typename sampler_type::engine_type;
+    using value_type = typename sampler_type::value_type;
+    using distributiont_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type>;
+    using container_type = typename process_type::container_type;
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+
+    for (std::size_t order : {0, 1, 3, 20})
+    {
+        CAPTURE(order);
+        container_type phi(order);
+        for (std::size_t i = 0; i < order; ++i) phi[i] = static_cast<value_type>(0.5 / (i + 1)) * ((i % 2 == 0) ? 1 : -1);
+
+        process_type process {distributiont_type{}, phi};
+        // Replicates the innovations drawn by the process.
+        engine_type innovation_engine {};
+        sampler_type innovation_sampler {distributiont_type{}};
+
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            // Most recent observations, newest first.
+            std::vector<value_type> history(order);
+            std::size_t time = 0;
+            while (time < 500)
+            {
+                // Blocks both shorter and longer than the order.
+                std::size_t block_size = 1 + static_cast<std::size_t>(engine() % (2 * order + 5));
+                container_type values(block_size);
+                container_type innovations(block_size);
+                process.next(values);
+                innovation_sampler(innovation_engine, std::span<value_type>(innovations.data(), block_size));
+
+                for (std::size_t i = 0; i < block_size; ++i)
+                {
+                    CAPTURE(time + i);
+                    // Sums are formed oldest observations first, as the process does.
+                    value_type x = innovations[i];
+                    for (std::size_t j = order; j != 0; --j) x += history[j - 1] * phi[j - 1];
+                    if (order != 0)
+                    {
+                        for (std::size_t j = order - 1; j != 0; --j) history[j] = history[j - 1];
+                        history[0] = x;
+                    } // if (...)
+                    REQUIRE_EQ(values[i], x);
+                } // for (...)
+                time += block_size;
+            } // while (...)
+            CHECK_EQ(process.count(), time);
+            process.clear();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing auto_regressive_process mirrored history", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using value_type = typename sampler_type::value_type;
+    using distributiont_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type>;
+    using container_type = typename process_type::container_type;
+    using mirrored_process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type, container_type,
+        ropufu::aftermath::mirrored_sliding_vector<value_type>>;
+
+    distributiont_type d{};
+    if constexpr (distributiont_type::parameter_dim == 1) d = distributiont_type(17);
+    if constexpr (distributiont_type::parameter_dim == 2) d = distributiont_type(17, 29);
+    container_type phi {static_cast<value_type>(0.1), static_cast<value_type>(-0.3), static_cast<value_type>(0.2)};
+
+    process_type a {d, phi};
+    mirrored_process_type b {d, phi};
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        for (std::size_t i = 0; i < 100; ++i) REQUIRE_EQ(a.next(), b.next());
+
+        container_type x(17);
+        container_type y(17);
+        a.next(x);
+        b.next(y);
+        for (std::size_t i = 0; i < x.size(); ++i) REQUIRE_EQ(x[i], y[i]);
+
+        a.clear();
+        b.clear();
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("auto_regressive_process mirrored vs sliding history")
+    {
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937_64>;
+        using value_type = typename sampler_type::value_type;
+        using distributiont_type = typename sampler_type::distribution_type;
+        using process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type>;
+        using container_type = typename process_type::container_type;
+        using mirrored_process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type, container_type,
+            ropufu::aftermath::mirrored_sliding_vector<value_type>>;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t order = 20;
+        constexpr std::size_t count_observations = 1'000'000;
+        container_type phi(order);
+        for (std::size_t i = 0; i < order; ++i) phi[i] = static_cast<value_type>(0.02);
+
+        double total_mirrored = 0;
+        double total_sliding = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&phi, &total_mirrored] () {
+                mirrored_process_type process {distributiont_type{}, phi};
+                for (std::size_t i = 0; i < count_observations; ++i) total_mirrored += process.next();
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&phi, &total_sliding] () {
+                process_type process {distributiont_type{}, phi};
+                for (std::size_t i = 0; i < count_observations; ++i) total_sliding += process.next();
+            });
+
+        CHECK_EQ(total_mirrored, total_sliding);
+        BENCH_COMPARE_TIMING("AR(20)", "mirrored", "sliding", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+
+    TEST_CASE("auto_regressive_process blocks vs single observations")
+    {
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937_64>;
+        using value_type = typename sampler_type::value_type;
+        using distributiont_type = typename sampler_type::distribution_type;
+        using process_type = ropufu::aftermath::sequential::auto_regressive_process<sampler_type>;
+        using container_type = typename process_type::container_type;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t order = 20;
+        constexpr std::size_t block_size = 1'000;
+        constexpr std::size_t count_blocks = 1'000;
+        container_type phi(order);
+        for (std::size_t i = 0; i < order; ++i) phi[i] = static_cast<value_type>(0.02);
+
+        double total_blocked = 0;
+        double total_single = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&phi, &total_blocked] () {
+                process_type process {distributiont_type{}, phi};
+                container_type values(block_size);
+                for (std::size_t i = 0; i < count_blocks; ++i)
+                {
+                    process.next(values);
+                    total_blocked += values[block_size - 1];
+                } // for (...)
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&phi, &total_single] () {
+                process_type process {distributiont_type{}, phi};
+                for (std::size_t i = 0; i < count_blocks; ++i)
+                {
+                    value_type x = 0;
+                    for (std::size_t k = 0; k < block_size; ++k) x = process.next();
+                    total_single += x;
+                } // for (...)
+            });
+
+        // Block sampling consumes the random stream differently, so only the magnitudes are comparable.
+        CHECK(std::isfinite(total_blocked));
+        CHECK(std::isfinite(total_single));
+        BENCH_COMPARE_TIMING("AR(20)", "blocks", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_AUTO_REGRESSIVE_PROCESS_HPP_INCLUDED
@@ -0,0 +1,244 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
+
+#include "../core.hpp"
+#include "../../ropufu/random/binomial_sampler.hpp"
+#include "../../ropufu/random/normal_sampler_512.hpp"
+#include "../../ropufu/random/uniform_int_sampler.hpp"
+#include "../../ropufu/sequential/batched_cusum.hpp"
+#include "../../ropufu/sequential/batched_finite_moving_average.hpp"
+#include "../../ropufu/sequential/batched_window_limited_cusum.hpp"
+#include "../../ropufu/sequential/cusum.hpp"
+#include "../../ropufu/sequential/finite_moving_average.hpp"
+#include "../../ropufu/sequential/window_limited_cusum.hpp"
+
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t
+#include <random>      // std::mt19937_64
+#include <stdexcept>   // std::logic_error
+#include <type_traits> // std::is_floating_point_v
+#include <vector>      // std::vector
+
+#ifdef ROPUFU_TMP_TEST_TYPES
+#undef ROPUFU_TMP_TEST_TYPES
+#endif
+#define ROPUFU_TMP_TEST_TYPES                                                      \
+    ropufu::aftermath::random::binomial_sampler<std::mt19937_64, std::int64_t>,    \
+    ropufu::aftermath::random::normal_sampler_512<std::mt19937_64, double>,        \
+    ropufu::aftermath::random::uniform_int_sampler<std::mt19937_64, std::int64_t>  \
+
+
+namespace ropufu::tests
+{
+    /** Feeds the same observations to \p batched and to a scalar statistic per lane, masking out lanes above \p threshold.
+     *  In addition, odd lanes are masked out after (100 k) observations, if they are still active.
+     */
+    template <typename t_sampler_type, typename t_batched_type, typename t_scalar_type>
+    void check_batched_statistic(t_batched_type& batched, std::vector<t_scalar_type>& scalars,
+        typename t_batched_type::statistic_value_type threshold, std::size_t count_observations)
+    {
+        using engine_type = typename t_sampler_type::engine_type;
+        using value_type = typename t_sampler_type::value_type;
+        using observation_batch_type = typename t_batched_type::observation_batch_type;
+        using statistic_batch_type = typename t_batched_type::statistic_batch_type;
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+        t_sampler_type sampler {};
+
+        REQUIRE_EQ(scalars.size(), t_batched_type::batch_size);
+        statistic_batch_type stopped_statistics {};
+        std::array<std::size_t, t_batched_type::batch_size> when {};
+
+        for (std::size_t time = 1; time <= count_observations; ++time)
+        {
+            observation_batch_type values {};
+            for (value_type& x : values) x = sampler(engine) - sampler(engine);
+
+            const statistic_batch_type& statistics = batched.observe(values);
+            REQUIRE_EQ(batched.count_observations(), time);
+            for (std::size_t k = 0; k < t_batched_type::batch_size; ++k)
+            {
+                CAPTURE(time);
+                CAPTURE(k);
+                value_type s = scalars[k].observe(values[k]);
+                if (when[k] != 0)
+                {
+                    // Statistics of inactive lanes are held at their values when stopped.
+                    REQUIRE_FALSE(batched.is_active(k));
+                    REQUIRE_EQ(statistics[k], stopped_statistics[k]);
+                    continue;
+                } // if (...)
+                REQUIRE(batched.is_active(k));
+                if constexpr (std::is_floating_point_v<value_type>) REQUIRE(statistics[k] == doctest::Approx(s));
+                else REQUIRE_EQ(statistics[k], s);
+                if (statistics[k] > threshold || (k % 2 == 1 && time == 100 * k))
+                {
+                    when[k] = time;
+                    stopped_statistics[k] = statistics[k];
+                } // if (...)
+            } // for (...)
+            batched.deactivate_above(threshold);
+            for (std::size_t k = 1; k < t_batched_type::batch_size; k += 2) if (time == 100 * k) batched.deactivate(k);
+        } // for (...)
+
+        CHECK_EQ(batched.when(), when);
+        std::size_t count_active = 0;
+        for (std::size_t t : when) if (t == 0) ++count_active;
+        CHECK_EQ(batched.count_active(), count_active);
+    } // check_batched_statistic(...)
+} // namespace ropufu::tests
+
+TEST_CASE_TEMPLATE("testing batched_cusum vs cusum", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using value_type = typename sampler_type::value_type;
+    using batched_type = ropufu::aftermath::sequential::batched_cusum<value_type, value_type, 8>;
+    using scalar_type = ropufu::aftermath::sequential::cusum<value_type>;
+
+    batched_type batched {};
+    std::vector<scalar_type> scalars(batched_type::batch_size);
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        ropufu::tests::check_batched_statistic<sampler_type>(batched, scalars, 30, 1'000);
+        batched.reset();
+        for (scalar_type& x : scalars) x.reset();
+        REQUIRE_EQ(batched.count_active(), batched_type::batch_size);
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing batched_finite_moving_average vs finite_moving_average", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using value_type = typename sampler_type::value_type;
+    using batched_type = ropufu::aftermath::sequential::batched_finite_moving_average<value_type, value_type, 5>;
+    using scalar_type = ropufu::aftermath::sequential::finite_moving_average<value_type>;
+
+    CHECK_THROWS_AS(batched_type(0), std::logic_error);
+
+    for (std::size_t window_size : {1, 2, 7, 50})
+    {
+        CAPTURE(window_size);
+        batched_type batched {window_size};
+        std::vector<scalar_type> scalars(batched_type::batch_size, scalar_type(window_size));
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            ropufu::tests::check_batched_statistic<sampler_type>(batched, scalars, 40, 1'000);
+            batched.reset();
+            for (scalar_type& x : scalars) x.reset();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing batched_window_limited_cusum vs window_limited_cusum", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using value_type = typename sampler_type::value_type;
+    using transform_type = ropufu::aftermath::sequential::linear_transform<value_type>;
+    using batched_type = ropufu::aftermath::sequential::batched_window_limited_cusum<value_type, value_type, 4, transform_type>;
+    using scalar_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type>;
+
+    CHECK_THROWS_AS(batched_type(0), std::logic_error);
+
+    transform_type transform {2, 1};
+    for (std::size_t window_size : {1, 2, 7, 50})
+    {
+        CAPTURE(window_size);
+        batched_type batched {window_size, transform};
+        std::vector<scalar_type> scalars(batched_type::batch_size, scalar_type(window_size, transform));
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            ropufu::tests::check_batched_statistic<sampler_type>(batched, scalars, 25, 1'000);
+            batched.reset();
+            for (scalar_type& x : scalars) x.reset();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("batched_window_limited_cusum vs window_limited_cusum")
+    {
+        using batched_type = ropufu::aftermath::sequential::batched_window_limited_cusum<double, double, 8>;
+        using scalar_type = ropufu::aftermath::sequential::window_limited_cusum<double>;
+        using engine_type = std::mt19937_64;
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<engine_type, double>;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t window_size = 20;
+        constexpr std::size_t count_observations = 200'000;
+        constexpr std::size_t batch_size = batched_type::batch_size;
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+        sampler_type sampler {};
+        std::vector<typename batched_type::observation_batch_type> values(count_observations);
+        for (auto& row : values) for (double& x : row) x = sampler(engine);
+
+        double total_batched = 0;
+        double total_scalar = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&values, &total_batched] () {
+                batched_type batched {window_size};
+                for (const auto& row : values) total_batched += batched.observe(row)[0];
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&values, &total_scalar] () {
+                std::vector<scalar_type> scalars(batch_size, scalar_type(window_size));
+                for (const auto& row : values)
+                    for (std::size_t k = 0; k < batch_size; ++k)
+                    {
+                        double s = scalars[k].observe(row[k]);
+                        if (k == 0) total_scalar += s;
+                    } // for (...)
+            });
+
+        CHECK(total_batched == doctest::Approx(total_scalar));
+        BENCH_COMPARE_TIMING("window_limited_cusum", "batched", "scalar", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+
+    TEST_CASE("batched_cusum vs cusum")
+    {
+        using batched_type = ropufu::aftermath::sequential::batched_cusum<double, double, 8>;
+        using scalar_type = ropufu::aftermath::sequential::cusum<double>;
+        using engine_type = std::mt19937_64;
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<engine_type, double>;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t count_observations = 200'000;
+        constexpr std::size_t batch_size = batched_type::batch_size;
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+        sampler_type sampler {};
+        std::vector<typename batched_type::observation_batch_type> values(count_observations);
+        for (auto& row : values) for (double& x : row) x = sampler(engine) - 0.1;
+
+        double total_batched = 0;
+        double total_scalar = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&values, &total_batched] () {
+                batched_type batched {};
+                for (const auto& row : values) total_batched += batched.observe(row)[0];
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&values, &total_scalar] () {
+                std::vector<scalar_type> scalars(batch_size);
+                for (const auto& row : values)
+                    for (std::size_t k = 0; k < batch_size; ++k)
+                    {
+                        double s = scalars[k].observe(row[k]);
+                        if (k == 0) total_scalar += s;
+                    } // for (...)
+            });
+
+        CHECK(total_batched == doctest::Approx(total_scalar));
+        BENCH_COMPARE_TIMING("cusum", "batched", "scalar", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(...)
+
+#endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_BATCHED_STATISTIC_HPP_INCLUDED
@@ -0,0 +1,197 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+
+#include "../core.hpp"
+#include "../../ropufu/probability/empirical_measure.hpp"
+#include "../../ropufu/probability/moment_statistic.hpp"
+#include "../../ropufu/random/binomial_sampler.hpp"
+#include "../../ropufu/random/normal_sampler_512.hpp"
+#include "../../ropufu/sequential/iid_process.hpp"
+#include "../../ropufu/sequential/importance_sampled_process.hpp"
+#include "../../ropufu/sequential/stopping_time.hpp"
+
+#include <cmath>   // std::abs, std::erfc, std::exp, std::log, std::sqrt
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <random>  // std::mt19937
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+#ifndef ROPUFU_NO_JSON
+TEST_CASE("testing importance_sampled_process json")
+{
+    using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::importance_sampled_process<sampler_type>;
+
+    process_type proc {distribution_type{0, 1}, distribution_type{2, 3}};
+
+    std::string xxx {};
+    std::string yyy {};
+
+    ropufu::tests::does_json_round_trip(proc, xxx, yyy);
+    CHECK_EQ(xxx, yyy);
+} // TEST_CASE(...)
+#endif
+
+TEST_CASE("testing importance_sampled_process likelihood ratio (Gaussian)")
+{
+    using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::importance_sampled_process<sampler_type>;
+    using container_type = typename process_type::container_type;
+
+    // For N(0, 1) against N(theta, 1) the log-likelihood ratio of x is theta (theta / 2 - x).
+    constexpr double theta = 1.5;
+    process_type proc {distribution_type{0, 1}, distribution_type{theta, 1}};
+    ropufu::tests::seed(proc);
+
+    double sum = 0;
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        sum += proc.next();
+        ++count;
+    } // for (...)
+
+    container_type values(17);
+    proc.next(values);
+    for (double x : values) sum += x;
+    count += values.size();
+
+    double expected = theta * (static_cast<double>(count) * theta / 2 - sum);
+    CHECK(proc.log_likelihood_ratio() == doctest::Approx(expected));
+    CHECK(proc.likelihood_ratio() == doctest::Approx(std::exp(expected)));
+
+    proc.clear();
+    CHECK_EQ(proc.count(), 0);
+    CHECK_EQ(proc.log_likelihood_ratio(), 0);
+} // TEST_CASE(...)
+
+TEST_CASE("testing importance_sampled_process likelihood ratio (binomial)")
+{
+    using sampler_type = ropufu::aftermath::random::binomial_sampler<std::mt19937, std::int64_t>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::importance_sampled_process<sampler_type>;
+
+    distribution_type nominal {10, 0.2};
+    distribution_type tilted {10, 0.6};
+    process_type proc {nominal, tilted};
+    ropufu::tests::seed(proc);
+
+    double expected = 0;
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        std::int64_t x = proc.next();
+        expected += std::log(nominal.pmf(x)) - std::log(tilted.pmf(x));
+    } // for (...)
+    CHECK(proc.log_likelihood_ratio() == doctest::Approx(expected));
+} // TEST_CASE(...)
+
+TEST_CASE("testing importance_sampled_process rare event")
+{
+    using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::importance_sampled_process<sampler_type>;
+    using statistic_type = ropufu::aftermath::probability::moment_statistic<double>;
+    using measure_type = ropufu::aftermath::probability::empirical_measure<std::size_t, double, double>;
+
+    // P(X_1 + ... + X_10 > 15) for iid standard normal observations, about 1.05e-6.
+    constexpr std::size_t horizon = 10;
+    constexpr double level = 15;
+    constexpr std::size_t sample_size = 10'000;
+    double exact = std::erfc(level / std::sqrt(2.0 * horizon)) / 2;
+
+    // Tilting to mean level / horizon puts the event at the center of the tilted distribution.
+    process_type proc {distribution_type{0, 1}, distribution_type{level / horizon, 1}};
+    ropufu::tests::seed(proc);
+
+    statistic_type statistic {};
+    measure_type measure {};
+    for (std::size_t k = 0; k < sample_size; ++k)
+    {
+        proc.clear();
+        double sum = 0;
+        for (std::size_t i = 0; i < horizon; ++i) sum += proc.next();
+        std::size_t is_rare = (sum > level) ? 1 : 0;
+        statistic.observe(static_cast<double>(is_rare), proc.likelihood_ratio());
+        measure.observe(is_rare, proc.likelihood_ratio());
+    } // for (...)
+
+    // Relative error of the estimator is roughly 2 / sqrt(sample_size).
+    double standard_error = std::sqrt(statistic.variance() / sample_size);
+    CHECK(standard_error < exact / 10);
+    CHECK(std::abs(statistic.mean() - exact) < 5 * standard_error);
+
+    // Self-normalized estimate.
+    CHECK(measure.pmf(1) == doctest::Approx(exact).epsilon(0.25));
+} // TEST_CASE(...)
+
+TEST_CASE("testing importance_sampled_process stopped likelihood ratio")
+{
+    using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937>;
+    using distribution_type = typename sampler_type::distribution_type;
+    using process_type = ropufu::aftermath::sequential::importance_sampled_process<sampler_type>;
+    using nominal_process_type = ropufu::aftermath::sequential::iid_process<sampler_type>;
+    using stopping_time_type = ropufu::aftermath::sequential::stopping_time<double, double>;
+    using statistic_type = ropufu::aftermath::probability::moment_statistic<double>;
+
+    // Probability that the log-likelihood ratio random walk for a change from N(0, 1) to N(1, 1)
+    // crosses the thresholds within the horizon. Tilting to N(1, 1) keeps the weights below exp(-threshold).
+    constexpr std::size_t horizon = 50;
+    constexpr std::size_t sample_size = 20'000;
+    std::vector<double> thresholds {2, 4};
+    std::size_t m = thresholds.size();
+
+    nominal_process_type nominal {distribution_type{0, 1}};
+    process_type proc {distribution_type{0, 1}, distribution_type{1, 1}};
+    ropufu::tests::seed(nominal);
+    ropufu::tests::seed(proc);
+
+    std::vector<statistic_type> plain(m);
+    std::vector<statistic_type> weighted(m);
+    for (std::size_t k = 0; k < sample_size; ++k)
+    {
+        double plain_walk = 0;
+        stopping_time_type plain_rule {thresholds};
+        nominal.clear();
+        for (std::size_t i = 0; i < horizon && plain_rule.is_running(); ++i)
+        {
+            plain_walk += nominal.next() - 0.5;
+            plain_rule.observe(plain_walk);
+        } // for (...)
+
+        double walk = 0;
+        stopping_time_type rule {thresholds};
+        proc.clear();
+        for (std::size_t i = 0; i < horizon && rule.is_running(); ++i)
+        {
+            walk += proc.next() - 0.5;
+            rule.if_stopped(proc.log_likelihood_ratio());
+            rule.observe(walk);
+        } // for (...)
+
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            bool is_alarm = (plain_rule.when(j) != 0);
+            plain[j].observe(is_alarm ? 1.0 : 0.0);
+            // Weigh each alarm by the likelihood ratio at the time it was raised.
+            is_alarm = (rule.when(j) != 0);
+            weighted[j].observe(is_alarm ? 1.0 : 0.0, is_alarm ? std::exp(rule.stopped_statistic()[j]) : 0.0);
+        } // for (...)
+    } // for (...)
+
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        CAPTURE(j);
+        double plain_error = std::sqrt(plain[j].variance() / sample_size);
+        double weighted_error = std::sqrt(weighted[j].variance() / sample_size);
+        CHECK(weighted_error < plain_error);
+        CHECK(std::abs(plain[j].mean() - weighted[j].mean()) < 5 * (plain_error + weighted_error));
+    } // for (...)
+} // TEST_CASE(...)
+
+#endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_IMPORTANCE_SAMPLED_PROCESS_HPP_INCLUDED
@@ -0,0 +1,164 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+
+#include "../core.hpp"
+#include "../../ropufu/probability/moment_statistic.hpp"
+#include "../../ropufu/random/bernoulli_sampler.hpp"
+#include "../../ropufu/random/monte_carlo.hpp"
+#include "../../ropufu/random/normal_sampler_512.hpp"
+#include "../../ropufu/sequential/iid_process.hpp"
+#include "../../ropufu/sequential/multilevel_splitting.hpp"
+#include "../../ropufu/sequential/window_limited_cusum.hpp"
+
+#include <cmath>     // std::abs, std::pow, std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int64_t
+#include <random>    // std::mt19937, std::seed_seq
+#include <stdexcept> // std::logic_error
+#include <vector>    // std::vector
+
+namespace ropufu::tests
+{
+    /** Random walk with steps +1 (with probability 0.3) and -1, started at 1 and absorbed at 0. */
+    struct gambler_trajectory
+    {
+        using sampler_type = ropufu::aftermath::random::bernoulli_sampler<std::mt19937>;
+        using distribution_type = typename sampler_type::distribution_type;
+        using process_type = ropufu::aftermath::sequential::iid_process<sampler_type>;
+
+        static constexpr double probability_of_success = 0.3;
+
+        process_type process {distribution_type{probability_of_success}};
+        std::int64_t position = 1;
+
+        void seed(std::seed_seq& sequence) noexcept { this->process.seed(sequence); }
+
+        bool is_terminated() const noexcept { return this->position == 0; }
+
+        double next() noexcept
+        {
+            this->position += this->process.next() ? 1 : -1;
+            return static_cast<double>(this->position);
+        } // next(...)
+
+        /** Probability of reaching \p target before 0. */
+        static double exact(std::int64_t target) noexcept
+        {
+            double r = (1 - probability_of_success) / probability_of_success;
+            return (r - 1) / (std::pow(r, static_cast<double>(target)) - 1);
+        } // exact(...)
+    }; // struct gambler_trajectory
+
+    /** Window-limited CUSUM for a change from N(0, 1) to N(1, 1), run for a fixed number of observations. */
+    struct window_limited_cusum_trajectory
+    {
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937>;
+        using process_type = ropufu::aftermath::sequential::iid_process<sampler_type>;
+        using statistic_type = ropufu::aftermath::sequential::window_limited_cusum<double>;
+
+        static constexpr std::size_t horizon = 100;
+
+        process_type process {};
+        statistic_type statistic {10};
+
+        void seed(std::seed_seq& sequence) noexcept { this->process.seed(sequence); }
+
+        bool is_terminated() const noexcept { return this->process.count() == horizon; }
+
+        double next() noexcept
+        {
+            return this->statistic.observe(this->process.next() - 0.5);
+        } // next(...)
+    }; // struct window_limited_cusum_trajectory
+} // namespace ropufu::tests
+
+TEST_CASE("testing multilevel_splitting levels")
+{
+    using trajectory_type = ropufu::tests::gambler_trajectory;
+    using splitting_type = ropufu::aftermath::sequential::multilevel_splitting<trajectory_type>;
+
+    trajectory_type start {};
+    CHECK_THROWS_AS(splitting_type(start, {}), std::logic_error);
+    CHECK_THROWS_AS(splitting_type(start, {1.5, 1.5}), std::logic_error);
+    CHECK_THROWS_AS(splitting_type(start, {2.5, 1.5}), std::logic_error);
+    CHECK_NOTHROW(splitting_type(start, {1.5, 2.5}));
+
+    splitting_type splitting {start, {1.5}};
+    CHECK_THROWS_AS(splitting.estimate(0), std::logic_error);
+} // TEST_CASE(...)
+
+TEST_CASE("testing multilevel_splitting rare event")
+{
+    using trajectory_type = ropufu::tests::gambler_trajectory;
+    using splitting_type = ropufu::aftermath::sequential::multilevel_splitting<trajectory_type, 4>;
+
+    // Probability of reaching 20 before 0 is about 6e-8.
+    constexpr std::int64_t target = 20;
+    std::vector<double> levels {};
+    for (std::int64_t k = 1; k < target; ++k) levels.push_back(static_cast<double>(k) + 0.5);
+
+    splitting_type splitting {trajectory_type{}, levels};
+    splitting.seed(ropufu::aftermath::random::monte_carlo_seed{1729});
+
+    // Relative error is roughly sqrt(count_levels (1 - p) / (p count_per_level)), about 6%.
+    double estimate = splitting.estimate(4'000);
+    double exact = trajectory_type::exact(target);
+    CHECK(estimate == doctest::Approx(exact).epsilon(0.3));
+    REQUIRE_EQ(splitting.conditional_probabilities().size(), levels.size());
+    CHECK(splitting.conditional_probabilities().front() == doctest::Approx(trajectory_type::exact(2)).epsilon(0.1));
+} // TEST_CASE(...)
+
+TEST_CASE("testing multilevel_splitting reproducibility")
+{
+    using trajectory_type = ropufu::tests::gambler_trajectory;
+    using single_threaded_type = ropufu::aftermath::sequential::multilevel_splitting<trajectory_type, 1>;
+    using multi_threaded_type = ropufu::aftermath::sequential::multilevel_splitting<trajectory_type, 3>;
+
+    std::vector<double> levels {1.5, 2.5, 3.5, 4.5, 5.5};
+    ropufu::aftermath::random::monte_carlo_seed seed {271828, 16};
+
+    single_threaded_type a {trajectory_type{}, levels};
+    multi_threaded_type b {trajectory_type{}, levels};
+    a.seed(seed);
+    b.seed(seed);
+
+    for (std::size_t count : {1, 100, 1000})
+    {
+        CAPTURE(count);
+        CHECK_EQ(a.estimate(count), b.estimate(count));
+        CHECK_EQ(a.conditional_probabilities(), b.conditional_probabilities());
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_CASE("testing multilevel_splitting window-limited cusum")
+{
+    using trajectory_type = ropufu::tests::window_limited_cusum_trajectory;
+    using splitting_type = ropufu::aftermath::sequential::multilevel_splitting<trajectory_type, 2>;
+    using statistic_type = ropufu::aftermath::probability::moment_statistic<double>;
+
+    // Probability of a false alarm within the horizon.
+    constexpr double threshold = 5;
+    constexpr std::size_t sample_size = 20'000;
+
+    statistic_type plain {};
+    for (std::size_t k = 0; k < sample_size; ++k)
+    {
+        trajectory_type x {};
+        std::seed_seq sequence {1, 7, 2, 9, static_cast<int>(k)};
+        x.seed(sequence);
+
+        bool is_alarm = false;
+        while (!is_alarm && !x.is_terminated()) is_alarm = (x.next() > threshold);
+        plain.observe(is_alarm ? 1.0 : 0.0);
+    } // for (...)
+    double plain_error = std::sqrt(plain.variance() / sample_size);
+
+    splitting_type splitting {trajectory_type{}, {1, 2, 3, 4, threshold}};
+    double estimate = splitting.estimate(sample_size / 5);
+    CHECK(std::abs(estimate - plain.mean()) < 5 * plain_error + 0.15 * plain.mean());
+} // TEST_CASE(...)
+
+#endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_MULTILEVEL_SPLITTING_HPP_INCLUDED
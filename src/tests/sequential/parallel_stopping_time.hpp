@@ -98,4 +98,98 @@ TEST_CASE_TEMPLATE("testing parallel_stopping_time stopped_statistic", value_typ
     CHECK_EQ(parallel_stopping_time.stopped_statistic(), parallel_stopping_time.when());
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing parallel_stopping_time block observe", value_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using parallel_stopping_time_type = ropufu::aftermath::sequential::parallel_stopping_time<value_type>;
+    constexpr std::size_t count_observations = 1000;
+
+    std::mt19937_64 engine {};
+    ropufu::tests::seed(engine);
+    std::uniform_int_distribution<int> vertical_step_distribution {-2, 3};
+    std::uniform_int_distribution<int> horizontal_step_distribution {-2, 4};
+
+    std::vector<value_type> vertical_thresholds {10, 30, 31, 60};
+    std::vector<value_type> horizontal_thresholds {15, 45, 90};
+    std::vector<value_type> process_a(count_observations);
+    std::vector<value_type> process_b(count_observations);
+    value_type a = 0;
+    value_type b = 0;
+    for (std::size_t i = 0; i < count_observations; ++i)
+    {
+        a += static_cast<value_type>(vertical_step_distribution(engine));
+        b += static_cast<value_type>(horizontal_step_distribution(engine));
+        process_a[i] = a;
+        process_b[i] = b;
+    } // for (...)
+
+    parallel_stopping_time_type reference_rule {vertical_thresholds, horizontal_thresholds};
+    for (std::size_t i = 0; i < count_observations; ++i) reference_rule.observe(std::make_pair(process_a[i], process_b[i]));
+
+    for (std::size_t block_size : {1, 2, 15, 16, 17, 100, 1000})
+    {
+        CAPTURE(block_size);
+        parallel_stopping_time_type block_rule {vertical_thresholds, horizontal_thresholds};
+        for (std::size_t k = 0; k < count_observations; k += block_size)
+        {
+            std::size_t next = (k + block_size < count_observations) ? (k + block_size) : count_observations;
+            std::vector<value_type> block_a(process_a.begin() + k, process_a.begin() + next);
+            std::vector<value_type> block_b(process_b.begin() + k, process_b.begin() + next);
+            block_rule.observe(block_a, block_b);
+        } // for (...)
+
+        CHECK_EQ(block_rule.is_running(), reference_rule.is_running());
+        CHECK_EQ(block_rule.count_observations(), reference_rule.count_observations());
+        CHECK_EQ(block_rule.when(), reference_rule.when());
+        CHECK_EQ(block_rule.which(), reference_rule.which());
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing parallel_stopping_time block observe mismatched sizes", value_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using parallel_stopping_time_type = ropufu::aftermath::sequential::parallel_stopping_time<value_type>;
+    constexpr std::size_t count_observations = 1000;
+    constexpr std::size_t block_size = 17;
+
+    std::mt19937_64 engine {};
+    ropufu::tests::seed(engine);
+    std::uniform_int_distribution<int> step_distribution {-2, 3};
+    std::uniform_int_distribution<int> extra_count_distribution {1, 5};
+
+    std::vector<value_type> vertical_thresholds {10, 30, 60};
+    std::vector<value_type> horizontal_thresholds {15, 45, 90};
+    std::vector<value_type> process_a(count_observations);
+    std::vector<value_type> process_b(count_observations);
+    value_type a = 0;
+    value_type b = 0;
+    for (std::size_t i = 0; i < count_observations; ++i)
+    {
+        a += static_cast<value_type>(step_distribution(engine));
+        b += static_cast<value_type>(step_distribution(engine));
+        process_a[i] = a;
+        process_b[i] = b;
+    } // for (...)
+
+    parallel_stopping_time_type reference_rule {vertical_thresholds, horizontal_thresholds};
+    parallel_stopping_time_type block_rule {vertical_thresholds, horizontal_thresholds};
+    for (std::size_t i = 0; i < count_observations; ++i) reference_rule.observe(std::make_pair(process_a[i], process_b[i]));
+
+    // Unpaired values exceed every threshold, so observing any of them would stop the rule early.
+    bool is_vertical_longer = true;
+    for (std::size_t k = 0; k < count_observations; k += block_size)
+    {
+        std::size_t next = (k + block_size < count_observations) ? (k + block_size) : count_observations;
+        std::vector<value_type> block_a(process_a.begin() + k, process_a.begin() + next);
+        std::vector<value_type> block_b(process_b.begin() + k, process_b.begin() + next);
+        std::vector<value_type>& longer = is_vertical_longer ? block_a : block_b;
+        longer.insert(longer.end(), static_cast<std::size_t>(extra_count_distribution(engine)), static_cast<value_type>(1000));
+        block_rule.observe(block_a, block_b);
+        is_vertical_longer = !is_vertical_longer;
+    } // for (...)
+
+    CHECK_EQ(block_rule.is_running(), reference_rule.is_running());
+    CHECK_EQ(block_rule.count_observations(), reference_rule.count_observations());
+    CHECK_EQ(block_rule.when(), reference_rule.when());
+    CHECK_EQ(block_rule.which(), reference_rule.which());
+} // TEST_CASE_TEMPLATE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_PARALLEL_STOPPING_TIME_HPP_INCLUDED
@@ -0,0 +1,136 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_PIPELINE_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_PIPELINE_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
+
+#include "../core.hpp"
+#include "../../ropufu/random/normal_sampler_512.hpp"
+#include "../../ropufu/sequential/concepts.hpp"
+#include "../../ropufu/sequential/cusum.hpp"
+#include "../../ropufu/sequential/discrete_process.hpp"
+#include "../../ropufu/sequential/iid_process.hpp"
+#include "../../ropufu/sequential/pipeline.hpp"
+#include "../../ropufu/sequential/statistic.hpp"
+#include "../../ropufu/sequential/stopping_time.hpp"
+
+#include <cstddef>     // std::size_t
+#include <random>      // std::mt19937_64
+#include <string>      // std::string
+#include <type_traits> // std::is_convertible_v
+#include <vector>      // std::vector
+
+namespace ropufu::tests
+{
+    using pipeline_sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937_64>;
+    using pipeline_process_type = ropufu::aftermath::sequential::iid_process<pipeline_sampler_type>;
+    using pipeline_statistic_type = ropufu::aftermath::sequential::cusum<double>;
+    using pipeline_stopping_type = ropufu::aftermath::sequential::stopping_time<double>;
+    using pipeline_type = ropufu::aftermath::sequential::pipeline<pipeline_process_type, pipeline_statistic_type, pipeline_stopping_type>;
+    using pipeline_process_base_type = ropufu::aftermath::sequential::discrete_process<double, typename pipeline_process_type::container_type>;
+
+    static_assert(ropufu::aftermath::sequential::process<pipeline_process_type>);
+    static_assert(ropufu::aftermath::sequential::detection_statistic<pipeline_statistic_type>);
+    static_assert(ropufu::aftermath::sequential::stopping_rule<pipeline_stopping_type>);
+    static_assert(std::is_convertible_v<pipeline_process_type&, pipeline_process_base_type&>);
+
+    /** Runs the chain through base class references, with every call dispatched at runtime. */
+    inline std::size_t run_pipeline_virtual(pipeline_process_base_type& proc,
+        ropufu::aftermath::sequential::statistic<double, double>& stat,
+        ropufu::aftermath::sequential::stopping_time<double>& rule,
+        std::size_t max_count) noexcept
+    {
+        std::size_t count = 0;
+        while (count < max_count && rule.is_running())
+        {
+            static_cast<ropufu::aftermath::sequential::statistic<double, void>&>(rule).observe(stat.observe(proc.next()));
+            ++count;
+        } // while (...)
+        return count;
+    } // run_pipeline_virtual(...)
+} // namespace ropufu::tests
+
+TEST_CASE("testing pipeline vs virtual chain")
+{
+    using distribution_type = typename ropufu::tests::pipeline_sampler_type::distribution_type;
+    constexpr std::size_t max_count = 100'000;
+    constexpr std::size_t count_runs = 20;
+
+    std::vector<double> thresholds {2, 4, 6};
+    distribution_type dist {0.5, 1};
+
+    ropufu::tests::pipeline_process_type proc_a {dist};
+    ropufu::tests::seed(proc_a);
+    ropufu::tests::pipeline_process_type proc_b = proc_a;
+
+    ropufu::tests::pipeline_statistic_type stat_b {};
+    ropufu::tests::pipeline_stopping_type rule_b {thresholds};
+    ropufu::tests::pipeline_type chain {proc_a, ropufu::tests::pipeline_statistic_type{}, ropufu::tests::pipeline_stopping_type{thresholds}};
+
+    for (std::size_t k = 0; k < count_runs; ++k)
+    {
+        chain.reset();
+        proc_b.clear();
+        stat_b.reset();
+        rule_b.reset();
+
+        std::size_t count_a = chain.run(max_count);
+        std::size_t count_b = ropufu::tests::run_pipeline_virtual(proc_b, stat_b, rule_b, max_count);
+
+        REQUIRE(chain.is_stopped());
+        REQUIRE(rule_b.is_stopped());
+        REQUIRE_EQ(count_a, count_b);
+        REQUIRE_EQ(chain.stopping_rule().when(), rule_b.when());
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("pipeline vs virtual chain")
+    {
+        using distribution_type = typename ropufu::tests::pipeline_sampler_type::distribution_type;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t max_count = 1'000'000;
+        constexpr std::size_t count_runs = 20;
+
+        std::vector<double> thresholds {1'000'000};
+        distribution_type dist {0, 1};
+
+        ropufu::tests::pipeline_process_type proc_a {dist};
+        ropufu::tests::seed(proc_a);
+        ropufu::tests::pipeline_process_type proc_b = proc_a;
+
+        ropufu::tests::pipeline_statistic_type stat_b {};
+        ropufu::tests::pipeline_stopping_type rule_b {thresholds};
+        ropufu::tests::pipeline_type chain {proc_a, ropufu::tests::pipeline_statistic_type{}, ropufu::tests::pipeline_stopping_type{thresholds}};
+
+        std::size_t total_a = 0;
+        std::size_t total_b = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&chain, &total_a] () {
+                for (std::size_t k = 0; k < count_runs; ++k)
+                {
+                    chain.reset();
+                    total_a += chain.run(max_count);
+                } // for (...)
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&proc_b, &stat_b, &rule_b, &total_b] () {
+                for (std::size_t k = 0; k < count_runs; ++k)
+                {
+                    proc_b.clear();
+                    stat_b.reset();
+                    rule_b.reset();
+                    total_b += ropufu::tests::run_pipeline_virtual(proc_b, stat_b, rule_b, max_count);
+                } // for (...)
+            });
+
+        CHECK_EQ(total_a, total_b);
+        BENCH_COMPARE_TIMING("cusum", "pipeline", "virtual", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(...)
+
+#endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_PIPELINE_HPP_INCLUDED
@@ -0,0 +1,167 @@
+
+#ifndef ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
+#define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
+
+#include "../core.hpp"
+#include "../../ropufu/random/bernoulli_sampler.hpp"
+#include "../../ropufu/random/monte_carlo.hpp"
+#include "../../ropufu/random/normal_sampler_512.hpp"
+#include "../../ropufu/sequential/cusum.hpp"
+#include "../../ropufu/sequential/iid_process.hpp"
+#include "../../ropufu/sequential/run_length.hpp"
+
+#include <cmath>     // std::abs, std::sqrt
+#include <cstddef>   // std::size_t
+#include <random>    // std::mt19937, std::mt19937_64
+#include <stdexcept> // std::logic_error
+#include <vector>    // std::vector
+
+namespace ropufu::tests
+{
+    using run_length_bernoulli_sampler_type = ropufu::aftermath::random::bernoulli_sampler<std::mt19937>;
+    using run_length_bernoulli_process_type = ropufu::aftermath::sequential::iid_process<run_length_bernoulli_sampler_type>;
+    using run_length_normal_sampler_type = ropufu::aftermath::random::normal_sampler_512<std::mt19937_64>;
+    using run_length_normal_process_type = ropufu::aftermath::sequential::iid_process<run_length_normal_sampler_type>;
+    using run_length_statistic_type = ropufu::aftermath::sequential::cusum<double>;
+
+    /** Observations are Bernoulli with probability 1/4; CUSUM of non-negative observations counts the successes. */
+    inline run_length_bernoulli_process_type make_bernoulli_process() noexcept
+    {
+        using distribution_type = typename run_length_bernoulli_sampler_type::distribution_type;
+        return run_length_bernoulli_process_type{distribution_type{0.25}};
+    } // make_bernoulli_process(...)
+
+    inline run_length_statistic_type make_cusum() noexcept
+    {
+        return run_length_statistic_type{};
+    } // make_cusum(...)
+} // namespace ropufu::tests
+
+TEST_CASE("testing run_length_engine arguments")
+{
+    using engine_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_bernoulli_process_type, ropufu::tests::run_length_statistic_type>;
+
+    CHECK_THROWS_AS(engine_type(ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, {}), std::logic_error);
+    CHECK_THROWS_AS(engine_type(ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, {1, 2}, 0), std::logic_error);
+    CHECK_NOTHROW(engine_type(ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, {1, 2}, 1));
+} // TEST_CASE(...)
+
+TEST_CASE("testing run_length_engine negative binomial")
+{
+    using engine_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_bernoulli_process_type, ropufu::tests::run_length_statistic_type, 3>;
+    constexpr std::size_t count_replications = 10'000;
+    constexpr double p = 0.25;
+
+    // The rule stops when the number of successes first exceeds the threshold, i.e., reaches (b + 1).
+    std::vector<double> thresholds {0, 4.5, 19.5};
+    std::vector<double> successes {1, 5, 20};
+
+    for (std::size_t block_size : {1, 7, 64})
+    {
+        CAPTURE(block_size);
+        engine_type engine {ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, thresholds, block_size};
+        engine.seed(ropufu::aftermath::random::monte_carlo_seed{1729, 32});
+
+        ropufu::aftermath::sequential::run_length_statistic result = engine.execute(count_replications);
+        REQUIRE_EQ(result.count(), count_replications);
+        std::vector<double> mean = result.mean();
+        std::vector<double> standard_error = result.standard_error();
+        REQUIRE_EQ(mean.size(), thresholds.size());
+        REQUIRE_EQ(standard_error.size(), thresholds.size());
+
+        for (std::size_t i = 0; i < thresholds.size(); ++i)
+        {
+            CAPTURE(i);
+            // Negative binomial: mean r / p, variance r (1 - p) / p^2.
+            double exact_mean = successes[i] / p;
+            double exact_error = std::sqrt(successes[i] * (1 - p) / count_replications) / p;
+            CHECK(standard_error[i] == doctest::Approx(exact_error).epsilon(0.1));
+            CHECK(std::abs(mean[i] - exact_mean) < 5 * exact_error);
+        } // for (...)
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_CASE("testing run_length_engine reproducibility")
+{
+    using single_threaded_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_normal_process_type, ropufu::tests::run_length_statistic_type, 1>;
+    using multi_threaded_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_normal_process_type, ropufu::tests::run_length_statistic_type, 4>;
+    using distribution_type = typename ropufu::tests::run_length_normal_sampler_type::distribution_type;
+
+    auto make_process = [] () { return ropufu::tests::run_length_normal_process_type{distribution_type{-0.5, 1}}; };
+    std::vector<double> thresholds {1, 2, 3};
+    ropufu::aftermath::random::monte_carlo_seed seed {271828, 8};
+
+    single_threaded_type a {make_process, ropufu::tests::make_cusum, thresholds};
+    multi_threaded_type b {make_process, ropufu::tests::make_cusum, thresholds};
+    a.seed(seed);
+    b.seed(seed);
+
+    for (std::size_t count : {2, 100, 1000})
+    {
+        CAPTURE(count);
+        ropufu::aftermath::sequential::run_length_statistic x = a.execute(count);
+        ropufu::aftermath::sequential::run_length_statistic y = b.execute(count);
+        CHECK_EQ(x.mean(), y.mean());
+        CHECK_EQ(x.standard_error(), y.standard_error());
+    } // for (...)
+} // TEST_CASE(...)
+
+TEST_CASE("testing run_length_engine default seeding")
+{
+    using single_threaded_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_bernoulli_process_type, ropufu::tests::run_length_statistic_type, 1>;
+    using multi_threaded_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_bernoulli_process_type, ropufu::tests::run_length_statistic_type, 4>;
+    constexpr std::size_t count_replications = 1'000'000;
+
+    // Without an explicit seed, large runs are still reproducible regardless of the number of threads.
+    std::vector<double> thresholds {0, 1};
+    single_threaded_type a {ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, thresholds, 1};
+    multi_threaded_type b {ropufu::tests::make_bernoulli_process, ropufu::tests::make_cusum, thresholds, 1};
+
+    ropufu::aftermath::sequential::run_length_statistic x = a.execute(count_replications);
+    ropufu::aftermath::sequential::run_length_statistic y = b.execute(count_replications);
+    REQUIRE_EQ(x.count(), count_replications);
+    CHECK_EQ(x.mean(), y.mean());
+    CHECK_EQ(x.standard_error(), y.standard_error());
+    CHECK(x.mean().front() == doctest::Approx(4).epsilon(0.01));
+} // TEST_CASE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("run_length_engine blocks vs single observations")
+    {
+        using engine_type = ropufu::aftermath::sequential::run_length_engine<ropufu::tests::run_length_normal_process_type, ropufu::tests::run_length_statistic_type>;
+        using distribution_type = typename ropufu::tests::run_length_normal_sampler_type::distribution_type;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t count_replications = 2'000;
+        auto make_process = [] () { return ropufu::tests::run_length_normal_process_type{distribution_type{-0.5, 1}}; };
+        std::vector<double> thresholds {2, 4, 6, 8};
+        ropufu::aftermath::random::monte_carlo_seed seed {1729, 64};
+
+        engine_type blocked {make_process, ropufu::tests::make_cusum, thresholds, 256};
+        engine_type single {make_process, ropufu::tests::make_cusum, thresholds, 1};
+        blocked.seed(seed);
+        single.seed(seed);
+
+        double total_blocked = 0;
+        double total_single = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&blocked, &total_blocked] () {
+                total_blocked += blocked.execute(count_replications).mean().back();
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&single, &total_single] () {
+                total_single += single.execute(count_replications).mean().back();
+            });
+
+        CHECK(total_blocked > 0);
+        CHECK(total_single > 0);
+        BENCH_COMPARE_TIMING("cusum", "blocks", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(...)
+
+#endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_RUN_LENGTH_HPP_INCLUDED
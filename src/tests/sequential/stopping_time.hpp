@@ -66,4 +66,42 @@ TEST_CASE_TEMPLATE("testing stopping_time stopped_statistic", value_type, ROPUFU
     CHECK_EQ(stopping_time.stopped_statistic(), stopping_time.when());
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing stopping_time block observe", value_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using stopping_time_type = ropufu::aftermath::sequential::stopping_time<value_type>;
+    constexpr std::size_t count_observations = 1000;
+
+    std::mt19937_64 engine {};
+    ropufu::tests::seed(engine);
+    std::uniform_int_distribution<int> step_distribution {-2, 3};
+
+    std::vector<value_type> thresholds {5, 20, 21, 40, 80, 1729};
+    std::vector<value_type> process(count_observations);
+    value_type x = 0;
+    for (value_type& y : process)
+    {
+        x += static_cast<value_type>(step_distribution(engine));
+        y = x;
+    } // for (...)
+
+    stopping_time_type reference_rule {thresholds};
+    for (value_type y : process) reference_rule.observe(y);
+
+    for (std::size_t block_size : {1, 2, 15, 16, 17, 100, 1000})
+    {
+        CAPTURE(block_size);
+        stopping_time_type block_rule {thresholds};
+        for (std::size_t k = 0; k < count_observations; k += block_size)
+        {
+            std::size_t next = (k + block_size < count_observations) ? (k + block_size) : count_observations;
+            std::vector<value_type> block(process.begin() + k, process.begin() + next);
+            block_rule.observe(block);
+        } // for (...)
+
+        CHECK_EQ(block_rule.is_running(), reference_rule.is_running());
+        CHECK_EQ(block_rule.count_observations(), reference_rule.count_observations());
+        CHECK_EQ(block_rule.when(), reference_rule.when());
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_STOPPING_TIME_HPP_INCLUDED
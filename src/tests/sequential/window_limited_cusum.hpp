@@ -3,6 +3,7 @@
 #define ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_WINDOW_LIMITED_CUSUM_HPP_INCLUDED
 
 #include <doctest/doctest.h>
+#include "../benchmark_reporter.hpp"
 
 #include "../core.hpp"
 #include "../../ropufu/random/binomial_sampler.hpp"
@@ -14,6 +15,7 @@
 #include <cstdint> // std::int64_t
 #include <random>  // std::mt19937_64
 #include <string>  // std::string
+#include <type_traits> // std::is_convertible_v, std::is_floating_point_v
 #include <vector>  // std::vector
 
 #ifdef ROPUFU_TMP_TEST_TYPES
@@ -68,4 +70,199 @@ TEST_CASE_TEMPLATE("testing window_limited_cusum accumulation", sampler_type, RO
     CHECK_EQ(s, 12);
 } // TEST_CASE_TEMPLATE(...)
 
+TEST_CASE_TEMPLATE("testing (randomized) window_limited_cusum incremental vs reference", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using engine_type = typename sampler_type::engine_type;
+    using value_type = typename sampler_type::value_type;
+    using transform_type = ropufu::aftermath::sequential::identity_transform<value_type>;
+    using incremental_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::incremental>;
+    using reference_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::reference>;
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    sampler_type sampler {};
+
+    for (std::size_t window_size : {1, 2, 7, 50})
+    {
+        CAPTURE(window_size);
+        incremental_type incremental {window_size};
+        reference_type reference {window_size};
+
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            for (std::size_t i = 0; i < 1'000; ++i)
+            {
+                value_type x = sampler(engine) - sampler(engine);
+                value_type s = incremental.observe(x);
+                value_type t = reference.observe(x);
+                if constexpr (std::is_floating_point_v<value_type>) REQUIRE(s == doctest::Approx(t));
+                else REQUIRE_EQ(s, t);
+            } // for (...)
+            incremental.reset();
+            reference.reset();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing (randomized) window_limited_cusum mirrored history", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using engine_type = typename sampler_type::engine_type;
+    using value_type = typename sampler_type::value_type;
+    using transform_type = ropufu::aftermath::sequential::identity_transform<value_type>;
+    using history_type = ropufu::aftermath::mirrored_sliding_vector<value_type>;
+    using incremental_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::incremental>;
+    using mirrored_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::incremental, history_type>;
+    using mirrored_reference_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::reference, history_type>;
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    sampler_type sampler {};
+
+    for (std::size_t window_size : {1, 2, 7, 50})
+    {
+        CAPTURE(window_size);
+        incremental_type incremental {window_size};
+        mirrored_type mirrored {window_size};
+        mirrored_reference_type reference {window_size};
+
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            for (std::size_t i = 0; i < 1'000; ++i)
+            {
+                value_type x = sampler(engine) - sampler(engine);
+                value_type s = incremental.observe(x);
+                REQUIRE_EQ(mirrored.observe(x), s);
+                value_type t = reference.observe(x);
+                if constexpr (std::is_floating_point_v<value_type>) REQUIRE(s == doctest::Approx(t));
+                else REQUIRE_EQ(s, t);
+            } // for (...)
+
+            std::vector<value_type> values(3 * window_size);
+            for (value_type& x : values) x = sampler(engine) - sampler(engine);
+            std::vector<value_type> s {};
+            std::vector<value_type> t {};
+            incremental.observe(values, s);
+            mirrored.observe(values, t);
+            CHECK_EQ(s, t);
+
+            incremental.reset();
+            mirrored.reset();
+            reference.reset();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_CASE_TEMPLATE("testing (randomized) window_limited_cusum blocks vs single observations", sampler_type, ROPUFU_TMP_TEST_TYPES)
+{
+    using engine_type = typename sampler_type::engine_type;
+    using value_type = typename sampler_type::value_type;
+    using transform_type = ropufu::aftermath::sequential::linear_transform<value_type>;
+    using incremental_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::incremental>;
+    using reference_type = ropufu::aftermath::sequential::window_limited_cusum<value_type, value_type, transform_type,
+        ropufu::aftermath::sequential::window_update_mode::reference>;
+    using base_type = ropufu::aftermath::sequential::window_limited_statistic<value_type, value_type, transform_type>;
+
+    static_assert(std::is_convertible_v<incremental_type&, base_type&>);
+    static_assert(incremental_type::template has_block_update<std::vector<value_type>>);
+
+    engine_type engine {};
+    ropufu::tests::seed(engine);
+    sampler_type sampler {};
+    transform_type transform {2, 1};
+
+    for (std::size_t window_size : {1, 2, 7, 50})
+    {
+        CAPTURE(window_size);
+        incremental_type single {window_size, transform};
+        incremental_type blocked {window_size, transform};
+        reference_type reference {window_size, transform};
+
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            std::size_t time = 0;
+            while (time < 1'000)
+            {
+                // Blocks both shorter and longer than the window.
+                std::size_t block_size = 1 + static_cast<std::size_t>(engine() % (3 * window_size));
+                std::vector<value_type> values(block_size);
+                for (value_type& x : values) x = sampler(engine) - sampler(engine);
+
+                std::vector<value_type> s {};
+                std::vector<value_type> t {};
+                blocked.observe(values, s);
+                reference.observe(values, t);
+                REQUIRE_EQ(s.size(), block_size);
+                REQUIRE_EQ(t.size(), block_size);
+                for (std::size_t i = 0; i < block_size; ++i)
+                {
+                    CAPTURE(time + i);
+                    // Blocks are processed with exactly the same arithmetic as single observations.
+                    REQUIRE_EQ(s[i], single.observe(values[i]));
+                    if constexpr (std::is_floating_point_v<value_type>) REQUIRE(s[i] == doctest::Approx(t[i]));
+                    else REQUIRE_EQ(s[i], t[i]);
+                } // for (...)
+                time += block_size;
+            } // while (...)
+            CHECK(blocked == single);
+            single.reset();
+            blocked.reset();
+            reference.reset();
+        } // for (...)
+    } // for (...)
+} // TEST_CASE_TEMPLATE(...)
+
+TEST_SUITE("Benchmarks")
+{
+    TEST_CASE("window_limited_cusum blocks vs single observations")
+    {
+        using engine_type = std::mt19937_64;
+        using sampler_type = ropufu::aftermath::random::normal_sampler_512<engine_type, double>;
+        using statistic_type = ropufu::aftermath::sequential::window_limited_cusum<double>;
+
+        if (!ropufu::tests::g_do_benchmarks) return;
+
+        constexpr std::size_t window_size = 200;
+        constexpr std::size_t block_size = 1'000;
+        constexpr std::size_t count_blocks = 500;
+
+        engine_type engine {};
+        ropufu::tests::seed(engine);
+        sampler_type sampler {};
+        std::vector<double> values(block_size);
+        for (double& x : values) x = sampler(engine);
+
+        double total_blocked = 0;
+        double total_single = 0;
+        double seconds_fast = ropufu::tests::benchmark(
+            [&values, &total_blocked] () {
+                statistic_type statistic {window_size};
+                std::vector<double> statistics {};
+                for (std::size_t i = 0; i < count_blocks; ++i)
+                {
+                    statistic.observe(values, statistics);
+                    total_blocked += statistics.back();
+                } // for (...)
+            });
+        double seconds_slow = ropufu::tests::benchmark(
+            [&values, &total_single] () {
+                statistic_type statistic {window_size};
+                for (std::size_t i = 0; i < count_blocks; ++i)
+                {
+                    double s = 0;
+                    for (double x : values) s = statistic.observe(x);
+                    total_single += s;
+                } // for (...)
+            });
+
+        CHECK_EQ(total_blocked, total_single);
+        BENCH_COMPARE_TIMING("window_limited_cusum", "blocks", "single", seconds_fast, seconds_slow);
+    } // TEST_CASE(...)
+} // TEST_SUITE(...)
+
 #endif // ROPUFU_AFTERMATH_TESTS_SEQUENTIAL_WINDOW_LIMITED_CUSUM_HPP_INCLUDED